@@ -940,7 +940,7 @@ static void random_set(plane_t *acf) {
 }
 
 void acas(){
-    int i;
+    int i, j;
 	plane_t own_acf;
 	plane_t intruders[NR_PLANES];
 
@@ -955,8 +955,8 @@ void acas(){
     MEASURE_START();
     for(i=0; i<ITERATIONS;i++) {
 		random_set(&own_acf);
-		for(i=0; i<NR_PLANES; i++) {
-			random_set(&intruders[i]);
+		for(j=0; j<NR_PLANES; j++) {
+			random_set(&intruders[j]);
 		}
         acas_bench(&own_acf, intruders, NR_PLANES);
     }
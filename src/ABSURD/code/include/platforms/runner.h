@@ -0,0 +1,55 @@
+/******************************************************************************
+*   Copyright 2026 The ABSURD contributors
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*******************************************************************************/
+#ifndef PLATFORM_RUNNER_H_
+#define PLATFORM_RUNNER_H_
+
+/**
+ * Platform used by the single-image benchmark runner (see code/runner). The
+ * runner owns the time base and the statistics: the benchmarks only report
+ * where the measured region starts and stops and whether the output check
+ * succeeded.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void absurd_measure_start(void);
+
+void absurd_measure_stop(void);
+
+void absurd_check_result(int ok);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** Variables declared in the global scope to support measurements **/
+#define MEASURE_GLOBAL_VARIABLES()
+
+/** The code to be executed when the time measurement starts **/
+#define MEASURE_START()  do { \
+                              absurd_measure_start(); \
+                           } while(0);
+
+/** The code to be executed when the time measurement stops **/
+#define MEASURE_STOP() do { \
+                              absurd_measure_stop(); \
+                           } while(0);
+
+#define CHECK_RESULT(x) absurd_check_result((x) ? 1 : 0);
+
+#endif
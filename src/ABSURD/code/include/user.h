@@ -45,6 +45,8 @@
     #include "platforms/nucleo_F746ZG.h"
 #elif defined(PLATFORM_LINUX)
     #include "platforms/linux.h"
+#elif defined(PLATFORM_RUNNER)
+    #include "platforms/runner.h"
 #else
    #define MEASURE_GLOBAL_VARIABLES()
    #define MEASURE_START()
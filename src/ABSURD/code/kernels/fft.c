@@ -72,7 +72,10 @@ static complex complex_exp(double x){
 }
 
 /**
- * @brief Actual fft implementation using Cooley–Tukey algorithm (radix-2 DIT case)
+ * @brief Actual fft implementation, the Fourier sum of each coefficient is split into
+ *        the even and odd terms like in the first step of the Cooley–Tukey algorithm
+ *        (radix-2 DIT case) but computed directly, i.e. in O(N^2). See
+ *        optimized/opt_fft.c for the actual radix-2 FFT.
  * 
  * @return Fourier transform for input array
  */
@@ -90,7 +93,7 @@ static void fft_routine(){
         for(n=0;n<FFT_LENGTH;n=n+2){
             complex n_term = complex_mult(array_in[n],complex_exp((-2*M_PI*n*k)/FFT_LENGTH));
 
-            complex_sum(even_sum,n_term);
+            even_sum=complex_sum(even_sum,n_term);
         }
         
         
@@ -99,7 +102,7 @@ static void fft_routine(){
         for(n=1;n<FFT_LENGTH;n=n+2){
             complex n_term = complex_mult(array_in[n],complex_exp((-2*M_PI*n*k)/FFT_LENGTH));
 
-            complex_sum(odd_sum,n_term);
+            odd_sum=complex_sum(odd_sum,n_term);
         }
 
         array_out[k] = complex_sum(even_sum,odd_sum);
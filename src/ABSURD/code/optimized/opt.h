@@ -0,0 +1,62 @@
+/******************************************************************************
+*   Copyright 2026 The ABSURD contributors
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*******************************************************************************/
+#ifndef OPT_H_
+#define OPT_H_
+
+/**
+ * Support for the optimized track of the benchmark suite. Every optimized
+ * kernel computes the same output as the reference kernel without the opt_
+ * prefix, on the same input, with a tuned algorithm. After the measured
+ * region the output is checked against the reference computation with
+ * CHECK_RESULT().
+ */
+
+#include <math.h>
+
+/**
+ * Two lane double precision vectors through the GCC vector extensions. They
+ * are only used where the target has SIMD registers for them, elsewhere the
+ * kernels fall back to their scalar loops.
+ */
+#if defined(__GNUC__) && (defined(__SSE2__) || (defined(__ARM_NEON) && defined(__aarch64__)))
+#define ABSURD_OPT_SIMD 1
+
+typedef double absurd_v2df __attribute__((vector_size(16)));
+
+/** Unaligned load and store of two consecutive doubles **/
+static inline absurd_v2df absurd_v2df_load(const double *p){
+    absurd_v2df v;
+    __builtin_memcpy(&v,p,sizeof(v));
+    return v;
+}
+
+static inline void absurd_v2df_store(double *p, absurd_v2df v){
+    __builtin_memcpy(p,&v,sizeof(v));
+}
+#else
+#define ABSURD_OPT_SIMD 0
+#endif
+
+/**
+ * @brief Compares a result with the reference value. The tolerance is
+ *        relative to scale, the magnitude of the terms summed up for the
+ *        reference value, since the tuned kernels round differently.
+ */
+static inline int absurd_opt_close(double x, double ref, double scale){
+    return fabs(x-ref) <= 1e-9*(scale > 1 ? scale : 1);
+}
+
+#endif
@@ -0,0 +1,138 @@
+/******************************************************************************
+*   Copyright 2026 The ABSURD contributors
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*******************************************************************************/
+#include "user.h"
+#include "simple_random.h"
+#include "opt.h"
+
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+MEASURE_GLOBAL_VARIABLES()
+
+
+static double array_in[ARRAY_LENGTH];
+static double array_out[ARRAY_LENGTH];
+
+
+
+/**
+ * @brief Biquad transposed direct form 2 implementation. The filter state
+ *        stays in two variables and each output depends on the previous one
+ *        through a single addition, which shortens the recurrence compared
+ *        to direct form 1.
+ * 
+ * @param a0 Digital biquad filter a0 param
+ * @param a1 Digital biquad filter a1 param
+ * @param a2 Digital biquad filter a2 param
+ * @param b0 Digital biquad filter b0 param
+ * @param b1 Digital biquad filter b1 param
+ * @param b2 Digital biquad filter b2 param
+ */
+static void opt_biquad_routine(double a0, double a1, double a2, double b0, double b1, double b2){
+    double s1=0,s2=0;
+    int i;
+
+    /*Params normalization*/
+    a1/=a0;
+    a2/=a0;
+    b0/=a0;
+    b1/=a0;
+    b2/=a0;
+
+    for(i=0;i<ARRAY_LENGTH;i++){
+        double x=array_in[i];
+        double y=b0*x+s1;
+
+        s1=b1*x-a1*y+s2;
+        s2=b2*x-a2*y;
+        array_out[i]=y;
+    }
+}
+
+/**
+ * @brief It checks all outputs against the direct form 1 of the biquad kernel
+ * 
+ */
+static int biquad_check(double a0, double a1, double a2, double b0, double b1, double b2){
+    double y1=0,y2=0;
+    int i;
+
+    a1/=a0;
+    a2/=a0;
+    b0/=a0;
+    b1/=a0;
+    b2/=a0;
+
+    for(i=0;i<ARRAY_LENGTH;i++){
+        double y=b0*array_in[i];
+
+        if(i>=1){
+            y+=b1*array_in[i-1];
+        }
+        if(i>=2){
+            y+=b2*array_in[i-2];
+        }
+        y-=a1*y1+a2*y2;
+
+        if(!absurd_opt_close(array_out[i],y,fabs(y))){
+            return 0;
+        }
+        y2=y1;
+        y1=y;
+    }
+    return 1;
+}
+
+/**
+ * @brief It applies a biquad lowpass filter to an input signal in transposed direct form 2. The execution time is measured through user defined MEASURE_START()/MEASURE_STOP() macros. 
+ */
+void opt_biquad(){
+    double alpha,w0,Q=0.5,f0=120,a0,a1,a2,b0,b1,b2;
+    int i;
+
+    /*Signal initialization*/
+    
+    for(i=0;i<ARRAY_LENGTH;i++){
+        array_in[i]=cos(2*M_PI*120*0.001*i)+random_get();
+    }
+
+    /*param initialization*/
+    Q=0.5;
+    f0=120;
+    w0=(2*M_PI*f0)/ARRAY_LENGTH;
+    alpha=sin(w0)/(2*Q);
+
+    
+    a0=1+alpha;
+    a1=-2*cos(w0);
+    a2=1-alpha;
+
+    b0=(1-cos(w0))/2;
+    b2=(1-cos(w0))/2;
+
+    b1=1-cos(w0);
+    
+    MEASURE_START();
+
+    opt_biquad_routine(a0,a1,a2,b0,b1,b2);
+
+    MEASURE_STOP();
+
+    CHECK_RESULT(biquad_check(a0,a1,a2,b0,b1,b2));
+}
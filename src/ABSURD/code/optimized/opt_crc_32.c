@@ -0,0 +1,125 @@
+/******************************************************************************
+*   Copyright 2026 The ABSURD contributors
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*******************************************************************************/
+#include "user.h"
+#include "simple_random.h"
+#include "opt.h"
+
+
+MEASURE_GLOBAL_VARIABLES()
+
+static unsigned char bytes_in[ARRAY_LENGTH];
+
+static UINT32_T crc_table[8][256];
+static UINT32_T crc32_out;
+
+
+/**
+ * @brief It computes the slicing-by-8 tables once, crc_table[k][i] is the CRC
+ *        of the byte i followed by k zero bytes
+ * 
+ */
+static void crc_32_tables(){
+    static int ready;
+    int i,k;
+
+    if(ready){
+        return;
+    }
+
+    for(i=0;i<256;i++){
+        UINT32_T crc32=i;
+        int j;
+        for(j=0;j<8;j++){
+            crc32 = (crc32 & 1) ? (crc32 >> 1) ^ 0xEDB88320 : crc32 >> 1;
+        }
+        crc_table[0][i]=crc32;
+    }
+
+    for(k=1;k<8;k++){
+        for(i=0;i<256;i++){
+            UINT32_T prev=crc_table[k-1][i];
+            crc_table[k][i]=(prev >> 8) ^ crc_table[0][prev & 0xFF];
+        }
+    }
+    ready=1;
+}
+
+/**
+ * @brief Slicing-by-8 crc32 implementation, eight input bytes per step
+ * 
+ * @return Cyclic redundancy check of the input bytes sequence.
+ */
+static UINT32_T opt_crc_32_routine(){
+    UINT32_T crc32 = 0xFFFFFFFF;
+    const unsigned char *p=bytes_in;
+    int len=ARRAY_LENGTH;
+
+    for(;len>=8;len-=8,p+=8){
+        /*Words are assembled byte by byte, compilers turn this into a plain load on little endian targets*/
+        UINT32_T one = crc32 ^ ((UINT32_T)p[0] | ((UINT32_T)p[1] << 8) | ((UINT32_T)p[2] << 16) | ((UINT32_T)p[3] << 24));
+        UINT32_T two = (UINT32_T)p[4] | ((UINT32_T)p[5] << 8) | ((UINT32_T)p[6] << 16) | ((UINT32_T)p[7] << 24);
+
+        crc32 = crc_table[7][one & 0xFF] ^ crc_table[6][(one >> 8) & 0xFF] ^
+                crc_table[5][(one >> 16) & 0xFF] ^ crc_table[4][one >> 24] ^
+                crc_table[3][two & 0xFF] ^ crc_table[2][(two >> 8) & 0xFF] ^
+                crc_table[1][(two >> 16) & 0xFF] ^ crc_table[0][two >> 24];
+    }
+
+    for(;len>0;len--,p++){
+        crc32 = (crc32 >> 8) ^ crc_table[0][(crc32 ^ *p) & 0xFF];
+    }
+    return ~crc32;
+}
+
+/**
+ * @brief Reference crc32, computed like the crc_32 kernel
+ * 
+ */
+static UINT32_T crc_32_reference(){
+    UINT32_T crc32 = 0xFFFFFFFF;
+    int i;
+
+    for(i=0;i<ARRAY_LENGTH;i++){
+        int j;
+        crc32 ^= bytes_in[i];
+        for(j=0;j<8;j++){
+            crc32 = (crc32 & 1) ? (crc32 >> 1) ^ 0xEDB88320 : crc32 >> 1;
+        }
+    }
+    return ~crc32;
+}
+
+/**
+ * @brief It computes CRC32 of a random byte array with the slicing-by-8 algorithm. The execution time is measured through user defined MEASURE_START()/MEASURE_STOP() macros. 
+ */
+void opt_crc_32(){
+    
+    int i;
+    
+    for(i=0;i<ARRAY_LENGTH;i++){
+        bytes_in[i] = 0xFF & (int)(random_get()*ARRAY_LENGTH);
+    }
+
+    crc_32_tables();
+ 
+    MEASURE_START();
+    
+    crc32_out=opt_crc_32_routine();
+    
+    MEASURE_STOP();
+
+    CHECK_RESULT(crc32_out==crc_32_reference());
+}
@@ -0,0 +1,142 @@
+/******************************************************************************
+*   Copyright 2026 The ABSURD contributors
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*******************************************************************************/
+#include "user.h"
+#include "simple_random.h"
+#include "opt.h"
+
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+MEASURE_GLOBAL_VARIABLES()
+
+
+static double array_in[ARRAY_LENGTH];
+static double array_out[ARRAY_LENGTH];
+
+/** cos(pi*m/(2*N)) for one period of m, the DCT-II uses m=(2n+1)*k **/
+static double cos_table[4*ARRAY_LENGTH];
+static double row[ARRAY_LENGTH];
+
+
+/**
+ * @brief It computes the cosine table once
+ * 
+ */
+static void dct_table(){
+    static int ready;
+    int m;
+
+    if(ready){
+        return;
+    }
+
+    for(m=0;m<4*ARRAY_LENGTH;m++){
+        cos_table[m]=cos((M_PI*m)/(2*ARRAY_LENGTH));
+    }
+    ready=1;
+}
+
+/**
+ * @brief Dot product of the input array with the basis row, with two lanes
+ *        where the target has SIMD registers for them
+ * 
+ */
+static double dct_dot(){
+    int n=0;
+    double sum;
+#if ABSURD_OPT_SIMD
+    absurd_v2df acc0={0,0},acc1={0,0};
+
+    for(;n+4<=ARRAY_LENGTH;n+=4){
+        acc0+=absurd_v2df_load(&array_in[n])*absurd_v2df_load(&row[n]);
+        acc1+=absurd_v2df_load(&array_in[n+2])*absurd_v2df_load(&row[n+2]);
+    }
+    acc0+=acc1;
+    sum=acc0[0]+acc0[1];
+#else
+    double sum1=0;
+
+    sum=0;
+    for(;n+2<=ARRAY_LENGTH;n+=2){
+        sum+=array_in[n]*row[n];
+        sum1+=array_in[n+1]*row[n+1];
+    }
+    sum+=sum1;
+#endif
+    for(;n<ARRAY_LENGTH;n++){
+        sum+=array_in[n]*row[n];
+    }
+    return sum;
+}
+
+/**
+ * @brief DCT-II implementation without calls to cos(): each basis row is
+ *        gathered from the cosine table and then multiplied with the input
+ * 
+ * @return Discrete cosine transformation of input array
+ */
+static void opt_dct_routine(){
+    int k,n;
+    for(k=0;k<ARRAY_LENGTH;k++){
+        int m=k;
+        for(n=0;n<ARRAY_LENGTH;n++){
+            row[n]=cos_table[m];
+            m+=2*k;
+            if(m>=4*ARRAY_LENGTH){
+                m-=4*ARRAY_LENGTH;
+            }
+        }
+        array_out[k]=dct_dot();
+    }
+}
+
+/**
+ * @brief Reference DCT-II coefficient k, computed like the dct kernel
+ * 
+ */
+static double dct_coefficient(int k){
+    double sum=0;
+    int n;
+    for(n=0;n<ARRAY_LENGTH;n++){
+        sum += (array_in[n] * cos((M_PI*(n+0.5)*k)/ARRAY_LENGTH));
+    }
+    return sum;
+}
+
+/**
+ * @brief It computes DCT of a random array with a precomputed cosine table. The execution time is measured through user defined MEASURE_START()/MEASURE_STOP() macros. 
+ */
+void opt_dct(){
+    int k;
+
+    /*Matrix initialization*/
+    
+    random_get_array(array_in,ARRAY_LENGTH);
+
+    dct_table();
+
+    MEASURE_START();
+    
+    opt_dct_routine();
+    
+    MEASURE_STOP();
+
+    k=random_get()*ARRAY_LENGTH;
+    CHECK_RESULT(absurd_opt_close(array_out[k],dct_coefficient(k),ARRAY_LENGTH));
+}
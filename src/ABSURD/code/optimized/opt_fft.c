@@ -0,0 +1,159 @@
+/******************************************************************************
+*   Copyright 2026 The ABSURD contributors
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*******************************************************************************/
+#include "user.h"
+#include "simple_random.h"
+#include "opt.h"
+
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+MEASURE_GLOBAL_VARIABLES()
+
+typedef struct{
+    double re,im;
+} complex;
+
+static complex array_in[FFT_LENGTH];
+static complex array_out[FFT_LENGTH];
+static complex twiddles[FFT_LENGTH/2];
+
+/**
+ * @brief It computes the twiddle factors e^(-i*2*pi*j/N), j < N/2, once
+ * 
+ */
+static void fft_twiddles(){
+    static int ready;
+    int j;
+
+    if(ready){
+        return;
+    }
+
+    for(j=0;j<FFT_LENGTH/2;j++){
+        twiddles[j].re=cos((-2*M_PI*j)/FFT_LENGTH);
+        twiddles[j].im=sin((-2*M_PI*j)/FFT_LENGTH);
+    }
+    ready=1;
+}
+
+/**
+ * @brief In-place radix-2 decimation in time FFT. The input is copied in
+ *        bit-reversed order to the output array, which is then transformed
+ *        in place stage by stage. FFT_LENGTH is a power of two in all classes.
+ * 
+ */
+static void opt_fft_routine(){
+    int i,j,len;
+
+    /*Bit-reversed copy*/
+    for(i=0,j=0;i<FFT_LENGTH;i++){
+        int bit;
+
+        array_out[j]=array_in[i];
+
+        for(bit=FFT_LENGTH>>1;j&bit;bit>>=1){
+            j^=bit;
+        }
+        j|=bit;
+    }
+
+    /*First stage, all twiddle factors are 1*/
+    for(i=0;i<FFT_LENGTH;i+=2){
+        complex a=array_out[i];
+        complex b=array_out[i+1];
+
+        array_out[i].re=a.re+b.re;
+        array_out[i].im=a.im+b.im;
+        array_out[i+1].re=a.re-b.re;
+        array_out[i+1].im=a.im-b.im;
+    }
+
+    for(len=4;len<=FFT_LENGTH;len<<=1){
+        int half=len>>1;
+        int step=FFT_LENGTH/len;
+
+        for(i=0;i<FFT_LENGTH;i+=len){
+            complex *lo=&array_out[i];
+            complex *hi=&array_out[i+half];
+
+            for(j=0;j<half;j++){
+                complex w=twiddles[j*step];
+                complex t;
+
+                t.re=(w.re*hi[j].re)-(w.im*hi[j].im);
+                t.im=(w.im*hi[j].re)+(w.re*hi[j].im);
+
+                hi[j].re=lo[j].re-t.re;
+                hi[j].im=lo[j].im-t.im;
+                lo[j].re+=t.re;
+                lo[j].im+=t.im;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Reference DFT coefficient k, computed like the fft kernel
+ * 
+ */
+static complex dft_coefficient(int k){
+    complex sum;
+    int n;
+
+    sum.re=0;
+    sum.im=0;
+    for(n=0;n<FFT_LENGTH;n++){
+        double angle=(-2*M_PI*n*k)/FFT_LENGTH;
+
+        sum.re+=(array_in[n].re*cos(angle))-(array_in[n].im*sin(angle));
+        sum.im+=(array_in[n].im*cos(angle))+(array_in[n].re*sin(angle));
+    }
+    return sum;
+}
+
+/**
+ * @brief It computes the FFT of a random array with an in-place radix-2 FFT. The execution time is measured through user defined MEASURE_START()/MEASURE_STOP() macros. 
+ */
+void opt_fft(){
+    complex ref;
+    int i,k;
+
+    /*Matrix initialization*/
+    
+    for(i=0; i<FFT_LENGTH;i++){
+        complex x;
+        x.re=random_get();
+        x.im=random_get();
+        
+        array_in[i]=x;
+    }
+
+    fft_twiddles();
+
+    MEASURE_START();
+    
+    opt_fft_routine();
+    
+    MEASURE_STOP();
+
+    k=random_get()*FFT_LENGTH;
+    ref=dft_coefficient(k);
+    CHECK_RESULT(absurd_opt_close(array_out[k].re,ref.re,FFT_LENGTH) &&
+                 absurd_opt_close(array_out[k].im,ref.im,FFT_LENGTH));
+}
@@ -0,0 +1,102 @@
+/******************************************************************************
+*   Copyright 2026 The ABSURD contributors
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*******************************************************************************/
+#include "user.h"
+#include "simple_random.h"
+#include "opt.h"
+
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+MEASURE_GLOBAL_VARIABLES()
+
+
+static double array_in[ARRAY_LENGTH];
+static double array_out[ARRAY_LENGTH];
+static double weights[5];
+
+
+/**
+ * @brief fir_avg implementation with the averaging folded into the weights
+ *        and the five taps unrolled. Where the target has SIMD registers,
+ *        two outputs are computed per step.
+ * 
+ */
+static void opt_fir_avg_routine(){
+    const double w0=weights[0]/5,w1=weights[1]/5,w2=weights[2]/5,w3=weights[3]/5,w4=weights[4]/5;
+    const double *in=array_in;
+    double *out=array_out;
+    int i=0;
+
+#if ABSURD_OPT_SIMD
+    for(;i+2<=ARRAY_LENGTH-5;i+=2){
+        absurd_v2df accum=w0*absurd_v2df_load(&in[i]);
+        accum+=w1*absurd_v2df_load(&in[i+1]);
+        accum+=w2*absurd_v2df_load(&in[i+2]);
+        accum+=w3*absurd_v2df_load(&in[i+3]);
+        accum+=w4*absurd_v2df_load(&in[i+4]);
+        absurd_v2df_store(&out[i],accum);
+    }
+#endif
+    for(;i<ARRAY_LENGTH-5;i++){
+        out[i]=w0*in[i]+w1*in[i+1]+w2*in[i+2]+w3*in[i+3]+w4*in[i+4];
+    }
+}
+
+/**
+ * @brief It checks all outputs against the fir_avg kernel computation
+ * 
+ */
+static int fir_avg_check(){
+    int i,j;
+    for(i=0;i<ARRAY_LENGTH-5;i++){
+        double accum=0;
+        for(j=0;j<5;j++){
+            accum+=weights[j]*array_in[i+j];
+        }
+        if(!absurd_opt_close(array_out[i],accum/5,5)){
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief It applies a moving average filter to an input signal with an unrolled filter loop. The execution time is measured through user defined MEASURE_START()/MEASURE_STOP() macros. 
+ */
+void opt_fir_avg(){
+    int i;
+    /*Signal initialization*/
+    
+    for(i=0;i<ARRAY_LENGTH;i++){
+        double dt=0.0001;
+        array_in[i]=sin(2*M_PI*120*dt*i)+random_get();
+    }
+
+    /*weight initialization*/
+    random_get_array(weights,5);
+
+    
+    MEASURE_START();
+    
+    opt_fir_avg_routine();
+    
+    MEASURE_STOP();
+
+    CHECK_RESULT(fir_avg_check());
+}
@@ -0,0 +1,262 @@
+/* Copyright (C) 1991-2, RSA Data Security, Inc. Created 1991. All
+rights reserved.
+
+License to copy and use this software is granted provided that it
+is identified as the "RSA Data Security, Inc. MD5 Message-Digest
+Algorithm" in all material mentioning or referencing this software
+or this function.
+
+License is also granted to make and use derivative works provided
+that such works are identified as "derived from the RSA Data
+Security, Inc. MD5 Message-Digest Algorithm" in all material
+mentioning or referencing the derived work.
+
+RSA Data Security, Inc. makes no representations concerning either
+the merchantability of this software or the suitability of this
+software for any particular purpose. It is provided "as is"
+without express or implied warranty of any kind.
+These notices must be retained in any copies of any part of this
+documentation and/or software.
+ */
+
+/* Tuned variant of kernels/md5.c, derived from the RSA Data Security, Inc.
+  MD5 Message-Digest Algorithm. The message is hashed in one pass: the
+  full blocks are transformed straight from the input and only the tail
+  is copied for the padding.
+ */
+#include "user.h"
+#include "simple_random.h"
+#include "opt.h"
+#include "string.h"
+
+/* UINT4 defines a four byte word */
+typedef unsigned int UINT4;
+
+/* Constants for the transform, see kernels/md5.c */
+#define S11 7
+#define S12 12
+#define S13 17
+#define S14 22
+#define S21 5
+#define S22 9
+#define S23 14
+#define S24 20
+#define S31 4
+#define S32 11
+#define S33 16
+#define S34 23
+#define S41 6
+#define S42 10
+#define S43 15
+#define S44 21
+
+/* F and G select bits with one operation less than in kernels/md5.c,
+  H and I are unchanged.
+ */
+#define F(x, y, z) ((z) ^ ((x) & ((y) ^ (z))))
+#define G(x, y, z) ((y) ^ ((z) & ((x) ^ (y))))
+#define H(x, y, z) ((x) ^ (y) ^ (z))
+#define I(x, y, z) ((y) ^ ((x) | (~z)))
+
+#define ROTATE_LEFT(x, n) (((x) << (n)) | ((x) >> (32-(n))))
+
+#define FF(a, b, c, d, x, s, ac) { \
+    (a) += F ((b), (c), (d)) + (x) + (UINT4)(ac); \
+    (a) = ROTATE_LEFT ((a), (s)); \
+    (a) += (b); \
+    }
+#define GG(a, b, c, d, x, s, ac) { \
+    (a) += G ((b), (c), (d)) + (x) + (UINT4)(ac); \
+    (a) = ROTATE_LEFT ((a), (s)); \
+    (a) += (b); \
+    }
+#define HH(a, b, c, d, x, s, ac) { \
+    (a) += H ((b), (c), (d)) + (x) + (UINT4)(ac); \
+    (a) = ROTATE_LEFT ((a), (s)); \
+    (a) += (b); \
+    }
+#define II(a, b, c, d, x, s, ac) { \
+    (a) += I ((b), (c), (d)) + (x) + (UINT4)(ac); \
+    (a) = ROTATE_LEFT ((a), (s)); \
+    (a) += (b); \
+    }
+
+/* Context of the reference implementation in kernels/md5.c, which is used
+  to check the digest.
+ */
+typedef struct {
+    UINT4 state[4];
+    UINT4 count[2];
+    unsigned char buffer[64];
+} MD5_CTX;
+
+void MD5Init (MD5_CTX *context);
+void MD5Update (MD5_CTX *context, unsigned char * input, unsigned int inputLen);
+void MD5Final (unsigned char digest[16], MD5_CTX *context);
+
+static unsigned char digest[16];
+static unsigned char bytes_in[ARRAY_LENGTH];
+MEASURE_GLOBAL_VARIABLES()
+
+/* Loads the little endian words of a block. On little endian targets this
+  is a plain copy.
+ */
+static void load_block (UINT4 x[16], const unsigned char *block)
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    memcpy (x, block, 64);
+#else
+    int i;
+
+    for (i = 0; i < 16; i++, block += 4){
+        x[i] = ((UINT4)block[0]) | (((UINT4)block[1]) << 8) | (((UINT4)block[2]) << 16) | (((UINT4)block[3]) << 24);
+    }
+#endif
+}
+
+/* MD5 basic transformation of nblocks consecutive blocks.
+ */
+static void opt_md5_transform (UINT4 state[4], const unsigned char *block, unsigned int nblocks)
+{
+    UINT4 a = state[0], b = state[1], c = state[2], d = state[3], x[16];
+
+    for (; nblocks > 0; nblocks--, block += 64) {
+        UINT4 aa = a, bb = b, cc = c, dd = d;
+
+        load_block (x, block);
+
+        /* Round 1 */
+        FF (a, b, c, d, x[ 0], S11, 0xd76aa478); /* 1 */
+        FF (d, a, b, c, x[ 1], S12, 0xe8c7b756); /* 2 */
+        FF (c, d, a, b, x[ 2], S13, 0x242070db); /* 3 */
+        FF (b, c, d, a, x[ 3], S14, 0xc1bdceee); /* 4 */
+        FF (a, b, c, d, x[ 4], S11, 0xf57c0faf); /* 5 */
+        FF (d, a, b, c, x[ 5], S12, 0x4787c62a); /* 6 */
+        FF (c, d, a, b, x[ 6], S13, 0xa8304613); /* 7 */
+        FF (b, c, d, a, x[ 7], S14, 0xfd469501); /* 8 */
+        FF (a, b, c, d, x[ 8], S11, 0x698098d8); /* 9 */
+        FF (d, a, b, c, x[ 9], S12, 0x8b44f7af); /* 10 */
+        FF (c, d, a, b, x[10], S13, 0xffff5bb1); /* 11 */
+        FF (b, c, d, a, x[11], S14, 0x895cd7be); /* 12 */
+        FF (a, b, c, d, x[12], S11, 0x6b901122); /* 13 */
+        FF (d, a, b, c, x[13], S12, 0xfd987193); /* 14 */
+        FF (c, d, a, b, x[14], S13, 0xa679438e); /* 15 */
+        FF (b, c, d, a, x[15], S14, 0x49b40821); /* 16 */
+
+        /* Round 2 */
+        GG (a, b, c, d, x[ 1], S21, 0xf61e2562); /* 17 */
+        GG (d, a, b, c, x[ 6], S22, 0xc040b340); /* 18 */
+        GG (c, d, a, b, x[11], S23, 0x265e5a51); /* 19 */
+        GG (b, c, d, a, x[ 0], S24, 0xe9b6c7aa); /* 20 */
+        GG (a, b, c, d, x[ 5], S21, 0xd62f105d); /* 21 */
+        GG (d, a, b, c, x[10], S22,  0x2441453); /* 22 */
+        GG (c, d, a, b, x[15], S23, 0xd8a1e681); /* 23 */
+        GG (b, c, d, a, x[ 4], S24, 0xe7d3fbc8); /* 24 */
+        GG (a, b, c, d, x[ 9], S21, 0x21e1cde6); /* 25 */
+        GG (d, a, b, c, x[14], S22, 0xc33707d6); /* 26 */
+        GG (c, d, a, b, x[ 3], S23, 0xf4d50d87); /* 27 */
+        GG (b, c, d, a, x[ 8], S24, 0x455a14ed); /* 28 */
+        GG (a, b, c, d, x[13], S21, 0xa9e3e905); /* 29 */
+        GG (d, a, b, c, x[ 2], S22, 0xfcefa3f8); /* 30 */
+        GG (c, d, a, b, x[ 7], S23, 0x676f02d9); /* 31 */
+        GG (b, c, d, a, x[12], S24, 0x8d2a4c8a); /* 32 */
+
+        /* Round 3 */
+        HH (a, b, c, d, x[ 5], S31, 0xfffa3942); /* 33 */
+        HH (d, a, b, c, x[ 8], S32, 0x8771f681); /* 34 */
+        HH (c, d, a, b, x[11], S33, 0x6d9d6122); /* 35 */
+        HH (b, c, d, a, x[14], S34, 0xfde5380c); /* 36 */
+        HH (a, b, c, d, x[ 1], S31, 0xa4beea44); /* 37 */
+        HH (d, a, b, c, x[ 4], S32, 0x4bdecfa9); /* 38 */
+        HH (c, d, a, b, x[ 7], S33, 0xf6bb4b60); /* 39 */
+        HH (b, c, d, a, x[10], S34, 0xbebfbc70); /* 40 */
+        HH (a, b, c, d, x[13], S31, 0x289b7ec6); /* 41 */
+        HH (d, a, b, c, x[ 0], S32, 0xeaa127fa); /* 42 */
+        HH (c, d, a, b, x[ 3], S33, 0xd4ef3085); /* 43 */
+        HH (b, c, d, a, x[ 6], S34,  0x4881d05); /* 44 */
+        HH (a, b, c, d, x[ 9], S31, 0xd9d4d039); /* 45 */
+        HH (d, a, b, c, x[12], S32, 0xe6db99e5); /* 46 */
+        HH (c, d, a, b, x[15], S33, 0x1fa27cf8); /* 47 */
+        HH (b, c, d, a, x[ 2], S34, 0xc4ac5665); /* 48 */
+
+        /* Round 4 */
+        II (a, b, c, d, x[ 0], S41, 0xf4292244); /* 49 */
+        II (d, a, b, c, x[ 7], S42, 0x432aff97); /* 50 */
+        II (c, d, a, b, x[14], S43, 0xab9423a7); /* 51 */
+        II (b, c, d, a, x[ 5], S44, 0xfc93a039); /* 52 */
+        II (a, b, c, d, x[12], S41, 0x655b59c3); /* 53 */
+        II (d, a, b, c, x[ 3], S42, 0x8f0ccc92); /* 54 */
+        II (c, d, a, b, x[10], S43, 0xffeff47d); /* 55 */
+        II (b, c, d, a, x[ 1], S44, 0x85845dd1); /* 56 */
+        II (a, b, c, d, x[ 8], S41, 0x6fa87e4f); /* 57 */
+        II (d, a, b, c, x[15], S42, 0xfe2ce6e0); /* 58 */
+        II (c, d, a, b, x[ 6], S43, 0xa3014314); /* 59 */
+        II (b, c, d, a, x[13], S44, 0x4e0811a1); /* 60 */
+        II (a, b, c, d, x[ 4], S41, 0xf7537e82); /* 61 */
+        II (d, a, b, c, x[11], S42, 0xbd3af235); /* 62 */
+        II (c, d, a, b, x[ 2], S43, 0x2ad7d2bb); /* 63 */
+        II (b, c, d, a, x[ 9], S44, 0xeb86d391); /* 64 */
+
+        a += aa;
+        b += bb;
+        c += cc;
+        d += dd;
+    }
+
+    state[0] = a;
+    state[1] = b;
+    state[2] = c;
+    state[3] = d;
+}
+
+/* One pass MD5 of len bytes.
+ */
+static void opt_md5_routine (unsigned char out[16], const unsigned char *input, unsigned int len)
+{
+    UINT4 state[4] = { 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476 };
+    unsigned char tail[128];
+    unsigned int full = len & ~63U;
+    unsigned int rest = len - full;
+    unsigned int tail_len = rest < 56 ? 64 : 128;
+    unsigned long long bits = (unsigned long long)len << 3;
+    int i;
+
+    opt_md5_transform (state, input, full / 64);
+
+    /* Padding: a one bit, zeros and the bit length in the last 8 bytes */
+    memcpy (tail, input + full, rest);
+    tail[rest] = 0x80;
+    memset (tail + rest + 1, 0, tail_len - rest - 9);
+    for (i = 0; i < 8; i++){
+        tail[tail_len - 8 + i] = (unsigned char)(bits >> (8 * i));
+    }
+    opt_md5_transform (state, tail, tail_len / 64);
+
+    for (i = 0; i < 16; i++){
+        out[i] = (unsigned char)(state[i / 4] >> (8 * (i % 4)));
+    }
+}
+
+/**
+ * @brief It computes the md5 of a random bytes sequence in one pass. The execution time is measured through user defined MEASURE_START()/MEASURE_STOP() macros. 
+ */
+void opt_md5(){
+    int i;
+    MD5_CTX context;
+    unsigned char reference[16];
+    
+    for(i=0;i<ARRAY_LENGTH;i++){
+        bytes_in[i] = 0xFF & (int)(random_get()*ARRAY_LENGTH);
+    }
+
+    MEASURE_START();
+    
+    opt_md5_routine (digest, bytes_in, ARRAY_LENGTH);
+    
+    MEASURE_STOP();
+
+    MD5Init (&context);
+    MD5Update (&context, bytes_in, ARRAY_LENGTH);
+    MD5Final (reference, &context);
+    CHECK_RESULT(memcmp(digest,reference,16)==0);
+}
@@ -0,0 +1,209 @@
+/******************************************************************************
+*   Copyright 2026 The ABSURD contributors
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*******************************************************************************/
+
+/*
+   Worker pool of the parallel track. The workers meet at two RTEMS barriers
+   with automatic release, one to start a job and one to wait for its end,
+   so idle helpers block and leave their processors to others. Within a
+   job, where synchronization points are frequent (e.g. once per pivot row
+   of the LU decomposition), the workers spin on a sense-reversing barrier.
+*/
+
+#include <stdatomic.h>
+#include <stdbool.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+#include "par.h"
+
+/** Stack size of the helper tasks **/
+#ifndef ABSURD_PAR_STACK_SIZE
+#define ABSURD_PAR_STACK_SIZE (16 * 1024)
+#endif
+
+#define ABSURD_PAR_CACHE_LINE 64
+
+typedef struct {
+    unsigned int sense;
+    unsigned long long busy_ticks;
+    rtems_id id;
+} __attribute__((aligned(ABSURD_PAR_CACHE_LINE))) par_worker;
+
+static struct {
+    unsigned int workers;
+    absurd_par_job job;
+    bool exit;
+    rtems_id start;
+    rtems_id done;
+    cpu_set_t affinity;
+    atomic_uint count __attribute__((aligned(ABSURD_PAR_CACHE_LINE)));
+    atomic_uint sense;
+    par_worker worker[ABSURD_PAR_MAX_WORKERS];
+} par;
+
+static void run_job(unsigned int worker){
+    rtems_counter_ticks t0;
+    rtems_counter_ticks t1;
+
+    t0 = rtems_counter_read();
+    (*par.job)(worker, par.workers);
+    t1 = rtems_counter_read();
+    par.worker[worker].busy_ticks += rtems_counter_difference(t1, t0);
+}
+
+static rtems_task helper(rtems_task_argument arg){
+    unsigned int worker = (unsigned int) arg;
+
+    while(true){
+        (void) rtems_barrier_wait(par.start, RTEMS_NO_TIMEOUT);
+
+        if(par.exit){
+            break;
+        }
+
+        run_job(worker);
+        (void) rtems_barrier_wait(par.done, RTEMS_NO_TIMEOUT);
+    }
+
+    rtems_task_exit();
+}
+
+static rtems_status_code pin(rtems_id id, unsigned int cpu){
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    CPU_SET((int) cpu, &set);
+    return rtems_task_set_affinity(id, sizeof(set), &set);
+}
+
+int absurd_par_start(unsigned int workers){
+    rtems_task_priority prio;
+    rtems_status_code sc;
+    unsigned int i;
+
+    if(workers == 0 || workers > ABSURD_PAR_MAX_WORKERS ||
+       workers > rtems_scheduler_get_processor_maximum()){
+        return -1;
+    }
+
+    par.workers = workers;
+    par.exit = false;
+    atomic_store(&par.count, 0);
+    atomic_store(&par.sense, 0);
+
+    for(i = 0; i < workers; ++i){
+        par.worker[i].sense = 0;
+        par.worker[i].busy_ticks = 0;
+        par.worker[i].id = 0;
+    }
+
+    sc = rtems_barrier_create(rtems_build_name('P', 'A', 'R', 'S'),
+                              RTEMS_BARRIER_AUTOMATIC_RELEASE, workers,
+                              &par.start);
+    if(sc != RTEMS_SUCCESSFUL){
+        return -1;
+    }
+
+    sc = rtems_barrier_create(rtems_build_name('P', 'A', 'R', 'D'),
+                              RTEMS_BARRIER_AUTOMATIC_RELEASE, workers,
+                              &par.done);
+    if(sc != RTEMS_SUCCESSFUL){
+        (void) rtems_barrier_delete(par.start);
+        return -1;
+    }
+
+    (void) rtems_task_get_affinity(RTEMS_SELF, sizeof(par.affinity), &par.affinity);
+    (void) pin(RTEMS_SELF, 0);
+    (void) rtems_task_set_priority(RTEMS_SELF, RTEMS_CURRENT_PRIORITY, &prio);
+    par.worker[0].id = rtems_task_self();
+
+    for(i = 1; i < workers; ++i){
+        rtems_id id;
+
+        sc = rtems_task_create(rtems_build_name('P', 'A', 'R', '0' + i), prio,
+                               ABSURD_PAR_STACK_SIZE, RTEMS_DEFAULT_MODES,
+                               RTEMS_FLOATING_POINT, &id);
+        if(sc == RTEMS_SUCCESSFUL){
+            /* Remember the task at once, so that the cleanup deletes it */
+            par.worker[i].id = id;
+            sc = pin(id, i);
+        }
+
+        if(sc == RTEMS_SUCCESSFUL){
+            sc = rtems_task_start(id, helper, i);
+        }
+
+        if(sc != RTEMS_SUCCESSFUL){
+            unsigned int j;
+
+            for(j = 1; j <= i; ++j){
+                if(par.worker[j].id != 0){
+                    (void) rtems_task_delete(par.worker[j].id);
+                }
+            }
+
+            (void) rtems_barrier_delete(par.start);
+            (void) rtems_barrier_delete(par.done);
+            (void) rtems_task_set_affinity(RTEMS_SELF, sizeof(par.affinity), &par.affinity);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+void absurd_par_stop(void){
+    par.exit = true;
+    (void) rtems_barrier_wait(par.start, RTEMS_NO_TIMEOUT);
+    (void) rtems_barrier_delete(par.start);
+    (void) rtems_barrier_delete(par.done);
+    (void) rtems_task_set_affinity(RTEMS_SELF, sizeof(par.affinity), &par.affinity);
+}
+
+void absurd_par_run(absurd_par_job job){
+    par.job = job;
+    (void) rtems_barrier_wait(par.start, RTEMS_NO_TIMEOUT);
+    run_job(0);
+    (void) rtems_barrier_wait(par.done, RTEMS_NO_TIMEOUT);
+}
+
+void absurd_par_barrier(unsigned int worker){
+    unsigned int sense = !par.worker[worker].sense;
+
+    par.worker[worker].sense = sense;
+
+    if(atomic_fetch_add_explicit(&par.count, 1, memory_order_acq_rel) == par.workers - 1){
+        atomic_store_explicit(&par.count, 0, memory_order_relaxed);
+        atomic_store_explicit(&par.sense, sense, memory_order_release);
+    }else{
+        while(atomic_load_explicit(&par.sense, memory_order_acquire) != sense){
+            /* Wait for the last worker */
+        }
+    }
+}
+
+unsigned long long absurd_par_busy_ticks(unsigned int worker){
+    return par.worker[worker].busy_ticks;
+}
+
+void absurd_par_reset_busy(void){
+    unsigned int i;
+
+    for(i = 0; i < par.workers; ++i){
+        par.worker[i].busy_ticks = 0;
+    }
+}
@@ -0,0 +1,73 @@
+/******************************************************************************
+*   Copyright 2026 The ABSURD contributors
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*******************************************************************************/
+#ifndef PAR_H_
+#define PAR_H_
+
+/**
+ * Support for the parallel track of the benchmark suite. A parallel kernel
+ * splits its work into jobs executed by all workers, one per processor, at
+ * the same time. Worker 0 is the calling task, the others are helper tasks
+ * pinned to the processors 1, 2, ... Inside a job the workers synchronize
+ * with absurd_par_barrier().
+ */
+
+/** Maximum number of workers, i.e. processors used by the parallel track **/
+#ifndef ABSURD_PAR_MAX_WORKERS
+#define ABSURD_PAR_MAX_WORKERS 8
+#endif
+
+typedef void (*absurd_par_job)(unsigned int worker, unsigned int workers);
+
+/**
+ * @brief Creates the helper tasks for the given number of workers.
+ *
+ * @return 0 on success, -1 if the workers could not be set up
+ */
+int absurd_par_start(unsigned int workers);
+
+/**
+ * @brief Deletes the helper tasks created by absurd_par_start().
+ */
+void absurd_par_stop(void);
+
+/**
+ * @brief Executes the job on all workers and returns when all are done.
+ */
+void absurd_par_run(absurd_par_job job);
+
+/**
+ * @brief Waits until all workers of the current job reached the barrier.
+ */
+void absurd_par_barrier(unsigned int worker);
+
+/**
+ * @brief Returns the counter ticks the worker spent in the jobs since the
+ *        last absurd_par_reset_busy().
+ */
+unsigned long long absurd_par_busy_ticks(unsigned int worker);
+
+void absurd_par_reset_busy(void);
+
+/**
+ * @brief Computes the block [*begin, *end) of [0, n) assigned to a worker.
+ */
+static inline void absurd_par_range(int n, unsigned int worker,
+                                    unsigned int workers, int *begin, int *end){
+    *begin = (int) (((long long) n * worker) / workers);
+    *end = (int) (((long long) n * (worker + 1)) / workers);
+}
+
+#endif
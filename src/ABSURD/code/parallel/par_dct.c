@@ -0,0 +1,76 @@
+/******************************************************************************
+*   Copyright 2026 The ABSURD contributors
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*******************************************************************************/
+#include "user.h"
+#include "simple_random.h"
+#include "par.h"
+
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+MEASURE_GLOBAL_VARIABLES()
+
+static double array_in[ARRAY_LENGTH];
+static double array_out[ARRAY_LENGTH];
+
+/**
+ * @brief DCT-II coefficient k of the input array
+ * 
+ */
+static double dct_coefficient(int k){
+    double sum=0;
+    int n;
+    for(n=0;n<ARRAY_LENGTH;n++){
+        sum += (array_in[n] * cos((M_PI*(n+0.5)*k)/ARRAY_LENGTH));
+    }
+    return sum;
+}
+
+/**
+ * @brief DCT-II of the coefficients assigned to the worker
+ * 
+ */
+static void par_dct_job(unsigned int worker, unsigned int workers){
+    int k,begin,end;
+
+    absurd_par_range(ARRAY_LENGTH,worker,workers,&begin,&end);
+
+    for(k=begin;k<end;k++){
+        array_out[k]=dct_coefficient(k);
+    }
+}
+
+/**
+ * @brief It computes DCT of a random array with the coefficients partitioned over all
+ *        workers. The execution time is measured through user defined
+ *        MEASURE_START()/MEASURE_STOP() macros. 
+ */
+void par_dct(){
+    int k;
+
+    random_get_array(array_in,ARRAY_LENGTH);
+
+    MEASURE_START();
+
+    absurd_par_run(par_dct_job);
+
+    MEASURE_STOP();
+
+    k=random_get()*ARRAY_LENGTH;
+    CHECK_RESULT(array_out[k]==dct_coefficient(k));
+}
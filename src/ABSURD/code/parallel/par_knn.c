@@ -0,0 +1,120 @@
+/******************************************************************************
+*   Copyright 2026 The ABSURD contributors
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*******************************************************************************/
+#include "user.h"
+#include "simple_random.h"
+#include "par.h"
+
+#include <math.h>
+
+/* knn.cpp defines iris_dataset in the same image */
+#define iris_dataset par_iris_dataset
+#include "data/iris_dataset.h"
+#undef iris_dataset
+
+#define K 5
+#define NR_CLASSES 3
+
+MEASURE_GLOBAL_VARIABLES()
+
+static double observations[ARRAY_LENGTH][4];
+static int labels[ARRAY_LENGTH];
+
+/**
+ * @brief It classifies an observation like the kNN classifier of knn.cpp: the labels
+ *        of the K+1 nearest data points are counted and the most frequent one with
+ *        the lowest index wins
+ * 
+ */
+static int classify(const double obs[4]){
+    double nearest_dist[K+1];
+    int nearest_label[K+1];
+    int count[NR_CLASSES];
+    int nr,i,label,max_rep;
+
+    nr=0;
+    for(i=0;i<IRIS_DATASET_LEN;i++){
+        const double *d=par_iris_dataset[i];
+        double dist;
+        int pos;
+
+        dist=sqrt(pow(obs[0]-d[0],2)+
+                  pow(obs[1]-d[1],2)+
+                  pow(obs[2]-d[2],2)+
+                  pow(obs[3]-d[3],2));
+
+        /*insertion into the sorted list of the nearest points*/
+        if(nr==K+1){
+            if(dist>=nearest_dist[K]) continue;
+            nr--;
+        }
+        for(pos=nr;pos>0 && nearest_dist[pos-1]>dist;pos--){
+            nearest_dist[pos]=nearest_dist[pos-1];
+            nearest_label[pos]=nearest_label[pos-1];
+        }
+        nearest_dist[pos]=dist;
+        nearest_label[pos]=(int)d[4];
+        nr++;
+    }
+
+    for(i=0;i<NR_CLASSES;i++) count[i]=0;
+    for(i=0;i<nr;i++) count[nearest_label[i]]++;
+
+    label=0;
+    max_rep=-1;
+    for(i=0;i<NR_CLASSES;i++){
+        if(count[i]>max_rep){
+            max_rep=count[i];
+            label=i;
+        }
+    }
+    return label;
+}
+
+/**
+ * @brief Classification of the observations assigned to the worker
+ * 
+ */
+static void par_knn_job(unsigned int worker, unsigned int workers){
+    int i,begin,end;
+
+    absurd_par_range(ARRAY_LENGTH,worker,workers,&begin,&end);
+
+    for(i=begin;i<end;i++){
+        labels[i]=classify(observations[i]);
+    }
+}
+
+/**
+ * @brief It classifies random observations of the iris dataset with the kNN algorithm
+ *        and the observations partitioned over all workers. The execution time is
+ *        measured through user defined MEASURE_START()/MEASURE_STOP() macros. 
+ */
+void par_knn(){
+    int i;
+
+    for(i=0;i<ARRAY_LENGTH;i++){
+        random_get_array(observations[i],4);
+    }
+
+    MEASURE_START();
+
+    absurd_par_run(par_knn_job);
+
+    MEASURE_STOP();
+
+    i=random_get()*ARRAY_LENGTH;
+    CHECK_RESULT(labels[i]==classify(observations[i]));
+}
@@ -0,0 +1,130 @@
+/******************************************************************************
+*   Copyright 2026 The ABSURD contributors
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*******************************************************************************/
+#include "user.h"
+#include "simple_random.h"
+#include "par.h"
+
+MEASURE_GLOBAL_VARIABLES()
+
+static double mat[MATRIX_SIZE][MATRIX_SIZE];
+static double l[MATRIX_SIZE][MATRIX_SIZE];
+static double u[MATRIX_SIZE][MATRIX_SIZE];
+/* Sequential decomposition, l below and u on and above the diagonal */
+static double seq[MATRIX_SIZE][MATRIX_SIZE];
+
+/**
+ * @brief LU decomposition, for each row i the workers compute a block of the
+ *        u matrix i row and then a block of the l matrix i column
+ * 
+ */
+static void par_lu_dec_job(unsigned int worker, unsigned int workers){
+    int i,j,begin,end;
+
+    for(i=0;i<MATRIX_SIZE;i++){
+        absurd_par_range(MATRIX_SIZE-i,worker,workers,&begin,&end);
+
+        /*compute u mat i row*/
+        for(j=i+begin;j<i+end;j++){
+            double sum = 0;
+            int k;
+            for (k = 0; k < i; k++){
+                sum += (l[i][k] * u[k][j]);
+            }
+            u[i][j]=mat[i][j] - sum;
+        }
+
+        /*u[i][i] is needed by all workers*/
+        absurd_par_barrier(worker);
+
+        /*compute l mat j column*/
+        for(j=i+begin;j<i+end;j++){
+            if(i==j){
+                l[j][i] = 1;
+            }
+            else
+            {
+                double sum = 0;
+                int k;
+                for (k = 0; k < i; k++){
+                    sum += l[j][k] * u[k][i];
+                }
+
+                l[j][i]= (mat[j][i] - sum) / u[i][i];
+            }
+        }
+
+        absurd_par_barrier(worker);
+    }
+}
+
+/**
+ * @brief Sequential LU decomposition of the rows and columns up to last in the
+ *        same order as the lu_dec kernel, so the results are exactly equal
+ *
+ */
+static void seq_lu_dec(int last){
+    int i,j,k;
+
+    for(i=0;i<=last;i++){
+        for(j=i;j<MATRIX_SIZE;j++){
+            double sum = 0;
+            for (k = 0; k < i; k++){
+                sum += (seq[i][k] * seq[k][j]);
+            }
+            seq[i][j]=mat[i][j] - sum;
+        }
+
+        for(j=i+1;j<MATRIX_SIZE;j++){
+            double sum = 0;
+            for (k = 0; k < i; k++){
+                sum += seq[j][k] * seq[k][i];
+            }
+            seq[j][i]= (mat[j][i] - sum) / seq[i][i];
+        }
+    }
+}
+
+/**
+ * @brief It performs LU decomposition using Doolittle algorithm on a random square matrix
+ *        with all workers. The execution time is measured through user defined
+ *        MEASURE_START()/MEASURE_STOP() macros. 
+ */
+void par_lu_dec(){
+    int i,j;
+
+    for(i=0; i<MATRIX_SIZE;i++){
+        random_get_array(mat[i],MATRIX_SIZE);
+    }
+
+    for(i=0; i<MATRIX_SIZE;i++){
+        for(j=0; j<MATRIX_SIZE;j++){
+            l[i][j]=0;
+            u[i][j]=0;
+        }
+    }
+
+    MEASURE_START();
+
+    absurd_par_run(par_lu_dec_job);
+
+    MEASURE_STOP();
+
+    /* Compare an element of u and of l with the sequential decomposition */
+    i=random_get()*MATRIX_SIZE;
+    j=i+random_get()*(MATRIX_SIZE-i);
+    seq_lu_dec(i);
+    CHECK_RESULT(u[i][j]==seq[i][j] && (i==j ? l[i][i]==1 : l[j][i]==seq[j][i]));
+}
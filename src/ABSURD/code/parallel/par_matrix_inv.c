@@ -0,0 +1,164 @@
+/******************************************************************************
+*   Copyright 2026 The ABSURD contributors
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*******************************************************************************/
+#include "user.h"
+#include "simple_random.h"
+#include "par.h"
+
+MEASURE_GLOBAL_VARIABLES()
+
+static double mat[MATRIX_SIZE][MATRIX_SIZE];
+static double l[MATRIX_SIZE][MATRIX_SIZE];
+static double u[MATRIX_SIZE][MATRIX_SIZE];
+static double tmp[ABSURD_PAR_MAX_WORKERS][MATRIX_SIZE];
+static double inv[MATRIX_SIZE][MATRIX_SIZE];
+static int inv_exists;
+
+/**
+ * @brief It performs LU decomposition of mat matrix with all workers
+ * 
+ */
+static void lu_decomposition(unsigned int worker, unsigned int workers){
+    int i,j,begin,end;
+
+    for(i=0;i<MATRIX_SIZE;i++){
+        absurd_par_range(MATRIX_SIZE-i,worker,workers,&begin,&end);
+
+        /*compute u matrix i row*/
+        for(j=i+begin;j<i+end;j++){
+            double sum = 0;
+            int k;
+            for (k = 0; k < i; k++){
+                sum += (l[i][k] * u[k][j]);
+            }
+            u[i][j]=mat[i][j] - sum;
+        }
+
+        absurd_par_barrier(worker);
+
+        /*compute l matrix j column*/
+        for(j=i+begin;j<i+end;j++){
+            if(i==j){
+                l[j][i] = 1;
+            }
+            else
+            {
+                double sum = 0;
+                int k;
+                for (k = 0; k < i; k++){
+                    sum += l[j][k] * u[k][i];
+                }
+
+                l[j][i]= (mat[j][i] - sum) / u[i][i];
+            }
+        }
+
+        absurd_par_barrier(worker);
+    }
+}
+
+/**
+ * @brief Actual mat determinant implementation 
+ * 
+ * @return double mat determinant
+ */
+static double matrix_det(){
+    int i;
+    double det;
+
+    det=1;
+    for(i=0;i<MATRIX_SIZE;i++){
+        det *= l[i][i]*u[i][i];
+    }
+    return det;
+}
+
+/**
+ * @brief Forward-backward pass of the column j of the inverse matrix
+ * 
+ */
+static void inverse_column(int j, double *t, double out[MATRIX_SIZE][MATRIX_SIZE]){
+    int i;
+
+    /*first j rows equals to 0*/
+    for(i=0;i<j;i++) t[i]=0;
+    t[j]=1;
+    for(i=j+1;i<MATRIX_SIZE;i++){
+        double sum=0;
+        int k;
+        for(k=0;k<i;k++) sum+=l[i][k]*t[k];
+        t[i]=-sum;
+    }
+
+    /*backward pass*/
+    for(i=MATRIX_SIZE-1;i>=0;i--){
+        double sum=0;
+        int k;
+        for(k=i+1;k<MATRIX_SIZE;k++) sum+=u[i][k]*out[k][j];
+        out[i][j]=(-sum+t[i])/u[i][i];
+    }
+}
+
+/**
+ * @brief Matrix inversion exploiting LU decomposition, the columns of the
+ *        inverse are partitioned over the workers
+ * 
+ */
+static void par_matrix_inv_job(unsigned int worker, unsigned int workers){
+    int j,begin,end;
+
+    lu_decomposition(worker,workers);
+
+    /*every worker sees the same decomposition after the last barrier*/
+    if(matrix_det() == 0){
+        if(worker==0) inv_exists=0;
+        return;
+    }
+
+    if(worker==0) inv_exists=1;
+    absurd_par_range(MATRIX_SIZE,worker,workers,&begin,&end);
+
+    for(j=begin;j<end;j++){
+        inverse_column(j,tmp[worker],inv);
+    }
+}
+
+/**
+ * @brief It computes, if possible, the inverse of a random square matrix with all workers.
+ *        The execution time is measured through user defined MEASURE_START()/MEASURE_STOP()
+ *        macros. 
+ */
+void par_matrix_inv(){
+    static double check[MATRIX_SIZE][MATRIX_SIZE];
+    int i,j;
+
+    for(i=0; i<MATRIX_SIZE;i++){
+        random_get_array(mat[i],MATRIX_SIZE);
+    }
+
+    MEASURE_START();
+
+    absurd_par_run(par_matrix_inv_job);
+
+    MEASURE_STOP();
+
+    if(inv_exists){
+        /* Recompute one column sequentially, it must match exactly */
+        j=random_get()*MATRIX_SIZE;
+        inverse_column(j,tmp[0],check);
+        for(i=0;i<MATRIX_SIZE && check[i][j]==inv[i][j];i++);
+        CHECK_RESULT(i==MATRIX_SIZE);
+    }
+}
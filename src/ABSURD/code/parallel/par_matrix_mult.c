@@ -0,0 +1,75 @@
+/******************************************************************************
+*   Copyright 2026 The ABSURD contributors
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*******************************************************************************/
+#include "user.h"
+#include "simple_random.h"
+#include "par.h"
+
+MEASURE_GLOBAL_VARIABLES()
+
+static double mat_1[MATRIX_SIZE][MATRIX_SIZE];
+static double mat_2[MATRIX_SIZE][MATRIX_SIZE];
+static double res[MATRIX_SIZE][MATRIX_SIZE];
+
+/**
+ * @brief Matrices multiplication of the rows assigned to the worker
+ * 
+ */
+static void par_matrix_mult_job(unsigned int worker, unsigned int workers){
+    int i,j,begin,end;
+
+    absurd_par_range(MATRIX_SIZE,worker,workers,&begin,&end);
+
+    for(i=begin;i<end;i++){
+        for(j=0;j<MATRIX_SIZE;j++){
+            double sum=0;
+            int k;
+            for(k=0;k<MATRIX_SIZE;k++){
+                sum += mat_1[i][k]*mat_2[k][j];
+            }
+            res[i][j]=sum;
+        }
+    }
+}
+
+/**
+ * @brief It performs matrices multiplication between two random matrices with the rows
+ *        partitioned over all workers. The execution time is measured through user defined
+ *        MEASURE_START()/MEASURE_STOP() macros. 
+ */
+void par_matrix_mult(){
+    int i,j,k;
+    double sum;
+
+    for(i=0; i<MATRIX_SIZE;i++){
+        random_get_array(mat_1[i],MATRIX_SIZE);
+        random_get_array(mat_2[i],MATRIX_SIZE);
+    }
+
+    MEASURE_START();
+
+    absurd_par_run(par_matrix_mult_job);
+
+    MEASURE_STOP();
+
+    /* Each element is computed in the same order as by the sequential kernel */
+    i=random_get()*MATRIX_SIZE;
+    j=random_get()*MATRIX_SIZE;
+    sum=0;
+    for(k=0;k<MATRIX_SIZE;k++){
+        sum += mat_1[i][k]*mat_2[k][j];
+    }
+    CHECK_RESULT(sum==res[i][j]);
+}
@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+#
+#   Copyright 2026 The ABSURD contributors
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+# Turns the console logs of runner images into Markdown tables, one table per
+# device class with a row per benchmark and a column per platform, e.g.
+#
+#   absurd_table.py --field median-ns erc32-a.log erc32-c.log native-a.log
+#
+# The reports of the parallel track have no group and one entry per worker
+# count, so their rows are in the "parallel" group and keyed by the benchmark
+# name and the worker count.
+
+import argparse
+import json
+import sys
+
+BEGIN = '*** BEGIN OF JSON DATA ***'
+END = '*** END OF JSON DATA ***'
+
+
+def reports(path):
+    with open(path) as f:
+        text = f.read()
+    while True:
+        begin = text.find(BEGIN)
+        if begin < 0:
+            return
+        end = text.find(END, begin)
+        if end < 0:
+            sys.exit('%s: unterminated JSON data' % (path))
+        yield json.loads(text[begin + len(BEGIN):end])
+        text = text[end + len(END):]
+
+
+def main():
+    parser = argparse.ArgumentParser(description='ABSURD runner tables')
+    parser.add_argument('--field', default='median-ns',
+                        help='benchmark field to tabulate (default median-ns)')
+    parser.add_argument('logs', nargs='+', help='console logs of the runner')
+    args = parser.parse_args()
+
+    # tables[class][platform][(group, name, workers)] = value
+    tables = {}
+    for path in args.logs:
+        for report in reports(path):
+            platform = report.get('platform', path)
+            column = tables.setdefault(report['class'], {}).setdefault(platform, {})
+            for bench in report['benchmarks']:
+                key = (bench.get('group', 'parallel'), bench['name'],
+                       bench.get('workers'))
+                column[key] = bench.get(args.field, '')
+
+    for cls in sorted(tables):
+        platforms = sorted(tables[cls])
+        rows = []
+        for platform in platforms:
+            for key in tables[cls][platform]:
+                if key not in rows:
+                    rows.append(key)
+        print('## Class %s, %s\n' % (cls, args.field))
+        print('| group | benchmark | ' + ' | '.join(platforms) + ' |')
+        print('|---|---|' + '---:|' * len(platforms))
+        for key in rows:
+            group, name, workers = key
+            if workers is not None:
+                name = '%s (%u workers)' % (name, workers)
+            values = [str(tables[cls][p].get(key, '')) for p in platforms]
+            print('| %s | %s | %s |' % (group, name, ' | '.join(values)))
+        print()
+
+
+if __name__ == '__main__':
+    main()
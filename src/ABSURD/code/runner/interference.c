@@ -0,0 +1,302 @@
+/******************************************************************************
+*   Copyright 2026 The ABSURD contributors
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*******************************************************************************/
+
+/*
+   Interference mode of the runner. Each benchmark is handed to
+   T_measure_runtime() of the RTEMS test framework, which executes it with a
+   full, hot and dirty cache and then with load workers dirtying the caches
+   on one, two, ... and finally all other processors. The sample taken by
+   T_measure_runtime() covers the whole benchmark call, the teardown handler
+   replaces it with the region between MEASURE_START() and MEASURE_STOP(), so
+   the input generation is not part of the distribution.
+
+   Besides the M: lines printed by T_measure_runtime() for each variant, the
+   median, p99 and maximum of every variant and its median inflation with
+   respect to the hot cache variant are printed as JSON.
+*/
+
+#ifdef ABSURD_INTERFERENCE
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rtems.h>
+#include <rtems/test.h>
+
+#include "runner.h"
+#include "simple_random.h"
+
+#define ABSURD_T_DISABLE_ALL (T_MEASURE_RUNTIME_DISABLE_FULL_CACHE | \
+                              T_MEASURE_RUNTIME_DISABLE_HOT_CACHE | \
+                              T_MEASURE_RUNTIME_DISABLE_DIRTY_CACHE | \
+                              T_MEASURE_RUNTIME_DISABLE_MINOR_LOAD | \
+                              T_MEASURE_RUNTIME_DISABLE_MAX_LOAD)
+
+typedef struct {
+    const char *name;
+    int enable;
+    /* T_measure_runtime() calls the body twice per hot cache sample */
+    unsigned int calls_per_sample;
+} scenario;
+
+static const scenario scenarios[] = {
+    { "FullCache", T_MEASURE_RUNTIME_DISABLE_FULL_CACHE, 1 },
+    { "HotCache", T_MEASURE_RUNTIME_DISABLE_HOT_CACHE, 2 },
+    { "DirtyCache", T_MEASURE_RUNTIME_DISABLE_DIRTY_CACHE, 1 },
+    { "Load", T_MEASURE_RUNTIME_DISABLE_MINOR_LOAD, 1 },
+    { "Load", T_MEASURE_RUNTIME_DISABLE_MAX_LOAD, 1 }
+};
+
+typedef struct {
+    char name[16];
+    unsigned long long median_ns;
+    unsigned long long p99_ns;
+    unsigned long long max_ns;
+} variant_stats;
+
+typedef struct {
+    T_ticks *samples;
+    size_t capacity;
+    size_t count;
+    unsigned int calls;
+    unsigned int calls_per_sample;
+} recorder;
+
+static recorder absurd_recorder;
+
+static const T_config absurd_t_config = {
+    .name = "ABSURD",
+    .putchar = T_putchar_default,
+    .verbosity = T_NORMAL,
+    .now = T_now_clock,
+    .allocate = malloc,
+    .deallocate = free
+};
+
+/* Every sample of every scenario shall process the same input */
+static void setup(void *arg){
+    (void) arg;
+    random_set_seed(SEED);
+    absurd_measure_reset();
+}
+
+static void body(void *arg){
+    const absurd_benchmark *bench = arg;
+
+    (*bench->entry)();
+}
+
+static bool teardown(void *arg, T_ticks *delta, uint32_t tic, uint32_t toc,
+                     unsigned int retry){
+    recorder *rec = &absurd_recorder;
+    unsigned long long ticks;
+
+    (void) arg;
+    (void) tic;
+    (void) toc;
+    (void) retry;
+
+    if(absurd_measure_get(&ticks) > 0){
+        *delta = (T_ticks) ticks;
+    }
+
+    ++rec->calls;
+
+    if(rec->calls % rec->calls_per_sample == 0 && rec->count < rec->capacity){
+        rec->samples[rec->count] = *delta;
+        ++rec->count;
+    }
+
+    /* Clock interrupts are part of the interference, keep every sample */
+    return true;
+}
+
+static int compare_ticks(const void *a, const void *b){
+    T_ticks x = *(const T_ticks *) a;
+    T_ticks y = *(const T_ticks *) b;
+
+    return (x > y) - (x < y);
+}
+
+static void variant_stats_compute(variant_stats *vs, T_ticks *s, size_t n){
+    qsort(s, n, sizeof(s[0]), compare_ticks);
+    vs->median_ns = absurd_ticks_to_ns(s[(n - 1) / 2]);
+    vs->p99_ns = absurd_ticks_to_ns(s[(99 * n + 99) / 100 - 1]);
+    vs->max_ns = absurd_ticks_to_ns(s[n - 1]);
+}
+
+/* The samples of consecutive load variants follow each other */
+static size_t measure_scenario(T_measure_runtime_context *ctx,
+                               const absurd_benchmark *bench,
+                               const scenario *sc, size_t sample_count,
+                               variant_stats *vs, unsigned int *load){
+    T_measure_runtime_request req;
+    recorder *rec = &absurd_recorder;
+    size_t variants;
+    size_t i;
+
+    memset(&req, 0, sizeof(req));
+    req.name = bench->name;
+    req.flags = ABSURD_T_DISABLE_ALL & ~sc->enable;
+    req.setup = setup;
+    req.body = body;
+    req.teardown = teardown;
+    req.arg = (void *) bench;
+
+    rec->count = 0;
+    rec->calls = 0;
+    rec->calls_per_sample = sc->calls_per_sample;
+
+    T_measure_runtime(ctx, &req);
+
+    variants = rec->count / sample_count;
+
+    for(i = 0; i < variants; ++i){
+        if(strcmp(sc->name, "Load") == 0){
+            ++(*load);
+            snprintf(vs[i].name, sizeof(vs[i].name), "Load/%u", *load);
+        }else{
+            snprintf(vs[i].name, sizeof(vs[i].name), "%s", sc->name);
+        }
+
+        variant_stats_compute(&vs[i], &rec->samples[i * sample_count], sample_count);
+    }
+
+    return variants;
+}
+
+static void print_inflation(const variant_stats *vs, const variant_stats *hot){
+    unsigned long long milli;
+
+    milli = hot->median_ns > 0 ? (vs->median_ns * 1000) / hot->median_ns : 0;
+    T_printf("%llu.%03llu", milli / 1000, milli % 1000);
+}
+
+unsigned int absurd_run_interference(void){
+    T_measure_runtime_config config;
+    T_measure_runtime_context *ctx;
+    variant_stats *stats;
+    size_t max_variants;
+    size_t *counts;
+    size_t sample_count;
+    unsigned int failures;
+    uint32_t cpu_max;
+    size_t i;
+
+    sample_count = ABSURD_RUNS;
+    cpu_max = rtems_scheduler_get_processor_maximum();
+    max_variants = 3 + cpu_max;
+
+    absurd_recorder.capacity = sample_count * (cpu_max > 1 ? cpu_max - 1 : 1);
+    absurd_recorder.samples = calloc(absurd_recorder.capacity, sizeof(T_ticks));
+    stats = calloc(absurd_benchmark_count * max_variants, sizeof(*stats));
+    counts = calloc(absurd_benchmark_count, sizeof(*counts));
+
+    if(absurd_recorder.samples == NULL || stats == NULL || counts == NULL){
+        free(absurd_recorder.samples);
+        free(stats);
+        free(counts);
+        return 1;
+    }
+
+    T_run_initialize(&absurd_t_config);
+    T_case_begin("ABSURDInterference", NULL);
+
+    memset(&config, 0, sizeof(config));
+    config.sample_count = sample_count;
+    ctx = T_measure_runtime_create(&config);
+    T_assert_not_null(ctx);
+
+    failures = 0;
+
+    for(i = 0; i < absurd_benchmark_count; ++i){
+        variant_stats *vs = &stats[i * max_variants];
+        unsigned int load = 0;
+        size_t j;
+
+        for(j = 0; j < sizeof(scenarios) / sizeof(scenarios[0]); ++j){
+            counts[i] += measure_scenario(ctx, &absurd_benchmarks[i],
+                                          &scenarios[j], sample_count,
+                                          &vs[counts[i]], &load);
+        }
+
+        failures += absurd_take_check_failures();
+    }
+
+    T_case_end();
+
+    T_printf(
+        "*** BEGIN OF JSON DATA ***\n"
+        "{\n"
+        "  \"platform\": \"" ABSURD_PLATFORM "\",\n"
+        "  \"class\": \"" ABSURD_CLASS "\",\n"
+        "  \"samples\": %zu,\n"
+        "  \"processors\": %" PRIu32 ",\n"
+        "  \"benchmarks\": [",
+        sample_count,
+        cpu_max
+    );
+
+    for(i = 0; i < absurd_benchmark_count; ++i){
+        const variant_stats *vs = &stats[i * max_variants];
+        size_t j;
+
+        T_printf(
+            "%s\n    {\n"
+            "      \"group\": \"%s\",\n"
+            "      \"name\": \"%s\",\n"
+            "      \"variants\": [",
+            i == 0 ? "" : ",",
+            absurd_benchmarks[i].group,
+            absurd_benchmarks[i].name
+        );
+
+        for(j = 0; j < counts[i]; ++j){
+            T_printf(
+                "%s\n        {\n"
+                "          \"variant\": \"%s\",\n"
+                "          \"median-ns\": %llu,\n"
+                "          \"p99-ns\": %llu,\n"
+                "          \"max-ns\": %llu,\n"
+                "          \"inflation\": ",
+                j == 0 ? "" : ",",
+                vs[j].name,
+                vs[j].median_ns,
+                vs[j].p99_ns,
+                vs[j].max_ns
+            );
+            /* The hot cache variant is always the second one */
+            print_inflation(&vs[j], &vs[1]);
+            T_printf("\n        }");
+        }
+
+        T_printf("\n      ]\n    }");
+    }
+
+    T_printf("\n  ]\n}\n*** END OF JSON DATA ***\n");
+
+    (void) T_run_finalize();
+
+    free(absurd_recorder.samples);
+    free(stats);
+    free(counts);
+
+    return failures;
+}
+
+#endif
@@ -0,0 +1,36 @@
+/******************************************************************************
+*   Copyright 2026 The ABSURD contributors
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*******************************************************************************/
+
+/*
+   Entry point of the native build of the runner, see the native variant in
+   the wscript. It runs the same benchmarks as the RTEMS image as a Linux
+   process to give a baseline for the RTEMS results.
+*/
+
+#include <stdio.h>
+
+#include "runner.h"
+
+int main(void){
+    unsigned int failures;
+
+    printf("\n*** ABSURD BENCHMARKS (CLASS " ABSURD_CLASS ") ***\n");
+
+    failures = absurd_run_all();
+
+    printf("*** %u FAILED CHECKS ***\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,184 @@
+/******************************************************************************
+*   Copyright 2026 The ABSURD contributors
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*******************************************************************************/
+
+/*
+   Parallel track of the runner. Every kernel of parallel.def is executed
+   with 1, 2, 4, ... workers up to the number of processors and
+   ABSURD_PAR_MAX_WORKERS. The report gives for each configuration the
+   statistics of the measured region, the speedup of its median with
+   respect to one worker and the median time each worker spent in its jobs.
+*/
+
+#ifdef ABSURD_PARALLEL
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include <rtems.h>
+#include <rtems/printer.h>
+
+#include "runner.h"
+#include "simple_random.h"
+#include "par.h"
+
+#define ABSURD_BENCHMARK(group, name) extern void name(void);
+#include "parallel.def"
+#undef ABSURD_BENCHMARK
+
+#define ABSURD_BENCHMARK(group, name) { #group, #name, name },
+static const absurd_benchmark absurd_par_benchmarks[] = {
+#include "parallel.def"
+};
+#undef ABSURD_BENCHMARK
+
+static unsigned long long samples[ABSURD_RUNS];
+
+static unsigned long long busy[ABSURD_PAR_MAX_WORKERS][ABSURD_RUNS];
+
+static int compare_ticks(const void *a, const void *b){
+    unsigned long long x = *(const unsigned long long *) a;
+    unsigned long long y = *(const unsigned long long *) b;
+
+    return (x > y) - (x < y);
+}
+
+/* Sorts the warm runs, the first run is left out like in absurd_run_benchmark() */
+static unsigned long long *warm_sorted(unsigned long long *s, size_t *n){
+    size_t skip = ABSURD_RUNS > 1 ? 1 : 0;
+
+    *n = ABSURD_RUNS - skip;
+    qsort(&s[skip], *n, sizeof(s[0]), compare_ticks);
+    return &s[skip];
+}
+
+static void print_ratio(const rtems_printer *printer, unsigned long long num,
+                        unsigned long long den){
+    unsigned long long milli = den > 0 ? (num * 1000) / den : 0;
+
+    rtems_printf(printer, "%llu.%03llu", milli / 1000, milli % 1000);
+}
+
+unsigned int absurd_run_parallel(void){
+    rtems_printer printer;
+    unsigned int failures;
+    unsigned int max_workers;
+    bool first;
+    size_t i;
+
+    rtems_print_printer_printf(&printer);
+
+    max_workers = rtems_scheduler_get_processor_maximum();
+    if(max_workers > ABSURD_PAR_MAX_WORKERS){
+        max_workers = ABSURD_PAR_MAX_WORKERS;
+    }
+
+    rtems_printf(
+        &printer,
+        "*** BEGIN OF JSON DATA ***\n"
+        "{\n"
+        "  \"platform\": \"" ABSURD_PLATFORM "\",\n"
+        "  \"class\": \"" ABSURD_CLASS "\",\n"
+        "  \"runs\": %u,\n"
+        "  \"processors\": %u,\n"
+        "  \"benchmarks\": [",
+        (unsigned int) ABSURD_RUNS,
+        (unsigned int) rtems_scheduler_get_processor_maximum()
+    );
+
+    failures = 0;
+    first = true;
+
+    for(i = 0; i < sizeof(absurd_par_benchmarks) / sizeof(absurd_par_benchmarks[0]); ++i){
+        const absurd_benchmark *bench = &absurd_par_benchmarks[i];
+        unsigned long long base = 0;
+        unsigned int workers;
+
+        for(workers = 1; workers <= max_workers; workers *= 2){
+            unsigned long long *s;
+            unsigned int checks;
+            size_t n;
+            size_t r;
+            unsigned int w;
+
+            if(absurd_par_start(workers) != 0){
+                ++failures;
+                break;
+            }
+
+            (void) absurd_take_check_failures();
+
+            for(r = 0; r < ABSURD_RUNS; ++r){
+                /* Every run shall process the same input */
+                random_set_seed(SEED);
+                absurd_par_reset_busy();
+                absurd_measure_reset();
+                (*bench->entry)();
+                (void) absurd_measure_get(&samples[r]);
+
+                for(w = 0; w < workers; ++w){
+                    busy[w][r] = absurd_par_busy_ticks(w);
+                }
+            }
+
+            absurd_par_stop();
+            checks = absurd_take_check_failures();
+            failures += checks;
+
+            s = warm_sorted(samples, &n);
+
+            if(workers == 1){
+                base = s[(n - 1) / 2];
+            }
+
+            rtems_printf(
+                &printer,
+                "%s\n    {\n"
+                "      \"name\": \"%s\",\n"
+                "      \"workers\": %u,\n"
+                "      \"min-ns\": %llu,\n"
+                "      \"median-ns\": %llu,\n"
+                "      \"p99-ns\": %llu,\n"
+                "      \"max-ns\": %llu,\n"
+                "      \"speedup\": ",
+                first ? "" : ",",
+                bench->name,
+                workers,
+                absurd_ticks_to_ns(s[0]),
+                absurd_ticks_to_ns(s[(n - 1) / 2]),
+                absurd_ticks_to_ns(s[(99 * n + 99) / 100 - 1]),
+                absurd_ticks_to_ns(s[n - 1])
+            );
+            print_ratio(&printer, base, s[(n - 1) / 2]);
+            rtems_printf(&printer, ",\n      \"worker-median-ns\": [");
+
+            for(w = 0; w < workers; ++w){
+                unsigned long long *b = warm_sorted(busy[w], &n);
+
+                rtems_printf(&printer, "%s%llu", w == 0 ? "" : ", ",
+                             absurd_ticks_to_ns(b[(n - 1) / 2]));
+            }
+
+            rtems_printf(&printer, "],\n      \"check-failures\": %u\n    }", checks);
+            first = false;
+        }
+    }
+
+    rtems_printf(&printer, "\n  ]\n}\n*** END OF JSON DATA ***\n");
+
+    return failures;
+}
+
+#endif
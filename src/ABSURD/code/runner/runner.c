@@ -0,0 +1,241 @@
+/******************************************************************************
+*   Copyright 2026 The ABSURD contributors
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*******************************************************************************/
+
+/*
+   Single-image benchmark runner for RTEMS. Every benchmark is executed
+   ABSURD_RUNS times, each run is timed with the CPU counter between its
+   MEASURE_START() and MEASURE_STOP() and the order statistics are printed as
+   JSON. The first run after seeding the PRNG is reported separately as the
+   cold run since it pays for cache and TLB misses the others do not.
+
+   The same runner builds natively on Linux as baseline, there the counter
+   is CLOCK_MONOTONIC with a resolution of one nanosecond.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef __rtems__
+#include <rtems/counter.h>
+#else
+#include <time.h>
+#endif
+
+#include "runner.h"
+#include "runstats.h"
+#include "simple_random.h"
+
+#define ABSURD_BENCHMARK(group, name) extern void name(void);
+#include "benchmarks.def"
+#undef ABSURD_BENCHMARK
+
+#define ABSURD_BENCHMARK(group, name) { #group, #name, name },
+const absurd_benchmark absurd_benchmarks[] = {
+#include "benchmarks.def"
+};
+#undef ABSURD_BENCHMARK
+
+const size_t absurd_benchmark_count =
+    sizeof(absurd_benchmarks) / sizeof(absurd_benchmarks[0]);
+
+#ifdef __rtems__
+typedef rtems_counter_ticks counter_ticks;
+
+static counter_ticks counter_read(void){
+    return rtems_counter_read();
+}
+
+static unsigned long long counter_difference(counter_ticks end, counter_ticks begin){
+    return rtems_counter_difference(end, begin);
+}
+
+static unsigned long long counter_frequency(void){
+    return rtems_counter_frequency();
+}
+#else
+typedef unsigned long long counter_ticks;
+
+static counter_ticks counter_read(void){
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (counter_ticks) now.tv_sec * BILLION + now.tv_nsec;
+}
+
+static unsigned long long counter_difference(counter_ticks end, counter_ticks begin){
+    return end - begin;
+}
+
+static unsigned long long counter_frequency(void){
+    return BILLION;
+}
+#endif
+
+static counter_ticks measure_begin;
+
+static unsigned long long measure_ticks;
+
+static unsigned int measure_count;
+
+static unsigned int check_failures;
+
+static unsigned long long samples[ABSURD_RUNS];
+
+void absurd_measure_start(void){
+    measure_begin = counter_read();
+}
+
+void absurd_measure_stop(void){
+    counter_ticks end = counter_read();
+
+    measure_ticks += counter_difference(end, measure_begin);
+    ++measure_count;
+}
+
+void absurd_check_result(int ok){
+    if(!ok){
+        ++check_failures;
+    }
+}
+
+void absurd_measure_reset(void){
+    measure_ticks = 0;
+    measure_count = 0;
+}
+
+unsigned int absurd_measure_get(unsigned long long *ticks){
+    *ticks = measure_ticks;
+    return measure_count;
+}
+
+unsigned int absurd_take_check_failures(void){
+    unsigned int failures = check_failures;
+
+    check_failures = 0;
+    return failures;
+}
+
+static unsigned long long run_once(const absurd_benchmark *bench, unsigned int *unmeasured){
+    counter_ticks begin;
+    counter_ticks end;
+    unsigned long long ticks;
+
+    /* Every run shall process the same input */
+    random_set_seed(SEED);
+    absurd_measure_reset();
+
+    begin = counter_read();
+    (*bench->entry)();
+    end = counter_read();
+
+    if(absurd_measure_get(&ticks) == 0){
+        ++(*unmeasured);
+        return counter_difference(end, begin);
+    }
+
+    return ticks;
+}
+
+void absurd_run_benchmark(const absurd_benchmark *bench, absurd_stats *stats){
+    absurd_run_stats rs;
+    size_t i;
+
+    stats->unmeasured_runs = 0;
+    (void) absurd_take_check_failures();
+
+    for(i = 0; i < ABSURD_RUNS; ++i){
+        samples[i] = run_once(bench, &stats->unmeasured_runs);
+    }
+
+    stats->check_failures = absurd_take_check_failures();
+
+    absurd_run_stats_compute(samples, ABSURD_RUNS, &rs);
+    stats->cold_ticks = rs.cold;
+    stats->min_ticks = rs.min;
+    stats->median_ticks = rs.median;
+    stats->p99_ticks = rs.p99;
+    stats->max_ticks = rs.max;
+    stats->mean_ticks = rs.mean;
+    stats->observed_wcet_ticks = rs.observed_wcet;
+}
+
+/* Accumulated tick counts may exceed the range of rtems_counter_ticks */
+unsigned long long absurd_ticks_to_ns(unsigned long long ticks){
+    unsigned long long freq = counter_frequency();
+
+    return (ticks / freq) * BILLION + ((ticks % freq) * BILLION) / freq;
+}
+
+unsigned int absurd_run_all(void){
+    unsigned int failures;
+    size_t i;
+
+    printf(
+        "*** BEGIN OF JSON DATA ***\n"
+        "{\n"
+        "  \"platform\": \"" ABSURD_PLATFORM "\",\n"
+        "  \"class\": \"" ABSURD_CLASS "\",\n"
+        "  \"runs\": %u,\n"
+        "  \"seed\": %u,\n"
+        "  \"counter-frequency\": %lu,\n"
+        "  \"benchmarks\": [",
+        (unsigned int) ABSURD_RUNS,
+        (unsigned int) SEED,
+        (unsigned long) counter_frequency()
+    );
+
+    failures = 0;
+
+    for(i = 0; i < absurd_benchmark_count; ++i){
+        const absurd_benchmark *bench = &absurd_benchmarks[i];
+        absurd_stats stats;
+
+        absurd_run_benchmark(bench, &stats);
+        failures += stats.check_failures;
+
+        printf(
+            "%s\n    {\n"
+            "      \"group\": \"%s\",\n"
+            "      \"name\": \"%s\",\n"
+            "      \"cold-ns\": %llu,\n"
+            "      \"min-ns\": %llu,\n"
+            "      \"median-ns\": %llu,\n"
+            "      \"p99-ns\": %llu,\n"
+            "      \"max-ns\": %llu,\n"
+            "      \"mean-ns\": %llu,\n"
+            "      \"observed-wcet-ns\": %llu,\n"
+            "      \"unmeasured-runs\": %u,\n"
+            "      \"check-failures\": %u\n"
+            "    }",
+            i == 0 ? "" : ",",
+            bench->group,
+            bench->name,
+            absurd_ticks_to_ns(stats.cold_ticks),
+            absurd_ticks_to_ns(stats.min_ticks),
+            absurd_ticks_to_ns(stats.median_ticks),
+            absurd_ticks_to_ns(stats.p99_ticks),
+            absurd_ticks_to_ns(stats.max_ticks),
+            absurd_ticks_to_ns(stats.mean_ticks),
+            absurd_ticks_to_ns(stats.observed_wcet_ticks),
+            stats.unmeasured_runs,
+            stats.check_failures
+        );
+    }
+
+    printf("\n  ]\n}\n*** END OF JSON DATA ***\n");
+
+    return failures;
+}
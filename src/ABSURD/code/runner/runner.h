@@ -0,0 +1,120 @@
+/******************************************************************************
+*   Copyright 2026 The ABSURD contributors
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*******************************************************************************/
+#ifndef RUNNER_H_
+#define RUNNER_H_
+
+#include <stddef.h>
+
+#include "user.h"
+
+/** Number of timed executions of each benchmark, the first one is the cold run **/
+#ifndef ABSURD_RUNS
+#define ABSURD_RUNS 100
+#endif
+
+/** Name of the platform in the report, the build passes the RTEMS BSP, e.g. "sparc/erc32" **/
+#ifndef ABSURD_PLATFORM
+#define ABSURD_PLATFORM "unknown"
+#endif
+
+#if defined(CLASS_A)
+#define ABSURD_CLASS "A"
+#elif defined(CLASS_B)
+#define ABSURD_CLASS "B"
+#elif defined(CLASS_C)
+#define ABSURD_CLASS "C"
+#elif defined(CLASS_D)
+#define ABSURD_CLASS "D"
+#else
+#define ABSURD_CLASS "E"
+#endif
+
+typedef struct {
+    const char *group;
+    const char *name;
+    void (*entry)(void);
+} absurd_benchmark;
+
+typedef struct {
+    /** Execution time in counter ticks of the first run after seeding the PRNG **/
+    unsigned long long cold_ticks;
+    /** Order statistics of the remaining (warm) runs **/
+    unsigned long long min_ticks;
+    unsigned long long median_ticks;
+    unsigned long long p99_ticks;
+    unsigned long long max_ticks;
+    unsigned long long mean_ticks;
+    /** Largest execution time observed over all runs, cold run included **/
+    unsigned long long observed_wcet_ticks;
+    /** Number of runs that timed the whole call since the benchmark never measured **/
+    unsigned int unmeasured_runs;
+    /** Number of failed CHECK_RESULT() **/
+    unsigned int check_failures;
+} absurd_stats;
+
+extern const absurd_benchmark absurd_benchmarks[];
+
+extern const size_t absurd_benchmark_count;
+
+/**
+ * @brief Forgets the measured region of the previous benchmark call.
+ */
+void absurd_measure_reset(void);
+
+/**
+ * @brief Returns how often MEASURE_STOP() was reached since the last reset and
+ *        the counter ticks accumulated between MEASURE_START() and MEASURE_STOP().
+ */
+unsigned int absurd_measure_get(unsigned long long *ticks);
+
+/**
+ * @brief Returns the number of failed CHECK_RESULT() since the last call.
+ */
+unsigned int absurd_take_check_failures(void);
+
+unsigned long long absurd_ticks_to_ns(unsigned long long ticks);
+
+/**
+ * @brief Runs a benchmark ABSURD_RUNS times and computes its statistics.
+ */
+void absurd_run_benchmark(const absurd_benchmark *bench, absurd_stats *stats);
+
+/**
+ * @brief Runs all benchmarks of the image and prints the report. It returns
+ *        the total number of failed output checks.
+ */
+unsigned int absurd_run_all(void);
+
+#ifdef ABSURD_INTERFERENCE
+/**
+ * @brief Runs all benchmarks through T_measure_runtime() under each cache and
+ *        load scenario and prints the execution time inflation with respect
+ *        to the hot cache scenario. It returns the total number of failed
+ *        output checks.
+ */
+unsigned int absurd_run_interference(void);
+#endif
+
+#ifdef ABSURD_PARALLEL
+/**
+ * @brief Runs the parallel track with 1, 2, 4, ... workers and prints the
+ *        speedup and per-worker times. It returns the total number of failed
+ *        output checks and worker setups.
+ */
+unsigned int absurd_run_parallel(void);
+#endif
+
+#endif
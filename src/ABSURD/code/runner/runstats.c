@@ -0,0 +1,60 @@
+/******************************************************************************
+*   Copyright 2026 The ABSURD contributors
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*******************************************************************************/
+#include <stdlib.h>
+
+#include "runstats.h"
+
+static int compare_samples(const void *a, const void *b){
+    unsigned long long x = *(const unsigned long long *) a;
+    unsigned long long y = *(const unsigned long long *) b;
+
+    return (x > y) - (x < y);
+}
+
+/* Nearest-rank percentile of the n sorted samples */
+static unsigned long long percentile(const unsigned long long *s, size_t n, unsigned int p){
+    size_t rank = (p * n + 99) / 100;
+
+    if(rank == 0){
+        rank = 1;
+    }
+
+    return s[rank - 1];
+}
+
+void absurd_run_stats_compute(unsigned long long *samples, size_t n, absurd_run_stats *stats){
+    unsigned long long *warm;
+    unsigned long long sum;
+    size_t warm_n;
+    size_t i;
+
+    warm_n = n > 1 ? n - 1 : 1;
+    warm = &samples[n - warm_n];
+    qsort(warm, warm_n, sizeof(warm[0]), compare_samples);
+
+    sum = 0;
+    for(i = 0; i < warm_n; ++i){
+        sum += warm[i];
+    }
+
+    stats->cold = samples[0];
+    stats->min = warm[0];
+    stats->median = percentile(warm, warm_n, 50);
+    stats->p99 = percentile(warm, warm_n, 99);
+    stats->max = warm[warm_n - 1];
+    stats->mean = sum / warm_n;
+    stats->observed_wcet = stats->max > stats->cold ? stats->max : stats->cold;
+}
@@ -0,0 +1,46 @@
+/******************************************************************************
+*   Copyright 2026 The ABSURD contributors
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*******************************************************************************/
+#ifndef RUNSTATS_H_
+#define RUNSTATS_H_
+
+#include <stddef.h>
+
+/*
+   The statistics over the timed runs of a benchmark. They do not depend on
+   the rest of the runner, so that testsuites/benchmarks/absurd in RTEMS
+   includes runstats.c as well.
+*/
+typedef struct {
+    /** First run after seeding the PRNG **/
+    unsigned long long cold;
+    /** Order statistics of the remaining (warm) runs **/
+    unsigned long long min;
+    unsigned long long median;
+    unsigned long long p99;
+    unsigned long long max;
+    unsigned long long mean;
+    /** Largest sample of all runs, cold run included **/
+    unsigned long long observed_wcet;
+} absurd_run_stats;
+
+/**
+ * @brief Computes the statistics of the n samples, the first one is the cold
+ *        run. It sorts the warm samples in place. If n is one, the cold run
+ *        is also used as the only warm run.
+ */
+void absurd_run_stats_compute(unsigned long long *samples, size_t n, absurd_run_stats *stats);
+
+#endif
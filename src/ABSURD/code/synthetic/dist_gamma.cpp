@@ -19,11 +19,16 @@
 
 extern "C" void dist_gamma();
 
+#ifdef ABSURD_SINGLE_IMAGE
+/* The image already provides random_set_seed() through simple_random.c */
+static UINT32_T seed = SEED;
+#else
 UINT32_T seed;
 
 extern "C" void random_set_seed(UINT32_T _seed) {
 	seed = _seed;
 }
+#endif
 
 MEASURE_GLOBAL_VARIABLES()
 
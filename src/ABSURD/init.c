@@ -1,33 +1,80 @@
+/******************************************************************************
+*   Copyright 2026 The ABSURD contributors
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*******************************************************************************/
+
 #include <rtems.h>
 #include <stdio.h>
 #include <stdlib.h>
 
-/* Prototipos de los benchmarks renombrados con el comando sed */
-extern int main_fibonacci();
-extern int main_bsqrt();
-extern int main_matrix_nn();
+#include "runner.h"
 
-rtems_task Init(rtems_task_argument argument) {
-    printf("\n*** RTEMS ABSURD BENCHMARKS PORT - STM32F4 ***\n"); [cite: 120, 125]
+static void Init(rtems_task_argument arg){
+    unsigned int failures;
 
-    printf("\nEjecutando Fibonacci...\n");
-    main_fibonacci();
+    (void) arg;
 
-    printf("\nEjecutando Bsqrt...\n");
-    main_bsqrt();
+    printf("\n*** ABSURD BENCHMARKS (CLASS " ABSURD_CLASS ") ***\n");
 
-    printf("\nEjecutando Matrix NN...\n");
-    main_matrix_nn();
+#if defined(ABSURD_INTERFERENCE)
+    failures = absurd_run_interference();
+#elif defined(ABSURD_PARALLEL)
+    failures = absurd_run_parallel();
+#else
+    failures = absurd_run_all();
+#endif
 
-    printf("\n*** PRUEBAS COMPLETADAS ***\n");
-    exit(0);
+    printf("*** %u FAILED CHECKS ***\n", failures);
+    exit(failures == 0 ? 0 : 1);
 }
 
-/* Configuración de RTEMS para la placa stm32f4 */
-#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER [cite: 471]
-#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER [cite: 470]
+/* Several benchmarks keep their input arrays on the stack */
+#ifndef ABSURD_STACK_SIZE
+#define ABSURD_STACK_SIZE (256 * 1024)
+#endif
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#if defined(ABSURD_INTERFERENCE) || defined(ABSURD_PARALLEL)
+/*
+ * T_measure_runtime() creates one load worker per processor, the parallel
+ * track one helper task per processor except the first.
+ */
+#ifndef ABSURD_MAXIMUM_PROCESSORS
+#define ABSURD_MAXIMUM_PROCESSORS 8
+#endif
+#define CONFIGURE_MAXIMUM_PROCESSORS ABSURD_MAXIMUM_PROCESSORS
+#define CONFIGURE_MAXIMUM_TASKS (1 + ABSURD_MAXIMUM_PROCESSORS)
+#define CONFIGURE_MAXIMUM_BARRIERS 2
+#else
 #define CONFIGURE_MAXIMUM_TASKS 1
+#endif
+
+#ifdef ABSURD_MULTI_THREAD
+#define CONFIGURE_MAXIMUM_POSIX_THREADS 3
+#define CONFIGURE_MAXIMUM_POSIX_KEYS 4
+#define CONFIGURE_MINIMUM_TASK_STACK_SIZE ABSURD_STACK_SIZE
+#endif
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_FLOATING_POINT
+#define CONFIGURE_INIT_TASK_STACK_SIZE ABSURD_STACK_SIZE
+
 #define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
 #define CONFIGURE_INIT
 
-#include <rtems/confdefs.h> [cite: 220]
+#include <rtems/confdefs.h>
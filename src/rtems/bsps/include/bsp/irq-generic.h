@@ -674,6 +674,38 @@ void bsp_interrupt_lock(void);
  */
 void bsp_interrupt_unlock(void);
 
+/**
+ * @brief Visitor routine for bsp_interrupt_server_iterate().
+ *
+ * @param server_index is the index of the interrupt server.
+ *
+ * @param server is the identifier of the interrupt server task.
+ *
+ * @param statistics is the dispatch statistics of the interrupt server.
+ *
+ * @param arg is the visitor argument.
+ */
+typedef void ( *bsp_interrupt_server_visitor )(
+  uint32_t                                 server_index,
+  rtems_id                                 server,
+  const rtems_interrupt_server_statistics *statistics,
+  void                                    *arg
+);
+
+/**
+ * @brief Calls the visitor for each interrupt server.
+ *
+ * The interrupt support lock is owned while the visitor is called.
+ *
+ * @param visitor is the visitor routine.
+ *
+ * @param arg is the visitor argument.
+ */
+void bsp_interrupt_server_iterate(
+  bsp_interrupt_server_visitor  visitor,
+  void                         *arg
+);
+
 /**
  * @brief Checks the vector and routine.  When the checks were successful, the
  *   interrupt support lock will be obtained.
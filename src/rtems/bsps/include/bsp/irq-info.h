@@ -52,6 +52,14 @@ void bsp_interrupt_report_with_plugin(
   const rtems_printer *printer
 );
 
+/**
+ * @brief Prints the dispatch statistics of all interrupt servers via the
+ * printer.
+ */
+void bsp_interrupt_server_report_with_plugin(
+  const rtems_printer *printer
+);
+
 /**
  * @brief Prints interrupt information via the default printk plugin.
  */
@@ -102,6 +102,52 @@ void bsp_interrupt_report_with_plugin(
   );
 }
 
+static void bsp_interrupt_server_report_per_server(
+  uint32_t server_index,
+  rtems_id server,
+  const rtems_interrupt_server_statistics *statistics,
+  void *arg
+)
+{
+  const rtems_printer *printer = arg;
+
+  rtems_printf(
+    printer,
+    "%7" PRIu32 " | 0x%08" PRIx32 " | %10lu | %10lu | %6lu | %10lu | %7lu\n",
+    server_index,
+    server,
+    statistics->wakeups,
+    statistics->dispatches,
+    statistics->max_batch,
+    statistics->coalesced,
+    statistics->errors
+  );
+}
+
+void bsp_interrupt_server_report_with_plugin(
+  const rtems_printer *printer
+)
+{
+  rtems_printf(
+    printer,
+    "-------------------------------------------------------------------------------\n"
+    "                          INTERRUPT SERVER STATISTICS\n"
+    "--------+------------+------------+------------+--------+------------+--------\n"
+    " SERVER | TASK       | WAKE-UPS   | DISPATCHES | BATCH  | COALESCED  | ERRORS\n"
+    "--------+------------+------------+------------+--------+------------+--------\n"
+  );
+
+  bsp_interrupt_server_iterate(
+    bsp_interrupt_server_report_per_server,
+    RTEMS_DECONST(rtems_printer *, printer)
+  );
+
+  rtems_printf(
+    printer,
+    "--------+------------+------------+------------+--------+------------+--------\n"
+  );
+}
+
 void bsp_interrupt_report(void)
 {
   rtems_printer printer;
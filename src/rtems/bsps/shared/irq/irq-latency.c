@@ -0,0 +1,127 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPILatency
+ *
+ * @brief This source file contains the interrupt dispatch wrapper of the
+ *   latency histograms.
+ */
+
+/*
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <bsp/irq-generic.h>
+
+#include <rtems/latency.h>
+#include <rtems/score/percpu.h>
+
+/* The regular interrupt entries are registered in this table */
+rtems_interrupt_entry *
+_Latency_Interrupt_dispatch_table[ BSP_INTERRUPT_DISPATCH_TABLE_SIZE ];
+
+/*
+ * Provide one interrupt entry for the _Latency_Interrupt_handler() interrupt
+ * dispatch wrapper for each interrupt vector.
+ */
+static rtems_interrupt_entry
+_Latency_Interrupt_entry_table[ BSP_INTERRUPT_DISPATCH_TABLE_SIZE ];
+
+static void _Latency_Interrupt_handler( void *arg )
+{
+  uintptr_t              vector;
+  rtems_interrupt_entry *entry;
+  Per_CPU_Control       *cpu_self;
+  Latency_Control       *control;
+  rtems_counter_ticks    begin;
+  rtems_counter_ticks    end;
+
+  vector = (uintptr_t) arg;
+  cpu_self = _Per_CPU_Get();
+  control = &_Latency_Configuration.controls[ _Per_CPU_Get_index( cpu_self ) ];
+  begin = rtems_counter_read();
+
+  if ( control->interrupt_entry_valid ) {
+    control->interrupt_entry_valid = false;
+    _Latency_Add(
+      control,
+      RTEMS_LATENCY_INTERRUPT_ENTRY,
+      rtems_counter_difference( begin, control->interrupt_entry )
+    );
+  }
+
+  entry = bsp_interrupt_entry_load_acquire(
+    &_Latency_Interrupt_dispatch_table[ vector ]
+  );
+
+  if ( RTEMS_PREDICT_TRUE( entry != NULL ) ) {
+    bsp_interrupt_dispatch_entries( entry );
+  } else {
+#if defined(RTEMS_SMP)
+    bsp_interrupt_spurious( vector );
+#else
+    bsp_interrupt_handler_default( vector );
+#endif
+  }
+
+  end = rtems_counter_read();
+  _Latency_Add(
+    control,
+    RTEMS_LATENCY_INTERRUPT_HANDLER,
+    rtems_counter_difference( end, begin )
+  );
+
+  /*
+   * The wake-up latency starts at the end of the first handler which made a
+   * thread dispatch necessary, it ends in _Latency_Thread_switch().  A thread
+   * dispatch may be requested without a new heir, for example to carry out
+   * post-switch actions such as an ASR.  This does not lead to a thread
+   * switch, so it shall not start a wake-up measurement.
+   */
+  if (
+    cpu_self->dispatch_necessary &&
+    cpu_self->heir != cpu_self->executing &&
+    !control->wakeup_pending
+  ) {
+    control->wakeup_begin = end;
+    control->wakeup_pending = true;
+  }
+}
+
+void _Latency_Interrupt_initialize( void )
+{
+  uintptr_t i;
+
+  /*
+   * Let each interrupt dispatch table slot reference the
+   * _Latency_Interrupt_handler() interrupt dispatch wrapper.
+   */
+  for ( i = 0; i < BSP_INTERRUPT_DISPATCH_TABLE_SIZE; ++i ) {
+    _Latency_Interrupt_entry_table[ i ].handler = _Latency_Interrupt_handler;
+    _Latency_Interrupt_entry_table[ i ].arg = (void *) i;
+    bsp_interrupt_dispatch_table[ i ] = &_Latency_Interrupt_entry_table[ i ];
+  }
+}
@@ -10,6 +10,7 @@
 
 /*
  * Copyright (C) 2009, 2020 embedded brains GmbH & Co. KG
+ * Copyright (C) 2026 The RTEMS Project
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -44,6 +45,21 @@
 
 #define BSP_INTERRUPT_SERVER_MANAGEMENT_VECTOR BSP_INTERRUPT_VECTOR_COUNT
 
+/*
+ * The state of an interrupt server entry consists of the pending, cancelled
+ * and release flags and the count of submissions since the last service of the
+ * entry.  An entry is pending while it is on the submission stack or a list
+ * of an interrupt server.  The interrupt server frees a cancelled entry with
+ * the release flag set when it drops the entry.
+ */
+#define BSP_INTERRUPT_SERVER_PENDING 0x1U
+
+#define BSP_INTERRUPT_SERVER_CANCELLED 0x2U
+
+#define BSP_INTERRUPT_SERVER_RELEASE 0x4U
+
+#define BSP_INTERRUPT_SERVER_SUBMISSION 0x8U
+
 static rtems_interrupt_server_control bsp_interrupt_server_default;
 
 static rtems_chain_control bsp_interrupt_server_chain =
@@ -76,27 +92,98 @@ static rtems_interrupt_server_control *bsp_interrupt_server_get_context(
   return NULL;
 }
 
+static bool bsp_interrupt_server_is_coalescing(
+  const rtems_interrupt_server_entry *e
+)
+{
+  return e->coalescing_count > 1;
+}
+
+/*
+ * The submitted entries are pushed to a lock-free stack.  The interrupt server
+ * takes all entries at once, so there is no ABA problem.  The server has to be
+ * notified only if the stack was empty, since otherwise a notification is
+ * already pending.
+ */
+static void bsp_interrupt_server_push(
+  rtems_interrupt_server_control *s,
+  rtems_interrupt_server_entry *e
+)
+{
+  uintptr_t top;
+
+  top = _Atomic_Load_uintptr(&s->submitted, ATOMIC_ORDER_RELAXED);
+
+  do {
+    e->next = (rtems_interrupt_server_entry *) top;
+  } while (
+    !_Atomic_Compare_exchange_uintptr(
+      &s->submitted,
+      &top,
+      (uintptr_t) e,
+      ATOMIC_ORDER_RELEASE,
+      ATOMIC_ORDER_RELAXED
+    )
+  );
+
+  if (top == 0) {
+    rtems_event_system_send(s->server, RTEMS_EVENT_SYSTEM_SERVER);
+  }
+}
+
 static void bsp_interrupt_server_trigger(void *arg)
 {
-  rtems_interrupt_lock_context lock_context;
   rtems_interrupt_server_entry *e = arg;
   rtems_interrupt_server_control *s = e->server;
+  unsigned int state;
+  unsigned int desired;
+  unsigned int submissions;
+
+  state = _Atomic_Load_uint(&e->state, ATOMIC_ORDER_RELAXED);
+
+  do {
+    desired = (state | BSP_INTERRUPT_SERVER_PENDING)
+      + BSP_INTERRUPT_SERVER_SUBMISSION;
+  } while (
+    !_Atomic_Compare_exchange_uint(
+      &e->state,
+      &state,
+      desired,
+      ATOMIC_ORDER_RELEASE,
+      ATOMIC_ORDER_RELAXED
+    )
+  );
 
-  if (bsp_interrupt_is_valid_vector(e->vector)) {
-    bsp_interrupt_vector_disable(e->vector);
-  }
+  submissions = desired / BSP_INTERRUPT_SERVER_SUBMISSION;
+
+  if (bsp_interrupt_server_is_coalescing(e)) {
+    /*
+     * Keep the interrupt vector enabled until the count threshold is reached.
+     * The interrupt server defers the service of the entry until then or
+     * until the coalescing interval expired.
+     */
+    if (submissions < e->coalescing_count) {
+      if ((state & BSP_INTERRUPT_SERVER_PENDING) == 0) {
+        bsp_interrupt_server_push(s, e);
+      }
 
-  rtems_interrupt_lock_acquire(&s->lock, &lock_context);
+      return;
+    }
 
-  if (rtems_chain_is_node_off_chain(&e->node)) {
-    rtems_chain_append_unprotected(&s->entries, &e->node);
-  } else {
-    ++s->errors;
+    if (submissions > e->coalescing_count) {
+      return;
+    }
   }
 
-  rtems_interrupt_lock_release(&s->lock, &lock_context);
+  if (bsp_interrupt_is_valid_vector(e->vector)) {
+    bsp_interrupt_vector_disable(e->vector);
+  }
 
-  rtems_event_system_send(s->server, RTEMS_EVENT_SYSTEM_SERVER);
+  if ((state & BSP_INTERRUPT_SERVER_PENDING) == 0) {
+    bsp_interrupt_server_push(s, e);
+  } else if (bsp_interrupt_server_is_coalescing(e)) {
+    rtems_event_system_send(s->server, RTEMS_EVENT_SYSTEM_SERVER);
+  }
 }
 
 typedef struct {
@@ -257,20 +344,35 @@ static void bsp_interrupt_server_remove_helper(void *arg)
       bool remove_last = e->actions->next == NULL;
 
       if (remove_last) {
+        unsigned int state;
+
         rtems_interrupt_handler_remove(
           hd->vector,
           bsp_interrupt_server_trigger,
           e
         );
+
+        /*
+         * A pending entry may be on the submission stack, in the batch
+         * currently serviced by this server, or on the deferred list of this
+         * server.  Let the interrupt server drop and free it.  Only this
+         * server clears the pending flag, so there is no race with
+         * bsp_interrupt_server_dispatch().
+         */
+        state = _Atomic_Fetch_or_uint(
+          &e->state,
+          BSP_INTERRUPT_SERVER_CANCELLED | BSP_INTERRUPT_SERVER_RELEASE,
+          ATOMIC_ORDER_RELAXED
+        );
+
+        if ((state & BSP_INTERRUPT_SERVER_PENDING) == 0) {
+          free(e);
+        }
       }
 
       *link = c->next;
       free(c);
 
-      if (remove_last) {
-        free(e);
-      }
-
       sc = RTEMS_SUCCESSFUL;
     } else {
       sc = RTEMS_UNSATISFIED;
@@ -318,56 +420,232 @@ static rtems_status_code bsp_interrupt_server_call_helper(
   return hd.sc;
 }
 
-static rtems_interrupt_server_entry *bsp_interrupt_server_get_entry(
+static void bsp_interrupt_server_synchronize_helper(void *arg)
+{
+  bsp_interrupt_server_helper_data *hd = arg;
+
+  rtems_event_transient_send(hd->task);
+}
+
+/*
+ * Wait until the server serviced all entries submitted to it before this call.
+ */
+static void bsp_interrupt_server_synchronize(rtems_interrupt_server_control *s)
+{
+  bsp_interrupt_server_call_helper(
+    s,
+    BSP_INTERRUPT_SERVER_MANAGEMENT_VECTOR,
+    0,
+    NULL,
+    NULL,
+    bsp_interrupt_server_synchronize_helper
+  );
+}
+
+static rtems_interrupt_server_entry *bsp_interrupt_server_get_entries(
   rtems_interrupt_server_control *s
 )
 {
-  rtems_interrupt_lock_context lock_context;
   rtems_interrupt_server_entry *e;
+  rtems_interrupt_server_entry *first;
+
+  e = (rtems_interrupt_server_entry *)
+    _Atomic_Exchange_uintptr(&s->submitted, 0, ATOMIC_ORDER_ACQUIRE);
+  first = NULL;
+
+  /* Reverse the stack to service the entries in submission order */
+  while (e != NULL) {
+    rtems_interrupt_server_entry *next = e->next;
+
+    e->next = first;
+    first = e;
+    e = next;
+  }
+
+  return first;
+}
+
+static bool bsp_interrupt_server_is_cancelled(
+  const rtems_interrupt_server_entry *e
+)
+{
+  unsigned int state;
+
+  state = _Atomic_Load_uint(&e->state, ATOMIC_ORDER_RELAXED);
+
+  return (state & BSP_INTERRUPT_SERVER_CANCELLED) != 0;
+}
+
+static bool bsp_interrupt_server_is_due(
+  const rtems_interrupt_server_entry *e,
+  rtems_interval now
+)
+{
+  unsigned int state;
+
+  state = _Atomic_Load_uint(&e->state, ATOMIC_ORDER_RELAXED);
+
+  return (state & BSP_INTERRUPT_SERVER_CANCELLED) != 0
+    || state / BSP_INTERRUPT_SERVER_SUBMISSION >= e->coalescing_count
+    || now - e->coalescing_begin >= e->coalescing_interval;
+}
+
+static void bsp_interrupt_server_dispatch(
+  rtems_interrupt_server_control *s,
+  rtems_interrupt_server_entry *e
+)
+{
+  rtems_interrupt_server_action *action = e->actions;
+  rtems_vector_number vector = e->vector;
+  bool coalescing = bsp_interrupt_server_is_coalescing(e);
+  unsigned int state;
+  unsigned long merged;
+
+  /*
+   * Clear the state before the actions are serviced, so that submissions
+   * during the service make the entry pending again.
+   */
+  state = _Atomic_Exchange_uint(&e->state, 0, ATOMIC_ORDER_ACQUIRE);
+
+  if ((state & BSP_INTERRUPT_SERVER_CANCELLED) != 0) {
+    if ((state & BSP_INTERRUPT_SERVER_RELEASE) != 0) {
+      free(e);
+    }
+
+    return;
+  }
 
-  rtems_interrupt_lock_acquire(&s->lock, &lock_context);
+  merged = state / BSP_INTERRUPT_SERVER_SUBMISSION;
 
-  if (!rtems_chain_is_empty(&s->entries)) {
-    e = (rtems_interrupt_server_entry *)
-      rtems_chain_get_first_unprotected(&s->entries);
-    rtems_chain_set_off_chain(&e->node);
+  if (merged > 0) {
+    --merged;
+  }
+
+  if (coalescing) {
+    s->statistics.coalesced += merged;
   } else {
-    e = NULL;
+    s->statistics.errors += merged;
   }
 
-  rtems_interrupt_lock_release(&s->lock, &lock_context);
+  ++s->statistics.dispatches;
+
+  do {
+    rtems_interrupt_server_action *current = action;
+    action = action->next;
+    (*current->handler)(current->arg);
+  } while (action != NULL);
 
-  return e;
+  if (bsp_interrupt_is_valid_vector(vector)) {
+    bsp_interrupt_vector_enable(vector);
+  }
 }
 
 static void bsp_interrupt_server_task(rtems_task_argument arg)
 {
   rtems_interrupt_server_control *s = (rtems_interrupt_server_control *) arg;
+  rtems_interrupt_server_entry *deferred = NULL;
+  rtems_interval timeout = RTEMS_NO_TIMEOUT;
 
   while (true) {
     rtems_event_set events;
     rtems_interrupt_server_entry *e;
+    rtems_interrupt_server_entry **link;
+    rtems_interval now;
+    unsigned long batch;
 
-    rtems_event_system_receive(
+    (void) rtems_event_system_receive(
       RTEMS_EVENT_SYSTEM_SERVER,
       RTEMS_EVENT_ALL | RTEMS_WAIT,
-      RTEMS_NO_TIMEOUT,
+      timeout,
       &events
     );
 
-    while ((e = bsp_interrupt_server_get_entry(s)) != NULL) {
-      rtems_interrupt_server_action *action = e->actions;
-      rtems_vector_number vector = e->vector;
+    now = rtems_clock_get_ticks_since_boot();
+    batch = 0;
+    ++s->statistics.wakeups;
+
+    /*
+     * Service the deferred entries first.  This ensures that cancelled entries
+     * are dropped before a following synchronization request is serviced, see
+     * rtems_interrupt_server_entry_destroy().
+     */
+    link = &deferred;
+
+    while ((e = *link) != NULL) {
+      if (e->server != s) {
+        *link = e->next;
+        bsp_interrupt_server_push(e->server, e);
+      } else if (bsp_interrupt_server_is_due(e, now)) {
+        *link = e->next;
+        bsp_interrupt_server_dispatch(s, e);
+        ++batch;
+      } else {
+        link = &e->next;
+      }
+    }
+
+    e = bsp_interrupt_server_get_entries(s);
+
+    while (e != NULL) {
+      /* The entry may be invalid after the service of its actions */
+      rtems_interrupt_server_entry *next = e->next;
+
+      if (bsp_interrupt_server_is_coalescing(e)) {
+        e->coalescing_begin = now;
+      }
+
+      if (e->server != s) {
+        /* Forward an entry moved to another server */
+        bsp_interrupt_server_push(e->server, e);
+      } else if (
+        bsp_interrupt_server_is_coalescing(e)
+          && !bsp_interrupt_server_is_due(e, now)
+      ) {
+        e->next = deferred;
+        deferred = e;
+      } else {
+        bsp_interrupt_server_dispatch(s, e);
+        ++batch;
+      }
+
+      e = next;
+    }
+
+    if (batch > s->statistics.max_batch) {
+      s->statistics.max_batch = batch;
+    }
+
+    timeout = RTEMS_NO_TIMEOUT;
+    link = &deferred;
+
+    /*
+     * An entry may have been moved to another server by a management request
+     * of the batch.  Forward it, so that only its new server references it.
+     * Do not wait for the coalescing interval of a cancelled entry.
+     */
+    while ((e = *link) != NULL) {
+      rtems_interval remaining;
+
+      if (e->server != s) {
+        *link = e->next;
+        bsp_interrupt_server_push(e->server, e);
+        continue;
+      }
+
+      /* Drop an entry cancelled by a management request of the batch */
+      if (bsp_interrupt_server_is_cancelled(e)) {
+        *link = e->next;
+        bsp_interrupt_server_dispatch(s, e);
+        continue;
+      }
 
-      do {
-        rtems_interrupt_server_action *current = action;
-        action = action->next;
-        (*current->handler)(current->arg);
-      } while (action != NULL);
+      remaining = e->coalescing_begin + e->coalescing_interval - now;
 
-      if (bsp_interrupt_is_valid_vector(vector)) {
-        bsp_interrupt_vector_enable(vector);
+      if (timeout == RTEMS_NO_TIMEOUT || remaining < timeout) {
+        timeout = remaining;
       }
+
+      link = &e->next;
     }
   }
 }
@@ -494,6 +772,110 @@ rtems_status_code rtems_interrupt_server_handler_iterate(
   );
 }
 
+typedef struct {
+  uint32_t count;
+  rtems_interval interval;
+} bsp_interrupt_server_coalescing_data;
+
+static void bsp_interrupt_server_set_coalescing_helper(void *arg)
+{
+  bsp_interrupt_server_helper_data *hd = arg;
+  bsp_interrupt_server_coalescing_data *cd = hd->arg;
+  rtems_status_code sc;
+  rtems_interrupt_server_entry *e;
+  rtems_option trigger_options;
+
+  bsp_interrupt_lock();
+
+  e = bsp_interrupt_server_query_entry(hd->vector, &trigger_options);
+  if (e != NULL) {
+    e->coalescing_count = cd->count;
+    e->coalescing_interval = cd->interval;
+    sc = RTEMS_SUCCESSFUL;
+  } else {
+    sc = RTEMS_UNSATISFIED;
+  }
+
+  bsp_interrupt_unlock();
+
+  hd->sc = sc;
+  rtems_event_transient_send(hd->task);
+}
+
+rtems_status_code rtems_interrupt_server_set_coalescing(
+  uint32_t server_index,
+  rtems_vector_number vector,
+  uint32_t count,
+  rtems_interval interval
+)
+{
+  rtems_status_code sc;
+  bsp_interrupt_server_coalescing_data cd;
+  rtems_interrupt_server_control *s;
+
+  s = bsp_interrupt_server_get_context(server_index, &sc);
+  if (s == NULL) {
+    return sc;
+  }
+
+  if (!bsp_interrupt_is_valid_vector(vector)) {
+    return RTEMS_INVALID_ID;
+  }
+
+  cd.count = count;
+  cd.interval = interval;
+  return bsp_interrupt_server_call_helper(
+    s,
+    vector,
+    0,
+    NULL,
+    &cd,
+    bsp_interrupt_server_set_coalescing_helper
+  );
+}
+
+rtems_status_code rtems_interrupt_server_get_statistics(
+  uint32_t server_index,
+  rtems_interrupt_server_statistics *statistics
+)
+{
+  rtems_status_code sc;
+  rtems_interrupt_server_control *s;
+
+  if (statistics == NULL) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  s = bsp_interrupt_server_get_context(server_index, &sc);
+  if (s == NULL) {
+    return sc;
+  }
+
+  *statistics = s->statistics;
+  return RTEMS_SUCCESSFUL;
+}
+
+void bsp_interrupt_server_iterate(
+  bsp_interrupt_server_visitor visitor,
+  void *arg
+)
+{
+  rtems_chain_node *node;
+
+  bsp_interrupt_lock();
+  node = rtems_chain_first(&bsp_interrupt_server_chain);
+
+  while (node != rtems_chain_tail(&bsp_interrupt_server_chain)) {
+    rtems_interrupt_server_control *s;
+
+    s = RTEMS_CONTAINER_OF(node, rtems_interrupt_server_control, node);
+    (*visitor)(s->index, s->server, &s->statistics, arg);
+    node = rtems_chain_next(node);
+  }
+
+  bsp_interrupt_unlock();
+}
+
 /*
  * The default server is statically allocated.  Just clear the structure so
  * that it can be re-initialized.
@@ -542,8 +924,8 @@ static rtems_status_code bsp_interrupt_server_create(
     return sc;
   }
 
-  rtems_interrupt_lock_initialize(&s->lock, "Interrupt Server");
-  rtems_chain_initialize_empty(&s->entries);
+  _Atomic_Init_uintptr(&s->submitted, 0);
+  memset(&s->statistics, 0, sizeof(s->statistics));
 
 #if defined(RTEMS_SMP)
   sc = rtems_scheduler_ident_by_processor(cpu_index, &scheduler);
@@ -677,8 +1059,8 @@ rtems_status_code rtems_interrupt_server_create(
     return sc;
   }
 
-  rtems_interrupt_lock_initialize(&s->lock, "Interrupt Server");
-  rtems_chain_initialize_empty(&s->entries);
+  _Atomic_Init_uintptr(&s->submitted, 0);
+  memset(&s->statistics, 0, sizeof(s->statistics));
   s->destroy = config->destroy;
   s->index = rtems_object_id_get_index(s->server)
     + rtems_scheduler_get_processor_maximum();
@@ -709,8 +1091,6 @@ static void bsp_interrupt_server_destroy_helper(void *arg)
   rtems_chain_extract_unprotected(&s->node);
   bsp_interrupt_unlock();
 
-  rtems_interrupt_lock_destroy(&s->lock);
-
   if (s->destroy != NULL) {
     (*s->destroy)(s);
   }
@@ -748,10 +1128,14 @@ static void bsp_interrupt_server_entry_initialize(
   rtems_interrupt_server_control *s
 )
 {
-  rtems_chain_set_off_chain(&entry->node);
+  entry->next = NULL;
   entry->server = s;
   entry->vector = BSP_INTERRUPT_SERVER_MANAGEMENT_VECTOR;
   entry->actions = NULL;
+  _Atomic_Init_uint(&entry->state, 0);
+  entry->coalescing_count = 0;
+  entry->coalescing_interval = 0;
+  entry->coalescing_begin = 0;
 }
 
 static void bsp_interrupt_server_action_prepend(
@@ -818,11 +1202,14 @@ rtems_status_code rtems_interrupt_server_entry_move(
   return RTEMS_SUCCESSFUL;
 }
 
-static void bsp_interrupt_server_entry_synchronize_helper(void *arg)
+void rtems_interrupt_server_entry_set_coalescing(
+  rtems_interrupt_server_entry *entry,
+  uint32_t                      count,
+  rtems_interval                interval
+)
 {
-  bsp_interrupt_server_helper_data *hd = arg;
-
-  rtems_event_transient_send(hd->task);
+  entry->coalescing_count = count;
+  entry->coalescing_interval = interval;
 }
 
 void rtems_interrupt_server_entry_destroy(
@@ -830,26 +1217,21 @@ void rtems_interrupt_server_entry_destroy(
 )
 {
   rtems_interrupt_server_control *s;
-  rtems_interrupt_lock_context lock_context;
 
+  /*
+   * A pending entry cannot be removed from the lock-free stack.  Mark it as
+   * cancelled, so that the interrupt server drops it without servicing its
+   * actions.  The synchronization request ensures that the interrupt server
+   * no longer references the entry.
+   */
   s = entry->server;
-  rtems_interrupt_lock_acquire(&s->lock, &lock_context);
-
-  if (!rtems_chain_is_node_off_chain(&entry->node)) {
-    rtems_chain_extract_unprotected(&entry->node);
-    rtems_chain_set_off_chain(&entry->node);
-  }
-
-  rtems_interrupt_lock_release(&s->lock, &lock_context);
-
-  bsp_interrupt_server_call_helper(
-    s,
-    BSP_INTERRUPT_SERVER_MANAGEMENT_VECTOR,
-    0,
-    NULL,
-    NULL,
-    bsp_interrupt_server_entry_synchronize_helper
+  _Atomic_Fetch_or_uint(
+    &entry->state,
+    BSP_INTERRUPT_SERVER_CANCELLED,
+    ATOMIC_ORDER_RELAXED
   );
+
+  bsp_interrupt_server_synchronize(s);
 }
 
 rtems_status_code rtems_interrupt_server_request_initialize(
@@ -888,29 +1270,12 @@ static void bsp_interrupt_server_handler_move_helper(void *arg)
 
   e = bsp_interrupt_server_query_entry(hd->vector, &trigger_options);
   if (e != NULL) {
-    rtems_interrupt_lock_context lock_context;
-    rtems_interrupt_server_control *src = e->server;
-    rtems_interrupt_server_control *dst = hihd->arg;
-    bool pending;
-
-    /* The source server is only used in SMP configurations for the lock */
-    (void) src;
-
-    rtems_interrupt_lock_acquire(&src->lock, &lock_context);
-
-    pending = !rtems_chain_is_node_off_chain(&e->node);
-    if (pending) {
-      rtems_chain_extract_unprotected(&e->node);
-      rtems_chain_set_off_chain(&e->node);
-    }
-
-    rtems_interrupt_lock_release(&src->lock, &lock_context);
-
-    e->server = dst;
-
-    if (pending) {
-      bsp_interrupt_server_trigger(e);
-    }
+    /*
+     * This server forwards a pending entry to the destination server, see
+     * bsp_interrupt_server_task().  Following submissions go to the
+     * destination server.
+     */
+    e->server = hihd->arg;
   }
 
   bsp_interrupt_unlock();
@@ -952,6 +1317,7 @@ rtems_status_code rtems_interrupt_server_move(
     &hihd,
     bsp_interrupt_server_handler_move_helper
   );
+  bsp_interrupt_server_synchronize(src);
   return RTEMS_SUCCESSFUL;
 }
 
@@ -1001,14 +1367,7 @@ rtems_status_code rtems_interrupt_server_resume(uint32_t server_index)
   }
 
   rtems_event_system_send(s->server, RTEMS_EVENT_SYSTEM_SERVER_RESUME);
-  bsp_interrupt_server_call_helper(
-    s,
-    BSP_INTERRUPT_SERVER_MANAGEMENT_VECTOR,
-    0,
-    NULL,
-    NULL,
-    bsp_interrupt_server_entry_synchronize_helper
-  );
+  bsp_interrupt_server_synchronize(s);
   return RTEMS_SUCCESSFUL;
 }
 
@@ -49,13 +49,14 @@ static int bsp_interrupt_shell_main(int argc, char **argv)
   rtems_printer printer;
   rtems_print_printer_printf(&printer);
   bsp_interrupt_report_with_plugin(&printer);
+  bsp_interrupt_server_report_with_plugin(&printer);
 
   return 0;
 }
 
 struct rtems_shell_cmd_tt bsp_interrupt_shell_command = {
   .name     = "irq",
-  .usage   = "Prints interrupt information",
+  .usage   = "Prints interrupt and interrupt server information",
   .topic   = "rtems",
   .command = bsp_interrupt_shell_main,
   .alias   = NULL,
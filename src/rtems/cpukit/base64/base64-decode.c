@@ -6,11 +6,12 @@
  * @ingroup RTEMSImplBase64
  *
  * @brief This source file contains the implementation of
- *   _Base64_Decode_initialize() and _Base64_Decode().
+ *   _Base64_Decode_initialize(), _Base64_Decode(), and _Base64_Decode_block().
  */
 
 /*
  * Copyright (C) 2023 embedded brains GmbH & Co. KG
+ * Copyright (C) 2026 The RTEMS Project
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -163,3 +164,65 @@ Base64_Decode_status _Base64_Decode(Base64_Decode_control* self, char ch) {
   self->target = target;
   return BASE64_DECODE_SUCCESS;
 }
+
+Base64_Decode_status _Base64_Decode_block(Base64_Decode_control* self,
+                                          const char* src,
+                                          size_t srclen) {
+  const unsigned char* in = (const unsigned char*)src;
+  const unsigned char* end = in + srclen;
+
+  while (in != end) {
+    Base64_Decode_status status;
+
+    /*
+     * Decode groups of four characters at once as long as the decoder is at
+     * a group boundary, the characters are valid encoding characters, and
+     * there is space for three bytes in the target area.  Everything else
+     * goes through the character decoder.
+     */
+    while (self->state == BASE64_DECODE_STATE_0 && end - in >= 4 &&
+           self->target_end - self->target >= 3) {
+      uint32_t d0;
+      uint32_t d1;
+      uint32_t d2;
+      uint32_t d3;
+      uint32_t w;
+      uint8_t* target;
+
+      if (((in[0] | in[1] | in[2] | in[3]) & 0x80U) != 0) {
+        break;
+      }
+
+      d0 = _Base64_Decoding[in[0]];
+      d1 = _Base64_Decoding[in[1]];
+      d2 = _Base64_Decoding[in[2]];
+      d3 = _Base64_Decoding[in[3]];
+
+      if ((d0 | d1 | d2 | d3) >= 64) {
+        break;
+      }
+
+      w = (d0 << 18) | (d1 << 12) | (d2 << 6) | d3;
+      target = self->target;
+      target[0] = (uint8_t)(w >> 16);
+      target[1] = (uint8_t)(w >> 8);
+      target[2] = (uint8_t)w;
+      self->target = target + 3;
+      in += 4;
+    }
+
+    if (in == end) {
+      break;
+    }
+
+    status = _Base64_Decode(self, (char)*in);
+
+    if (status != BASE64_DECODE_SUCCESS) {
+      return status;
+    }
+
+    ++in;
+  }
+
+  return BASE64_DECODE_SUCCESS;
+}
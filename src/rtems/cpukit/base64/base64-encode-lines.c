@@ -0,0 +1,148 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSImplBase64
+ *
+ * @brief This source file contains the implementation of
+ *   _Base64_Encode_lines_initialize(), _Base64_Encode_lines(), and
+ *   _Base64_Encode_lines_flush().
+ */
+
+/*
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <rtems/base64.h>
+
+#include <string.h>
+
+static void _Base64_Put_line(
+  const Base64_Encode_lines_control *self,
+  const char                        *line,
+  size_t                             length
+)
+{
+  IO_Put_char  put_char;
+  void        *arg;
+  size_t       i;
+
+  put_char = self->put_char;
+  arg = self->arg;
+
+  for ( i = 0; i < length; ++i ) {
+    ( *put_char )( line[ i ], arg );
+  }
+}
+
+static void _Base64_Encode_line(
+  const Base64_Encode_lines_control *self,
+  const void                        *src
+)
+{
+  char line[ BASE64_LINE_LENGTH + 1 ];
+
+  (void) _Base64_Encode_block( line, src, BASE64_LINE_SOURCE_SIZE );
+  line[ BASE64_LINE_LENGTH ] = '\n';
+  _Base64_Put_line( self, line, sizeof( line ) );
+}
+
+void _Base64_Encode_lines_initialize(
+  Base64_Encode_lines_control *self,
+  IO_Put_char                  put_char,
+  void                        *arg
+)
+{
+  self->put_char = put_char;
+  self->arg = arg;
+  self->index = 0;
+}
+
+void _Base64_Encode_lines(
+  Base64_Encode_lines_control *self,
+  const void                  *src,
+  size_t                       srclen
+)
+{
+  const uint8_t *in;
+  size_t         index;
+
+  in = src;
+  index = self->index;
+
+  if ( index > 0 ) {
+    size_t n;
+
+    n = BASE64_LINE_SOURCE_SIZE - index;
+
+    if ( n > srclen ) {
+      n = srclen;
+    }
+
+    memcpy( &self->buf[ index ], in, n );
+    in += n;
+    srclen -= n;
+    index += n;
+
+    if ( index < BASE64_LINE_SOURCE_SIZE ) {
+      self->index = index;
+      return;
+    }
+
+    _Base64_Encode_line( self, self->buf );
+  }
+
+  /* Encode complete lines directly from the source buffer */
+  while ( srclen >= BASE64_LINE_SOURCE_SIZE ) {
+    _Base64_Encode_line( self, in );
+    in += BASE64_LINE_SOURCE_SIZE;
+    srclen -= BASE64_LINE_SOURCE_SIZE;
+  }
+
+  memcpy( &self->buf[ 0 ], in, srclen );
+  self->index = srclen;
+}
+
+size_t _Base64_Encode_lines_flush( Base64_Encode_lines_control *self )
+{
+  char   line[ BASE64_LINE_LENGTH + 1 ];
+  size_t length;
+
+  length = _Base64_Encode_block( line, self->buf, self->index );
+  self->index = 0;
+
+  /*
+   * The padding may complete the line.  A complete line is always terminated
+   * by a new line character.
+   */
+  if ( length == BASE64_LINE_LENGTH ) {
+    line[ BASE64_LINE_LENGTH ] = '\n';
+    _Base64_Put_line( self, line, sizeof( line ) );
+    return 0;
+  }
+
+  _Base64_Put_line( self, line, length );
+  return length;
+}
@@ -6,11 +6,13 @@
  * @ingroup RTEMSImplBase64
  *
  * @brief This source file contains the implementation of
- *   _Base64_Encode() and _Base64url_Encode().
+ *   _Base64_Encode(), _Base64url_Encode(), _Base64_Encode_block(), and
+ *   _Base64url_Encode_block().
  */
 
 /*
  * Copyright (C) 2020, 2024 embedded brains GmbH & Co. KG
+ * Copyright (C) 2026 The RTEMS Project
  * Copyright (C) 2004, 2005, 2007, 2009  Internet Systems Consortium, Inc. ("ISC")
  * Copyright (C) 1998-2001, 2003  Internet Software Consortium.
  *
@@ -88,6 +90,45 @@ _Base64_Do_encode(IO_Put_char put_char, void *arg, const void *src,
 	return out;
 }
 
+static size_t
+_Base64_Do_encode_block(char *dst, const void *src, size_t srclen,
+    const uint8_t *encoding)
+{
+	const unsigned char *in = src;
+	char *out = dst;
+
+	/*
+	 * Combine three input bytes into one word and map the four 6-bit groups
+	 * of the word through the encoding table.
+	 */
+	while (srclen > 2) {
+		uint32_t w;
+
+		w = ((uint32_t)in[0] << 16) | ((uint32_t)in[1] << 8) | in[2];
+		out[0] = (char)encoding[w >> 18];
+		out[1] = (char)encoding[(w >> 12) & 0x3f];
+		out[2] = (char)encoding[(w >> 6) & 0x3f];
+		out[3] = (char)encoding[w & 0x3f];
+		in += 3;
+		srclen -= 3;
+		out += 4;
+	}
+	if (srclen == 2) {
+		out[0] = (char)encoding[(in[0]>>2)&0x3f];
+		out[1] = (char)encoding[((in[0]<<4)&0x30)|((in[1]>>4)&0x0f)];
+		out[2] = (char)encoding[((in[1]<<2)&0x3c)];
+		out[3] = '=';
+		out += 4;
+	} else if (srclen == 1) {
+		out[0] = (char)encoding[(in[0]>>2)&0x3f];
+		out[1] = (char)encoding[((in[0]<<4)&0x30)];
+		out[2] = '=';
+		out[3] = '=';
+		out += 4;
+	}
+	return (size_t)(out - dst);
+}
+
 const uint8_t _Base64_Encoding[64] = {
     'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O',
     'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd',
@@ -104,6 +145,12 @@ _Base64_Encode(IO_Put_char put_char, void *arg, const void *src, size_t srclen,
 	    wordlen, _Base64_Encoding);
 }
 
+size_t
+_Base64_Encode_block(char *dst, const void *src, size_t srclen)
+{
+	return _Base64_Do_encode_block(dst, src, srclen, _Base64_Encoding);
+}
+
 const uint8_t _Base64url_Encoding[64] = {
     'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O',
     'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd',
@@ -119,3 +166,9 @@ _Base64url_Encode(IO_Put_char put_char, void *arg, const void *src,
 	return _Base64_Do_encode(put_char, arg, src, srclen, wordbreak,
 	    wordlen, _Base64url_Encoding);
 }
+
+size_t
+_Base64url_Encode_block(char *dst, const void *src, size_t srclen)
+{
+	return _Base64_Do_encode_block(dst, src, srclen, _Base64url_Encoding);
+}
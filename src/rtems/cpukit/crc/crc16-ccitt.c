@@ -0,0 +1,605 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSImplCRC
+ *
+ * @brief This source file contains the implementation of
+ *   _CRC16_CCITT_Update() and _CRC16_CCITT_Sequence_update().
+ *
+ * The CRC-16/CCITT cyclic redundancy checksum with the polynomial 0x1021 is
+ * used for example by XMODEM and the SD card data transfers.
+ */
+
+/*
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <rtems/crc.h>
+
+/*
+ * The first table is the byte-wise table of the polynomial 0x1021.  The other
+ * tables are derived by T[k][i] = (T[k - 1][i] << 8) ^ T[0][T[k - 1][i] >> 8]
+ * and are used to process eight bytes at once.
+ */
+static const uint16_t _CRC16_CCITT_Table[8][256] = {
+    {
+        UINT16_C(0x0000), UINT16_C(0x1021), UINT16_C(0x2042), UINT16_C(0x3063),
+        UINT16_C(0x4084), UINT16_C(0x50A5), UINT16_C(0x60C6), UINT16_C(0x70E7),
+        UINT16_C(0x8108), UINT16_C(0x9129), UINT16_C(0xA14A), UINT16_C(0xB16B),
+        UINT16_C(0xC18C), UINT16_C(0xD1AD), UINT16_C(0xE1CE), UINT16_C(0xF1EF),
+        UINT16_C(0x1231), UINT16_C(0x0210), UINT16_C(0x3273), UINT16_C(0x2252),
+        UINT16_C(0x52B5), UINT16_C(0x4294), UINT16_C(0x72F7), UINT16_C(0x62D6),
+        UINT16_C(0x9339), UINT16_C(0x8318), UINT16_C(0xB37B), UINT16_C(0xA35A),
+        UINT16_C(0xD3BD), UINT16_C(0xC39C), UINT16_C(0xF3FF), UINT16_C(0xE3DE),
+        UINT16_C(0x2462), UINT16_C(0x3443), UINT16_C(0x0420), UINT16_C(0x1401),
+        UINT16_C(0x64E6), UINT16_C(0x74C7), UINT16_C(0x44A4), UINT16_C(0x5485),
+        UINT16_C(0xA56A), UINT16_C(0xB54B), UINT16_C(0x8528), UINT16_C(0x9509),
+        UINT16_C(0xE5EE), UINT16_C(0xF5CF), UINT16_C(0xC5AC), UINT16_C(0xD58D),
+        UINT16_C(0x3653), UINT16_C(0x2672), UINT16_C(0x1611), UINT16_C(0x0630),
+        UINT16_C(0x76D7), UINT16_C(0x66F6), UINT16_C(0x5695), UINT16_C(0x46B4),
+        UINT16_C(0xB75B), UINT16_C(0xA77A), UINT16_C(0x9719), UINT16_C(0x8738),
+        UINT16_C(0xF7DF), UINT16_C(0xE7FE), UINT16_C(0xD79D), UINT16_C(0xC7BC),
+        UINT16_C(0x48C4), UINT16_C(0x58E5), UINT16_C(0x6886), UINT16_C(0x78A7),
+        UINT16_C(0x0840), UINT16_C(0x1861), UINT16_C(0x2802), UINT16_C(0x3823),
+        UINT16_C(0xC9CC), UINT16_C(0xD9ED), UINT16_C(0xE98E), UINT16_C(0xF9AF),
+        UINT16_C(0x8948), UINT16_C(0x9969), UINT16_C(0xA90A), UINT16_C(0xB92B),
+        UINT16_C(0x5AF5), UINT16_C(0x4AD4), UINT16_C(0x7AB7), UINT16_C(0x6A96),
+        UINT16_C(0x1A71), UINT16_C(0x0A50), UINT16_C(0x3A33), UINT16_C(0x2A12),
+        UINT16_C(0xDBFD), UINT16_C(0xCBDC), UINT16_C(0xFBBF), UINT16_C(0xEB9E),
+        UINT16_C(0x9B79), UINT16_C(0x8B58), UINT16_C(0xBB3B), UINT16_C(0xAB1A),
+        UINT16_C(0x6CA6), UINT16_C(0x7C87), UINT16_C(0x4CE4), UINT16_C(0x5CC5),
+        UINT16_C(0x2C22), UINT16_C(0x3C03), UINT16_C(0x0C60), UINT16_C(0x1C41),
+        UINT16_C(0xEDAE), UINT16_C(0xFD8F), UINT16_C(0xCDEC), UINT16_C(0xDDCD),
+        UINT16_C(0xAD2A), UINT16_C(0xBD0B), UINT16_C(0x8D68), UINT16_C(0x9D49),
+        UINT16_C(0x7E97), UINT16_C(0x6EB6), UINT16_C(0x5ED5), UINT16_C(0x4EF4),
+        UINT16_C(0x3E13), UINT16_C(0x2E32), UINT16_C(0x1E51), UINT16_C(0x0E70),
+        UINT16_C(0xFF9F), UINT16_C(0xEFBE), UINT16_C(0xDFDD), UINT16_C(0xCFFC),
+        UINT16_C(0xBF1B), UINT16_C(0xAF3A), UINT16_C(0x9F59), UINT16_C(0x8F78),
+        UINT16_C(0x9188), UINT16_C(0x81A9), UINT16_C(0xB1CA), UINT16_C(0xA1EB),
+        UINT16_C(0xD10C), UINT16_C(0xC12D), UINT16_C(0xF14E), UINT16_C(0xE16F),
+        UINT16_C(0x1080), UINT16_C(0x00A1), UINT16_C(0x30C2), UINT16_C(0x20E3),
+        UINT16_C(0x5004), UINT16_C(0x4025), UINT16_C(0x7046), UINT16_C(0x6067),
+        UINT16_C(0x83B9), UINT16_C(0x9398), UINT16_C(0xA3FB), UINT16_C(0xB3DA),
+        UINT16_C(0xC33D), UINT16_C(0xD31C), UINT16_C(0xE37F), UINT16_C(0xF35E),
+        UINT16_C(0x02B1), UINT16_C(0x1290), UINT16_C(0x22F3), UINT16_C(0x32D2),
+        UINT16_C(0x4235), UINT16_C(0x5214), UINT16_C(0x6277), UINT16_C(0x7256),
+        UINT16_C(0xB5EA), UINT16_C(0xA5CB), UINT16_C(0x95A8), UINT16_C(0x8589),
+        UINT16_C(0xF56E), UINT16_C(0xE54F), UINT16_C(0xD52C), UINT16_C(0xC50D),
+        UINT16_C(0x34E2), UINT16_C(0x24C3), UINT16_C(0x14A0), UINT16_C(0x0481),
+        UINT16_C(0x7466), UINT16_C(0x6447), UINT16_C(0x5424), UINT16_C(0x4405),
+        UINT16_C(0xA7DB), UINT16_C(0xB7FA), UINT16_C(0x8799), UINT16_C(0x97B8),
+        UINT16_C(0xE75F), UINT16_C(0xF77E), UINT16_C(0xC71D), UINT16_C(0xD73C),
+        UINT16_C(0x26D3), UINT16_C(0x36F2), UINT16_C(0x0691), UINT16_C(0x16B0),
+        UINT16_C(0x6657), UINT16_C(0x7676), UINT16_C(0x4615), UINT16_C(0x5634),
+        UINT16_C(0xD94C), UINT16_C(0xC96D), UINT16_C(0xF90E), UINT16_C(0xE92F),
+        UINT16_C(0x99C8), UINT16_C(0x89E9), UINT16_C(0xB98A), UINT16_C(0xA9AB),
+        UINT16_C(0x5844), UINT16_C(0x4865), UINT16_C(0x7806), UINT16_C(0x6827),
+        UINT16_C(0x18C0), UINT16_C(0x08E1), UINT16_C(0x3882), UINT16_C(0x28A3),
+        UINT16_C(0xCB7D), UINT16_C(0xDB5C), UINT16_C(0xEB3F), UINT16_C(0xFB1E),
+        UINT16_C(0x8BF9), UINT16_C(0x9BD8), UINT16_C(0xABBB), UINT16_C(0xBB9A),
+        UINT16_C(0x4A75), UINT16_C(0x5A54), UINT16_C(0x6A37), UINT16_C(0x7A16),
+        UINT16_C(0x0AF1), UINT16_C(0x1AD0), UINT16_C(0x2AB3), UINT16_C(0x3A92),
+        UINT16_C(0xFD2E), UINT16_C(0xED0F), UINT16_C(0xDD6C), UINT16_C(0xCD4D),
+        UINT16_C(0xBDAA), UINT16_C(0xAD8B), UINT16_C(0x9DE8), UINT16_C(0x8DC9),
+        UINT16_C(0x7C26), UINT16_C(0x6C07), UINT16_C(0x5C64), UINT16_C(0x4C45),
+        UINT16_C(0x3CA2), UINT16_C(0x2C83), UINT16_C(0x1CE0), UINT16_C(0x0CC1),
+        UINT16_C(0xEF1F), UINT16_C(0xFF3E), UINT16_C(0xCF5D), UINT16_C(0xDF7C),
+        UINT16_C(0xAF9B), UINT16_C(0xBFBA), UINT16_C(0x8FD9), UINT16_C(0x9FF8),
+        UINT16_C(0x6E17), UINT16_C(0x7E36), UINT16_C(0x4E55), UINT16_C(0x5E74),
+        UINT16_C(0x2E93), UINT16_C(0x3EB2), UINT16_C(0x0ED1), UINT16_C(0x1EF0)
+    },
+    {
+        UINT16_C(0x0000), UINT16_C(0x3331), UINT16_C(0x6662), UINT16_C(0x5553),
+        UINT16_C(0xCCC4), UINT16_C(0xFFF5), UINT16_C(0xAAA6), UINT16_C(0x9997),
+        UINT16_C(0x89A9), UINT16_C(0xBA98), UINT16_C(0xEFCB), UINT16_C(0xDCFA),
+        UINT16_C(0x456D), UINT16_C(0x765C), UINT16_C(0x230F), UINT16_C(0x103E),
+        UINT16_C(0x0373), UINT16_C(0x3042), UINT16_C(0x6511), UINT16_C(0x5620),
+        UINT16_C(0xCFB7), UINT16_C(0xFC86), UINT16_C(0xA9D5), UINT16_C(0x9AE4),
+        UINT16_C(0x8ADA), UINT16_C(0xB9EB), UINT16_C(0xECB8), UINT16_C(0xDF89),
+        UINT16_C(0x461E), UINT16_C(0x752F), UINT16_C(0x207C), UINT16_C(0x134D),
+        UINT16_C(0x06E6), UINT16_C(0x35D7), UINT16_C(0x6084), UINT16_C(0x53B5),
+        UINT16_C(0xCA22), UINT16_C(0xF913), UINT16_C(0xAC40), UINT16_C(0x9F71),
+        UINT16_C(0x8F4F), UINT16_C(0xBC7E), UINT16_C(0xE92D), UINT16_C(0xDA1C),
+        UINT16_C(0x438B), UINT16_C(0x70BA), UINT16_C(0x25E9), UINT16_C(0x16D8),
+        UINT16_C(0x0595), UINT16_C(0x36A4), UINT16_C(0x63F7), UINT16_C(0x50C6),
+        UINT16_C(0xC951), UINT16_C(0xFA60), UINT16_C(0xAF33), UINT16_C(0x9C02),
+        UINT16_C(0x8C3C), UINT16_C(0xBF0D), UINT16_C(0xEA5E), UINT16_C(0xD96F),
+        UINT16_C(0x40F8), UINT16_C(0x73C9), UINT16_C(0x269A), UINT16_C(0x15AB),
+        UINT16_C(0x0DCC), UINT16_C(0x3EFD), UINT16_C(0x6BAE), UINT16_C(0x589F),
+        UINT16_C(0xC108), UINT16_C(0xF239), UINT16_C(0xA76A), UINT16_C(0x945B),
+        UINT16_C(0x8465), UINT16_C(0xB754), UINT16_C(0xE207), UINT16_C(0xD136),
+        UINT16_C(0x48A1), UINT16_C(0x7B90), UINT16_C(0x2EC3), UINT16_C(0x1DF2),
+        UINT16_C(0x0EBF), UINT16_C(0x3D8E), UINT16_C(0x68DD), UINT16_C(0x5BEC),
+        UINT16_C(0xC27B), UINT16_C(0xF14A), UINT16_C(0xA419), UINT16_C(0x9728),
+        UINT16_C(0x8716), UINT16_C(0xB427), UINT16_C(0xE174), UINT16_C(0xD245),
+        UINT16_C(0x4BD2), UINT16_C(0x78E3), UINT16_C(0x2DB0), UINT16_C(0x1E81),
+        UINT16_C(0x0B2A), UINT16_C(0x381B), UINT16_C(0x6D48), UINT16_C(0x5E79),
+        UINT16_C(0xC7EE), UINT16_C(0xF4DF), UINT16_C(0xA18C), UINT16_C(0x92BD),
+        UINT16_C(0x8283), UINT16_C(0xB1B2), UINT16_C(0xE4E1), UINT16_C(0xD7D0),
+        UINT16_C(0x4E47), UINT16_C(0x7D76), UINT16_C(0x2825), UINT16_C(0x1B14),
+        UINT16_C(0x0859), UINT16_C(0x3B68), UINT16_C(0x6E3B), UINT16_C(0x5D0A),
+        UINT16_C(0xC49D), UINT16_C(0xF7AC), UINT16_C(0xA2FF), UINT16_C(0x91CE),
+        UINT16_C(0x81F0), UINT16_C(0xB2C1), UINT16_C(0xE792), UINT16_C(0xD4A3),
+        UINT16_C(0x4D34), UINT16_C(0x7E05), UINT16_C(0x2B56), UINT16_C(0x1867),
+        UINT16_C(0x1B98), UINT16_C(0x28A9), UINT16_C(0x7DFA), UINT16_C(0x4ECB),
+        UINT16_C(0xD75C), UINT16_C(0xE46D), UINT16_C(0xB13E), UINT16_C(0x820F),
+        UINT16_C(0x9231), UINT16_C(0xA100), UINT16_C(0xF453), UINT16_C(0xC762),
+        UINT16_C(0x5EF5), UINT16_C(0x6DC4), UINT16_C(0x3897), UINT16_C(0x0BA6),
+        UINT16_C(0x18EB), UINT16_C(0x2BDA), UINT16_C(0x7E89), UINT16_C(0x4DB8),
+        UINT16_C(0xD42F), UINT16_C(0xE71E), UINT16_C(0xB24D), UINT16_C(0x817C),
+        UINT16_C(0x9142), UINT16_C(0xA273), UINT16_C(0xF720), UINT16_C(0xC411),
+        UINT16_C(0x5D86), UINT16_C(0x6EB7), UINT16_C(0x3BE4), UINT16_C(0x08D5),
+        UINT16_C(0x1D7E), UINT16_C(0x2E4F), UINT16_C(0x7B1C), UINT16_C(0x482D),
+        UINT16_C(0xD1BA), UINT16_C(0xE28B), UINT16_C(0xB7D8), UINT16_C(0x84E9),
+        UINT16_C(0x94D7), UINT16_C(0xA7E6), UINT16_C(0xF2B5), UINT16_C(0xC184),
+        UINT16_C(0x5813), UINT16_C(0x6B22), UINT16_C(0x3E71), UINT16_C(0x0D40),
+        UINT16_C(0x1E0D), UINT16_C(0x2D3C), UINT16_C(0x786F), UINT16_C(0x4B5E),
+        UINT16_C(0xD2C9), UINT16_C(0xE1F8), UINT16_C(0xB4AB), UINT16_C(0x879A),
+        UINT16_C(0x97A4), UINT16_C(0xA495), UINT16_C(0xF1C6), UINT16_C(0xC2F7),
+        UINT16_C(0x5B60), UINT16_C(0x6851), UINT16_C(0x3D02), UINT16_C(0x0E33),
+        UINT16_C(0x1654), UINT16_C(0x2565), UINT16_C(0x7036), UINT16_C(0x4307),
+        UINT16_C(0xDA90), UINT16_C(0xE9A1), UINT16_C(0xBCF2), UINT16_C(0x8FC3),
+        UINT16_C(0x9FFD), UINT16_C(0xACCC), UINT16_C(0xF99F), UINT16_C(0xCAAE),
+        UINT16_C(0x5339), UINT16_C(0x6008), UINT16_C(0x355B), UINT16_C(0x066A),
+        UINT16_C(0x1527), UINT16_C(0x2616), UINT16_C(0x7345), UINT16_C(0x4074),
+        UINT16_C(0xD9E3), UINT16_C(0xEAD2), UINT16_C(0xBF81), UINT16_C(0x8CB0),
+        UINT16_C(0x9C8E), UINT16_C(0xAFBF), UINT16_C(0xFAEC), UINT16_C(0xC9DD),
+        UINT16_C(0x504A), UINT16_C(0x637B), UINT16_C(0x3628), UINT16_C(0x0519),
+        UINT16_C(0x10B2), UINT16_C(0x2383), UINT16_C(0x76D0), UINT16_C(0x45E1),
+        UINT16_C(0xDC76), UINT16_C(0xEF47), UINT16_C(0xBA14), UINT16_C(0x8925),
+        UINT16_C(0x991B), UINT16_C(0xAA2A), UINT16_C(0xFF79), UINT16_C(0xCC48),
+        UINT16_C(0x55DF), UINT16_C(0x66EE), UINT16_C(0x33BD), UINT16_C(0x008C),
+        UINT16_C(0x13C1), UINT16_C(0x20F0), UINT16_C(0x75A3), UINT16_C(0x4692),
+        UINT16_C(0xDF05), UINT16_C(0xEC34), UINT16_C(0xB967), UINT16_C(0x8A56),
+        UINT16_C(0x9A68), UINT16_C(0xA959), UINT16_C(0xFC0A), UINT16_C(0xCF3B),
+        UINT16_C(0x56AC), UINT16_C(0x659D), UINT16_C(0x30CE), UINT16_C(0x03FF)
+    },
+    {
+        UINT16_C(0x0000), UINT16_C(0x3730), UINT16_C(0x6E60), UINT16_C(0x5950),
+        UINT16_C(0xDCC0), UINT16_C(0xEBF0), UINT16_C(0xB2A0), UINT16_C(0x8590),
+        UINT16_C(0xA9A1), UINT16_C(0x9E91), UINT16_C(0xC7C1), UINT16_C(0xF0F1),
+        UINT16_C(0x7561), UINT16_C(0x4251), UINT16_C(0x1B01), UINT16_C(0x2C31),
+        UINT16_C(0x4363), UINT16_C(0x7453), UINT16_C(0x2D03), UINT16_C(0x1A33),
+        UINT16_C(0x9FA3), UINT16_C(0xA893), UINT16_C(0xF1C3), UINT16_C(0xC6F3),
+        UINT16_C(0xEAC2), UINT16_C(0xDDF2), UINT16_C(0x84A2), UINT16_C(0xB392),
+        UINT16_C(0x3602), UINT16_C(0x0132), UINT16_C(0x5862), UINT16_C(0x6F52),
+        UINT16_C(0x86C6), UINT16_C(0xB1F6), UINT16_C(0xE8A6), UINT16_C(0xDF96),
+        UINT16_C(0x5A06), UINT16_C(0x6D36), UINT16_C(0x3466), UINT16_C(0x0356),
+        UINT16_C(0x2F67), UINT16_C(0x1857), UINT16_C(0x4107), UINT16_C(0x7637),
+        UINT16_C(0xF3A7), UINT16_C(0xC497), UINT16_C(0x9DC7), UINT16_C(0xAAF7),
+        UINT16_C(0xC5A5), UINT16_C(0xF295), UINT16_C(0xABC5), UINT16_C(0x9CF5),
+        UINT16_C(0x1965), UINT16_C(0x2E55), UINT16_C(0x7705), UINT16_C(0x4035),
+        UINT16_C(0x6C04), UINT16_C(0x5B34), UINT16_C(0x0264), UINT16_C(0x3554),
+        UINT16_C(0xB0C4), UINT16_C(0x87F4), UINT16_C(0xDEA4), UINT16_C(0xE994),
+        UINT16_C(0x1DAD), UINT16_C(0x2A9D), UINT16_C(0x73CD), UINT16_C(0x44FD),
+        UINT16_C(0xC16D), UINT16_C(0xF65D), UINT16_C(0xAF0D), UINT16_C(0x983D),
+        UINT16_C(0xB40C), UINT16_C(0x833C), UINT16_C(0xDA6C), UINT16_C(0xED5C),
+        UINT16_C(0x68CC), UINT16_C(0x5FFC), UINT16_C(0x06AC), UINT16_C(0x319C),
+        UINT16_C(0x5ECE), UINT16_C(0x69FE), UINT16_C(0x30AE), UINT16_C(0x079E),
+        UINT16_C(0x820E), UINT16_C(0xB53E), UINT16_C(0xEC6E), UINT16_C(0xDB5E),
+        UINT16_C(0xF76F), UINT16_C(0xC05F), UINT16_C(0x990F), UINT16_C(0xAE3F),
+        UINT16_C(0x2BAF), UINT16_C(0x1C9F), UINT16_C(0x45CF), UINT16_C(0x72FF),
+        UINT16_C(0x9B6B), UINT16_C(0xAC5B), UINT16_C(0xF50B), UINT16_C(0xC23B),
+        UINT16_C(0x47AB), UINT16_C(0x709B), UINT16_C(0x29CB), UINT16_C(0x1EFB),
+        UINT16_C(0x32CA), UINT16_C(0x05FA), UINT16_C(0x5CAA), UINT16_C(0x6B9A),
+        UINT16_C(0xEE0A), UINT16_C(0xD93A), UINT16_C(0x806A), UINT16_C(0xB75A),
+        UINT16_C(0xD808), UINT16_C(0xEF38), UINT16_C(0xB668), UINT16_C(0x8158),
+        UINT16_C(0x04C8), UINT16_C(0x33F8), UINT16_C(0x6AA8), UINT16_C(0x5D98),
+        UINT16_C(0x71A9), UINT16_C(0x4699), UINT16_C(0x1FC9), UINT16_C(0x28F9),
+        UINT16_C(0xAD69), UINT16_C(0x9A59), UINT16_C(0xC309), UINT16_C(0xF439),
+        UINT16_C(0x3B5A), UINT16_C(0x0C6A), UINT16_C(0x553A), UINT16_C(0x620A),
+        UINT16_C(0xE79A), UINT16_C(0xD0AA), UINT16_C(0x89FA), UINT16_C(0xBECA),
+        UINT16_C(0x92FB), UINT16_C(0xA5CB), UINT16_C(0xFC9B), UINT16_C(0xCBAB),
+        UINT16_C(0x4E3B), UINT16_C(0x790B), UINT16_C(0x205B), UINT16_C(0x176B),
+        UINT16_C(0x7839), UINT16_C(0x4F09), UINT16_C(0x1659), UINT16_C(0x2169),
+        UINT16_C(0xA4F9), UINT16_C(0x93C9), UINT16_C(0xCA99), UINT16_C(0xFDA9),
+        UINT16_C(0xD198), UINT16_C(0xE6A8), UINT16_C(0xBFF8), UINT16_C(0x88C8),
+        UINT16_C(0x0D58), UINT16_C(0x3A68), UINT16_C(0x6338), UINT16_C(0x5408),
+        UINT16_C(0xBD9C), UINT16_C(0x8AAC), UINT16_C(0xD3FC), UINT16_C(0xE4CC),
+        UINT16_C(0x615C), UINT16_C(0x566C), UINT16_C(0x0F3C), UINT16_C(0x380C),
+        UINT16_C(0x143D), UINT16_C(0x230D), UINT16_C(0x7A5D), UINT16_C(0x4D6D),
+        UINT16_C(0xC8FD), UINT16_C(0xFFCD), UINT16_C(0xA69D), UINT16_C(0x91AD),
+        UINT16_C(0xFEFF), UINT16_C(0xC9CF), UINT16_C(0x909F), UINT16_C(0xA7AF),
+        UINT16_C(0x223F), UINT16_C(0x150F), UINT16_C(0x4C5F), UINT16_C(0x7B6F),
+        UINT16_C(0x575E), UINT16_C(0x606E), UINT16_C(0x393E), UINT16_C(0x0E0E),
+        UINT16_C(0x8B9E), UINT16_C(0xBCAE), UINT16_C(0xE5FE), UINT16_C(0xD2CE),
+        UINT16_C(0x26F7), UINT16_C(0x11C7), UINT16_C(0x4897), UINT16_C(0x7FA7),
+        UINT16_C(0xFA37), UINT16_C(0xCD07), UINT16_C(0x9457), UINT16_C(0xA367),
+        UINT16_C(0x8F56), UINT16_C(0xB866), UINT16_C(0xE136), UINT16_C(0xD606),
+        UINT16_C(0x5396), UINT16_C(0x64A6), UINT16_C(0x3DF6), UINT16_C(0x0AC6),
+        UINT16_C(0x6594), UINT16_C(0x52A4), UINT16_C(0x0BF4), UINT16_C(0x3CC4),
+        UINT16_C(0xB954), UINT16_C(0x8E64), UINT16_C(0xD734), UINT16_C(0xE004),
+        UINT16_C(0xCC35), UINT16_C(0xFB05), UINT16_C(0xA255), UINT16_C(0x9565),
+        UINT16_C(0x10F5), UINT16_C(0x27C5), UINT16_C(0x7E95), UINT16_C(0x49A5),
+        UINT16_C(0xA031), UINT16_C(0x9701), UINT16_C(0xCE51), UINT16_C(0xF961),
+        UINT16_C(0x7CF1), UINT16_C(0x4BC1), UINT16_C(0x1291), UINT16_C(0x25A1),
+        UINT16_C(0x0990), UINT16_C(0x3EA0), UINT16_C(0x67F0), UINT16_C(0x50C0),
+        UINT16_C(0xD550), UINT16_C(0xE260), UINT16_C(0xBB30), UINT16_C(0x8C00),
+        UINT16_C(0xE352), UINT16_C(0xD462), UINT16_C(0x8D32), UINT16_C(0xBA02),
+        UINT16_C(0x3F92), UINT16_C(0x08A2), UINT16_C(0x51F2), UINT16_C(0x66C2),
+        UINT16_C(0x4AF3), UINT16_C(0x7DC3), UINT16_C(0x2493), UINT16_C(0x13A3),
+        UINT16_C(0x9633), UINT16_C(0xA103), UINT16_C(0xF853), UINT16_C(0xCF63)
+    },
+    {
+        UINT16_C(0x0000), UINT16_C(0x76B4), UINT16_C(0xED68), UINT16_C(0x9BDC),
+        UINT16_C(0xCAF1), UINT16_C(0xBC45), UINT16_C(0x2799), UINT16_C(0x512D),
+        UINT16_C(0x85C3), UINT16_C(0xF377), UINT16_C(0x68AB), UINT16_C(0x1E1F),
+        UINT16_C(0x4F32), UINT16_C(0x3986), UINT16_C(0xA25A), UINT16_C(0xD4EE),
+        UINT16_C(0x1BA7), UINT16_C(0x6D13), UINT16_C(0xF6CF), UINT16_C(0x807B),
+        UINT16_C(0xD156), UINT16_C(0xA7E2), UINT16_C(0x3C3E), UINT16_C(0x4A8A),
+        UINT16_C(0x9E64), UINT16_C(0xE8D0), UINT16_C(0x730C), UINT16_C(0x05B8),
+        UINT16_C(0x5495), UINT16_C(0x2221), UINT16_C(0xB9FD), UINT16_C(0xCF49),
+        UINT16_C(0x374E), UINT16_C(0x41FA), UINT16_C(0xDA26), UINT16_C(0xAC92),
+        UINT16_C(0xFDBF), UINT16_C(0x8B0B), UINT16_C(0x10D7), UINT16_C(0x6663),
+        UINT16_C(0xB28D), UINT16_C(0xC439), UINT16_C(0x5FE5), UINT16_C(0x2951),
+        UINT16_C(0x787C), UINT16_C(0x0EC8), UINT16_C(0x9514), UINT16_C(0xE3A0),
+        UINT16_C(0x2CE9), UINT16_C(0x5A5D), UINT16_C(0xC181), UINT16_C(0xB735),
+        UINT16_C(0xE618), UINT16_C(0x90AC), UINT16_C(0x0B70), UINT16_C(0x7DC4),
+        UINT16_C(0xA92A), UINT16_C(0xDF9E), UINT16_C(0x4442), UINT16_C(0x32F6),
+        UINT16_C(0x63DB), UINT16_C(0x156F), UINT16_C(0x8EB3), UINT16_C(0xF807),
+        UINT16_C(0x6E9C), UINT16_C(0x1828), UINT16_C(0x83F4), UINT16_C(0xF540),
+        UINT16_C(0xA46D), UINT16_C(0xD2D9), UINT16_C(0x4905), UINT16_C(0x3FB1),
+        UINT16_C(0xEB5F), UINT16_C(0x9DEB), UINT16_C(0x0637), UINT16_C(0x7083),
+        UINT16_C(0x21AE), UINT16_C(0x571A), UINT16_C(0xCCC6), UINT16_C(0xBA72),
+        UINT16_C(0x753B), UINT16_C(0x038F), UINT16_C(0x9853), UINT16_C(0xEEE7),
+        UINT16_C(0xBFCA), UINT16_C(0xC97E), UINT16_C(0x52A2), UINT16_C(0x2416),
+        UINT16_C(0xF0F8), UINT16_C(0x864C), UINT16_C(0x1D90), UINT16_C(0x6B24),
+        UINT16_C(0x3A09), UINT16_C(0x4CBD), UINT16_C(0xD761), UINT16_C(0xA1D5),
+        UINT16_C(0x59D2), UINT16_C(0x2F66), UINT16_C(0xB4BA), UINT16_C(0xC20E),
+        UINT16_C(0x9323), UINT16_C(0xE597), UINT16_C(0x7E4B), UINT16_C(0x08FF),
+        UINT16_C(0xDC11), UINT16_C(0xAAA5), UINT16_C(0x3179), UINT16_C(0x47CD),
+        UINT16_C(0x16E0), UINT16_C(0x6054), UINT16_C(0xFB88), UINT16_C(0x8D3C),
+        UINT16_C(0x4275), UINT16_C(0x34C1), UINT16_C(0xAF1D), UINT16_C(0xD9A9),
+        UINT16_C(0x8884), UINT16_C(0xFE30), UINT16_C(0x65EC), UINT16_C(0x1358),
+        UINT16_C(0xC7B6), UINT16_C(0xB102), UINT16_C(0x2ADE), UINT16_C(0x5C6A),
+        UINT16_C(0x0D47), UINT16_C(0x7BF3), UINT16_C(0xE02F), UINT16_C(0x969B),
+        UINT16_C(0xDD38), UINT16_C(0xAB8C), UINT16_C(0x3050), UINT16_C(0x46E4),
+        UINT16_C(0x17C9), UINT16_C(0x617D), UINT16_C(0xFAA1), UINT16_C(0x8C15),
+        UINT16_C(0x58FB), UINT16_C(0x2E4F), UINT16_C(0xB593), UINT16_C(0xC327),
+        UINT16_C(0x920A), UINT16_C(0xE4BE), UINT16_C(0x7F62), UINT16_C(0x09D6),
+        UINT16_C(0xC69F), UINT16_C(0xB02B), UINT16_C(0x2BF7), UINT16_C(0x5D43),
+        UINT16_C(0x0C6E), UINT16_C(0x7ADA), UINT16_C(0xE106), UINT16_C(0x97B2),
+        UINT16_C(0x435C), UINT16_C(0x35E8), UINT16_C(0xAE34), UINT16_C(0xD880),
+        UINT16_C(0x89AD), UINT16_C(0xFF19), UINT16_C(0x64C5), UINT16_C(0x1271),
+        UINT16_C(0xEA76), UINT16_C(0x9CC2), UINT16_C(0x071E), UINT16_C(0x71AA),
+        UINT16_C(0x2087), UINT16_C(0x5633), UINT16_C(0xCDEF), UINT16_C(0xBB5B),
+        UINT16_C(0x6FB5), UINT16_C(0x1901), UINT16_C(0x82DD), UINT16_C(0xF469),
+        UINT16_C(0xA544), UINT16_C(0xD3F0), UINT16_C(0x482C), UINT16_C(0x3E98),
+        UINT16_C(0xF1D1), UINT16_C(0x8765), UINT16_C(0x1CB9), UINT16_C(0x6A0D),
+        UINT16_C(0x3B20), UINT16_C(0x4D94), UINT16_C(0xD648), UINT16_C(0xA0FC),
+        UINT16_C(0x7412), UINT16_C(0x02A6), UINT16_C(0x997A), UINT16_C(0xEFCE),
+        UINT16_C(0xBEE3), UINT16_C(0xC857), UINT16_C(0x538B), UINT16_C(0x253F),
+        UINT16_C(0xB3A4), UINT16_C(0xC510), UINT16_C(0x5ECC), UINT16_C(0x2878),
+        UINT16_C(0x7955), UINT16_C(0x0FE1), UINT16_C(0x943D), UINT16_C(0xE289),
+        UINT16_C(0x3667), UINT16_C(0x40D3), UINT16_C(0xDB0F), UINT16_C(0xADBB),
+        UINT16_C(0xFC96), UINT16_C(0x8A22), UINT16_C(0x11FE), UINT16_C(0x674A),
+        UINT16_C(0xA803), UINT16_C(0xDEB7), UINT16_C(0x456B), UINT16_C(0x33DF),
+        UINT16_C(0x62F2), UINT16_C(0x1446), UINT16_C(0x8F9A), UINT16_C(0xF92E),
+        UINT16_C(0x2DC0), UINT16_C(0x5B74), UINT16_C(0xC0A8), UINT16_C(0xB61C),
+        UINT16_C(0xE731), UINT16_C(0x9185), UINT16_C(0x0A59), UINT16_C(0x7CED),
+        UINT16_C(0x84EA), UINT16_C(0xF25E), UINT16_C(0x6982), UINT16_C(0x1F36),
+        UINT16_C(0x4E1B), UINT16_C(0x38AF), UINT16_C(0xA373), UINT16_C(0xD5C7),
+        UINT16_C(0x0129), UINT16_C(0x779D), UINT16_C(0xEC41), UINT16_C(0x9AF5),
+        UINT16_C(0xCBD8), UINT16_C(0xBD6C), UINT16_C(0x26B0), UINT16_C(0x5004),
+        UINT16_C(0x9F4D), UINT16_C(0xE9F9), UINT16_C(0x7225), UINT16_C(0x0491),
+        UINT16_C(0x55BC), UINT16_C(0x2308), UINT16_C(0xB8D4), UINT16_C(0xCE60),
+        UINT16_C(0x1A8E), UINT16_C(0x6C3A), UINT16_C(0xF7E6), UINT16_C(0x8152),
+        UINT16_C(0xD07F), UINT16_C(0xA6CB), UINT16_C(0x3D17), UINT16_C(0x4BA3)
+    },
+    {
+        UINT16_C(0x0000), UINT16_C(0xAA51), UINT16_C(0x4483), UINT16_C(0xEED2),
+        UINT16_C(0x8906), UINT16_C(0x2357), UINT16_C(0xCD85), UINT16_C(0x67D4),
+        UINT16_C(0x022D), UINT16_C(0xA87C), UINT16_C(0x46AE), UINT16_C(0xECFF),
+        UINT16_C(0x8B2B), UINT16_C(0x217A), UINT16_C(0xCFA8), UINT16_C(0x65F9),
+        UINT16_C(0x045A), UINT16_C(0xAE0B), UINT16_C(0x40D9), UINT16_C(0xEA88),
+        UINT16_C(0x8D5C), UINT16_C(0x270D), UINT16_C(0xC9DF), UINT16_C(0x638E),
+        UINT16_C(0x0677), UINT16_C(0xAC26), UINT16_C(0x42F4), UINT16_C(0xE8A5),
+        UINT16_C(0x8F71), UINT16_C(0x2520), UINT16_C(0xCBF2), UINT16_C(0x61A3),
+        UINT16_C(0x08B4), UINT16_C(0xA2E5), UINT16_C(0x4C37), UINT16_C(0xE666),
+        UINT16_C(0x81B2), UINT16_C(0x2BE3), UINT16_C(0xC531), UINT16_C(0x6F60),
+        UINT16_C(0x0A99), UINT16_C(0xA0C8), UINT16_C(0x4E1A), UINT16_C(0xE44B),
+        UINT16_C(0x839F), UINT16_C(0x29CE), UINT16_C(0xC71C), UINT16_C(0x6D4D),
+        UINT16_C(0x0CEE), UINT16_C(0xA6BF), UINT16_C(0x486D), UINT16_C(0xE23C),
+        UINT16_C(0x85E8), UINT16_C(0x2FB9), UINT16_C(0xC16B), UINT16_C(0x6B3A),
+        UINT16_C(0x0EC3), UINT16_C(0xA492), UINT16_C(0x4A40), UINT16_C(0xE011),
+        UINT16_C(0x87C5), UINT16_C(0x2D94), UINT16_C(0xC346), UINT16_C(0x6917),
+        UINT16_C(0x1168), UINT16_C(0xBB39), UINT16_C(0x55EB), UINT16_C(0xFFBA),
+        UINT16_C(0x986E), UINT16_C(0x323F), UINT16_C(0xDCED), UINT16_C(0x76BC),
+        UINT16_C(0x1345), UINT16_C(0xB914), UINT16_C(0x57C6), UINT16_C(0xFD97),
+        UINT16_C(0x9A43), UINT16_C(0x3012), UINT16_C(0xDEC0), UINT16_C(0x7491),
+        UINT16_C(0x1532), UINT16_C(0xBF63), UINT16_C(0x51B1), UINT16_C(0xFBE0),
+        UINT16_C(0x9C34), UINT16_C(0x3665), UINT16_C(0xD8B7), UINT16_C(0x72E6),
+        UINT16_C(0x171F), UINT16_C(0xBD4E), UINT16_C(0x539C), UINT16_C(0xF9CD),
+        UINT16_C(0x9E19), UINT16_C(0x3448), UINT16_C(0xDA9A), UINT16_C(0x70CB),
+        UINT16_C(0x19DC), UINT16_C(0xB38D), UINT16_C(0x5D5F), UINT16_C(0xF70E),
+        UINT16_C(0x90DA), UINT16_C(0x3A8B), UINT16_C(0xD459), UINT16_C(0x7E08),
+        UINT16_C(0x1BF1), UINT16_C(0xB1A0), UINT16_C(0x5F72), UINT16_C(0xF523),
+        UINT16_C(0x92F7), UINT16_C(0x38A6), UINT16_C(0xD674), UINT16_C(0x7C25),
+        UINT16_C(0x1D86), UINT16_C(0xB7D7), UINT16_C(0x5905), UINT16_C(0xF354),
+        UINT16_C(0x9480), UINT16_C(0x3ED1), UINT16_C(0xD003), UINT16_C(0x7A52),
+        UINT16_C(0x1FAB), UINT16_C(0xB5FA), UINT16_C(0x5B28), UINT16_C(0xF179),
+        UINT16_C(0x96AD), UINT16_C(0x3CFC), UINT16_C(0xD22E), UINT16_C(0x787F),
+        UINT16_C(0x22D0), UINT16_C(0x8881), UINT16_C(0x6653), UINT16_C(0xCC02),
+        UINT16_C(0xABD6), UINT16_C(0x0187), UINT16_C(0xEF55), UINT16_C(0x4504),
+        UINT16_C(0x20FD), UINT16_C(0x8AAC), UINT16_C(0x647E), UINT16_C(0xCE2F),
+        UINT16_C(0xA9FB), UINT16_C(0x03AA), UINT16_C(0xED78), UINT16_C(0x4729),
+        UINT16_C(0x268A), UINT16_C(0x8CDB), UINT16_C(0x6209), UINT16_C(0xC858),
+        UINT16_C(0xAF8C), UINT16_C(0x05DD), UINT16_C(0xEB0F), UINT16_C(0x415E),
+        UINT16_C(0x24A7), UINT16_C(0x8EF6), UINT16_C(0x6024), UINT16_C(0xCA75),
+        UINT16_C(0xADA1), UINT16_C(0x07F0), UINT16_C(0xE922), UINT16_C(0x4373),
+        UINT16_C(0x2A64), UINT16_C(0x8035), UINT16_C(0x6EE7), UINT16_C(0xC4B6),
+        UINT16_C(0xA362), UINT16_C(0x0933), UINT16_C(0xE7E1), UINT16_C(0x4DB0),
+        UINT16_C(0x2849), UINT16_C(0x8218), UINT16_C(0x6CCA), UINT16_C(0xC69B),
+        UINT16_C(0xA14F), UINT16_C(0x0B1E), UINT16_C(0xE5CC), UINT16_C(0x4F9D),
+        UINT16_C(0x2E3E), UINT16_C(0x846F), UINT16_C(0x6ABD), UINT16_C(0xC0EC),
+        UINT16_C(0xA738), UINT16_C(0x0D69), UINT16_C(0xE3BB), UINT16_C(0x49EA),
+        UINT16_C(0x2C13), UINT16_C(0x8642), UINT16_C(0x6890), UINT16_C(0xC2C1),
+        UINT16_C(0xA515), UINT16_C(0x0F44), UINT16_C(0xE196), UINT16_C(0x4BC7),
+        UINT16_C(0x33B8), UINT16_C(0x99E9), UINT16_C(0x773B), UINT16_C(0xDD6A),
+        UINT16_C(0xBABE), UINT16_C(0x10EF), UINT16_C(0xFE3D), UINT16_C(0x546C),
+        UINT16_C(0x3195), UINT16_C(0x9BC4), UINT16_C(0x7516), UINT16_C(0xDF47),
+        UINT16_C(0xB893), UINT16_C(0x12C2), UINT16_C(0xFC10), UINT16_C(0x5641),
+        UINT16_C(0x37E2), UINT16_C(0x9DB3), UINT16_C(0x7361), UINT16_C(0xD930),
+        UINT16_C(0xBEE4), UINT16_C(0x14B5), UINT16_C(0xFA67), UINT16_C(0x5036),
+        UINT16_C(0x35CF), UINT16_C(0x9F9E), UINT16_C(0x714C), UINT16_C(0xDB1D),
+        UINT16_C(0xBCC9), UINT16_C(0x1698), UINT16_C(0xF84A), UINT16_C(0x521B),
+        UINT16_C(0x3B0C), UINT16_C(0x915D), UINT16_C(0x7F8F), UINT16_C(0xD5DE),
+        UINT16_C(0xB20A), UINT16_C(0x185B), UINT16_C(0xF689), UINT16_C(0x5CD8),
+        UINT16_C(0x3921), UINT16_C(0x9370), UINT16_C(0x7DA2), UINT16_C(0xD7F3),
+        UINT16_C(0xB027), UINT16_C(0x1A76), UINT16_C(0xF4A4), UINT16_C(0x5EF5),
+        UINT16_C(0x3F56), UINT16_C(0x9507), UINT16_C(0x7BD5), UINT16_C(0xD184),
+        UINT16_C(0xB650), UINT16_C(0x1C01), UINT16_C(0xF2D3), UINT16_C(0x5882),
+        UINT16_C(0x3D7B), UINT16_C(0x972A), UINT16_C(0x79F8), UINT16_C(0xD3A9),
+        UINT16_C(0xB47D), UINT16_C(0x1E2C), UINT16_C(0xF0FE), UINT16_C(0x5AAF)
+    },
+    {
+        UINT16_C(0x0000), UINT16_C(0x45A0), UINT16_C(0x8B40), UINT16_C(0xCEE0),
+        UINT16_C(0x06A1), UINT16_C(0x4301), UINT16_C(0x8DE1), UINT16_C(0xC841),
+        UINT16_C(0x0D42), UINT16_C(0x48E2), UINT16_C(0x8602), UINT16_C(0xC3A2),
+        UINT16_C(0x0BE3), UINT16_C(0x4E43), UINT16_C(0x80A3), UINT16_C(0xC503),
+        UINT16_C(0x1A84), UINT16_C(0x5F24), UINT16_C(0x91C4), UINT16_C(0xD464),
+        UINT16_C(0x1C25), UINT16_C(0x5985), UINT16_C(0x9765), UINT16_C(0xD2C5),
+        UINT16_C(0x17C6), UINT16_C(0x5266), UINT16_C(0x9C86), UINT16_C(0xD926),
+        UINT16_C(0x1167), UINT16_C(0x54C7), UINT16_C(0x9A27), UINT16_C(0xDF87),
+        UINT16_C(0x3508), UINT16_C(0x70A8), UINT16_C(0xBE48), UINT16_C(0xFBE8),
+        UINT16_C(0x33A9), UINT16_C(0x7609), UINT16_C(0xB8E9), UINT16_C(0xFD49),
+        UINT16_C(0x384A), UINT16_C(0x7DEA), UINT16_C(0xB30A), UINT16_C(0xF6AA),
+        UINT16_C(0x3EEB), UINT16_C(0x7B4B), UINT16_C(0xB5AB), UINT16_C(0xF00B),
+        UINT16_C(0x2F8C), UINT16_C(0x6A2C), UINT16_C(0xA4CC), UINT16_C(0xE16C),
+        UINT16_C(0x292D), UINT16_C(0x6C8D), UINT16_C(0xA26D), UINT16_C(0xE7CD),
+        UINT16_C(0x22CE), UINT16_C(0x676E), UINT16_C(0xA98E), UINT16_C(0xEC2E),
+        UINT16_C(0x246F), UINT16_C(0x61CF), UINT16_C(0xAF2F), UINT16_C(0xEA8F),
+        UINT16_C(0x6A10), UINT16_C(0x2FB0), UINT16_C(0xE150), UINT16_C(0xA4F0),
+        UINT16_C(0x6CB1), UINT16_C(0x2911), UINT16_C(0xE7F1), UINT16_C(0xA251),
+        UINT16_C(0x6752), UINT16_C(0x22F2), UINT16_C(0xEC12), UINT16_C(0xA9B2),
+        UINT16_C(0x61F3), UINT16_C(0x2453), UINT16_C(0xEAB3), UINT16_C(0xAF13),
+        UINT16_C(0x7094), UINT16_C(0x3534), UINT16_C(0xFBD4), UINT16_C(0xBE74),
+        UINT16_C(0x7635), UINT16_C(0x3395), UINT16_C(0xFD75), UINT16_C(0xB8D5),
+        UINT16_C(0x7DD6), UINT16_C(0x3876), UINT16_C(0xF696), UINT16_C(0xB336),
+        UINT16_C(0x7B77), UINT16_C(0x3ED7), UINT16_C(0xF037), UINT16_C(0xB597),
+        UINT16_C(0x5F18), UINT16_C(0x1AB8), UINT16_C(0xD458), UINT16_C(0x91F8),
+        UINT16_C(0x59B9), UINT16_C(0x1C19), UINT16_C(0xD2F9), UINT16_C(0x9759),
+        UINT16_C(0x525A), UINT16_C(0x17FA), UINT16_C(0xD91A), UINT16_C(0x9CBA),
+        UINT16_C(0x54FB), UINT16_C(0x115B), UINT16_C(0xDFBB), UINT16_C(0x9A1B),
+        UINT16_C(0x459C), UINT16_C(0x003C), UINT16_C(0xCEDC), UINT16_C(0x8B7C),
+        UINT16_C(0x433D), UINT16_C(0x069D), UINT16_C(0xC87D), UINT16_C(0x8DDD),
+        UINT16_C(0x48DE), UINT16_C(0x0D7E), UINT16_C(0xC39E), UINT16_C(0x863E),
+        UINT16_C(0x4E7F), UINT16_C(0x0BDF), UINT16_C(0xC53F), UINT16_C(0x809F),
+        UINT16_C(0xD420), UINT16_C(0x9180), UINT16_C(0x5F60), UINT16_C(0x1AC0),
+        UINT16_C(0xD281), UINT16_C(0x9721), UINT16_C(0x59C1), UINT16_C(0x1C61),
+        UINT16_C(0xD962), UINT16_C(0x9CC2), UINT16_C(0x5222), UINT16_C(0x1782),
+        UINT16_C(0xDFC3), UINT16_C(0x9A63), UINT16_C(0x5483), UINT16_C(0x1123),
+        UINT16_C(0xCEA4), UINT16_C(0x8B04), UINT16_C(0x45E4), UINT16_C(0x0044),
+        UINT16_C(0xC805), UINT16_C(0x8DA5), UINT16_C(0x4345), UINT16_C(0x06E5),
+        UINT16_C(0xC3E6), UINT16_C(0x8646), UINT16_C(0x48A6), UINT16_C(0x0D06),
+        UINT16_C(0xC547), UINT16_C(0x80E7), UINT16_C(0x4E07), UINT16_C(0x0BA7),
+        UINT16_C(0xE128), UINT16_C(0xA488), UINT16_C(0x6A68), UINT16_C(0x2FC8),
+        UINT16_C(0xE789), UINT16_C(0xA229), UINT16_C(0x6CC9), UINT16_C(0x2969),
+        UINT16_C(0xEC6A), UINT16_C(0xA9CA), UINT16_C(0x672A), UINT16_C(0x228A),
+        UINT16_C(0xEACB), UINT16_C(0xAF6B), UINT16_C(0x618B), UINT16_C(0x242B),
+        UINT16_C(0xFBAC), UINT16_C(0xBE0C), UINT16_C(0x70EC), UINT16_C(0x354C),
+        UINT16_C(0xFD0D), UINT16_C(0xB8AD), UINT16_C(0x764D), UINT16_C(0x33ED),
+        UINT16_C(0xF6EE), UINT16_C(0xB34E), UINT16_C(0x7DAE), UINT16_C(0x380E),
+        UINT16_C(0xF04F), UINT16_C(0xB5EF), UINT16_C(0x7B0F), UINT16_C(0x3EAF),
+        UINT16_C(0xBE30), UINT16_C(0xFB90), UINT16_C(0x3570), UINT16_C(0x70D0),
+        UINT16_C(0xB891), UINT16_C(0xFD31), UINT16_C(0x33D1), UINT16_C(0x7671),
+        UINT16_C(0xB372), UINT16_C(0xF6D2), UINT16_C(0x3832), UINT16_C(0x7D92),
+        UINT16_C(0xB5D3), UINT16_C(0xF073), UINT16_C(0x3E93), UINT16_C(0x7B33),
+        UINT16_C(0xA4B4), UINT16_C(0xE114), UINT16_C(0x2FF4), UINT16_C(0x6A54),
+        UINT16_C(0xA215), UINT16_C(0xE7B5), UINT16_C(0x2955), UINT16_C(0x6CF5),
+        UINT16_C(0xA9F6), UINT16_C(0xEC56), UINT16_C(0x22B6), UINT16_C(0x6716),
+        UINT16_C(0xAF57), UINT16_C(0xEAF7), UINT16_C(0x2417), UINT16_C(0x61B7),
+        UINT16_C(0x8B38), UINT16_C(0xCE98), UINT16_C(0x0078), UINT16_C(0x45D8),
+        UINT16_C(0x8D99), UINT16_C(0xC839), UINT16_C(0x06D9), UINT16_C(0x4379),
+        UINT16_C(0x867A), UINT16_C(0xC3DA), UINT16_C(0x0D3A), UINT16_C(0x489A),
+        UINT16_C(0x80DB), UINT16_C(0xC57B), UINT16_C(0x0B9B), UINT16_C(0x4E3B),
+        UINT16_C(0x91BC), UINT16_C(0xD41C), UINT16_C(0x1AFC), UINT16_C(0x5F5C),
+        UINT16_C(0x971D), UINT16_C(0xD2BD), UINT16_C(0x1C5D), UINT16_C(0x59FD),
+        UINT16_C(0x9CFE), UINT16_C(0xD95E), UINT16_C(0x17BE), UINT16_C(0x521E),
+        UINT16_C(0x9A5F), UINT16_C(0xDFFF), UINT16_C(0x111F), UINT16_C(0x54BF)
+    },
+    {
+        UINT16_C(0x0000), UINT16_C(0xB861), UINT16_C(0x60E3), UINT16_C(0xD882),
+        UINT16_C(0xC1C6), UINT16_C(0x79A7), UINT16_C(0xA125), UINT16_C(0x1944),
+        UINT16_C(0x93AD), UINT16_C(0x2BCC), UINT16_C(0xF34E), UINT16_C(0x4B2F),
+        UINT16_C(0x526B), UINT16_C(0xEA0A), UINT16_C(0x3288), UINT16_C(0x8AE9),
+        UINT16_C(0x377B), UINT16_C(0x8F1A), UINT16_C(0x5798), UINT16_C(0xEFF9),
+        UINT16_C(0xF6BD), UINT16_C(0x4EDC), UINT16_C(0x965E), UINT16_C(0x2E3F),
+        UINT16_C(0xA4D6), UINT16_C(0x1CB7), UINT16_C(0xC435), UINT16_C(0x7C54),
+        UINT16_C(0x6510), UINT16_C(0xDD71), UINT16_C(0x05F3), UINT16_C(0xBD92),
+        UINT16_C(0x6EF6), UINT16_C(0xD697), UINT16_C(0x0E15), UINT16_C(0xB674),
+        UINT16_C(0xAF30), UINT16_C(0x1751), UINT16_C(0xCFD3), UINT16_C(0x77B2),
+        UINT16_C(0xFD5B), UINT16_C(0x453A), UINT16_C(0x9DB8), UINT16_C(0x25D9),
+        UINT16_C(0x3C9D), UINT16_C(0x84FC), UINT16_C(0x5C7E), UINT16_C(0xE41F),
+        UINT16_C(0x598D), UINT16_C(0xE1EC), UINT16_C(0x396E), UINT16_C(0x810F),
+        UINT16_C(0x984B), UINT16_C(0x202A), UINT16_C(0xF8A8), UINT16_C(0x40C9),
+        UINT16_C(0xCA20), UINT16_C(0x7241), UINT16_C(0xAAC3), UINT16_C(0x12A2),
+        UINT16_C(0x0BE6), UINT16_C(0xB387), UINT16_C(0x6B05), UINT16_C(0xD364),
+        UINT16_C(0xDDEC), UINT16_C(0x658D), UINT16_C(0xBD0F), UINT16_C(0x056E),
+        UINT16_C(0x1C2A), UINT16_C(0xA44B), UINT16_C(0x7CC9), UINT16_C(0xC4A8),
+        UINT16_C(0x4E41), UINT16_C(0xF620), UINT16_C(0x2EA2), UINT16_C(0x96C3),
+        UINT16_C(0x8F87), UINT16_C(0x37E6), UINT16_C(0xEF64), UINT16_C(0x5705),
+        UINT16_C(0xEA97), UINT16_C(0x52F6), UINT16_C(0x8A74), UINT16_C(0x3215),
+        UINT16_C(0x2B51), UINT16_C(0x9330), UINT16_C(0x4BB2), UINT16_C(0xF3D3),
+        UINT16_C(0x793A), UINT16_C(0xC15B), UINT16_C(0x19D9), UINT16_C(0xA1B8),
+        UINT16_C(0xB8FC), UINT16_C(0x009D), UINT16_C(0xD81F), UINT16_C(0x607E),
+        UINT16_C(0xB31A), UINT16_C(0x0B7B), UINT16_C(0xD3F9), UINT16_C(0x6B98),
+        UINT16_C(0x72DC), UINT16_C(0xCABD), UINT16_C(0x123F), UINT16_C(0xAA5E),
+        UINT16_C(0x20B7), UINT16_C(0x98D6), UINT16_C(0x4054), UINT16_C(0xF835),
+        UINT16_C(0xE171), UINT16_C(0x5910), UINT16_C(0x8192), UINT16_C(0x39F3),
+        UINT16_C(0x8461), UINT16_C(0x3C00), UINT16_C(0xE482), UINT16_C(0x5CE3),
+        UINT16_C(0x45A7), UINT16_C(0xFDC6), UINT16_C(0x2544), UINT16_C(0x9D25),
+        UINT16_C(0x17CC), UINT16_C(0xAFAD), UINT16_C(0x772F), UINT16_C(0xCF4E),
+        UINT16_C(0xD60A), UINT16_C(0x6E6B), UINT16_C(0xB6E9), UINT16_C(0x0E88),
+        UINT16_C(0xABF9), UINT16_C(0x1398), UINT16_C(0xCB1A), UINT16_C(0x737B),
+        UINT16_C(0x6A3F), UINT16_C(0xD25E), UINT16_C(0x0ADC), UINT16_C(0xB2BD),
+        UINT16_C(0x3854), UINT16_C(0x8035), UINT16_C(0x58B7), UINT16_C(0xE0D6),
+        UINT16_C(0xF992), UINT16_C(0x41F3), UINT16_C(0x9971), UINT16_C(0x2110),
+        UINT16_C(0x9C82), UINT16_C(0x24E3), UINT16_C(0xFC61), UINT16_C(0x4400),
+        UINT16_C(0x5D44), UINT16_C(0xE525), UINT16_C(0x3DA7), UINT16_C(0x85C6),
+        UINT16_C(0x0F2F), UINT16_C(0xB74E), UINT16_C(0x6FCC), UINT16_C(0xD7AD),
+        UINT16_C(0xCEE9), UINT16_C(0x7688), UINT16_C(0xAE0A), UINT16_C(0x166B),
+        UINT16_C(0xC50F), UINT16_C(0x7D6E), UINT16_C(0xA5EC), UINT16_C(0x1D8D),
+        UINT16_C(0x04C9), UINT16_C(0xBCA8), UINT16_C(0x642A), UINT16_C(0xDC4B),
+        UINT16_C(0x56A2), UINT16_C(0xEEC3), UINT16_C(0x3641), UINT16_C(0x8E20),
+        UINT16_C(0x9764), UINT16_C(0x2F05), UINT16_C(0xF787), UINT16_C(0x4FE6),
+        UINT16_C(0xF274), UINT16_C(0x4A15), UINT16_C(0x9297), UINT16_C(0x2AF6),
+        UINT16_C(0x33B2), UINT16_C(0x8BD3), UINT16_C(0x5351), UINT16_C(0xEB30),
+        UINT16_C(0x61D9), UINT16_C(0xD9B8), UINT16_C(0x013A), UINT16_C(0xB95B),
+        UINT16_C(0xA01F), UINT16_C(0x187E), UINT16_C(0xC0FC), UINT16_C(0x789D),
+        UINT16_C(0x7615), UINT16_C(0xCE74), UINT16_C(0x16F6), UINT16_C(0xAE97),
+        UINT16_C(0xB7D3), UINT16_C(0x0FB2), UINT16_C(0xD730), UINT16_C(0x6F51),
+        UINT16_C(0xE5B8), UINT16_C(0x5DD9), UINT16_C(0x855B), UINT16_C(0x3D3A),
+        UINT16_C(0x247E), UINT16_C(0x9C1F), UINT16_C(0x449D), UINT16_C(0xFCFC),
+        UINT16_C(0x416E), UINT16_C(0xF90F), UINT16_C(0x218D), UINT16_C(0x99EC),
+        UINT16_C(0x80A8), UINT16_C(0x38C9), UINT16_C(0xE04B), UINT16_C(0x582A),
+        UINT16_C(0xD2C3), UINT16_C(0x6AA2), UINT16_C(0xB220), UINT16_C(0x0A41),
+        UINT16_C(0x1305), UINT16_C(0xAB64), UINT16_C(0x73E6), UINT16_C(0xCB87),
+        UINT16_C(0x18E3), UINT16_C(0xA082), UINT16_C(0x7800), UINT16_C(0xC061),
+        UINT16_C(0xD925), UINT16_C(0x6144), UINT16_C(0xB9C6), UINT16_C(0x01A7),
+        UINT16_C(0x8B4E), UINT16_C(0x332F), UINT16_C(0xEBAD), UINT16_C(0x53CC),
+        UINT16_C(0x4A88), UINT16_C(0xF2E9), UINT16_C(0x2A6B), UINT16_C(0x920A),
+        UINT16_C(0x2F98), UINT16_C(0x97F9), UINT16_C(0x4F7B), UINT16_C(0xF71A),
+        UINT16_C(0xEE5E), UINT16_C(0x563F), UINT16_C(0x8EBD), UINT16_C(0x36DC),
+        UINT16_C(0xBC35), UINT16_C(0x0454), UINT16_C(0xDCD6), UINT16_C(0x64B7),
+        UINT16_C(0x7DF3), UINT16_C(0xC592), UINT16_C(0x1D10), UINT16_C(0xA571)
+    },
+    {
+        UINT16_C(0x0000), UINT16_C(0x47D3), UINT16_C(0x8FA6), UINT16_C(0xC875),
+        UINT16_C(0x0F6D), UINT16_C(0x48BE), UINT16_C(0x80CB), UINT16_C(0xC718),
+        UINT16_C(0x1EDA), UINT16_C(0x5909), UINT16_C(0x917C), UINT16_C(0xD6AF),
+        UINT16_C(0x11B7), UINT16_C(0x5664), UINT16_C(0x9E11), UINT16_C(0xD9C2),
+        UINT16_C(0x3DB4), UINT16_C(0x7A67), UINT16_C(0xB212), UINT16_C(0xF5C1),
+        UINT16_C(0x32D9), UINT16_C(0x750A), UINT16_C(0xBD7F), UINT16_C(0xFAAC),
+        UINT16_C(0x236E), UINT16_C(0x64BD), UINT16_C(0xACC8), UINT16_C(0xEB1B),
+        UINT16_C(0x2C03), UINT16_C(0x6BD0), UINT16_C(0xA3A5), UINT16_C(0xE476),
+        UINT16_C(0x7B68), UINT16_C(0x3CBB), UINT16_C(0xF4CE), UINT16_C(0xB31D),
+        UINT16_C(0x7405), UINT16_C(0x33D6), UINT16_C(0xFBA3), UINT16_C(0xBC70),
+        UINT16_C(0x65B2), UINT16_C(0x2261), UINT16_C(0xEA14), UINT16_C(0xADC7),
+        UINT16_C(0x6ADF), UINT16_C(0x2D0C), UINT16_C(0xE579), UINT16_C(0xA2AA),
+        UINT16_C(0x46DC), UINT16_C(0x010F), UINT16_C(0xC97A), UINT16_C(0x8EA9),
+        UINT16_C(0x49B1), UINT16_C(0x0E62), UINT16_C(0xC617), UINT16_C(0x81C4),
+        UINT16_C(0x5806), UINT16_C(0x1FD5), UINT16_C(0xD7A0), UINT16_C(0x9073),
+        UINT16_C(0x576B), UINT16_C(0x10B8), UINT16_C(0xD8CD), UINT16_C(0x9F1E),
+        UINT16_C(0xF6D0), UINT16_C(0xB103), UINT16_C(0x7976), UINT16_C(0x3EA5),
+        UINT16_C(0xF9BD), UINT16_C(0xBE6E), UINT16_C(0x761B), UINT16_C(0x31C8),
+        UINT16_C(0xE80A), UINT16_C(0xAFD9), UINT16_C(0x67AC), UINT16_C(0x207F),
+        UINT16_C(0xE767), UINT16_C(0xA0B4), UINT16_C(0x68C1), UINT16_C(0x2F12),
+        UINT16_C(0xCB64), UINT16_C(0x8CB7), UINT16_C(0x44C2), UINT16_C(0x0311),
+        UINT16_C(0xC409), UINT16_C(0x83DA), UINT16_C(0x4BAF), UINT16_C(0x0C7C),
+        UINT16_C(0xD5BE), UINT16_C(0x926D), UINT16_C(0x5A18), UINT16_C(0x1DCB),
+        UINT16_C(0xDAD3), UINT16_C(0x9D00), UINT16_C(0x5575), UINT16_C(0x12A6),
+        UINT16_C(0x8DB8), UINT16_C(0xCA6B), UINT16_C(0x021E), UINT16_C(0x45CD),
+        UINT16_C(0x82D5), UINT16_C(0xC506), UINT16_C(0x0D73), UINT16_C(0x4AA0),
+        UINT16_C(0x9362), UINT16_C(0xD4B1), UINT16_C(0x1CC4), UINT16_C(0x5B17),
+        UINT16_C(0x9C0F), UINT16_C(0xDBDC), UINT16_C(0x13A9), UINT16_C(0x547A),
+        UINT16_C(0xB00C), UINT16_C(0xF7DF), UINT16_C(0x3FAA), UINT16_C(0x7879),
+        UINT16_C(0xBF61), UINT16_C(0xF8B2), UINT16_C(0x30C7), UINT16_C(0x7714),
+        UINT16_C(0xAED6), UINT16_C(0xE905), UINT16_C(0x2170), UINT16_C(0x66A3),
+        UINT16_C(0xA1BB), UINT16_C(0xE668), UINT16_C(0x2E1D), UINT16_C(0x69CE),
+        UINT16_C(0xFD81), UINT16_C(0xBA52), UINT16_C(0x7227), UINT16_C(0x35F4),
+        UINT16_C(0xF2EC), UINT16_C(0xB53F), UINT16_C(0x7D4A), UINT16_C(0x3A99),
+        UINT16_C(0xE35B), UINT16_C(0xA488), UINT16_C(0x6CFD), UINT16_C(0x2B2E),
+        UINT16_C(0xEC36), UINT16_C(0xABE5), UINT16_C(0x6390), UINT16_C(0x2443),
+        UINT16_C(0xC035), UINT16_C(0x87E6), UINT16_C(0x4F93), UINT16_C(0x0840),
+        UINT16_C(0xCF58), UINT16_C(0x888B), UINT16_C(0x40FE), UINT16_C(0x072D),
+        UINT16_C(0xDEEF), UINT16_C(0x993C), UINT16_C(0x5149), UINT16_C(0x169A),
+        UINT16_C(0xD182), UINT16_C(0x9651), UINT16_C(0x5E24), UINT16_C(0x19F7),
+        UINT16_C(0x86E9), UINT16_C(0xC13A), UINT16_C(0x094F), UINT16_C(0x4E9C),
+        UINT16_C(0x8984), UINT16_C(0xCE57), UINT16_C(0x0622), UINT16_C(0x41F1),
+        UINT16_C(0x9833), UINT16_C(0xDFE0), UINT16_C(0x1795), UINT16_C(0x5046),
+        UINT16_C(0x975E), UINT16_C(0xD08D), UINT16_C(0x18F8), UINT16_C(0x5F2B),
+        UINT16_C(0xBB5D), UINT16_C(0xFC8E), UINT16_C(0x34FB), UINT16_C(0x7328),
+        UINT16_C(0xB430), UINT16_C(0xF3E3), UINT16_C(0x3B96), UINT16_C(0x7C45),
+        UINT16_C(0xA587), UINT16_C(0xE254), UINT16_C(0x2A21), UINT16_C(0x6DF2),
+        UINT16_C(0xAAEA), UINT16_C(0xED39), UINT16_C(0x254C), UINT16_C(0x629F),
+        UINT16_C(0x0B51), UINT16_C(0x4C82), UINT16_C(0x84F7), UINT16_C(0xC324),
+        UINT16_C(0x043C), UINT16_C(0x43EF), UINT16_C(0x8B9A), UINT16_C(0xCC49),
+        UINT16_C(0x158B), UINT16_C(0x5258), UINT16_C(0x9A2D), UINT16_C(0xDDFE),
+        UINT16_C(0x1AE6), UINT16_C(0x5D35), UINT16_C(0x9540), UINT16_C(0xD293),
+        UINT16_C(0x36E5), UINT16_C(0x7136), UINT16_C(0xB943), UINT16_C(0xFE90),
+        UINT16_C(0x3988), UINT16_C(0x7E5B), UINT16_C(0xB62E), UINT16_C(0xF1FD),
+        UINT16_C(0x283F), UINT16_C(0x6FEC), UINT16_C(0xA799), UINT16_C(0xE04A),
+        UINT16_C(0x2752), UINT16_C(0x6081), UINT16_C(0xA8F4), UINT16_C(0xEF27),
+        UINT16_C(0x7039), UINT16_C(0x37EA), UINT16_C(0xFF9F), UINT16_C(0xB84C),
+        UINT16_C(0x7F54), UINT16_C(0x3887), UINT16_C(0xF0F2), UINT16_C(0xB721),
+        UINT16_C(0x6EE3), UINT16_C(0x2930), UINT16_C(0xE145), UINT16_C(0xA696),
+        UINT16_C(0x618E), UINT16_C(0x265D), UINT16_C(0xEE28), UINT16_C(0xA9FB),
+        UINT16_C(0x4D8D), UINT16_C(0x0A5E), UINT16_C(0xC22B), UINT16_C(0x85F8),
+        UINT16_C(0x42E0), UINT16_C(0x0533), UINT16_C(0xCD46), UINT16_C(0x8A95),
+        UINT16_C(0x5357), UINT16_C(0x1484), UINT16_C(0xDCF1), UINT16_C(0x9B22),
+        UINT16_C(0x5C3A), UINT16_C(0x1BE9), UINT16_C(0xD39C), UINT16_C(0x944F)
+    }};
+
+uint16_t _CRC16_CCITT_Update(uint16_t crc, uint8_t byte) {
+  return (uint16_t)((crc << 8) ^ _CRC16_CCITT_Table[0][(crc >> 8) ^ byte]);
+}
+
+uint16_t _CRC16_CCITT_Sequence_update(uint16_t crc,
+                                      const void* bytes,
+                                      size_t size_in_bytes) {
+  const uint8_t* in = bytes;
+
+  /* Process eight bytes per iteration */
+  while (size_in_bytes >= 8) {
+    uint32_t x = crc ^ (((uint32_t)in[0] << 8) | in[1]);
+
+    crc = _CRC16_CCITT_Table[7][x >> 8] ^ _CRC16_CCITT_Table[6][x & 0xff] ^
+          _CRC16_CCITT_Table[5][in[2]] ^ _CRC16_CCITT_Table[4][in[3]] ^
+          _CRC16_CCITT_Table[3][in[4]] ^ _CRC16_CCITT_Table[2][in[5]] ^
+          _CRC16_CCITT_Table[1][in[6]] ^ _CRC16_CCITT_Table[0][in[7]];
+    in += 8;
+    size_in_bytes -= 8;
+  }
+
+  while (size_in_bytes > 0) {
+    crc = (uint16_t)((crc << 8) ^ _CRC16_CCITT_Table[0][(crc >> 8) ^ *in]);
+    ++in;
+    --size_in_bytes;
+  }
+
+  return crc;
+}
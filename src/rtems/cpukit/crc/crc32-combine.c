@@ -0,0 +1,97 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSImplCRC
+ *
+ * @brief This source file contains the implementation of
+ *   _CRC32_Combine() and _CRC32C_Combine().
+ */
+
+/*
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <rtems/crc.h>
+
+#include <stdbool.h>
+
+/*
+ * The polynomials are represented in the reflected bit order.  The most
+ * significant bit corresponds to x^0.
+ */
+
+#define CRC_X0 UINT32_C(0x80000000)
+
+static uint32_t _CRC_Multiply_modulo(uint32_t a, uint32_t b, uint32_t poly) {
+  uint32_t m = CRC_X0;
+  uint32_t p = 0;
+
+  while (true) {
+    if ((a & m) != 0) {
+      p ^= b;
+
+      if ((a & (m - 1)) == 0) {
+        break;
+      }
+    }
+
+    m >>= 1;
+    b = (b & 1) != 0 ? (b >> 1) ^ poly : b >> 1;
+  }
+
+  return p;
+}
+
+static uint32_t _CRC_Shift(uint32_t crc, size_t size_in_bytes, uint32_t poly) {
+  /* This is x^8 which corresponds to one byte */
+  uint32_t x2n = CRC_X0 >> 8;
+
+  /*
+   * Multiply the CRC by x^(8 * size_in_bytes) modulo the polynomial using the
+   * binary representation of the size and repeated squaring.
+   */
+  while (size_in_bytes != 0) {
+    if ((size_in_bytes & 1) != 0) {
+      crc = _CRC_Multiply_modulo(x2n, crc, poly);
+    }
+
+    size_in_bytes >>= 1;
+
+    if (size_in_bytes != 0) {
+      x2n = _CRC_Multiply_modulo(x2n, x2n, poly);
+    }
+  }
+
+  return crc;
+}
+
+uint32_t _CRC32_Combine(uint32_t crc_a, uint32_t crc_b, size_t size_b) {
+  return _CRC_Shift(crc_a, size_b, UINT32_C(0xedb88320)) ^ crc_b;
+}
+
+uint32_t _CRC32C_Combine(uint32_t crc_a, uint32_t crc_b, size_t size_b) {
+  return _CRC_Shift(crc_a, size_b, UINT32_C(0x82f63b78)) ^ crc_b;
+}
@@ -0,0 +1,785 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSImplCRC
+ *
+ * @brief This source file contains the implementation of
+ *   _CRC32_Update() and _CRC32_Sequence_update().
+ *
+ * The CRC-32 cyclic redundancy checksum is used for example by Ethernet,
+ * zlib, PNG, and JFFS2.
+ */
+
+/*
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <rtems/crc.h>
+
+/*
+ * The first table is the byte-wise table of the reflected polynomial
+ * 0xedb88320.  The other tables are derived by
+ * T[k][i] = (T[k - 1][i] >> 8) ^ T[0][T[k - 1][i] & 0xff] and are used to
+ * process eight bytes at once.
+ */
+static const uint32_t _CRC32_Table[8][256] = {
+    {
+        UINT32_C(0x00000000), UINT32_C(0x77073096), UINT32_C(0xEE0E612C),
+        UINT32_C(0x990951BA), UINT32_C(0x076DC419), UINT32_C(0x706AF48F),
+        UINT32_C(0xE963A535), UINT32_C(0x9E6495A3), UINT32_C(0x0EDB8832),
+        UINT32_C(0x79DCB8A4), UINT32_C(0xE0D5E91E), UINT32_C(0x97D2D988),
+        UINT32_C(0x09B64C2B), UINT32_C(0x7EB17CBD), UINT32_C(0xE7B82D07),
+        UINT32_C(0x90BF1D91), UINT32_C(0x1DB71064), UINT32_C(0x6AB020F2),
+        UINT32_C(0xF3B97148), UINT32_C(0x84BE41DE), UINT32_C(0x1ADAD47D),
+        UINT32_C(0x6DDDE4EB), UINT32_C(0xF4D4B551), UINT32_C(0x83D385C7),
+        UINT32_C(0x136C9856), UINT32_C(0x646BA8C0), UINT32_C(0xFD62F97A),
+        UINT32_C(0x8A65C9EC), UINT32_C(0x14015C4F), UINT32_C(0x63066CD9),
+        UINT32_C(0xFA0F3D63), UINT32_C(0x8D080DF5), UINT32_C(0x3B6E20C8),
+        UINT32_C(0x4C69105E), UINT32_C(0xD56041E4), UINT32_C(0xA2677172),
+        UINT32_C(0x3C03E4D1), UINT32_C(0x4B04D447), UINT32_C(0xD20D85FD),
+        UINT32_C(0xA50AB56B), UINT32_C(0x35B5A8FA), UINT32_C(0x42B2986C),
+        UINT32_C(0xDBBBC9D6), UINT32_C(0xACBCF940), UINT32_C(0x32D86CE3),
+        UINT32_C(0x45DF5C75), UINT32_C(0xDCD60DCF), UINT32_C(0xABD13D59),
+        UINT32_C(0x26D930AC), UINT32_C(0x51DE003A), UINT32_C(0xC8D75180),
+        UINT32_C(0xBFD06116), UINT32_C(0x21B4F4B5), UINT32_C(0x56B3C423),
+        UINT32_C(0xCFBA9599), UINT32_C(0xB8BDA50F), UINT32_C(0x2802B89E),
+        UINT32_C(0x5F058808), UINT32_C(0xC60CD9B2), UINT32_C(0xB10BE924),
+        UINT32_C(0x2F6F7C87), UINT32_C(0x58684C11), UINT32_C(0xC1611DAB),
+        UINT32_C(0xB6662D3D), UINT32_C(0x76DC4190), UINT32_C(0x01DB7106),
+        UINT32_C(0x98D220BC), UINT32_C(0xEFD5102A), UINT32_C(0x71B18589),
+        UINT32_C(0x06B6B51F), UINT32_C(0x9FBFE4A5), UINT32_C(0xE8B8D433),
+        UINT32_C(0x7807C9A2), UINT32_C(0x0F00F934), UINT32_C(0x9609A88E),
+        UINT32_C(0xE10E9818), UINT32_C(0x7F6A0DBB), UINT32_C(0x086D3D2D),
+        UINT32_C(0x91646C97), UINT32_C(0xE6635C01), UINT32_C(0x6B6B51F4),
+        UINT32_C(0x1C6C6162), UINT32_C(0x856530D8), UINT32_C(0xF262004E),
+        UINT32_C(0x6C0695ED), UINT32_C(0x1B01A57B), UINT32_C(0x8208F4C1),
+        UINT32_C(0xF50FC457), UINT32_C(0x65B0D9C6), UINT32_C(0x12B7E950),
+        UINT32_C(0x8BBEB8EA), UINT32_C(0xFCB9887C), UINT32_C(0x62DD1DDF),
+        UINT32_C(0x15DA2D49), UINT32_C(0x8CD37CF3), UINT32_C(0xFBD44C65),
+        UINT32_C(0x4DB26158), UINT32_C(0x3AB551CE), UINT32_C(0xA3BC0074),
+        UINT32_C(0xD4BB30E2), UINT32_C(0x4ADFA541), UINT32_C(0x3DD895D7),
+        UINT32_C(0xA4D1C46D), UINT32_C(0xD3D6F4FB), UINT32_C(0x4369E96A),
+        UINT32_C(0x346ED9FC), UINT32_C(0xAD678846), UINT32_C(0xDA60B8D0),
+        UINT32_C(0x44042D73), UINT32_C(0x33031DE5), UINT32_C(0xAA0A4C5F),
+        UINT32_C(0xDD0D7CC9), UINT32_C(0x5005713C), UINT32_C(0x270241AA),
+        UINT32_C(0xBE0B1010), UINT32_C(0xC90C2086), UINT32_C(0x5768B525),
+        UINT32_C(0x206F85B3), UINT32_C(0xB966D409), UINT32_C(0xCE61E49F),
+        UINT32_C(0x5EDEF90E), UINT32_C(0x29D9C998), UINT32_C(0xB0D09822),
+        UINT32_C(0xC7D7A8B4), UINT32_C(0x59B33D17), UINT32_C(0x2EB40D81),
+        UINT32_C(0xB7BD5C3B), UINT32_C(0xC0BA6CAD), UINT32_C(0xEDB88320),
+        UINT32_C(0x9ABFB3B6), UINT32_C(0x03B6E20C), UINT32_C(0x74B1D29A),
+        UINT32_C(0xEAD54739), UINT32_C(0x9DD277AF), UINT32_C(0x04DB2615),
+        UINT32_C(0x73DC1683), UINT32_C(0xE3630B12), UINT32_C(0x94643B84),
+        UINT32_C(0x0D6D6A3E), UINT32_C(0x7A6A5AA8), UINT32_C(0xE40ECF0B),
+        UINT32_C(0x9309FF9D), UINT32_C(0x0A00AE27), UINT32_C(0x7D079EB1),
+        UINT32_C(0xF00F9344), UINT32_C(0x8708A3D2), UINT32_C(0x1E01F268),
+        UINT32_C(0x6906C2FE), UINT32_C(0xF762575D), UINT32_C(0x806567CB),
+        UINT32_C(0x196C3671), UINT32_C(0x6E6B06E7), UINT32_C(0xFED41B76),
+        UINT32_C(0x89D32BE0), UINT32_C(0x10DA7A5A), UINT32_C(0x67DD4ACC),
+        UINT32_C(0xF9B9DF6F), UINT32_C(0x8EBEEFF9), UINT32_C(0x17B7BE43),
+        UINT32_C(0x60B08ED5), UINT32_C(0xD6D6A3E8), UINT32_C(0xA1D1937E),
+        UINT32_C(0x38D8C2C4), UINT32_C(0x4FDFF252), UINT32_C(0xD1BB67F1),
+        UINT32_C(0xA6BC5767), UINT32_C(0x3FB506DD), UINT32_C(0x48B2364B),
+        UINT32_C(0xD80D2BDA), UINT32_C(0xAF0A1B4C), UINT32_C(0x36034AF6),
+        UINT32_C(0x41047A60), UINT32_C(0xDF60EFC3), UINT32_C(0xA867DF55),
+        UINT32_C(0x316E8EEF), UINT32_C(0x4669BE79), UINT32_C(0xCB61B38C),
+        UINT32_C(0xBC66831A), UINT32_C(0x256FD2A0), UINT32_C(0x5268E236),
+        UINT32_C(0xCC0C7795), UINT32_C(0xBB0B4703), UINT32_C(0x220216B9),
+        UINT32_C(0x5505262F), UINT32_C(0xC5BA3BBE), UINT32_C(0xB2BD0B28),
+        UINT32_C(0x2BB45A92), UINT32_C(0x5CB36A04), UINT32_C(0xC2D7FFA7),
+        UINT32_C(0xB5D0CF31), UINT32_C(0x2CD99E8B), UINT32_C(0x5BDEAE1D),
+        UINT32_C(0x9B64C2B0), UINT32_C(0xEC63F226), UINT32_C(0x756AA39C),
+        UINT32_C(0x026D930A), UINT32_C(0x9C0906A9), UINT32_C(0xEB0E363F),
+        UINT32_C(0x72076785), UINT32_C(0x05005713), UINT32_C(0x95BF4A82),
+        UINT32_C(0xE2B87A14), UINT32_C(0x7BB12BAE), UINT32_C(0x0CB61B38),
+        UINT32_C(0x92D28E9B), UINT32_C(0xE5D5BE0D), UINT32_C(0x7CDCEFB7),
+        UINT32_C(0x0BDBDF21), UINT32_C(0x86D3D2D4), UINT32_C(0xF1D4E242),
+        UINT32_C(0x68DDB3F8), UINT32_C(0x1FDA836E), UINT32_C(0x81BE16CD),
+        UINT32_C(0xF6B9265B), UINT32_C(0x6FB077E1), UINT32_C(0x18B74777),
+        UINT32_C(0x88085AE6), UINT32_C(0xFF0F6A70), UINT32_C(0x66063BCA),
+        UINT32_C(0x11010B5C), UINT32_C(0x8F659EFF), UINT32_C(0xF862AE69),
+        UINT32_C(0x616BFFD3), UINT32_C(0x166CCF45), UINT32_C(0xA00AE278),
+        UINT32_C(0xD70DD2EE), UINT32_C(0x4E048354), UINT32_C(0x3903B3C2),
+        UINT32_C(0xA7672661), UINT32_C(0xD06016F7), UINT32_C(0x4969474D),
+        UINT32_C(0x3E6E77DB), UINT32_C(0xAED16A4A), UINT32_C(0xD9D65ADC),
+        UINT32_C(0x40DF0B66), UINT32_C(0x37D83BF0), UINT32_C(0xA9BCAE53),
+        UINT32_C(0xDEBB9EC5), UINT32_C(0x47B2CF7F), UINT32_C(0x30B5FFE9),
+        UINT32_C(0xBDBDF21C), UINT32_C(0xCABAC28A), UINT32_C(0x53B39330),
+        UINT32_C(0x24B4A3A6), UINT32_C(0xBAD03605), UINT32_C(0xCDD70693),
+        UINT32_C(0x54DE5729), UINT32_C(0x23D967BF), UINT32_C(0xB3667A2E),
+        UINT32_C(0xC4614AB8), UINT32_C(0x5D681B02), UINT32_C(0x2A6F2B94),
+        UINT32_C(0xB40BBE37), UINT32_C(0xC30C8EA1), UINT32_C(0x5A05DF1B),
+        UINT32_C(0x2D02EF8D)
+    },
+    {
+        UINT32_C(0x00000000), UINT32_C(0x191B3141), UINT32_C(0x32366282),
+        UINT32_C(0x2B2D53C3), UINT32_C(0x646CC504), UINT32_C(0x7D77F445),
+        UINT32_C(0x565AA786), UINT32_C(0x4F4196C7), UINT32_C(0xC8D98A08),
+        UINT32_C(0xD1C2BB49), UINT32_C(0xFAEFE88A), UINT32_C(0xE3F4D9CB),
+        UINT32_C(0xACB54F0C), UINT32_C(0xB5AE7E4D), UINT32_C(0x9E832D8E),
+        UINT32_C(0x87981CCF), UINT32_C(0x4AC21251), UINT32_C(0x53D92310),
+        UINT32_C(0x78F470D3), UINT32_C(0x61EF4192), UINT32_C(0x2EAED755),
+        UINT32_C(0x37B5E614), UINT32_C(0x1C98B5D7), UINT32_C(0x05838496),
+        UINT32_C(0x821B9859), UINT32_C(0x9B00A918), UINT32_C(0xB02DFADB),
+        UINT32_C(0xA936CB9A), UINT32_C(0xE6775D5D), UINT32_C(0xFF6C6C1C),
+        UINT32_C(0xD4413FDF), UINT32_C(0xCD5A0E9E), UINT32_C(0x958424A2),
+        UINT32_C(0x8C9F15E3), UINT32_C(0xA7B24620), UINT32_C(0xBEA97761),
+        UINT32_C(0xF1E8E1A6), UINT32_C(0xE8F3D0E7), UINT32_C(0xC3DE8324),
+        UINT32_C(0xDAC5B265), UINT32_C(0x5D5DAEAA), UINT32_C(0x44469FEB),
+        UINT32_C(0x6F6BCC28), UINT32_C(0x7670FD69), UINT32_C(0x39316BAE),
+        UINT32_C(0x202A5AEF), UINT32_C(0x0B07092C), UINT32_C(0x121C386D),
+        UINT32_C(0xDF4636F3), UINT32_C(0xC65D07B2), UINT32_C(0xED705471),
+        UINT32_C(0xF46B6530), UINT32_C(0xBB2AF3F7), UINT32_C(0xA231C2B6),
+        UINT32_C(0x891C9175), UINT32_C(0x9007A034), UINT32_C(0x179FBCFB),
+        UINT32_C(0x0E848DBA), UINT32_C(0x25A9DE79), UINT32_C(0x3CB2EF38),
+        UINT32_C(0x73F379FF), UINT32_C(0x6AE848BE), UINT32_C(0x41C51B7D),
+        UINT32_C(0x58DE2A3C), UINT32_C(0xF0794F05), UINT32_C(0xE9627E44),
+        UINT32_C(0xC24F2D87), UINT32_C(0xDB541CC6), UINT32_C(0x94158A01),
+        UINT32_C(0x8D0EBB40), UINT32_C(0xA623E883), UINT32_C(0xBF38D9C2),
+        UINT32_C(0x38A0C50D), UINT32_C(0x21BBF44C), UINT32_C(0x0A96A78F),
+        UINT32_C(0x138D96CE), UINT32_C(0x5CCC0009), UINT32_C(0x45D73148),
+        UINT32_C(0x6EFA628B), UINT32_C(0x77E153CA), UINT32_C(0xBABB5D54),
+        UINT32_C(0xA3A06C15), UINT32_C(0x888D3FD6), UINT32_C(0x91960E97),
+        UINT32_C(0xDED79850), UINT32_C(0xC7CCA911), UINT32_C(0xECE1FAD2),
+        UINT32_C(0xF5FACB93), UINT32_C(0x7262D75C), UINT32_C(0x6B79E61D),
+        UINT32_C(0x4054B5DE), UINT32_C(0x594F849F), UINT32_C(0x160E1258),
+        UINT32_C(0x0F152319), UINT32_C(0x243870DA), UINT32_C(0x3D23419B),
+        UINT32_C(0x65FD6BA7), UINT32_C(0x7CE65AE6), UINT32_C(0x57CB0925),
+        UINT32_C(0x4ED03864), UINT32_C(0x0191AEA3), UINT32_C(0x188A9FE2),
+        UINT32_C(0x33A7CC21), UINT32_C(0x2ABCFD60), UINT32_C(0xAD24E1AF),
+        UINT32_C(0xB43FD0EE), UINT32_C(0x9F12832D), UINT32_C(0x8609B26C),
+        UINT32_C(0xC94824AB), UINT32_C(0xD05315EA), UINT32_C(0xFB7E4629),
+        UINT32_C(0xE2657768), UINT32_C(0x2F3F79F6), UINT32_C(0x362448B7),
+        UINT32_C(0x1D091B74), UINT32_C(0x04122A35), UINT32_C(0x4B53BCF2),
+        UINT32_C(0x52488DB3), UINT32_C(0x7965DE70), UINT32_C(0x607EEF31),
+        UINT32_C(0xE7E6F3FE), UINT32_C(0xFEFDC2BF), UINT32_C(0xD5D0917C),
+        UINT32_C(0xCCCBA03D), UINT32_C(0x838A36FA), UINT32_C(0x9A9107BB),
+        UINT32_C(0xB1BC5478), UINT32_C(0xA8A76539), UINT32_C(0x3B83984B),
+        UINT32_C(0x2298A90A), UINT32_C(0x09B5FAC9), UINT32_C(0x10AECB88),
+        UINT32_C(0x5FEF5D4F), UINT32_C(0x46F46C0E), UINT32_C(0x6DD93FCD),
+        UINT32_C(0x74C20E8C), UINT32_C(0xF35A1243), UINT32_C(0xEA412302),
+        UINT32_C(0xC16C70C1), UINT32_C(0xD8774180), UINT32_C(0x9736D747),
+        UINT32_C(0x8E2DE606), UINT32_C(0xA500B5C5), UINT32_C(0xBC1B8484),
+        UINT32_C(0x71418A1A), UINT32_C(0x685ABB5B), UINT32_C(0x4377E898),
+        UINT32_C(0x5A6CD9D9), UINT32_C(0x152D4F1E), UINT32_C(0x0C367E5F),
+        UINT32_C(0x271B2D9C), UINT32_C(0x3E001CDD), UINT32_C(0xB9980012),
+        UINT32_C(0xA0833153), UINT32_C(0x8BAE6290), UINT32_C(0x92B553D1),
+        UINT32_C(0xDDF4C516), UINT32_C(0xC4EFF457), UINT32_C(0xEFC2A794),
+        UINT32_C(0xF6D996D5), UINT32_C(0xAE07BCE9), UINT32_C(0xB71C8DA8),
+        UINT32_C(0x9C31DE6B), UINT32_C(0x852AEF2A), UINT32_C(0xCA6B79ED),
+        UINT32_C(0xD37048AC), UINT32_C(0xF85D1B6F), UINT32_C(0xE1462A2E),
+        UINT32_C(0x66DE36E1), UINT32_C(0x7FC507A0), UINT32_C(0x54E85463),
+        UINT32_C(0x4DF36522), UINT32_C(0x02B2F3E5), UINT32_C(0x1BA9C2A4),
+        UINT32_C(0x30849167), UINT32_C(0x299FA026), UINT32_C(0xE4C5AEB8),
+        UINT32_C(0xFDDE9FF9), UINT32_C(0xD6F3CC3A), UINT32_C(0xCFE8FD7B),
+        UINT32_C(0x80A96BBC), UINT32_C(0x99B25AFD), UINT32_C(0xB29F093E),
+        UINT32_C(0xAB84387F), UINT32_C(0x2C1C24B0), UINT32_C(0x350715F1),
+        UINT32_C(0x1E2A4632), UINT32_C(0x07317773), UINT32_C(0x4870E1B4),
+        UINT32_C(0x516BD0F5), UINT32_C(0x7A468336), UINT32_C(0x635DB277),
+        UINT32_C(0xCBFAD74E), UINT32_C(0xD2E1E60F), UINT32_C(0xF9CCB5CC),
+        UINT32_C(0xE0D7848D), UINT32_C(0xAF96124A), UINT32_C(0xB68D230B),
+        UINT32_C(0x9DA070C8), UINT32_C(0x84BB4189), UINT32_C(0x03235D46),
+        UINT32_C(0x1A386C07), UINT32_C(0x31153FC4), UINT32_C(0x280E0E85),
+        UINT32_C(0x674F9842), UINT32_C(0x7E54A903), UINT32_C(0x5579FAC0),
+        UINT32_C(0x4C62CB81), UINT32_C(0x8138C51F), UINT32_C(0x9823F45E),
+        UINT32_C(0xB30EA79D), UINT32_C(0xAA1596DC), UINT32_C(0xE554001B),
+        UINT32_C(0xFC4F315A), UINT32_C(0xD7626299), UINT32_C(0xCE7953D8),
+        UINT32_C(0x49E14F17), UINT32_C(0x50FA7E56), UINT32_C(0x7BD72D95),
+        UINT32_C(0x62CC1CD4), UINT32_C(0x2D8D8A13), UINT32_C(0x3496BB52),
+        UINT32_C(0x1FBBE891), UINT32_C(0x06A0D9D0), UINT32_C(0x5E7EF3EC),
+        UINT32_C(0x4765C2AD), UINT32_C(0x6C48916E), UINT32_C(0x7553A02F),
+        UINT32_C(0x3A1236E8), UINT32_C(0x230907A9), UINT32_C(0x0824546A),
+        UINT32_C(0x113F652B), UINT32_C(0x96A779E4), UINT32_C(0x8FBC48A5),
+        UINT32_C(0xA4911B66), UINT32_C(0xBD8A2A27), UINT32_C(0xF2CBBCE0),
+        UINT32_C(0xEBD08DA1), UINT32_C(0xC0FDDE62), UINT32_C(0xD9E6EF23),
+        UINT32_C(0x14BCE1BD), UINT32_C(0x0DA7D0FC), UINT32_C(0x268A833F),
+        UINT32_C(0x3F91B27E), UINT32_C(0x70D024B9), UINT32_C(0x69CB15F8),
+        UINT32_C(0x42E6463B), UINT32_C(0x5BFD777A), UINT32_C(0xDC656BB5),
+        UINT32_C(0xC57E5AF4), UINT32_C(0xEE530937), UINT32_C(0xF7483876),
+        UINT32_C(0xB809AEB1), UINT32_C(0xA1129FF0), UINT32_C(0x8A3FCC33),
+        UINT32_C(0x9324FD72)
+    },
+    {
+        UINT32_C(0x00000000), UINT32_C(0x01C26A37), UINT32_C(0x0384D46E),
+        UINT32_C(0x0246BE59), UINT32_C(0x0709A8DC), UINT32_C(0x06CBC2EB),
+        UINT32_C(0x048D7CB2), UINT32_C(0x054F1685), UINT32_C(0x0E1351B8),
+        UINT32_C(0x0FD13B8F), UINT32_C(0x0D9785D6), UINT32_C(0x0C55EFE1),
+        UINT32_C(0x091AF964), UINT32_C(0x08D89353), UINT32_C(0x0A9E2D0A),
+        UINT32_C(0x0B5C473D), UINT32_C(0x1C26A370), UINT32_C(0x1DE4C947),
+        UINT32_C(0x1FA2771E), UINT32_C(0x1E601D29), UINT32_C(0x1B2F0BAC),
+        UINT32_C(0x1AED619B), UINT32_C(0x18ABDFC2), UINT32_C(0x1969B5F5),
+        UINT32_C(0x1235F2C8), UINT32_C(0x13F798FF), UINT32_C(0x11B126A6),
+        UINT32_C(0x10734C91), UINT32_C(0x153C5A14), UINT32_C(0x14FE3023),
+        UINT32_C(0x16B88E7A), UINT32_C(0x177AE44D), UINT32_C(0x384D46E0),
+        UINT32_C(0x398F2CD7), UINT32_C(0x3BC9928E), UINT32_C(0x3A0BF8B9),
+        UINT32_C(0x3F44EE3C), UINT32_C(0x3E86840B), UINT32_C(0x3CC03A52),
+        UINT32_C(0x3D025065), UINT32_C(0x365E1758), UINT32_C(0x379C7D6F),
+        UINT32_C(0x35DAC336), UINT32_C(0x3418A901), UINT32_C(0x3157BF84),
+        UINT32_C(0x3095D5B3), UINT32_C(0x32D36BEA), UINT32_C(0x331101DD),
+        UINT32_C(0x246BE590), UINT32_C(0x25A98FA7), UINT32_C(0x27EF31FE),
+        UINT32_C(0x262D5BC9), UINT32_C(0x23624D4C), UINT32_C(0x22A0277B),
+        UINT32_C(0x20E69922), UINT32_C(0x2124F315), UINT32_C(0x2A78B428),
+        UINT32_C(0x2BBADE1F), UINT32_C(0x29FC6046), UINT32_C(0x283E0A71),
+        UINT32_C(0x2D711CF4), UINT32_C(0x2CB376C3), UINT32_C(0x2EF5C89A),
+        UINT32_C(0x2F37A2AD), UINT32_C(0x709A8DC0), UINT32_C(0x7158E7F7),
+        UINT32_C(0x731E59AE), UINT32_C(0x72DC3399), UINT32_C(0x7793251C),
+        UINT32_C(0x76514F2B), UINT32_C(0x7417F172), UINT32_C(0x75D59B45),
+        UINT32_C(0x7E89DC78), UINT32_C(0x7F4BB64F), UINT32_C(0x7D0D0816),
+        UINT32_C(0x7CCF6221), UINT32_C(0x798074A4), UINT32_C(0x78421E93),
+        UINT32_C(0x7A04A0CA), UINT32_C(0x7BC6CAFD), UINT32_C(0x6CBC2EB0),
+        UINT32_C(0x6D7E4487), UINT32_C(0x6F38FADE), UINT32_C(0x6EFA90E9),
+        UINT32_C(0x6BB5866C), UINT32_C(0x6A77EC5B), UINT32_C(0x68315202),
+        UINT32_C(0x69F33835), UINT32_C(0x62AF7F08), UINT32_C(0x636D153F),
+        UINT32_C(0x612BAB66), UINT32_C(0x60E9C151), UINT32_C(0x65A6D7D4),
+        UINT32_C(0x6464BDE3), UINT32_C(0x662203BA), UINT32_C(0x67E0698D),
+        UINT32_C(0x48D7CB20), UINT32_C(0x4915A117), UINT32_C(0x4B531F4E),
+        UINT32_C(0x4A917579), UINT32_C(0x4FDE63FC), UINT32_C(0x4E1C09CB),
+        UINT32_C(0x4C5AB792), UINT32_C(0x4D98DDA5), UINT32_C(0x46C49A98),
+        UINT32_C(0x4706F0AF), UINT32_C(0x45404EF6), UINT32_C(0x448224C1),
+        UINT32_C(0x41CD3244), UINT32_C(0x400F5873), UINT32_C(0x4249E62A),
+        UINT32_C(0x438B8C1D), UINT32_C(0x54F16850), UINT32_C(0x55330267),
+        UINT32_C(0x5775BC3E), UINT32_C(0x56B7D609), UINT32_C(0x53F8C08C),
+        UINT32_C(0x523AAABB), UINT32_C(0x507C14E2), UINT32_C(0x51BE7ED5),
+        UINT32_C(0x5AE239E8), UINT32_C(0x5B2053DF), UINT32_C(0x5966ED86),
+        UINT32_C(0x58A487B1), UINT32_C(0x5DEB9134), UINT32_C(0x5C29FB03),
+        UINT32_C(0x5E6F455A), UINT32_C(0x5FAD2F6D), UINT32_C(0xE1351B80),
+        UINT32_C(0xE0F771B7), UINT32_C(0xE2B1CFEE), UINT32_C(0xE373A5D9),
+        UINT32_C(0xE63CB35C), UINT32_C(0xE7FED96B), UINT32_C(0xE5B86732),
+        UINT32_C(0xE47A0D05), UINT32_C(0xEF264A38), UINT32_C(0xEEE4200F),
+        UINT32_C(0xECA29E56), UINT32_C(0xED60F461), UINT32_C(0xE82FE2E4),
+        UINT32_C(0xE9ED88D3), UINT32_C(0xEBAB368A), UINT32_C(0xEA695CBD),
+        UINT32_C(0xFD13B8F0), UINT32_C(0xFCD1D2C7), UINT32_C(0xFE976C9E),
+        UINT32_C(0xFF5506A9), UINT32_C(0xFA1A102C), UINT32_C(0xFBD87A1B),
+        UINT32_C(0xF99EC442), UINT32_C(0xF85CAE75), UINT32_C(0xF300E948),
+        UINT32_C(0xF2C2837F), UINT32_C(0xF0843D26), UINT32_C(0xF1465711),
+        UINT32_C(0xF4094194), UINT32_C(0xF5CB2BA3), UINT32_C(0xF78D95FA),
+        UINT32_C(0xF64FFFCD), UINT32_C(0xD9785D60), UINT32_C(0xD8BA3757),
+        UINT32_C(0xDAFC890E), UINT32_C(0xDB3EE339), UINT32_C(0xDE71F5BC),
+        UINT32_C(0xDFB39F8B), UINT32_C(0xDDF521D2), UINT32_C(0xDC374BE5),
+        UINT32_C(0xD76B0CD8), UINT32_C(0xD6A966EF), UINT32_C(0xD4EFD8B6),
+        UINT32_C(0xD52DB281), UINT32_C(0xD062A404), UINT32_C(0xD1A0CE33),
+        UINT32_C(0xD3E6706A), UINT32_C(0xD2241A5D), UINT32_C(0xC55EFE10),
+        UINT32_C(0xC49C9427), UINT32_C(0xC6DA2A7E), UINT32_C(0xC7184049),
+        UINT32_C(0xC25756CC), UINT32_C(0xC3953CFB), UINT32_C(0xC1D382A2),
+        UINT32_C(0xC011E895), UINT32_C(0xCB4DAFA8), UINT32_C(0xCA8FC59F),
+        UINT32_C(0xC8C97BC6), UINT32_C(0xC90B11F1), UINT32_C(0xCC440774),
+        UINT32_C(0xCD866D43), UINT32_C(0xCFC0D31A), UINT32_C(0xCE02B92D),
+        UINT32_C(0x91AF9640), UINT32_C(0x906DFC77), UINT32_C(0x922B422E),
+        UINT32_C(0x93E92819), UINT32_C(0x96A63E9C), UINT32_C(0x976454AB),
+        UINT32_C(0x9522EAF2), UINT32_C(0x94E080C5), UINT32_C(0x9FBCC7F8),
+        UINT32_C(0x9E7EADCF), UINT32_C(0x9C381396), UINT32_C(0x9DFA79A1),
+        UINT32_C(0x98B56F24), UINT32_C(0x99770513), UINT32_C(0x9B31BB4A),
+        UINT32_C(0x9AF3D17D), UINT32_C(0x8D893530), UINT32_C(0x8C4B5F07),
+        UINT32_C(0x8E0DE15E), UINT32_C(0x8FCF8B69), UINT32_C(0x8A809DEC),
+        UINT32_C(0x8B42F7DB), UINT32_C(0x89044982), UINT32_C(0x88C623B5),
+        UINT32_C(0x839A6488), UINT32_C(0x82580EBF), UINT32_C(0x801EB0E6),
+        UINT32_C(0x81DCDAD1), UINT32_C(0x8493CC54), UINT32_C(0x8551A663),
+        UINT32_C(0x8717183A), UINT32_C(0x86D5720D), UINT32_C(0xA9E2D0A0),
+        UINT32_C(0xA820BA97), UINT32_C(0xAA6604CE), UINT32_C(0xABA46EF9),
+        UINT32_C(0xAEEB787C), UINT32_C(0xAF29124B), UINT32_C(0xAD6FAC12),
+        UINT32_C(0xACADC625), UINT32_C(0xA7F18118), UINT32_C(0xA633EB2F),
+        UINT32_C(0xA4755576), UINT32_C(0xA5B73F41), UINT32_C(0xA0F829C4),
+        UINT32_C(0xA13A43F3), UINT32_C(0xA37CFDAA), UINT32_C(0xA2BE979D),
+        UINT32_C(0xB5C473D0), UINT32_C(0xB40619E7), UINT32_C(0xB640A7BE),
+        UINT32_C(0xB782CD89), UINT32_C(0xB2CDDB0C), UINT32_C(0xB30FB13B),
+        UINT32_C(0xB1490F62), UINT32_C(0xB08B6555), UINT32_C(0xBBD72268),
+        UINT32_C(0xBA15485F), UINT32_C(0xB853F606), UINT32_C(0xB9919C31),
+        UINT32_C(0xBCDE8AB4), UINT32_C(0xBD1CE083), UINT32_C(0xBF5A5EDA),
+        UINT32_C(0xBE9834ED)
+    },
+    {
+        UINT32_C(0x00000000), UINT32_C(0xB8BC6765), UINT32_C(0xAA09C88B),
+        UINT32_C(0x12B5AFEE), UINT32_C(0x8F629757), UINT32_C(0x37DEF032),
+        UINT32_C(0x256B5FDC), UINT32_C(0x9DD738B9), UINT32_C(0xC5B428EF),
+        UINT32_C(0x7D084F8A), UINT32_C(0x6FBDE064), UINT32_C(0xD7018701),
+        UINT32_C(0x4AD6BFB8), UINT32_C(0xF26AD8DD), UINT32_C(0xE0DF7733),
+        UINT32_C(0x58631056), UINT32_C(0x5019579F), UINT32_C(0xE8A530FA),
+        UINT32_C(0xFA109F14), UINT32_C(0x42ACF871), UINT32_C(0xDF7BC0C8),
+        UINT32_C(0x67C7A7AD), UINT32_C(0x75720843), UINT32_C(0xCDCE6F26),
+        UINT32_C(0x95AD7F70), UINT32_C(0x2D111815), UINT32_C(0x3FA4B7FB),
+        UINT32_C(0x8718D09E), UINT32_C(0x1ACFE827), UINT32_C(0xA2738F42),
+        UINT32_C(0xB0C620AC), UINT32_C(0x087A47C9), UINT32_C(0xA032AF3E),
+        UINT32_C(0x188EC85B), UINT32_C(0x0A3B67B5), UINT32_C(0xB28700D0),
+        UINT32_C(0x2F503869), UINT32_C(0x97EC5F0C), UINT32_C(0x8559F0E2),
+        UINT32_C(0x3DE59787), UINT32_C(0x658687D1), UINT32_C(0xDD3AE0B4),
+        UINT32_C(0xCF8F4F5A), UINT32_C(0x7733283F), UINT32_C(0xEAE41086),
+        UINT32_C(0x525877E3), UINT32_C(0x40EDD80D), UINT32_C(0xF851BF68),
+        UINT32_C(0xF02BF8A1), UINT32_C(0x48979FC4), UINT32_C(0x5A22302A),
+        UINT32_C(0xE29E574F), UINT32_C(0x7F496FF6), UINT32_C(0xC7F50893),
+        UINT32_C(0xD540A77D), UINT32_C(0x6DFCC018), UINT32_C(0x359FD04E),
+        UINT32_C(0x8D23B72B), UINT32_C(0x9F9618C5), UINT32_C(0x272A7FA0),
+        UINT32_C(0xBAFD4719), UINT32_C(0x0241207C), UINT32_C(0x10F48F92),
+        UINT32_C(0xA848E8F7), UINT32_C(0x9B14583D), UINT32_C(0x23A83F58),
+        UINT32_C(0x311D90B6), UINT32_C(0x89A1F7D3), UINT32_C(0x1476CF6A),
+        UINT32_C(0xACCAA80F), UINT32_C(0xBE7F07E1), UINT32_C(0x06C36084),
+        UINT32_C(0x5EA070D2), UINT32_C(0xE61C17B7), UINT32_C(0xF4A9B859),
+        UINT32_C(0x4C15DF3C), UINT32_C(0xD1C2E785), UINT32_C(0x697E80E0),
+        UINT32_C(0x7BCB2F0E), UINT32_C(0xC377486B), UINT32_C(0xCB0D0FA2),
+        UINT32_C(0x73B168C7), UINT32_C(0x6104C729), UINT32_C(0xD9B8A04C),
+        UINT32_C(0x446F98F5), UINT32_C(0xFCD3FF90), UINT32_C(0xEE66507E),
+        UINT32_C(0x56DA371B), UINT32_C(0x0EB9274D), UINT32_C(0xB6054028),
+        UINT32_C(0xA4B0EFC6), UINT32_C(0x1C0C88A3), UINT32_C(0x81DBB01A),
+        UINT32_C(0x3967D77F), UINT32_C(0x2BD27891), UINT32_C(0x936E1FF4),
+        UINT32_C(0x3B26F703), UINT32_C(0x839A9066), UINT32_C(0x912F3F88),
+        UINT32_C(0x299358ED), UINT32_C(0xB4446054), UINT32_C(0x0CF80731),
+        UINT32_C(0x1E4DA8DF), UINT32_C(0xA6F1CFBA), UINT32_C(0xFE92DFEC),
+        UINT32_C(0x462EB889), UINT32_C(0x549B1767), UINT32_C(0xEC277002),
+        UINT32_C(0x71F048BB), UINT32_C(0xC94C2FDE), UINT32_C(0xDBF98030),
+        UINT32_C(0x6345E755), UINT32_C(0x6B3FA09C), UINT32_C(0xD383C7F9),
+        UINT32_C(0xC1366817), UINT32_C(0x798A0F72), UINT32_C(0xE45D37CB),
+        UINT32_C(0x5CE150AE), UINT32_C(0x4E54FF40), UINT32_C(0xF6E89825),
+        UINT32_C(0xAE8B8873), UINT32_C(0x1637EF16), UINT32_C(0x048240F8),
+        UINT32_C(0xBC3E279D), UINT32_C(0x21E91F24), UINT32_C(0x99557841),
+        UINT32_C(0x8BE0D7AF), UINT32_C(0x335CB0CA), UINT32_C(0xED59B63B),
+        UINT32_C(0x55E5D15E), UINT32_C(0x47507EB0), UINT32_C(0xFFEC19D5),
+        UINT32_C(0x623B216C), UINT32_C(0xDA874609), UINT32_C(0xC832E9E7),
+        UINT32_C(0x708E8E82), UINT32_C(0x28ED9ED4), UINT32_C(0x9051F9B1),
+        UINT32_C(0x82E4565F), UINT32_C(0x3A58313A), UINT32_C(0xA78F0983),
+        UINT32_C(0x1F336EE6), UINT32_C(0x0D86C108), UINT32_C(0xB53AA66D),
+        UINT32_C(0xBD40E1A4), UINT32_C(0x05FC86C1), UINT32_C(0x1749292F),
+        UINT32_C(0xAFF54E4A), UINT32_C(0x322276F3), UINT32_C(0x8A9E1196),
+        UINT32_C(0x982BBE78), UINT32_C(0x2097D91D), UINT32_C(0x78F4C94B),
+        UINT32_C(0xC048AE2E), UINT32_C(0xD2FD01C0), UINT32_C(0x6A4166A5),
+        UINT32_C(0xF7965E1C), UINT32_C(0x4F2A3979), UINT32_C(0x5D9F9697),
+        UINT32_C(0xE523F1F2), UINT32_C(0x4D6B1905), UINT32_C(0xF5D77E60),
+        UINT32_C(0xE762D18E), UINT32_C(0x5FDEB6EB), UINT32_C(0xC2098E52),
+        UINT32_C(0x7AB5E937), UINT32_C(0x680046D9), UINT32_C(0xD0BC21BC),
+        UINT32_C(0x88DF31EA), UINT32_C(0x3063568F), UINT32_C(0x22D6F961),
+        UINT32_C(0x9A6A9E04), UINT32_C(0x07BDA6BD), UINT32_C(0xBF01C1D8),
+        UINT32_C(0xADB46E36), UINT32_C(0x15080953), UINT32_C(0x1D724E9A),
+        UINT32_C(0xA5CE29FF), UINT32_C(0xB77B8611), UINT32_C(0x0FC7E174),
+        UINT32_C(0x9210D9CD), UINT32_C(0x2AACBEA8), UINT32_C(0x38191146),
+        UINT32_C(0x80A57623), UINT32_C(0xD8C66675), UINT32_C(0x607A0110),
+        UINT32_C(0x72CFAEFE), UINT32_C(0xCA73C99B), UINT32_C(0x57A4F122),
+        UINT32_C(0xEF189647), UINT32_C(0xFDAD39A9), UINT32_C(0x45115ECC),
+        UINT32_C(0x764DEE06), UINT32_C(0xCEF18963), UINT32_C(0xDC44268D),
+        UINT32_C(0x64F841E8), UINT32_C(0xF92F7951), UINT32_C(0x41931E34),
+        UINT32_C(0x5326B1DA), UINT32_C(0xEB9AD6BF), UINT32_C(0xB3F9C6E9),
+        UINT32_C(0x0B45A18C), UINT32_C(0x19F00E62), UINT32_C(0xA14C6907),
+        UINT32_C(0x3C9B51BE), UINT32_C(0x842736DB), UINT32_C(0x96929935),
+        UINT32_C(0x2E2EFE50), UINT32_C(0x2654B999), UINT32_C(0x9EE8DEFC),
+        UINT32_C(0x8C5D7112), UINT32_C(0x34E11677), UINT32_C(0xA9362ECE),
+        UINT32_C(0x118A49AB), UINT32_C(0x033FE645), UINT32_C(0xBB838120),
+        UINT32_C(0xE3E09176), UINT32_C(0x5B5CF613), UINT32_C(0x49E959FD),
+        UINT32_C(0xF1553E98), UINT32_C(0x6C820621), UINT32_C(0xD43E6144),
+        UINT32_C(0xC68BCEAA), UINT32_C(0x7E37A9CF), UINT32_C(0xD67F4138),
+        UINT32_C(0x6EC3265D), UINT32_C(0x7C7689B3), UINT32_C(0xC4CAEED6),
+        UINT32_C(0x591DD66F), UINT32_C(0xE1A1B10A), UINT32_C(0xF3141EE4),
+        UINT32_C(0x4BA87981), UINT32_C(0x13CB69D7), UINT32_C(0xAB770EB2),
+        UINT32_C(0xB9C2A15C), UINT32_C(0x017EC639), UINT32_C(0x9CA9FE80),
+        UINT32_C(0x241599E5), UINT32_C(0x36A0360B), UINT32_C(0x8E1C516E),
+        UINT32_C(0x866616A7), UINT32_C(0x3EDA71C2), UINT32_C(0x2C6FDE2C),
+        UINT32_C(0x94D3B949), UINT32_C(0x090481F0), UINT32_C(0xB1B8E695),
+        UINT32_C(0xA30D497B), UINT32_C(0x1BB12E1E), UINT32_C(0x43D23E48),
+        UINT32_C(0xFB6E592D), UINT32_C(0xE9DBF6C3), UINT32_C(0x516791A6),
+        UINT32_C(0xCCB0A91F), UINT32_C(0x740CCE7A), UINT32_C(0x66B96194),
+        UINT32_C(0xDE0506F1)
+    },
+    {
+        UINT32_C(0x00000000), UINT32_C(0x3D6029B0), UINT32_C(0x7AC05360),
+        UINT32_C(0x47A07AD0), UINT32_C(0xF580A6C0), UINT32_C(0xC8E08F70),
+        UINT32_C(0x8F40F5A0), UINT32_C(0xB220DC10), UINT32_C(0x30704BC1),
+        UINT32_C(0x0D106271), UINT32_C(0x4AB018A1), UINT32_C(0x77D03111),
+        UINT32_C(0xC5F0ED01), UINT32_C(0xF890C4B1), UINT32_C(0xBF30BE61),
+        UINT32_C(0x825097D1), UINT32_C(0x60E09782), UINT32_C(0x5D80BE32),
+        UINT32_C(0x1A20C4E2), UINT32_C(0x2740ED52), UINT32_C(0x95603142),
+        UINT32_C(0xA80018F2), UINT32_C(0xEFA06222), UINT32_C(0xD2C04B92),
+        UINT32_C(0x5090DC43), UINT32_C(0x6DF0F5F3), UINT32_C(0x2A508F23),
+        UINT32_C(0x1730A693), UINT32_C(0xA5107A83), UINT32_C(0x98705333),
+        UINT32_C(0xDFD029E3), UINT32_C(0xE2B00053), UINT32_C(0xC1C12F04),
+        UINT32_C(0xFCA106B4), UINT32_C(0xBB017C64), UINT32_C(0x866155D4),
+        UINT32_C(0x344189C4), UINT32_C(0x0921A074), UINT32_C(0x4E81DAA4),
+        UINT32_C(0x73E1F314), UINT32_C(0xF1B164C5), UINT32_C(0xCCD14D75),
+        UINT32_C(0x8B7137A5), UINT32_C(0xB6111E15), UINT32_C(0x0431C205),
+        UINT32_C(0x3951EBB5), UINT32_C(0x7EF19165), UINT32_C(0x4391B8D5),
+        UINT32_C(0xA121B886), UINT32_C(0x9C419136), UINT32_C(0xDBE1EBE6),
+        UINT32_C(0xE681C256), UINT32_C(0x54A11E46), UINT32_C(0x69C137F6),
+        UINT32_C(0x2E614D26), UINT32_C(0x13016496), UINT32_C(0x9151F347),
+        UINT32_C(0xAC31DAF7), UINT32_C(0xEB91A027), UINT32_C(0xD6F18997),
+        UINT32_C(0x64D15587), UINT32_C(0x59B17C37), UINT32_C(0x1E1106E7),
+        UINT32_C(0x23712F57), UINT32_C(0x58F35849), UINT32_C(0x659371F9),
+        UINT32_C(0x22330B29), UINT32_C(0x1F532299), UINT32_C(0xAD73FE89),
+        UINT32_C(0x9013D739), UINT32_C(0xD7B3ADE9), UINT32_C(0xEAD38459),
+        UINT32_C(0x68831388), UINT32_C(0x55E33A38), UINT32_C(0x124340E8),
+        UINT32_C(0x2F236958), UINT32_C(0x9D03B548), UINT32_C(0xA0639CF8),
+        UINT32_C(0xE7C3E628), UINT32_C(0xDAA3CF98), UINT32_C(0x3813CFCB),
+        UINT32_C(0x0573E67B), UINT32_C(0x42D39CAB), UINT32_C(0x7FB3B51B),
+        UINT32_C(0xCD93690B), UINT32_C(0xF0F340BB), UINT32_C(0xB7533A6B),
+        UINT32_C(0x8A3313DB), UINT32_C(0x0863840A), UINT32_C(0x3503ADBA),
+        UINT32_C(0x72A3D76A), UINT32_C(0x4FC3FEDA), UINT32_C(0xFDE322CA),
+        UINT32_C(0xC0830B7A), UINT32_C(0x872371AA), UINT32_C(0xBA43581A),
+        UINT32_C(0x9932774D), UINT32_C(0xA4525EFD), UINT32_C(0xE3F2242D),
+        UINT32_C(0xDE920D9D), UINT32_C(0x6CB2D18D), UINT32_C(0x51D2F83D),
+        UINT32_C(0x167282ED), UINT32_C(0x2B12AB5D), UINT32_C(0xA9423C8C),
+        UINT32_C(0x9422153C), UINT32_C(0xD3826FEC), UINT32_C(0xEEE2465C),
+        UINT32_C(0x5CC29A4C), UINT32_C(0x61A2B3FC), UINT32_C(0x2602C92C),
+        UINT32_C(0x1B62E09C), UINT32_C(0xF9D2E0CF), UINT32_C(0xC4B2C97F),
+        UINT32_C(0x8312B3AF), UINT32_C(0xBE729A1F), UINT32_C(0x0C52460F),
+        UINT32_C(0x31326FBF), UINT32_C(0x7692156F), UINT32_C(0x4BF23CDF),
+        UINT32_C(0xC9A2AB0E), UINT32_C(0xF4C282BE), UINT32_C(0xB362F86E),
+        UINT32_C(0x8E02D1DE), UINT32_C(0x3C220DCE), UINT32_C(0x0142247E),
+        UINT32_C(0x46E25EAE), UINT32_C(0x7B82771E), UINT32_C(0xB1E6B092),
+        UINT32_C(0x8C869922), UINT32_C(0xCB26E3F2), UINT32_C(0xF646CA42),
+        UINT32_C(0x44661652), UINT32_C(0x79063FE2), UINT32_C(0x3EA64532),
+        UINT32_C(0x03C66C82), UINT32_C(0x8196FB53), UINT32_C(0xBCF6D2E3),
+        UINT32_C(0xFB56A833), UINT32_C(0xC6368183), UINT32_C(0x74165D93),
+        UINT32_C(0x49767423), UINT32_C(0x0ED60EF3), UINT32_C(0x33B62743),
+        UINT32_C(0xD1062710), UINT32_C(0xEC660EA0), UINT32_C(0xABC67470),
+        UINT32_C(0x96A65DC0), UINT32_C(0x248681D0), UINT32_C(0x19E6A860),
+        UINT32_C(0x5E46D2B0), UINT32_C(0x6326FB00), UINT32_C(0xE1766CD1),
+        UINT32_C(0xDC164561), UINT32_C(0x9BB63FB1), UINT32_C(0xA6D61601),
+        UINT32_C(0x14F6CA11), UINT32_C(0x2996E3A1), UINT32_C(0x6E369971),
+        UINT32_C(0x5356B0C1), UINT32_C(0x70279F96), UINT32_C(0x4D47B626),
+        UINT32_C(0x0AE7CCF6), UINT32_C(0x3787E546), UINT32_C(0x85A73956),
+        UINT32_C(0xB8C710E6), UINT32_C(0xFF676A36), UINT32_C(0xC2074386),
+        UINT32_C(0x4057D457), UINT32_C(0x7D37FDE7), UINT32_C(0x3A978737),
+        UINT32_C(0x07F7AE87), UINT32_C(0xB5D77297), UINT32_C(0x88B75B27),
+        UINT32_C(0xCF1721F7), UINT32_C(0xF2770847), UINT32_C(0x10C70814),
+        UINT32_C(0x2DA721A4), UINT32_C(0x6A075B74), UINT32_C(0x576772C4),
+        UINT32_C(0xE547AED4), UINT32_C(0xD8278764), UINT32_C(0x9F87FDB4),
+        UINT32_C(0xA2E7D404), UINT32_C(0x20B743D5), UINT32_C(0x1DD76A65),
+        UINT32_C(0x5A7710B5), UINT32_C(0x67173905), UINT32_C(0xD537E515),
+        UINT32_C(0xE857CCA5), UINT32_C(0xAFF7B675), UINT32_C(0x92979FC5),
+        UINT32_C(0xE915E8DB), UINT32_C(0xD475C16B), UINT32_C(0x93D5BBBB),
+        UINT32_C(0xAEB5920B), UINT32_C(0x1C954E1B), UINT32_C(0x21F567AB),
+        UINT32_C(0x66551D7B), UINT32_C(0x5B3534CB), UINT32_C(0xD965A31A),
+        UINT32_C(0xE4058AAA), UINT32_C(0xA3A5F07A), UINT32_C(0x9EC5D9CA),
+        UINT32_C(0x2CE505DA), UINT32_C(0x11852C6A), UINT32_C(0x562556BA),
+        UINT32_C(0x6B457F0A), UINT32_C(0x89F57F59), UINT32_C(0xB49556E9),
+        UINT32_C(0xF3352C39), UINT32_C(0xCE550589), UINT32_C(0x7C75D999),
+        UINT32_C(0x4115F029), UINT32_C(0x06B58AF9), UINT32_C(0x3BD5A349),
+        UINT32_C(0xB9853498), UINT32_C(0x84E51D28), UINT32_C(0xC34567F8),
+        UINT32_C(0xFE254E48), UINT32_C(0x4C059258), UINT32_C(0x7165BBE8),
+        UINT32_C(0x36C5C138), UINT32_C(0x0BA5E888), UINT32_C(0x28D4C7DF),
+        UINT32_C(0x15B4EE6F), UINT32_C(0x521494BF), UINT32_C(0x6F74BD0F),
+        UINT32_C(0xDD54611F), UINT32_C(0xE03448AF), UINT32_C(0xA794327F),
+        UINT32_C(0x9AF41BCF), UINT32_C(0x18A48C1E), UINT32_C(0x25C4A5AE),
+        UINT32_C(0x6264DF7E), UINT32_C(0x5F04F6CE), UINT32_C(0xED242ADE),
+        UINT32_C(0xD044036E), UINT32_C(0x97E479BE), UINT32_C(0xAA84500E),
+        UINT32_C(0x4834505D), UINT32_C(0x755479ED), UINT32_C(0x32F4033D),
+        UINT32_C(0x0F942A8D), UINT32_C(0xBDB4F69D), UINT32_C(0x80D4DF2D),
+        UINT32_C(0xC774A5FD), UINT32_C(0xFA148C4D), UINT32_C(0x78441B9C),
+        UINT32_C(0x4524322C), UINT32_C(0x028448FC), UINT32_C(0x3FE4614C),
+        UINT32_C(0x8DC4BD5C), UINT32_C(0xB0A494EC), UINT32_C(0xF704EE3C),
+        UINT32_C(0xCA64C78C)
+    },
+    {
+        UINT32_C(0x00000000), UINT32_C(0xCB5CD3A5), UINT32_C(0x4DC8A10B),
+        UINT32_C(0x869472AE), UINT32_C(0x9B914216), UINT32_C(0x50CD91B3),
+        UINT32_C(0xD659E31D), UINT32_C(0x1D0530B8), UINT32_C(0xEC53826D),
+        UINT32_C(0x270F51C8), UINT32_C(0xA19B2366), UINT32_C(0x6AC7F0C3),
+        UINT32_C(0x77C2C07B), UINT32_C(0xBC9E13DE), UINT32_C(0x3A0A6170),
+        UINT32_C(0xF156B2D5), UINT32_C(0x03D6029B), UINT32_C(0xC88AD13E),
+        UINT32_C(0x4E1EA390), UINT32_C(0x85427035), UINT32_C(0x9847408D),
+        UINT32_C(0x531B9328), UINT32_C(0xD58FE186), UINT32_C(0x1ED33223),
+        UINT32_C(0xEF8580F6), UINT32_C(0x24D95353), UINT32_C(0xA24D21FD),
+        UINT32_C(0x6911F258), UINT32_C(0x7414C2E0), UINT32_C(0xBF481145),
+        UINT32_C(0x39DC63EB), UINT32_C(0xF280B04E), UINT32_C(0x07AC0536),
+        UINT32_C(0xCCF0D693), UINT32_C(0x4A64A43D), UINT32_C(0x81387798),
+        UINT32_C(0x9C3D4720), UINT32_C(0x57619485), UINT32_C(0xD1F5E62B),
+        UINT32_C(0x1AA9358E), UINT32_C(0xEBFF875B), UINT32_C(0x20A354FE),
+        UINT32_C(0xA6372650), UINT32_C(0x6D6BF5F5), UINT32_C(0x706EC54D),
+        UINT32_C(0xBB3216E8), UINT32_C(0x3DA66446), UINT32_C(0xF6FAB7E3),
+        UINT32_C(0x047A07AD), UINT32_C(0xCF26D408), UINT32_C(0x49B2A6A6),
+        UINT32_C(0x82EE7503), UINT32_C(0x9FEB45BB), UINT32_C(0x54B7961E),
+        UINT32_C(0xD223E4B0), UINT32_C(0x197F3715), UINT32_C(0xE82985C0),
+        UINT32_C(0x23755665), UINT32_C(0xA5E124CB), UINT32_C(0x6EBDF76E),
+        UINT32_C(0x73B8C7D6), UINT32_C(0xB8E41473), UINT32_C(0x3E7066DD),
+        UINT32_C(0xF52CB578), UINT32_C(0x0F580A6C), UINT32_C(0xC404D9C9),
+        UINT32_C(0x4290AB67), UINT32_C(0x89CC78C2), UINT32_C(0x94C9487A),
+        UINT32_C(0x5F959BDF), UINT32_C(0xD901E971), UINT32_C(0x125D3AD4),
+        UINT32_C(0xE30B8801), UINT32_C(0x28575BA4), UINT32_C(0xAEC3290A),
+        UINT32_C(0x659FFAAF), UINT32_C(0x789ACA17), UINT32_C(0xB3C619B2),
+        UINT32_C(0x35526B1C), UINT32_C(0xFE0EB8B9), UINT32_C(0x0C8E08F7),
+        UINT32_C(0xC7D2DB52), UINT32_C(0x4146A9FC), UINT32_C(0x8A1A7A59),
+        UINT32_C(0x971F4AE1), UINT32_C(0x5C439944), UINT32_C(0xDAD7EBEA),
+        UINT32_C(0x118B384F), UINT32_C(0xE0DD8A9A), UINT32_C(0x2B81593F),
+        UINT32_C(0xAD152B91), UINT32_C(0x6649F834), UINT32_C(0x7B4CC88C),
+        UINT32_C(0xB0101B29), UINT32_C(0x36846987), UINT32_C(0xFDD8BA22),
+        UINT32_C(0x08F40F5A), UINT32_C(0xC3A8DCFF), UINT32_C(0x453CAE51),
+        UINT32_C(0x8E607DF4), UINT32_C(0x93654D4C), UINT32_C(0x58399EE9),
+        UINT32_C(0xDEADEC47), UINT32_C(0x15F13FE2), UINT32_C(0xE4A78D37),
+        UINT32_C(0x2FFB5E92), UINT32_C(0xA96F2C3C), UINT32_C(0x6233FF99),
+        UINT32_C(0x7F36CF21), UINT32_C(0xB46A1C84), UINT32_C(0x32FE6E2A),
+        UINT32_C(0xF9A2BD8F), UINT32_C(0x0B220DC1), UINT32_C(0xC07EDE64),
+        UINT32_C(0x46EAACCA), UINT32_C(0x8DB67F6F), UINT32_C(0x90B34FD7),
+        UINT32_C(0x5BEF9C72), UINT32_C(0xDD7BEEDC), UINT32_C(0x16273D79),
+        UINT32_C(0xE7718FAC), UINT32_C(0x2C2D5C09), UINT32_C(0xAAB92EA7),
+        UINT32_C(0x61E5FD02), UINT32_C(0x7CE0CDBA), UINT32_C(0xB7BC1E1F),
+        UINT32_C(0x31286CB1), UINT32_C(0xFA74BF14), UINT32_C(0x1EB014D8),
+        UINT32_C(0xD5ECC77D), UINT32_C(0x5378B5D3), UINT32_C(0x98246676),
+        UINT32_C(0x852156CE), UINT32_C(0x4E7D856B), UINT32_C(0xC8E9F7C5),
+        UINT32_C(0x03B52460), UINT32_C(0xF2E396B5), UINT32_C(0x39BF4510),
+        UINT32_C(0xBF2B37BE), UINT32_C(0x7477E41B), UINT32_C(0x6972D4A3),
+        UINT32_C(0xA22E0706), UINT32_C(0x24BA75A8), UINT32_C(0xEFE6A60D),
+        UINT32_C(0x1D661643), UINT32_C(0xD63AC5E6), UINT32_C(0x50AEB748),
+        UINT32_C(0x9BF264ED), UINT32_C(0x86F75455), UINT32_C(0x4DAB87F0),
+        UINT32_C(0xCB3FF55E), UINT32_C(0x006326FB), UINT32_C(0xF135942E),
+        UINT32_C(0x3A69478B), UINT32_C(0xBCFD3525), UINT32_C(0x77A1E680),
+        UINT32_C(0x6AA4D638), UINT32_C(0xA1F8059D), UINT32_C(0x276C7733),
+        UINT32_C(0xEC30A496), UINT32_C(0x191C11EE), UINT32_C(0xD240C24B),
+        UINT32_C(0x54D4B0E5), UINT32_C(0x9F886340), UINT32_C(0x828D53F8),
+        UINT32_C(0x49D1805D), UINT32_C(0xCF45F2F3), UINT32_C(0x04192156),
+        UINT32_C(0xF54F9383), UINT32_C(0x3E134026), UINT32_C(0xB8873288),
+        UINT32_C(0x73DBE12D), UINT32_C(0x6EDED195), UINT32_C(0xA5820230),
+        UINT32_C(0x2316709E), UINT32_C(0xE84AA33B), UINT32_C(0x1ACA1375),
+        UINT32_C(0xD196C0D0), UINT32_C(0x5702B27E), UINT32_C(0x9C5E61DB),
+        UINT32_C(0x815B5163), UINT32_C(0x4A0782C6), UINT32_C(0xCC93F068),
+        UINT32_C(0x07CF23CD), UINT32_C(0xF6999118), UINT32_C(0x3DC542BD),
+        UINT32_C(0xBB513013), UINT32_C(0x700DE3B6), UINT32_C(0x6D08D30E),
+        UINT32_C(0xA65400AB), UINT32_C(0x20C07205), UINT32_C(0xEB9CA1A0),
+        UINT32_C(0x11E81EB4), UINT32_C(0xDAB4CD11), UINT32_C(0x5C20BFBF),
+        UINT32_C(0x977C6C1A), UINT32_C(0x8A795CA2), UINT32_C(0x41258F07),
+        UINT32_C(0xC7B1FDA9), UINT32_C(0x0CED2E0C), UINT32_C(0xFDBB9CD9),
+        UINT32_C(0x36E74F7C), UINT32_C(0xB0733DD2), UINT32_C(0x7B2FEE77),
+        UINT32_C(0x662ADECF), UINT32_C(0xAD760D6A), UINT32_C(0x2BE27FC4),
+        UINT32_C(0xE0BEAC61), UINT32_C(0x123E1C2F), UINT32_C(0xD962CF8A),
+        UINT32_C(0x5FF6BD24), UINT32_C(0x94AA6E81), UINT32_C(0x89AF5E39),
+        UINT32_C(0x42F38D9C), UINT32_C(0xC467FF32), UINT32_C(0x0F3B2C97),
+        UINT32_C(0xFE6D9E42), UINT32_C(0x35314DE7), UINT32_C(0xB3A53F49),
+        UINT32_C(0x78F9ECEC), UINT32_C(0x65FCDC54), UINT32_C(0xAEA00FF1),
+        UINT32_C(0x28347D5F), UINT32_C(0xE368AEFA), UINT32_C(0x16441B82),
+        UINT32_C(0xDD18C827), UINT32_C(0x5B8CBA89), UINT32_C(0x90D0692C),
+        UINT32_C(0x8DD55994), UINT32_C(0x46898A31), UINT32_C(0xC01DF89F),
+        UINT32_C(0x0B412B3A), UINT32_C(0xFA1799EF), UINT32_C(0x314B4A4A),
+        UINT32_C(0xB7DF38E4), UINT32_C(0x7C83EB41), UINT32_C(0x6186DBF9),
+        UINT32_C(0xAADA085C), UINT32_C(0x2C4E7AF2), UINT32_C(0xE712A957),
+        UINT32_C(0x15921919), UINT32_C(0xDECECABC), UINT32_C(0x585AB812),
+        UINT32_C(0x93066BB7), UINT32_C(0x8E035B0F), UINT32_C(0x455F88AA),
+        UINT32_C(0xC3CBFA04), UINT32_C(0x089729A1), UINT32_C(0xF9C19B74),
+        UINT32_C(0x329D48D1), UINT32_C(0xB4093A7F), UINT32_C(0x7F55E9DA),
+        UINT32_C(0x6250D962), UINT32_C(0xA90C0AC7), UINT32_C(0x2F987869),
+        UINT32_C(0xE4C4ABCC)
+    },
+    {
+        UINT32_C(0x00000000), UINT32_C(0xA6770BB4), UINT32_C(0x979F1129),
+        UINT32_C(0x31E81A9D), UINT32_C(0xF44F2413), UINT32_C(0x52382FA7),
+        UINT32_C(0x63D0353A), UINT32_C(0xC5A73E8E), UINT32_C(0x33EF4E67),
+        UINT32_C(0x959845D3), UINT32_C(0xA4705F4E), UINT32_C(0x020754FA),
+        UINT32_C(0xC7A06A74), UINT32_C(0x61D761C0), UINT32_C(0x503F7B5D),
+        UINT32_C(0xF64870E9), UINT32_C(0x67DE9CCE), UINT32_C(0xC1A9977A),
+        UINT32_C(0xF0418DE7), UINT32_C(0x56368653), UINT32_C(0x9391B8DD),
+        UINT32_C(0x35E6B369), UINT32_C(0x040EA9F4), UINT32_C(0xA279A240),
+        UINT32_C(0x5431D2A9), UINT32_C(0xF246D91D), UINT32_C(0xC3AEC380),
+        UINT32_C(0x65D9C834), UINT32_C(0xA07EF6BA), UINT32_C(0x0609FD0E),
+        UINT32_C(0x37E1E793), UINT32_C(0x9196EC27), UINT32_C(0xCFBD399C),
+        UINT32_C(0x69CA3228), UINT32_C(0x582228B5), UINT32_C(0xFE552301),
+        UINT32_C(0x3BF21D8F), UINT32_C(0x9D85163B), UINT32_C(0xAC6D0CA6),
+        UINT32_C(0x0A1A0712), UINT32_C(0xFC5277FB), UINT32_C(0x5A257C4F),
+        UINT32_C(0x6BCD66D2), UINT32_C(0xCDBA6D66), UINT32_C(0x081D53E8),
+        UINT32_C(0xAE6A585C), UINT32_C(0x9F8242C1), UINT32_C(0x39F54975),
+        UINT32_C(0xA863A552), UINT32_C(0x0E14AEE6), UINT32_C(0x3FFCB47B),
+        UINT32_C(0x998BBFCF), UINT32_C(0x5C2C8141), UINT32_C(0xFA5B8AF5),
+        UINT32_C(0xCBB39068), UINT32_C(0x6DC49BDC), UINT32_C(0x9B8CEB35),
+        UINT32_C(0x3DFBE081), UINT32_C(0x0C13FA1C), UINT32_C(0xAA64F1A8),
+        UINT32_C(0x6FC3CF26), UINT32_C(0xC9B4C492), UINT32_C(0xF85CDE0F),
+        UINT32_C(0x5E2BD5BB), UINT32_C(0x440B7579), UINT32_C(0xE27C7ECD),
+        UINT32_C(0xD3946450), UINT32_C(0x75E36FE4), UINT32_C(0xB044516A),
+        UINT32_C(0x16335ADE), UINT32_C(0x27DB4043), UINT32_C(0x81AC4BF7),
+        UINT32_C(0x77E43B1E), UINT32_C(0xD19330AA), UINT32_C(0xE07B2A37),
+        UINT32_C(0x460C2183), UINT32_C(0x83AB1F0D), UINT32_C(0x25DC14B9),
+        UINT32_C(0x14340E24), UINT32_C(0xB2430590), UINT32_C(0x23D5E9B7),
+        UINT32_C(0x85A2E203), UINT32_C(0xB44AF89E), UINT32_C(0x123DF32A),
+        UINT32_C(0xD79ACDA4), UINT32_C(0x71EDC610), UINT32_C(0x4005DC8D),
+        UINT32_C(0xE672D739), UINT32_C(0x103AA7D0), UINT32_C(0xB64DAC64),
+        UINT32_C(0x87A5B6F9), UINT32_C(0x21D2BD4D), UINT32_C(0xE47583C3),
+        UINT32_C(0x42028877), UINT32_C(0x73EA92EA), UINT32_C(0xD59D995E),
+        UINT32_C(0x8BB64CE5), UINT32_C(0x2DC14751), UINT32_C(0x1C295DCC),
+        UINT32_C(0xBA5E5678), UINT32_C(0x7FF968F6), UINT32_C(0xD98E6342),
+        UINT32_C(0xE86679DF), UINT32_C(0x4E11726B), UINT32_C(0xB8590282),
+        UINT32_C(0x1E2E0936), UINT32_C(0x2FC613AB), UINT32_C(0x89B1181F),
+        UINT32_C(0x4C162691), UINT32_C(0xEA612D25), UINT32_C(0xDB8937B8),
+        UINT32_C(0x7DFE3C0C), UINT32_C(0xEC68D02B), UINT32_C(0x4A1FDB9F),
+        UINT32_C(0x7BF7C102), UINT32_C(0xDD80CAB6), UINT32_C(0x1827F438),
+        UINT32_C(0xBE50FF8C), UINT32_C(0x8FB8E511), UINT32_C(0x29CFEEA5),
+        UINT32_C(0xDF879E4C), UINT32_C(0x79F095F8), UINT32_C(0x48188F65),
+        UINT32_C(0xEE6F84D1), UINT32_C(0x2BC8BA5F), UINT32_C(0x8DBFB1EB),
+        UINT32_C(0xBC57AB76), UINT32_C(0x1A20A0C2), UINT32_C(0x8816EAF2),
+        UINT32_C(0x2E61E146), UINT32_C(0x1F89FBDB), UINT32_C(0xB9FEF06F),
+        UINT32_C(0x7C59CEE1), UINT32_C(0xDA2EC555), UINT32_C(0xEBC6DFC8),
+        UINT32_C(0x4DB1D47C), UINT32_C(0xBBF9A495), UINT32_C(0x1D8EAF21),
+        UINT32_C(0x2C66B5BC), UINT32_C(0x8A11BE08), UINT32_C(0x4FB68086),
+        UINT32_C(0xE9C18B32), UINT32_C(0xD82991AF), UINT32_C(0x7E5E9A1B),
+        UINT32_C(0xEFC8763C), UINT32_C(0x49BF7D88), UINT32_C(0x78576715),
+        UINT32_C(0xDE206CA1), UINT32_C(0x1B87522F), UINT32_C(0xBDF0599B),
+        UINT32_C(0x8C184306), UINT32_C(0x2A6F48B2), UINT32_C(0xDC27385B),
+        UINT32_C(0x7A5033EF), UINT32_C(0x4BB82972), UINT32_C(0xEDCF22C6),
+        UINT32_C(0x28681C48), UINT32_C(0x8E1F17FC), UINT32_C(0xBFF70D61),
+        UINT32_C(0x198006D5), UINT32_C(0x47ABD36E), UINT32_C(0xE1DCD8DA),
+        UINT32_C(0xD034C247), UINT32_C(0x7643C9F3), UINT32_C(0xB3E4F77D),
+        UINT32_C(0x1593FCC9), UINT32_C(0x247BE654), UINT32_C(0x820CEDE0),
+        UINT32_C(0x74449D09), UINT32_C(0xD23396BD), UINT32_C(0xE3DB8C20),
+        UINT32_C(0x45AC8794), UINT32_C(0x800BB91A), UINT32_C(0x267CB2AE),
+        UINT32_C(0x1794A833), UINT32_C(0xB1E3A387), UINT32_C(0x20754FA0),
+        UINT32_C(0x86024414), UINT32_C(0xB7EA5E89), UINT32_C(0x119D553D),
+        UINT32_C(0xD43A6BB3), UINT32_C(0x724D6007), UINT32_C(0x43A57A9A),
+        UINT32_C(0xE5D2712E), UINT32_C(0x139A01C7), UINT32_C(0xB5ED0A73),
+        UINT32_C(0x840510EE), UINT32_C(0x22721B5A), UINT32_C(0xE7D525D4),
+        UINT32_C(0x41A22E60), UINT32_C(0x704A34FD), UINT32_C(0xD63D3F49),
+        UINT32_C(0xCC1D9F8B), UINT32_C(0x6A6A943F), UINT32_C(0x5B828EA2),
+        UINT32_C(0xFDF58516), UINT32_C(0x3852BB98), UINT32_C(0x9E25B02C),
+        UINT32_C(0xAFCDAAB1), UINT32_C(0x09BAA105), UINT32_C(0xFFF2D1EC),
+        UINT32_C(0x5985DA58), UINT32_C(0x686DC0C5), UINT32_C(0xCE1ACB71),
+        UINT32_C(0x0BBDF5FF), UINT32_C(0xADCAFE4B), UINT32_C(0x9C22E4D6),
+        UINT32_C(0x3A55EF62), UINT32_C(0xABC30345), UINT32_C(0x0DB408F1),
+        UINT32_C(0x3C5C126C), UINT32_C(0x9A2B19D8), UINT32_C(0x5F8C2756),
+        UINT32_C(0xF9FB2CE2), UINT32_C(0xC813367F), UINT32_C(0x6E643DCB),
+        UINT32_C(0x982C4D22), UINT32_C(0x3E5B4696), UINT32_C(0x0FB35C0B),
+        UINT32_C(0xA9C457BF), UINT32_C(0x6C636931), UINT32_C(0xCA146285),
+        UINT32_C(0xFBFC7818), UINT32_C(0x5D8B73AC), UINT32_C(0x03A0A617),
+        UINT32_C(0xA5D7ADA3), UINT32_C(0x943FB73E), UINT32_C(0x3248BC8A),
+        UINT32_C(0xF7EF8204), UINT32_C(0x519889B0), UINT32_C(0x6070932D),
+        UINT32_C(0xC6079899), UINT32_C(0x304FE870), UINT32_C(0x9638E3C4),
+        UINT32_C(0xA7D0F959), UINT32_C(0x01A7F2ED), UINT32_C(0xC400CC63),
+        UINT32_C(0x6277C7D7), UINT32_C(0x539FDD4A), UINT32_C(0xF5E8D6FE),
+        UINT32_C(0x647E3AD9), UINT32_C(0xC209316D), UINT32_C(0xF3E12BF0),
+        UINT32_C(0x55962044), UINT32_C(0x90311ECA), UINT32_C(0x3646157E),
+        UINT32_C(0x07AE0FE3), UINT32_C(0xA1D90457), UINT32_C(0x579174BE),
+        UINT32_C(0xF1E67F0A), UINT32_C(0xC00E6597), UINT32_C(0x66796E23),
+        UINT32_C(0xA3DE50AD), UINT32_C(0x05A95B19), UINT32_C(0x34414184),
+        UINT32_C(0x92364A30)
+    },
+    {
+        UINT32_C(0x00000000), UINT32_C(0xCCAA009E), UINT32_C(0x4225077D),
+        UINT32_C(0x8E8F07E3), UINT32_C(0x844A0EFA), UINT32_C(0x48E00E64),
+        UINT32_C(0xC66F0987), UINT32_C(0x0AC50919), UINT32_C(0xD3E51BB5),
+        UINT32_C(0x1F4F1B2B), UINT32_C(0x91C01CC8), UINT32_C(0x5D6A1C56),
+        UINT32_C(0x57AF154F), UINT32_C(0x9B0515D1), UINT32_C(0x158A1232),
+        UINT32_C(0xD92012AC), UINT32_C(0x7CBB312B), UINT32_C(0xB01131B5),
+        UINT32_C(0x3E9E3656), UINT32_C(0xF23436C8), UINT32_C(0xF8F13FD1),
+        UINT32_C(0x345B3F4F), UINT32_C(0xBAD438AC), UINT32_C(0x767E3832),
+        UINT32_C(0xAF5E2A9E), UINT32_C(0x63F42A00), UINT32_C(0xED7B2DE3),
+        UINT32_C(0x21D12D7D), UINT32_C(0x2B142464), UINT32_C(0xE7BE24FA),
+        UINT32_C(0x69312319), UINT32_C(0xA59B2387), UINT32_C(0xF9766256),
+        UINT32_C(0x35DC62C8), UINT32_C(0xBB53652B), UINT32_C(0x77F965B5),
+        UINT32_C(0x7D3C6CAC), UINT32_C(0xB1966C32), UINT32_C(0x3F196BD1),
+        UINT32_C(0xF3B36B4F), UINT32_C(0x2A9379E3), UINT32_C(0xE639797D),
+        UINT32_C(0x68B67E9E), UINT32_C(0xA41C7E00), UINT32_C(0xAED97719),
+        UINT32_C(0x62737787), UINT32_C(0xECFC7064), UINT32_C(0x205670FA),
+        UINT32_C(0x85CD537D), UINT32_C(0x496753E3), UINT32_C(0xC7E85400),
+        UINT32_C(0x0B42549E), UINT32_C(0x01875D87), UINT32_C(0xCD2D5D19),
+        UINT32_C(0x43A25AFA), UINT32_C(0x8F085A64), UINT32_C(0x562848C8),
+        UINT32_C(0x9A824856), UINT32_C(0x140D4FB5), UINT32_C(0xD8A74F2B),
+        UINT32_C(0xD2624632), UINT32_C(0x1EC846AC), UINT32_C(0x9047414F),
+        UINT32_C(0x5CED41D1), UINT32_C(0x299DC2ED), UINT32_C(0xE537C273),
+        UINT32_C(0x6BB8C590), UINT32_C(0xA712C50E), UINT32_C(0xADD7CC17),
+        UINT32_C(0x617DCC89), UINT32_C(0xEFF2CB6A), UINT32_C(0x2358CBF4),
+        UINT32_C(0xFA78D958), UINT32_C(0x36D2D9C6), UINT32_C(0xB85DDE25),
+        UINT32_C(0x74F7DEBB), UINT32_C(0x7E32D7A2), UINT32_C(0xB298D73C),
+        UINT32_C(0x3C17D0DF), UINT32_C(0xF0BDD041), UINT32_C(0x5526F3C6),
+        UINT32_C(0x998CF358), UINT32_C(0x1703F4BB), UINT32_C(0xDBA9F425),
+        UINT32_C(0xD16CFD3C), UINT32_C(0x1DC6FDA2), UINT32_C(0x9349FA41),
+        UINT32_C(0x5FE3FADF), UINT32_C(0x86C3E873), UINT32_C(0x4A69E8ED),
+        UINT32_C(0xC4E6EF0E), UINT32_C(0x084CEF90), UINT32_C(0x0289E689),
+        UINT32_C(0xCE23E617), UINT32_C(0x40ACE1F4), UINT32_C(0x8C06E16A),
+        UINT32_C(0xD0EBA0BB), UINT32_C(0x1C41A025), UINT32_C(0x92CEA7C6),
+        UINT32_C(0x5E64A758), UINT32_C(0x54A1AE41), UINT32_C(0x980BAEDF),
+        UINT32_C(0x1684A93C), UINT32_C(0xDA2EA9A2), UINT32_C(0x030EBB0E),
+        UINT32_C(0xCFA4BB90), UINT32_C(0x412BBC73), UINT32_C(0x8D81BCED),
+        UINT32_C(0x8744B5F4), UINT32_C(0x4BEEB56A), UINT32_C(0xC561B289),
+        UINT32_C(0x09CBB217), UINT32_C(0xAC509190), UINT32_C(0x60FA910E),
+        UINT32_C(0xEE7596ED), UINT32_C(0x22DF9673), UINT32_C(0x281A9F6A),
+        UINT32_C(0xE4B09FF4), UINT32_C(0x6A3F9817), UINT32_C(0xA6959889),
+        UINT32_C(0x7FB58A25), UINT32_C(0xB31F8ABB), UINT32_C(0x3D908D58),
+        UINT32_C(0xF13A8DC6), UINT32_C(0xFBFF84DF), UINT32_C(0x37558441),
+        UINT32_C(0xB9DA83A2), UINT32_C(0x7570833C), UINT32_C(0x533B85DA),
+        UINT32_C(0x9F918544), UINT32_C(0x111E82A7), UINT32_C(0xDDB48239),
+        UINT32_C(0xD7718B20), UINT32_C(0x1BDB8BBE), UINT32_C(0x95548C5D),
+        UINT32_C(0x59FE8CC3), UINT32_C(0x80DE9E6F), UINT32_C(0x4C749EF1),
+        UINT32_C(0xC2FB9912), UINT32_C(0x0E51998C), UINT32_C(0x04949095),
+        UINT32_C(0xC83E900B), UINT32_C(0x46B197E8), UINT32_C(0x8A1B9776),
+        UINT32_C(0x2F80B4F1), UINT32_C(0xE32AB46F), UINT32_C(0x6DA5B38C),
+        UINT32_C(0xA10FB312), UINT32_C(0xABCABA0B), UINT32_C(0x6760BA95),
+        UINT32_C(0xE9EFBD76), UINT32_C(0x2545BDE8), UINT32_C(0xFC65AF44),
+        UINT32_C(0x30CFAFDA), UINT32_C(0xBE40A839), UINT32_C(0x72EAA8A7),
+        UINT32_C(0x782FA1BE), UINT32_C(0xB485A120), UINT32_C(0x3A0AA6C3),
+        UINT32_C(0xF6A0A65D), UINT32_C(0xAA4DE78C), UINT32_C(0x66E7E712),
+        UINT32_C(0xE868E0F1), UINT32_C(0x24C2E06F), UINT32_C(0x2E07E976),
+        UINT32_C(0xE2ADE9E8), UINT32_C(0x6C22EE0B), UINT32_C(0xA088EE95),
+        UINT32_C(0x79A8FC39), UINT32_C(0xB502FCA7), UINT32_C(0x3B8DFB44),
+        UINT32_C(0xF727FBDA), UINT32_C(0xFDE2F2C3), UINT32_C(0x3148F25D),
+        UINT32_C(0xBFC7F5BE), UINT32_C(0x736DF520), UINT32_C(0xD6F6D6A7),
+        UINT32_C(0x1A5CD639), UINT32_C(0x94D3D1DA), UINT32_C(0x5879D144),
+        UINT32_C(0x52BCD85D), UINT32_C(0x9E16D8C3), UINT32_C(0x1099DF20),
+        UINT32_C(0xDC33DFBE), UINT32_C(0x0513CD12), UINT32_C(0xC9B9CD8C),
+        UINT32_C(0x4736CA6F), UINT32_C(0x8B9CCAF1), UINT32_C(0x8159C3E8),
+        UINT32_C(0x4DF3C376), UINT32_C(0xC37CC495), UINT32_C(0x0FD6C40B),
+        UINT32_C(0x7AA64737), UINT32_C(0xB60C47A9), UINT32_C(0x3883404A),
+        UINT32_C(0xF42940D4), UINT32_C(0xFEEC49CD), UINT32_C(0x32464953),
+        UINT32_C(0xBCC94EB0), UINT32_C(0x70634E2E), UINT32_C(0xA9435C82),
+        UINT32_C(0x65E95C1C), UINT32_C(0xEB665BFF), UINT32_C(0x27CC5B61),
+        UINT32_C(0x2D095278), UINT32_C(0xE1A352E6), UINT32_C(0x6F2C5505),
+        UINT32_C(0xA386559B), UINT32_C(0x061D761C), UINT32_C(0xCAB77682),
+        UINT32_C(0x44387161), UINT32_C(0x889271FF), UINT32_C(0x825778E6),
+        UINT32_C(0x4EFD7878), UINT32_C(0xC0727F9B), UINT32_C(0x0CD87F05),
+        UINT32_C(0xD5F86DA9), UINT32_C(0x19526D37), UINT32_C(0x97DD6AD4),
+        UINT32_C(0x5B776A4A), UINT32_C(0x51B26353), UINT32_C(0x9D1863CD),
+        UINT32_C(0x1397642E), UINT32_C(0xDF3D64B0), UINT32_C(0x83D02561),
+        UINT32_C(0x4F7A25FF), UINT32_C(0xC1F5221C), UINT32_C(0x0D5F2282),
+        UINT32_C(0x079A2B9B), UINT32_C(0xCB302B05), UINT32_C(0x45BF2CE6),
+        UINT32_C(0x89152C78), UINT32_C(0x50353ED4), UINT32_C(0x9C9F3E4A),
+        UINT32_C(0x121039A9), UINT32_C(0xDEBA3937), UINT32_C(0xD47F302E),
+        UINT32_C(0x18D530B0), UINT32_C(0x965A3753), UINT32_C(0x5AF037CD),
+        UINT32_C(0xFF6B144A), UINT32_C(0x33C114D4), UINT32_C(0xBD4E1337),
+        UINT32_C(0x71E413A9), UINT32_C(0x7B211AB0), UINT32_C(0xB78B1A2E),
+        UINT32_C(0x39041DCD), UINT32_C(0xF5AE1D53), UINT32_C(0x2C8E0FFF),
+        UINT32_C(0xE0240F61), UINT32_C(0x6EAB0882), UINT32_C(0xA201081C),
+        UINT32_C(0xA8C40105), UINT32_C(0x646E019B), UINT32_C(0xEAE10678),
+        UINT32_C(0x264B06E6)
+    }};
+
+uint32_t _CRC32_Update(uint32_t crc, uint8_t byte) {
+  return (crc >> 8) ^ _CRC32_Table[0][(uint8_t)crc ^ byte];
+}
+
+uint32_t _CRC32_Sequence_update(uint32_t crc,
+                                const void* bytes,
+                                size_t size_in_bytes) {
+  const uint8_t* in = bytes;
+
+  /*
+   * Process eight bytes per iteration.  The bytes are combined explicitly so
+   * that the loop is independent of the byte order and the alignment.
+   */
+  while (size_in_bytes >= 8) {
+    crc ^= (uint32_t)in[0] | ((uint32_t)in[1] << 8) |
+           ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+    crc = _CRC32_Table[7][crc & 0xff] ^ _CRC32_Table[6][(crc >> 8) & 0xff] ^
+          _CRC32_Table[5][(crc >> 16) & 0xff] ^ _CRC32_Table[4][crc >> 24] ^
+          _CRC32_Table[3][in[4]] ^ _CRC32_Table[2][in[5]] ^
+          _CRC32_Table[1][in[6]] ^ _CRC32_Table[0][in[7]];
+    in += 8;
+    size_in_bytes -= 8;
+  }
+
+  while (size_in_bytes > 0) {
+    crc = (crc >> 8) ^ _CRC32_Table[0][(uint8_t)crc ^ *in];
+    ++in;
+    --size_in_bytes;
+  }
+
+  return crc;
+}
@@ -0,0 +1,785 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSImplCRC
+ *
+ * @brief This source file contains the implementation of
+ *   _CRC32C_Update() and _CRC32C_Sequence_update().
+ *
+ * The CRC-32C (Castagnoli) cyclic redundancy checksum is used for example by
+ * iSCSI, SCTP, ext4, and Btrfs.
+ */
+
+/*
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <rtems/crc.h>
+
+/*
+ * The first table is the byte-wise table of the reflected polynomial
+ * 0x82f63b78.  The other tables are derived by
+ * T[k][i] = (T[k - 1][i] >> 8) ^ T[0][T[k - 1][i] & 0xff] and are used to
+ * process eight bytes at once.
+ */
+static const uint32_t _CRC32C_Table[8][256] = {
+    {
+        UINT32_C(0x00000000), UINT32_C(0xF26B8303), UINT32_C(0xE13B70F7),
+        UINT32_C(0x1350F3F4), UINT32_C(0xC79A971F), UINT32_C(0x35F1141C),
+        UINT32_C(0x26A1E7E8), UINT32_C(0xD4CA64EB), UINT32_C(0x8AD958CF),
+        UINT32_C(0x78B2DBCC), UINT32_C(0x6BE22838), UINT32_C(0x9989AB3B),
+        UINT32_C(0x4D43CFD0), UINT32_C(0xBF284CD3), UINT32_C(0xAC78BF27),
+        UINT32_C(0x5E133C24), UINT32_C(0x105EC76F), UINT32_C(0xE235446C),
+        UINT32_C(0xF165B798), UINT32_C(0x030E349B), UINT32_C(0xD7C45070),
+        UINT32_C(0x25AFD373), UINT32_C(0x36FF2087), UINT32_C(0xC494A384),
+        UINT32_C(0x9A879FA0), UINT32_C(0x68EC1CA3), UINT32_C(0x7BBCEF57),
+        UINT32_C(0x89D76C54), UINT32_C(0x5D1D08BF), UINT32_C(0xAF768BBC),
+        UINT32_C(0xBC267848), UINT32_C(0x4E4DFB4B), UINT32_C(0x20BD8EDE),
+        UINT32_C(0xD2D60DDD), UINT32_C(0xC186FE29), UINT32_C(0x33ED7D2A),
+        UINT32_C(0xE72719C1), UINT32_C(0x154C9AC2), UINT32_C(0x061C6936),
+        UINT32_C(0xF477EA35), UINT32_C(0xAA64D611), UINT32_C(0x580F5512),
+        UINT32_C(0x4B5FA6E6), UINT32_C(0xB93425E5), UINT32_C(0x6DFE410E),
+        UINT32_C(0x9F95C20D), UINT32_C(0x8CC531F9), UINT32_C(0x7EAEB2FA),
+        UINT32_C(0x30E349B1), UINT32_C(0xC288CAB2), UINT32_C(0xD1D83946),
+        UINT32_C(0x23B3BA45), UINT32_C(0xF779DEAE), UINT32_C(0x05125DAD),
+        UINT32_C(0x1642AE59), UINT32_C(0xE4292D5A), UINT32_C(0xBA3A117E),
+        UINT32_C(0x4851927D), UINT32_C(0x5B016189), UINT32_C(0xA96AE28A),
+        UINT32_C(0x7DA08661), UINT32_C(0x8FCB0562), UINT32_C(0x9C9BF696),
+        UINT32_C(0x6EF07595), UINT32_C(0x417B1DBC), UINT32_C(0xB3109EBF),
+        UINT32_C(0xA0406D4B), UINT32_C(0x522BEE48), UINT32_C(0x86E18AA3),
+        UINT32_C(0x748A09A0), UINT32_C(0x67DAFA54), UINT32_C(0x95B17957),
+        UINT32_C(0xCBA24573), UINT32_C(0x39C9C670), UINT32_C(0x2A993584),
+        UINT32_C(0xD8F2B687), UINT32_C(0x0C38D26C), UINT32_C(0xFE53516F),
+        UINT32_C(0xED03A29B), UINT32_C(0x1F682198), UINT32_C(0x5125DAD3),
+        UINT32_C(0xA34E59D0), UINT32_C(0xB01EAA24), UINT32_C(0x42752927),
+        UINT32_C(0x96BF4DCC), UINT32_C(0x64D4CECF), UINT32_C(0x77843D3B),
+        UINT32_C(0x85EFBE38), UINT32_C(0xDBFC821C), UINT32_C(0x2997011F),
+        UINT32_C(0x3AC7F2EB), UINT32_C(0xC8AC71E8), UINT32_C(0x1C661503),
+        UINT32_C(0xEE0D9600), UINT32_C(0xFD5D65F4), UINT32_C(0x0F36E6F7),
+        UINT32_C(0x61C69362), UINT32_C(0x93AD1061), UINT32_C(0x80FDE395),
+        UINT32_C(0x72966096), UINT32_C(0xA65C047D), UINT32_C(0x5437877E),
+        UINT32_C(0x4767748A), UINT32_C(0xB50CF789), UINT32_C(0xEB1FCBAD),
+        UINT32_C(0x197448AE), UINT32_C(0x0A24BB5A), UINT32_C(0xF84F3859),
+        UINT32_C(0x2C855CB2), UINT32_C(0xDEEEDFB1), UINT32_C(0xCDBE2C45),
+        UINT32_C(0x3FD5AF46), UINT32_C(0x7198540D), UINT32_C(0x83F3D70E),
+        UINT32_C(0x90A324FA), UINT32_C(0x62C8A7F9), UINT32_C(0xB602C312),
+        UINT32_C(0x44694011), UINT32_C(0x5739B3E5), UINT32_C(0xA55230E6),
+        UINT32_C(0xFB410CC2), UINT32_C(0x092A8FC1), UINT32_C(0x1A7A7C35),
+        UINT32_C(0xE811FF36), UINT32_C(0x3CDB9BDD), UINT32_C(0xCEB018DE),
+        UINT32_C(0xDDE0EB2A), UINT32_C(0x2F8B6829), UINT32_C(0x82F63B78),
+        UINT32_C(0x709DB87B), UINT32_C(0x63CD4B8F), UINT32_C(0x91A6C88C),
+        UINT32_C(0x456CAC67), UINT32_C(0xB7072F64), UINT32_C(0xA457DC90),
+        UINT32_C(0x563C5F93), UINT32_C(0x082F63B7), UINT32_C(0xFA44E0B4),
+        UINT32_C(0xE9141340), UINT32_C(0x1B7F9043), UINT32_C(0xCFB5F4A8),
+        UINT32_C(0x3DDE77AB), UINT32_C(0x2E8E845F), UINT32_C(0xDCE5075C),
+        UINT32_C(0x92A8FC17), UINT32_C(0x60C37F14), UINT32_C(0x73938CE0),
+        UINT32_C(0x81F80FE3), UINT32_C(0x55326B08), UINT32_C(0xA759E80B),
+        UINT32_C(0xB4091BFF), UINT32_C(0x466298FC), UINT32_C(0x1871A4D8),
+        UINT32_C(0xEA1A27DB), UINT32_C(0xF94AD42F), UINT32_C(0x0B21572C),
+        UINT32_C(0xDFEB33C7), UINT32_C(0x2D80B0C4), UINT32_C(0x3ED04330),
+        UINT32_C(0xCCBBC033), UINT32_C(0xA24BB5A6), UINT32_C(0x502036A5),
+        UINT32_C(0x4370C551), UINT32_C(0xB11B4652), UINT32_C(0x65D122B9),
+        UINT32_C(0x97BAA1BA), UINT32_C(0x84EA524E), UINT32_C(0x7681D14D),
+        UINT32_C(0x2892ED69), UINT32_C(0xDAF96E6A), UINT32_C(0xC9A99D9E),
+        UINT32_C(0x3BC21E9D), UINT32_C(0xEF087A76), UINT32_C(0x1D63F975),
+        UINT32_C(0x0E330A81), UINT32_C(0xFC588982), UINT32_C(0xB21572C9),
+        UINT32_C(0x407EF1CA), UINT32_C(0x532E023E), UINT32_C(0xA145813D),
+        UINT32_C(0x758FE5D6), UINT32_C(0x87E466D5), UINT32_C(0x94B49521),
+        UINT32_C(0x66DF1622), UINT32_C(0x38CC2A06), UINT32_C(0xCAA7A905),
+        UINT32_C(0xD9F75AF1), UINT32_C(0x2B9CD9F2), UINT32_C(0xFF56BD19),
+        UINT32_C(0x0D3D3E1A), UINT32_C(0x1E6DCDEE), UINT32_C(0xEC064EED),
+        UINT32_C(0xC38D26C4), UINT32_C(0x31E6A5C7), UINT32_C(0x22B65633),
+        UINT32_C(0xD0DDD530), UINT32_C(0x0417B1DB), UINT32_C(0xF67C32D8),
+        UINT32_C(0xE52CC12C), UINT32_C(0x1747422F), UINT32_C(0x49547E0B),
+        UINT32_C(0xBB3FFD08), UINT32_C(0xA86F0EFC), UINT32_C(0x5A048DFF),
+        UINT32_C(0x8ECEE914), UINT32_C(0x7CA56A17), UINT32_C(0x6FF599E3),
+        UINT32_C(0x9D9E1AE0), UINT32_C(0xD3D3E1AB), UINT32_C(0x21B862A8),
+        UINT32_C(0x32E8915C), UINT32_C(0xC083125F), UINT32_C(0x144976B4),
+        UINT32_C(0xE622F5B7), UINT32_C(0xF5720643), UINT32_C(0x07198540),
+        UINT32_C(0x590AB964), UINT32_C(0xAB613A67), UINT32_C(0xB831C993),
+        UINT32_C(0x4A5A4A90), UINT32_C(0x9E902E7B), UINT32_C(0x6CFBAD78),
+        UINT32_C(0x7FAB5E8C), UINT32_C(0x8DC0DD8F), UINT32_C(0xE330A81A),
+        UINT32_C(0x115B2B19), UINT32_C(0x020BD8ED), UINT32_C(0xF0605BEE),
+        UINT32_C(0x24AA3F05), UINT32_C(0xD6C1BC06), UINT32_C(0xC5914FF2),
+        UINT32_C(0x37FACCF1), UINT32_C(0x69E9F0D5), UINT32_C(0x9B8273D6),
+        UINT32_C(0x88D28022), UINT32_C(0x7AB90321), UINT32_C(0xAE7367CA),
+        UINT32_C(0x5C18E4C9), UINT32_C(0x4F48173D), UINT32_C(0xBD23943E),
+        UINT32_C(0xF36E6F75), UINT32_C(0x0105EC76), UINT32_C(0x12551F82),
+        UINT32_C(0xE03E9C81), UINT32_C(0x34F4F86A), UINT32_C(0xC69F7B69),
+        UINT32_C(0xD5CF889D), UINT32_C(0x27A40B9E), UINT32_C(0x79B737BA),
+        UINT32_C(0x8BDCB4B9), UINT32_C(0x988C474D), UINT32_C(0x6AE7C44E),
+        UINT32_C(0xBE2DA0A5), UINT32_C(0x4C4623A6), UINT32_C(0x5F16D052),
+        UINT32_C(0xAD7D5351)
+    },
+    {
+        UINT32_C(0x00000000), UINT32_C(0x13A29877), UINT32_C(0x274530EE),
+        UINT32_C(0x34E7A899), UINT32_C(0x4E8A61DC), UINT32_C(0x5D28F9AB),
+        UINT32_C(0x69CF5132), UINT32_C(0x7A6DC945), UINT32_C(0x9D14C3B8),
+        UINT32_C(0x8EB65BCF), UINT32_C(0xBA51F356), UINT32_C(0xA9F36B21),
+        UINT32_C(0xD39EA264), UINT32_C(0xC03C3A13), UINT32_C(0xF4DB928A),
+        UINT32_C(0xE7790AFD), UINT32_C(0x3FC5F181), UINT32_C(0x2C6769F6),
+        UINT32_C(0x1880C16F), UINT32_C(0x0B225918), UINT32_C(0x714F905D),
+        UINT32_C(0x62ED082A), UINT32_C(0x560AA0B3), UINT32_C(0x45A838C4),
+        UINT32_C(0xA2D13239), UINT32_C(0xB173AA4E), UINT32_C(0x859402D7),
+        UINT32_C(0x96369AA0), UINT32_C(0xEC5B53E5), UINT32_C(0xFFF9CB92),
+        UINT32_C(0xCB1E630B), UINT32_C(0xD8BCFB7C), UINT32_C(0x7F8BE302),
+        UINT32_C(0x6C297B75), UINT32_C(0x58CED3EC), UINT32_C(0x4B6C4B9B),
+        UINT32_C(0x310182DE), UINT32_C(0x22A31AA9), UINT32_C(0x1644B230),
+        UINT32_C(0x05E62A47), UINT32_C(0xE29F20BA), UINT32_C(0xF13DB8CD),
+        UINT32_C(0xC5DA1054), UINT32_C(0xD6788823), UINT32_C(0xAC154166),
+        UINT32_C(0xBFB7D911), UINT32_C(0x8B507188), UINT32_C(0x98F2E9FF),
+        UINT32_C(0x404E1283), UINT32_C(0x53EC8AF4), UINT32_C(0x670B226D),
+        UINT32_C(0x74A9BA1A), UINT32_C(0x0EC4735F), UINT32_C(0x1D66EB28),
+        UINT32_C(0x298143B1), UINT32_C(0x3A23DBC6), UINT32_C(0xDD5AD13B),
+        UINT32_C(0xCEF8494C), UINT32_C(0xFA1FE1D5), UINT32_C(0xE9BD79A2),
+        UINT32_C(0x93D0B0E7), UINT32_C(0x80722890), UINT32_C(0xB4958009),
+        UINT32_C(0xA737187E), UINT32_C(0xFF17C604), UINT32_C(0xECB55E73),
+        UINT32_C(0xD852F6EA), UINT32_C(0xCBF06E9D), UINT32_C(0xB19DA7D8),
+        UINT32_C(0xA23F3FAF), UINT32_C(0x96D89736), UINT32_C(0x857A0F41),
+        UINT32_C(0x620305BC), UINT32_C(0x71A19DCB), UINT32_C(0x45463552),
+        UINT32_C(0x56E4AD25), UINT32_C(0x2C896460), UINT32_C(0x3F2BFC17),
+        UINT32_C(0x0BCC548E), UINT32_C(0x186ECCF9), UINT32_C(0xC0D23785),
+        UINT32_C(0xD370AFF2), UINT32_C(0xE797076B), UINT32_C(0xF4359F1C),
+        UINT32_C(0x8E585659), UINT32_C(0x9DFACE2E), UINT32_C(0xA91D66B7),
+        UINT32_C(0xBABFFEC0), UINT32_C(0x5DC6F43D), UINT32_C(0x4E646C4A),
+        UINT32_C(0x7A83C4D3), UINT32_C(0x69215CA4), UINT32_C(0x134C95E1),
+        UINT32_C(0x00EE0D96), UINT32_C(0x3409A50F), UINT32_C(0x27AB3D78),
+        UINT32_C(0x809C2506), UINT32_C(0x933EBD71), UINT32_C(0xA7D915E8),
+        UINT32_C(0xB47B8D9F), UINT32_C(0xCE1644DA), UINT32_C(0xDDB4DCAD),
+        UINT32_C(0xE9537434), UINT32_C(0xFAF1EC43), UINT32_C(0x1D88E6BE),
+        UINT32_C(0x0E2A7EC9), UINT32_C(0x3ACDD650), UINT32_C(0x296F4E27),
+        UINT32_C(0x53028762), UINT32_C(0x40A01F15), UINT32_C(0x7447B78C),
+        UINT32_C(0x67E52FFB), UINT32_C(0xBF59D487), UINT32_C(0xACFB4CF0),
+        UINT32_C(0x981CE469), UINT32_C(0x8BBE7C1E), UINT32_C(0xF1D3B55B),
+        UINT32_C(0xE2712D2C), UINT32_C(0xD69685B5), UINT32_C(0xC5341DC2),
+        UINT32_C(0x224D173F), UINT32_C(0x31EF8F48), UINT32_C(0x050827D1),
+        UINT32_C(0x16AABFA6), UINT32_C(0x6CC776E3), UINT32_C(0x7F65EE94),
+        UINT32_C(0x4B82460D), UINT32_C(0x5820DE7A), UINT32_C(0xFBC3FAF9),
+        UINT32_C(0xE861628E), UINT32_C(0xDC86CA17), UINT32_C(0xCF245260),
+        UINT32_C(0xB5499B25), UINT32_C(0xA6EB0352), UINT32_C(0x920CABCB),
+        UINT32_C(0x81AE33BC), UINT32_C(0x66D73941), UINT32_C(0x7575A136),
+        UINT32_C(0x419209AF), UINT32_C(0x523091D8), UINT32_C(0x285D589D),
+        UINT32_C(0x3BFFC0EA), UINT32_C(0x0F186873), UINT32_C(0x1CBAF004),
+        UINT32_C(0xC4060B78), UINT32_C(0xD7A4930F), UINT32_C(0xE3433B96),
+        UINT32_C(0xF0E1A3E1), UINT32_C(0x8A8C6AA4), UINT32_C(0x992EF2D3),
+        UINT32_C(0xADC95A4A), UINT32_C(0xBE6BC23D), UINT32_C(0x5912C8C0),
+        UINT32_C(0x4AB050B7), UINT32_C(0x7E57F82E), UINT32_C(0x6DF56059),
+        UINT32_C(0x1798A91C), UINT32_C(0x043A316B), UINT32_C(0x30DD99F2),
+        UINT32_C(0x237F0185), UINT32_C(0x844819FB), UINT32_C(0x97EA818C),
+        UINT32_C(0xA30D2915), UINT32_C(0xB0AFB162), UINT32_C(0xCAC27827),
+        UINT32_C(0xD960E050), UINT32_C(0xED8748C9), UINT32_C(0xFE25D0BE),
+        UINT32_C(0x195CDA43), UINT32_C(0x0AFE4234), UINT32_C(0x3E19EAAD),
+        UINT32_C(0x2DBB72DA), UINT32_C(0x57D6BB9F), UINT32_C(0x447423E8),
+        UINT32_C(0x70938B71), UINT32_C(0x63311306), UINT32_C(0xBB8DE87A),
+        UINT32_C(0xA82F700D), UINT32_C(0x9CC8D894), UINT32_C(0x8F6A40E3),
+        UINT32_C(0xF50789A6), UINT32_C(0xE6A511D1), UINT32_C(0xD242B948),
+        UINT32_C(0xC1E0213F), UINT32_C(0x26992BC2), UINT32_C(0x353BB3B5),
+        UINT32_C(0x01DC1B2C), UINT32_C(0x127E835B), UINT32_C(0x68134A1E),
+        UINT32_C(0x7BB1D269), UINT32_C(0x4F567AF0), UINT32_C(0x5CF4E287),
+        UINT32_C(0x04D43CFD), UINT32_C(0x1776A48A), UINT32_C(0x23910C13),
+        UINT32_C(0x30339464), UINT32_C(0x4A5E5D21), UINT32_C(0x59FCC556),
+        UINT32_C(0x6D1B6DCF), UINT32_C(0x7EB9F5B8), UINT32_C(0x99C0FF45),
+        UINT32_C(0x8A626732), UINT32_C(0xBE85CFAB), UINT32_C(0xAD2757DC),
+        UINT32_C(0xD74A9E99), UINT32_C(0xC4E806EE), UINT32_C(0xF00FAE77),
+        UINT32_C(0xE3AD3600), UINT32_C(0x3B11CD7C), UINT32_C(0x28B3550B),
+        UINT32_C(0x1C54FD92), UINT32_C(0x0FF665E5), UINT32_C(0x759BACA0),
+        UINT32_C(0x663934D7), UINT32_C(0x52DE9C4E), UINT32_C(0x417C0439),
+        UINT32_C(0xA6050EC4), UINT32_C(0xB5A796B3), UINT32_C(0x81403E2A),
+        UINT32_C(0x92E2A65D), UINT32_C(0xE88F6F18), UINT32_C(0xFB2DF76F),
+        UINT32_C(0xCFCA5FF6), UINT32_C(0xDC68C781), UINT32_C(0x7B5FDFFF),
+        UINT32_C(0x68FD4788), UINT32_C(0x5C1AEF11), UINT32_C(0x4FB87766),
+        UINT32_C(0x35D5BE23), UINT32_C(0x26772654), UINT32_C(0x12908ECD),
+        UINT32_C(0x013216BA), UINT32_C(0xE64B1C47), UINT32_C(0xF5E98430),
+        UINT32_C(0xC10E2CA9), UINT32_C(0xD2ACB4DE), UINT32_C(0xA8C17D9B),
+        UINT32_C(0xBB63E5EC), UINT32_C(0x8F844D75), UINT32_C(0x9C26D502),
+        UINT32_C(0x449A2E7E), UINT32_C(0x5738B609), UINT32_C(0x63DF1E90),
+        UINT32_C(0x707D86E7), UINT32_C(0x0A104FA2), UINT32_C(0x19B2D7D5),
+        UINT32_C(0x2D557F4C), UINT32_C(0x3EF7E73B), UINT32_C(0xD98EEDC6),
+        UINT32_C(0xCA2C75B1), UINT32_C(0xFECBDD28), UINT32_C(0xED69455F),
+        UINT32_C(0x97048C1A), UINT32_C(0x84A6146D), UINT32_C(0xB041BCF4),
+        UINT32_C(0xA3E32483)
+    },
+    {
+        UINT32_C(0x00000000), UINT32_C(0xA541927E), UINT32_C(0x4F6F520D),
+        UINT32_C(0xEA2EC073), UINT32_C(0x9EDEA41A), UINT32_C(0x3B9F3664),
+        UINT32_C(0xD1B1F617), UINT32_C(0x74F06469), UINT32_C(0x38513EC5),
+        UINT32_C(0x9D10ACBB), UINT32_C(0x773E6CC8), UINT32_C(0xD27FFEB6),
+        UINT32_C(0xA68F9ADF), UINT32_C(0x03CE08A1), UINT32_C(0xE9E0C8D2),
+        UINT32_C(0x4CA15AAC), UINT32_C(0x70A27D8A), UINT32_C(0xD5E3EFF4),
+        UINT32_C(0x3FCD2F87), UINT32_C(0x9A8CBDF9), UINT32_C(0xEE7CD990),
+        UINT32_C(0x4B3D4BEE), UINT32_C(0xA1138B9D), UINT32_C(0x045219E3),
+        UINT32_C(0x48F3434F), UINT32_C(0xEDB2D131), UINT32_C(0x079C1142),
+        UINT32_C(0xA2DD833C), UINT32_C(0xD62DE755), UINT32_C(0x736C752B),
+        UINT32_C(0x9942B558), UINT32_C(0x3C032726), UINT32_C(0xE144FB14),
+        UINT32_C(0x4405696A), UINT32_C(0xAE2BA919), UINT32_C(0x0B6A3B67),
+        UINT32_C(0x7F9A5F0E), UINT32_C(0xDADBCD70), UINT32_C(0x30F50D03),
+        UINT32_C(0x95B49F7D), UINT32_C(0xD915C5D1), UINT32_C(0x7C5457AF),
+        UINT32_C(0x967A97DC), UINT32_C(0x333B05A2), UINT32_C(0x47CB61CB),
+        UINT32_C(0xE28AF3B5), UINT32_C(0x08A433C6), UINT32_C(0xADE5A1B8),
+        UINT32_C(0x91E6869E), UINT32_C(0x34A714E0), UINT32_C(0xDE89D493),
+        UINT32_C(0x7BC846ED), UINT32_C(0x0F382284), UINT32_C(0xAA79B0FA),
+        UINT32_C(0x40577089), UINT32_C(0xE516E2F7), UINT32_C(0xA9B7B85B),
+        UINT32_C(0x0CF62A25), UINT32_C(0xE6D8EA56), UINT32_C(0x43997828),
+        UINT32_C(0x37691C41), UINT32_C(0x92288E3F), UINT32_C(0x78064E4C),
+        UINT32_C(0xDD47DC32), UINT32_C(0xC76580D9), UINT32_C(0x622412A7),
+        UINT32_C(0x880AD2D4), UINT32_C(0x2D4B40AA), UINT32_C(0x59BB24C3),
+        UINT32_C(0xFCFAB6BD), UINT32_C(0x16D476CE), UINT32_C(0xB395E4B0),
+        UINT32_C(0xFF34BE1C), UINT32_C(0x5A752C62), UINT32_C(0xB05BEC11),
+        UINT32_C(0x151A7E6F), UINT32_C(0x61EA1A06), UINT32_C(0xC4AB8878),
+        UINT32_C(0x2E85480B), UINT32_C(0x8BC4DA75), UINT32_C(0xB7C7FD53),
+        UINT32_C(0x12866F2D), UINT32_C(0xF8A8AF5E), UINT32_C(0x5DE93D20),
+        UINT32_C(0x29195949), UINT32_C(0x8C58CB37), UINT32_C(0x66760B44),
+        UINT32_C(0xC337993A), UINT32_C(0x8F96C396), UINT32_C(0x2AD751E8),
+        UINT32_C(0xC0F9919B), UINT32_C(0x65B803E5), UINT32_C(0x1148678C),
+        UINT32_C(0xB409F5F2), UINT32_C(0x5E273581), UINT32_C(0xFB66A7FF),
+        UINT32_C(0x26217BCD), UINT32_C(0x8360E9B3), UINT32_C(0x694E29C0),
+        UINT32_C(0xCC0FBBBE), UINT32_C(0xB8FFDFD7), UINT32_C(0x1DBE4DA9),
+        UINT32_C(0xF7908DDA), UINT32_C(0x52D11FA4), UINT32_C(0x1E704508),
+        UINT32_C(0xBB31D776), UINT32_C(0x511F1705), UINT32_C(0xF45E857B),
+        UINT32_C(0x80AEE112), UINT32_C(0x25EF736C), UINT32_C(0xCFC1B31F),
+        UINT32_C(0x6A802161), UINT32_C(0x56830647), UINT32_C(0xF3C29439),
+        UINT32_C(0x19EC544A), UINT32_C(0xBCADC634), UINT32_C(0xC85DA25D),
+        UINT32_C(0x6D1C3023), UINT32_C(0x8732F050), UINT32_C(0x2273622E),
+        UINT32_C(0x6ED23882), UINT32_C(0xCB93AAFC), UINT32_C(0x21BD6A8F),
+        UINT32_C(0x84FCF8F1), UINT32_C(0xF00C9C98), UINT32_C(0x554D0EE6),
+        UINT32_C(0xBF63CE95), UINT32_C(0x1A225CEB), UINT32_C(0x8B277743),
+        UINT32_C(0x2E66E53D), UINT32_C(0xC448254E), UINT32_C(0x6109B730),
+        UINT32_C(0x15F9D359), UINT32_C(0xB0B84127), UINT32_C(0x5A968154),
+        UINT32_C(0xFFD7132A), UINT32_C(0xB3764986), UINT32_C(0x1637DBF8),
+        UINT32_C(0xFC191B8B), UINT32_C(0x595889F5), UINT32_C(0x2DA8ED9C),
+        UINT32_C(0x88E97FE2), UINT32_C(0x62C7BF91), UINT32_C(0xC7862DEF),
+        UINT32_C(0xFB850AC9), UINT32_C(0x5EC498B7), UINT32_C(0xB4EA58C4),
+        UINT32_C(0x11ABCABA), UINT32_C(0x655BAED3), UINT32_C(0xC01A3CAD),
+        UINT32_C(0x2A34FCDE), UINT32_C(0x8F756EA0), UINT32_C(0xC3D4340C),
+        UINT32_C(0x6695A672), UINT32_C(0x8CBB6601), UINT32_C(0x29FAF47F),
+        UINT32_C(0x5D0A9016), UINT32_C(0xF84B0268), UINT32_C(0x1265C21B),
+        UINT32_C(0xB7245065), UINT32_C(0x6A638C57), UINT32_C(0xCF221E29),
+        UINT32_C(0x250CDE5A), UINT32_C(0x804D4C24), UINT32_C(0xF4BD284D),
+        UINT32_C(0x51FCBA33), UINT32_C(0xBBD27A40), UINT32_C(0x1E93E83E),
+        UINT32_C(0x5232B292), UINT32_C(0xF77320EC), UINT32_C(0x1D5DE09F),
+        UINT32_C(0xB81C72E1), UINT32_C(0xCCEC1688), UINT32_C(0x69AD84F6),
+        UINT32_C(0x83834485), UINT32_C(0x26C2D6FB), UINT32_C(0x1AC1F1DD),
+        UINT32_C(0xBF8063A3), UINT32_C(0x55AEA3D0), UINT32_C(0xF0EF31AE),
+        UINT32_C(0x841F55C7), UINT32_C(0x215EC7B9), UINT32_C(0xCB7007CA),
+        UINT32_C(0x6E3195B4), UINT32_C(0x2290CF18), UINT32_C(0x87D15D66),
+        UINT32_C(0x6DFF9D15), UINT32_C(0xC8BE0F6B), UINT32_C(0xBC4E6B02),
+        UINT32_C(0x190FF97C), UINT32_C(0xF321390F), UINT32_C(0x5660AB71),
+        UINT32_C(0x4C42F79A), UINT32_C(0xE90365E4), UINT32_C(0x032DA597),
+        UINT32_C(0xA66C37E9), UINT32_C(0xD29C5380), UINT32_C(0x77DDC1FE),
+        UINT32_C(0x9DF3018D), UINT32_C(0x38B293F3), UINT32_C(0x7413C95F),
+        UINT32_C(0xD1525B21), UINT32_C(0x3B7C9B52), UINT32_C(0x9E3D092C),
+        UINT32_C(0xEACD6D45), UINT32_C(0x4F8CFF3B), UINT32_C(0xA5A23F48),
+        UINT32_C(0x00E3AD36), UINT32_C(0x3CE08A10), UINT32_C(0x99A1186E),
+        UINT32_C(0x738FD81D), UINT32_C(0xD6CE4A63), UINT32_C(0xA23E2E0A),
+        UINT32_C(0x077FBC74), UINT32_C(0xED517C07), UINT32_C(0x4810EE79),
+        UINT32_C(0x04B1B4D5), UINT32_C(0xA1F026AB), UINT32_C(0x4BDEE6D8),
+        UINT32_C(0xEE9F74A6), UINT32_C(0x9A6F10CF), UINT32_C(0x3F2E82B1),
+        UINT32_C(0xD50042C2), UINT32_C(0x7041D0BC), UINT32_C(0xAD060C8E),
+        UINT32_C(0x08479EF0), UINT32_C(0xE2695E83), UINT32_C(0x4728CCFD),
+        UINT32_C(0x33D8A894), UINT32_C(0x96993AEA), UINT32_C(0x7CB7FA99),
+        UINT32_C(0xD9F668E7), UINT32_C(0x9557324B), UINT32_C(0x3016A035),
+        UINT32_C(0xDA386046), UINT32_C(0x7F79F238), UINT32_C(0x0B899651),
+        UINT32_C(0xAEC8042F), UINT32_C(0x44E6C45C), UINT32_C(0xE1A75622),
+        UINT32_C(0xDDA47104), UINT32_C(0x78E5E37A), UINT32_C(0x92CB2309),
+        UINT32_C(0x378AB177), UINT32_C(0x437AD51E), UINT32_C(0xE63B4760),
+        UINT32_C(0x0C158713), UINT32_C(0xA954156D), UINT32_C(0xE5F54FC1),
+        UINT32_C(0x40B4DDBF), UINT32_C(0xAA9A1DCC), UINT32_C(0x0FDB8FB2),
+        UINT32_C(0x7B2BEBDB), UINT32_C(0xDE6A79A5), UINT32_C(0x3444B9D6),
+        UINT32_C(0x91052BA8)
+    },
+    {
+        UINT32_C(0x00000000), UINT32_C(0xDD45AAB8), UINT32_C(0xBF672381),
+        UINT32_C(0x62228939), UINT32_C(0x7B2231F3), UINT32_C(0xA6679B4B),
+        UINT32_C(0xC4451272), UINT32_C(0x1900B8CA), UINT32_C(0xF64463E6),
+        UINT32_C(0x2B01C95E), UINT32_C(0x49234067), UINT32_C(0x9466EADF),
+        UINT32_C(0x8D665215), UINT32_C(0x5023F8AD), UINT32_C(0x32017194),
+        UINT32_C(0xEF44DB2C), UINT32_C(0xE964B13D), UINT32_C(0x34211B85),
+        UINT32_C(0x560392BC), UINT32_C(0x8B463804), UINT32_C(0x924680CE),
+        UINT32_C(0x4F032A76), UINT32_C(0x2D21A34F), UINT32_C(0xF06409F7),
+        UINT32_C(0x1F20D2DB), UINT32_C(0xC2657863), UINT32_C(0xA047F15A),
+        UINT32_C(0x7D025BE2), UINT32_C(0x6402E328), UINT32_C(0xB9474990),
+        UINT32_C(0xDB65C0A9), UINT32_C(0x06206A11), UINT32_C(0xD725148B),
+        UINT32_C(0x0A60BE33), UINT32_C(0x6842370A), UINT32_C(0xB5079DB2),
+        UINT32_C(0xAC072578), UINT32_C(0x71428FC0), UINT32_C(0x136006F9),
+        UINT32_C(0xCE25AC41), UINT32_C(0x2161776D), UINT32_C(0xFC24DDD5),
+        UINT32_C(0x9E0654EC), UINT32_C(0x4343FE54), UINT32_C(0x5A43469E),
+        UINT32_C(0x8706EC26), UINT32_C(0xE524651F), UINT32_C(0x3861CFA7),
+        UINT32_C(0x3E41A5B6), UINT32_C(0xE3040F0E), UINT32_C(0x81268637),
+        UINT32_C(0x5C632C8F), UINT32_C(0x45639445), UINT32_C(0x98263EFD),
+        UINT32_C(0xFA04B7C4), UINT32_C(0x27411D7C), UINT32_C(0xC805C650),
+        UINT32_C(0x15406CE8), UINT32_C(0x7762E5D1), UINT32_C(0xAA274F69),
+        UINT32_C(0xB327F7A3), UINT32_C(0x6E625D1B), UINT32_C(0x0C40D422),
+        UINT32_C(0xD1057E9A), UINT32_C(0xABA65FE7), UINT32_C(0x76E3F55F),
+        UINT32_C(0x14C17C66), UINT32_C(0xC984D6DE), UINT32_C(0xD0846E14),
+        UINT32_C(0x0DC1C4AC), UINT32_C(0x6FE34D95), UINT32_C(0xB2A6E72D),
+        UINT32_C(0x5DE23C01), UINT32_C(0x80A796B9), UINT32_C(0xE2851F80),
+        UINT32_C(0x3FC0B538), UINT32_C(0x26C00DF2), UINT32_C(0xFB85A74A),
+        UINT32_C(0x99A72E73), UINT32_C(0x44E284CB), UINT32_C(0x42C2EEDA),
+        UINT32_C(0x9F874462), UINT32_C(0xFDA5CD5B), UINT32_C(0x20E067E3),
+        UINT32_C(0x39E0DF29), UINT32_C(0xE4A57591), UINT32_C(0x8687FCA8),
+        UINT32_C(0x5BC25610), UINT32_C(0xB4868D3C), UINT32_C(0x69C32784),
+        UINT32_C(0x0BE1AEBD), UINT32_C(0xD6A40405), UINT32_C(0xCFA4BCCF),
+        UINT32_C(0x12E11677), UINT32_C(0x70C39F4E), UINT32_C(0xAD8635F6),
+        UINT32_C(0x7C834B6C), UINT32_C(0xA1C6E1D4), UINT32_C(0xC3E468ED),
+        UINT32_C(0x1EA1C255), UINT32_C(0x07A17A9F), UINT32_C(0xDAE4D027),
+        UINT32_C(0xB8C6591E), UINT32_C(0x6583F3A6), UINT32_C(0x8AC7288A),
+        UINT32_C(0x57828232), UINT32_C(0x35A00B0B), UINT32_C(0xE8E5A1B3),
+        UINT32_C(0xF1E51979), UINT32_C(0x2CA0B3C1), UINT32_C(0x4E823AF8),
+        UINT32_C(0x93C79040), UINT32_C(0x95E7FA51), UINT32_C(0x48A250E9),
+        UINT32_C(0x2A80D9D0), UINT32_C(0xF7C57368), UINT32_C(0xEEC5CBA2),
+        UINT32_C(0x3380611A), UINT32_C(0x51A2E823), UINT32_C(0x8CE7429B),
+        UINT32_C(0x63A399B7), UINT32_C(0xBEE6330F), UINT32_C(0xDCC4BA36),
+        UINT32_C(0x0181108E), UINT32_C(0x1881A844), UINT32_C(0xC5C402FC),
+        UINT32_C(0xA7E68BC5), UINT32_C(0x7AA3217D), UINT32_C(0x52A0C93F),
+        UINT32_C(0x8FE56387), UINT32_C(0xEDC7EABE), UINT32_C(0x30824006),
+        UINT32_C(0x2982F8CC), UINT32_C(0xF4C75274), UINT32_C(0x96E5DB4D),
+        UINT32_C(0x4BA071F5), UINT32_C(0xA4E4AAD9), UINT32_C(0x79A10061),
+        UINT32_C(0x1B838958), UINT32_C(0xC6C623E0), UINT32_C(0xDFC69B2A),
+        UINT32_C(0x02833192), UINT32_C(0x60A1B8AB), UINT32_C(0xBDE41213),
+        UINT32_C(0xBBC47802), UINT32_C(0x6681D2BA), UINT32_C(0x04A35B83),
+        UINT32_C(0xD9E6F13B), UINT32_C(0xC0E649F1), UINT32_C(0x1DA3E349),
+        UINT32_C(0x7F816A70), UINT32_C(0xA2C4C0C8), UINT32_C(0x4D801BE4),
+        UINT32_C(0x90C5B15C), UINT32_C(0xF2E73865), UINT32_C(0x2FA292DD),
+        UINT32_C(0x36A22A17), UINT32_C(0xEBE780AF), UINT32_C(0x89C50996),
+        UINT32_C(0x5480A32E), UINT32_C(0x8585DDB4), UINT32_C(0x58C0770C),
+        UINT32_C(0x3AE2FE35), UINT32_C(0xE7A7548D), UINT32_C(0xFEA7EC47),
+        UINT32_C(0x23E246FF), UINT32_C(0x41C0CFC6), UINT32_C(0x9C85657E),
+        UINT32_C(0x73C1BE52), UINT32_C(0xAE8414EA), UINT32_C(0xCCA69DD3),
+        UINT32_C(0x11E3376B), UINT32_C(0x08E38FA1), UINT32_C(0xD5A62519),
+        UINT32_C(0xB784AC20), UINT32_C(0x6AC10698), UINT32_C(0x6CE16C89),
+        UINT32_C(0xB1A4C631), UINT32_C(0xD3864F08), UINT32_C(0x0EC3E5B0),
+        UINT32_C(0x17C35D7A), UINT32_C(0xCA86F7C2), UINT32_C(0xA8A47EFB),
+        UINT32_C(0x75E1D443), UINT32_C(0x9AA50F6F), UINT32_C(0x47E0A5D7),
+        UINT32_C(0x25C22CEE), UINT32_C(0xF8878656), UINT32_C(0xE1873E9C),
+        UINT32_C(0x3CC29424), UINT32_C(0x5EE01D1D), UINT32_C(0x83A5B7A5),
+        UINT32_C(0xF90696D8), UINT32_C(0x24433C60), UINT32_C(0x4661B559),
+        UINT32_C(0x9B241FE1), UINT32_C(0x8224A72B), UINT32_C(0x5F610D93),
+        UINT32_C(0x3D4384AA), UINT32_C(0xE0062E12), UINT32_C(0x0F42F53E),
+        UINT32_C(0xD2075F86), UINT32_C(0xB025D6BF), UINT32_C(0x6D607C07),
+        UINT32_C(0x7460C4CD), UINT32_C(0xA9256E75), UINT32_C(0xCB07E74C),
+        UINT32_C(0x16424DF4), UINT32_C(0x106227E5), UINT32_C(0xCD278D5D),
+        UINT32_C(0xAF050464), UINT32_C(0x7240AEDC), UINT32_C(0x6B401616),
+        UINT32_C(0xB605BCAE), UINT32_C(0xD4273597), UINT32_C(0x09629F2F),
+        UINT32_C(0xE6264403), UINT32_C(0x3B63EEBB), UINT32_C(0x59416782),
+        UINT32_C(0x8404CD3A), UINT32_C(0x9D0475F0), UINT32_C(0x4041DF48),
+        UINT32_C(0x22635671), UINT32_C(0xFF26FCC9), UINT32_C(0x2E238253),
+        UINT32_C(0xF36628EB), UINT32_C(0x9144A1D2), UINT32_C(0x4C010B6A),
+        UINT32_C(0x5501B3A0), UINT32_C(0x88441918), UINT32_C(0xEA669021),
+        UINT32_C(0x37233A99), UINT32_C(0xD867E1B5), UINT32_C(0x05224B0D),
+        UINT32_C(0x6700C234), UINT32_C(0xBA45688C), UINT32_C(0xA345D046),
+        UINT32_C(0x7E007AFE), UINT32_C(0x1C22F3C7), UINT32_C(0xC167597F),
+        UINT32_C(0xC747336E), UINT32_C(0x1A0299D6), UINT32_C(0x782010EF),
+        UINT32_C(0xA565BA57), UINT32_C(0xBC65029D), UINT32_C(0x6120A825),
+        UINT32_C(0x0302211C), UINT32_C(0xDE478BA4), UINT32_C(0x31035088),
+        UINT32_C(0xEC46FA30), UINT32_C(0x8E647309), UINT32_C(0x5321D9B1),
+        UINT32_C(0x4A21617B), UINT32_C(0x9764CBC3), UINT32_C(0xF54642FA),
+        UINT32_C(0x2803E842)
+    },
+    {
+        UINT32_C(0x00000000), UINT32_C(0x38116FAC), UINT32_C(0x7022DF58),
+        UINT32_C(0x4833B0F4), UINT32_C(0xE045BEB0), UINT32_C(0xD854D11C),
+        UINT32_C(0x906761E8), UINT32_C(0xA8760E44), UINT32_C(0xC5670B91),
+        UINT32_C(0xFD76643D), UINT32_C(0xB545D4C9), UINT32_C(0x8D54BB65),
+        UINT32_C(0x2522B521), UINT32_C(0x1D33DA8D), UINT32_C(0x55006A79),
+        UINT32_C(0x6D1105D5), UINT32_C(0x8F2261D3), UINT32_C(0xB7330E7F),
+        UINT32_C(0xFF00BE8B), UINT32_C(0xC711D127), UINT32_C(0x6F67DF63),
+        UINT32_C(0x5776B0CF), UINT32_C(0x1F45003B), UINT32_C(0x27546F97),
+        UINT32_C(0x4A456A42), UINT32_C(0x725405EE), UINT32_C(0x3A67B51A),
+        UINT32_C(0x0276DAB6), UINT32_C(0xAA00D4F2), UINT32_C(0x9211BB5E),
+        UINT32_C(0xDA220BAA), UINT32_C(0xE2336406), UINT32_C(0x1BA8B557),
+        UINT32_C(0x23B9DAFB), UINT32_C(0x6B8A6A0F), UINT32_C(0x539B05A3),
+        UINT32_C(0xFBED0BE7), UINT32_C(0xC3FC644B), UINT32_C(0x8BCFD4BF),
+        UINT32_C(0xB3DEBB13), UINT32_C(0xDECFBEC6), UINT32_C(0xE6DED16A),
+        UINT32_C(0xAEED619E), UINT32_C(0x96FC0E32), UINT32_C(0x3E8A0076),
+        UINT32_C(0x069B6FDA), UINT32_C(0x4EA8DF2E), UINT32_C(0x76B9B082),
+        UINT32_C(0x948AD484), UINT32_C(0xAC9BBB28), UINT32_C(0xE4A80BDC),
+        UINT32_C(0xDCB96470), UINT32_C(0x74CF6A34), UINT32_C(0x4CDE0598),
+        UINT32_C(0x04EDB56C), UINT32_C(0x3CFCDAC0), UINT32_C(0x51EDDF15),
+        UINT32_C(0x69FCB0B9), UINT32_C(0x21CF004D), UINT32_C(0x19DE6FE1),
+        UINT32_C(0xB1A861A5), UINT32_C(0x89B90E09), UINT32_C(0xC18ABEFD),
+        UINT32_C(0xF99BD151), UINT32_C(0x37516AAE), UINT32_C(0x0F400502),
+        UINT32_C(0x4773B5F6), UINT32_C(0x7F62DA5A), UINT32_C(0xD714D41E),
+        UINT32_C(0xEF05BBB2), UINT32_C(0xA7360B46), UINT32_C(0x9F2764EA),
+        UINT32_C(0xF236613F), UINT32_C(0xCA270E93), UINT32_C(0x8214BE67),
+        UINT32_C(0xBA05D1CB), UINT32_C(0x1273DF8F), UINT32_C(0x2A62B023),
+        UINT32_C(0x625100D7), UINT32_C(0x5A406F7B), UINT32_C(0xB8730B7D),
+        UINT32_C(0x806264D1), UINT32_C(0xC851D425), UINT32_C(0xF040BB89),
+        UINT32_C(0x5836B5CD), UINT32_C(0x6027DA61), UINT32_C(0x28146A95),
+        UINT32_C(0x10050539), UINT32_C(0x7D1400EC), UINT32_C(0x45056F40),
+        UINT32_C(0x0D36DFB4), UINT32_C(0x3527B018), UINT32_C(0x9D51BE5C),
+        UINT32_C(0xA540D1F0), UINT32_C(0xED736104), UINT32_C(0xD5620EA8),
+        UINT32_C(0x2CF9DFF9), UINT32_C(0x14E8B055), UINT32_C(0x5CDB00A1),
+        UINT32_C(0x64CA6F0D), UINT32_C(0xCCBC6149), UINT32_C(0xF4AD0EE5),
+        UINT32_C(0xBC9EBE11), UINT32_C(0x848FD1BD), UINT32_C(0xE99ED468),
+        UINT32_C(0xD18FBBC4), UINT32_C(0x99BC0B30), UINT32_C(0xA1AD649C),
+        UINT32_C(0x09DB6AD8), UINT32_C(0x31CA0574), UINT32_C(0x79F9B580),
+        UINT32_C(0x41E8DA2C), UINT32_C(0xA3DBBE2A), UINT32_C(0x9BCAD186),
+        UINT32_C(0xD3F96172), UINT32_C(0xEBE80EDE), UINT32_C(0x439E009A),
+        UINT32_C(0x7B8F6F36), UINT32_C(0x33BCDFC2), UINT32_C(0x0BADB06E),
+        UINT32_C(0x66BCB5BB), UINT32_C(0x5EADDA17), UINT32_C(0x169E6AE3),
+        UINT32_C(0x2E8F054F), UINT32_C(0x86F90B0B), UINT32_C(0xBEE864A7),
+        UINT32_C(0xF6DBD453), UINT32_C(0xCECABBFF), UINT32_C(0x6EA2D55C),
+        UINT32_C(0x56B3BAF0), UINT32_C(0x1E800A04), UINT32_C(0x269165A8),
+        UINT32_C(0x8EE76BEC), UINT32_C(0xB6F60440), UINT32_C(0xFEC5B4B4),
+        UINT32_C(0xC6D4DB18), UINT32_C(0xABC5DECD), UINT32_C(0x93D4B161),
+        UINT32_C(0xDBE70195), UINT32_C(0xE3F66E39), UINT32_C(0x4B80607D),
+        UINT32_C(0x73910FD1), UINT32_C(0x3BA2BF25), UINT32_C(0x03B3D089),
+        UINT32_C(0xE180B48F), UINT32_C(0xD991DB23), UINT32_C(0x91A26BD7),
+        UINT32_C(0xA9B3047B), UINT32_C(0x01C50A3F), UINT32_C(0x39D46593),
+        UINT32_C(0x71E7D567), UINT32_C(0x49F6BACB), UINT32_C(0x24E7BF1E),
+        UINT32_C(0x1CF6D0B2), UINT32_C(0x54C56046), UINT32_C(0x6CD40FEA),
+        UINT32_C(0xC4A201AE), UINT32_C(0xFCB36E02), UINT32_C(0xB480DEF6),
+        UINT32_C(0x8C91B15A), UINT32_C(0x750A600B), UINT32_C(0x4D1B0FA7),
+        UINT32_C(0x0528BF53), UINT32_C(0x3D39D0FF), UINT32_C(0x954FDEBB),
+        UINT32_C(0xAD5EB117), UINT32_C(0xE56D01E3), UINT32_C(0xDD7C6E4F),
+        UINT32_C(0xB06D6B9A), UINT32_C(0x887C0436), UINT32_C(0xC04FB4C2),
+        UINT32_C(0xF85EDB6E), UINT32_C(0x5028D52A), UINT32_C(0x6839BA86),
+        UINT32_C(0x200A0A72), UINT32_C(0x181B65DE), UINT32_C(0xFA2801D8),
+        UINT32_C(0xC2396E74), UINT32_C(0x8A0ADE80), UINT32_C(0xB21BB12C),
+        UINT32_C(0x1A6DBF68), UINT32_C(0x227CD0C4), UINT32_C(0x6A4F6030),
+        UINT32_C(0x525E0F9C), UINT32_C(0x3F4F0A49), UINT32_C(0x075E65E5),
+        UINT32_C(0x4F6DD511), UINT32_C(0x777CBABD), UINT32_C(0xDF0AB4F9),
+        UINT32_C(0xE71BDB55), UINT32_C(0xAF286BA1), UINT32_C(0x9739040D),
+        UINT32_C(0x59F3BFF2), UINT32_C(0x61E2D05E), UINT32_C(0x29D160AA),
+        UINT32_C(0x11C00F06), UINT32_C(0xB9B60142), UINT32_C(0x81A76EEE),
+        UINT32_C(0xC994DE1A), UINT32_C(0xF185B1B6), UINT32_C(0x9C94B463),
+        UINT32_C(0xA485DBCF), UINT32_C(0xECB66B3B), UINT32_C(0xD4A70497),
+        UINT32_C(0x7CD10AD3), UINT32_C(0x44C0657F), UINT32_C(0x0CF3D58B),
+        UINT32_C(0x34E2BA27), UINT32_C(0xD6D1DE21), UINT32_C(0xEEC0B18D),
+        UINT32_C(0xA6F30179), UINT32_C(0x9EE26ED5), UINT32_C(0x36946091),
+        UINT32_C(0x0E850F3D), UINT32_C(0x46B6BFC9), UINT32_C(0x7EA7D065),
+        UINT32_C(0x13B6D5B0), UINT32_C(0x2BA7BA1C), UINT32_C(0x63940AE8),
+        UINT32_C(0x5B856544), UINT32_C(0xF3F36B00), UINT32_C(0xCBE204AC),
+        UINT32_C(0x83D1B458), UINT32_C(0xBBC0DBF4), UINT32_C(0x425B0AA5),
+        UINT32_C(0x7A4A6509), UINT32_C(0x3279D5FD), UINT32_C(0x0A68BA51),
+        UINT32_C(0xA21EB415), UINT32_C(0x9A0FDBB9), UINT32_C(0xD23C6B4D),
+        UINT32_C(0xEA2D04E1), UINT32_C(0x873C0134), UINT32_C(0xBF2D6E98),
+        UINT32_C(0xF71EDE6C), UINT32_C(0xCF0FB1C0), UINT32_C(0x6779BF84),
+        UINT32_C(0x5F68D028), UINT32_C(0x175B60DC), UINT32_C(0x2F4A0F70),
+        UINT32_C(0xCD796B76), UINT32_C(0xF56804DA), UINT32_C(0xBD5BB42E),
+        UINT32_C(0x854ADB82), UINT32_C(0x2D3CD5C6), UINT32_C(0x152DBA6A),
+        UINT32_C(0x5D1E0A9E), UINT32_C(0x650F6532), UINT32_C(0x081E60E7),
+        UINT32_C(0x300F0F4B), UINT32_C(0x783CBFBF), UINT32_C(0x402DD013),
+        UINT32_C(0xE85BDE57), UINT32_C(0xD04AB1FB), UINT32_C(0x9879010F),
+        UINT32_C(0xA0686EA3)
+    },
+    {
+        UINT32_C(0x00000000), UINT32_C(0xEF306B19), UINT32_C(0xDB8CA0C3),
+        UINT32_C(0x34BCCBDA), UINT32_C(0xB2F53777), UINT32_C(0x5DC55C6E),
+        UINT32_C(0x697997B4), UINT32_C(0x8649FCAD), UINT32_C(0x6006181F),
+        UINT32_C(0x8F367306), UINT32_C(0xBB8AB8DC), UINT32_C(0x54BAD3C5),
+        UINT32_C(0xD2F32F68), UINT32_C(0x3DC34471), UINT32_C(0x097F8FAB),
+        UINT32_C(0xE64FE4B2), UINT32_C(0xC00C303E), UINT32_C(0x2F3C5B27),
+        UINT32_C(0x1B8090FD), UINT32_C(0xF4B0FBE4), UINT32_C(0x72F90749),
+        UINT32_C(0x9DC96C50), UINT32_C(0xA975A78A), UINT32_C(0x4645CC93),
+        UINT32_C(0xA00A2821), UINT32_C(0x4F3A4338), UINT32_C(0x7B8688E2),
+        UINT32_C(0x94B6E3FB), UINT32_C(0x12FF1F56), UINT32_C(0xFDCF744F),
+        UINT32_C(0xC973BF95), UINT32_C(0x2643D48C), UINT32_C(0x85F4168D),
+        UINT32_C(0x6AC47D94), UINT32_C(0x5E78B64E), UINT32_C(0xB148DD57),
+        UINT32_C(0x370121FA), UINT32_C(0xD8314AE3), UINT32_C(0xEC8D8139),
+        UINT32_C(0x03BDEA20), UINT32_C(0xE5F20E92), UINT32_C(0x0AC2658B),
+        UINT32_C(0x3E7EAE51), UINT32_C(0xD14EC548), UINT32_C(0x570739E5),
+        UINT32_C(0xB83752FC), UINT32_C(0x8C8B9926), UINT32_C(0x63BBF23F),
+        UINT32_C(0x45F826B3), UINT32_C(0xAAC84DAA), UINT32_C(0x9E748670),
+        UINT32_C(0x7144ED69), UINT32_C(0xF70D11C4), UINT32_C(0x183D7ADD),
+        UINT32_C(0x2C81B107), UINT32_C(0xC3B1DA1E), UINT32_C(0x25FE3EAC),
+        UINT32_C(0xCACE55B5), UINT32_C(0xFE729E6F), UINT32_C(0x1142F576),
+        UINT32_C(0x970B09DB), UINT32_C(0x783B62C2), UINT32_C(0x4C87A918),
+        UINT32_C(0xA3B7C201), UINT32_C(0x0E045BEB), UINT32_C(0xE13430F2),
+        UINT32_C(0xD588FB28), UINT32_C(0x3AB89031), UINT32_C(0xBCF16C9C),
+        UINT32_C(0x53C10785), UINT32_C(0x677DCC5F), UINT32_C(0x884DA746),
+        UINT32_C(0x6E0243F4), UINT32_C(0x813228ED), UINT32_C(0xB58EE337),
+        UINT32_C(0x5ABE882E), UINT32_C(0xDCF77483), UINT32_C(0x33C71F9A),
+        UINT32_C(0x077BD440), UINT32_C(0xE84BBF59), UINT32_C(0xCE086BD5),
+        UINT32_C(0x213800CC), UINT32_C(0x1584CB16), UINT32_C(0xFAB4A00F),
+        UINT32_C(0x7CFD5CA2), UINT32_C(0x93CD37BB), UINT32_C(0xA771FC61),
+        UINT32_C(0x48419778), UINT32_C(0xAE0E73CA), UINT32_C(0x413E18D3),
+        UINT32_C(0x7582D309), UINT32_C(0x9AB2B810), UINT32_C(0x1CFB44BD),
+        UINT32_C(0xF3CB2FA4), UINT32_C(0xC777E47E), UINT32_C(0x28478F67),
+        UINT32_C(0x8BF04D66), UINT32_C(0x64C0267F), UINT32_C(0x507CEDA5),
+        UINT32_C(0xBF4C86BC), UINT32_C(0x39057A11), UINT32_C(0xD6351108),
+        UINT32_C(0xE289DAD2), UINT32_C(0x0DB9B1CB), UINT32_C(0xEBF65579),
+        UINT32_C(0x04C63E60), UINT32_C(0x307AF5BA), UINT32_C(0xDF4A9EA3),
+        UINT32_C(0x5903620E), UINT32_C(0xB6330917), UINT32_C(0x828FC2CD),
+        UINT32_C(0x6DBFA9D4), UINT32_C(0x4BFC7D58), UINT32_C(0xA4CC1641),
+        UINT32_C(0x9070DD9B), UINT32_C(0x7F40B682), UINT32_C(0xF9094A2F),
+        UINT32_C(0x16392136), UINT32_C(0x2285EAEC), UINT32_C(0xCDB581F5),
+        UINT32_C(0x2BFA6547), UINT32_C(0xC4CA0E5E), UINT32_C(0xF076C584),
+        UINT32_C(0x1F46AE9D), UINT32_C(0x990F5230), UINT32_C(0x763F3929),
+        UINT32_C(0x4283F2F3), UINT32_C(0xADB399EA), UINT32_C(0x1C08B7D6),
+        UINT32_C(0xF338DCCF), UINT32_C(0xC7841715), UINT32_C(0x28B47C0C),
+        UINT32_C(0xAEFD80A1), UINT32_C(0x41CDEBB8), UINT32_C(0x75712062),
+        UINT32_C(0x9A414B7B), UINT32_C(0x7C0EAFC9), UINT32_C(0x933EC4D0),
+        UINT32_C(0xA7820F0A), UINT32_C(0x48B26413), UINT32_C(0xCEFB98BE),
+        UINT32_C(0x21CBF3A7), UINT32_C(0x1577387D), UINT32_C(0xFA475364),
+        UINT32_C(0xDC0487E8), UINT32_C(0x3334ECF1), UINT32_C(0x0788272B),
+        UINT32_C(0xE8B84C32), UINT32_C(0x6EF1B09F), UINT32_C(0x81C1DB86),
+        UINT32_C(0xB57D105C), UINT32_C(0x5A4D7B45), UINT32_C(0xBC029FF7),
+        UINT32_C(0x5332F4EE), UINT32_C(0x678E3F34), UINT32_C(0x88BE542D),
+        UINT32_C(0x0EF7A880), UINT32_C(0xE1C7C399), UINT32_C(0xD57B0843),
+        UINT32_C(0x3A4B635A), UINT32_C(0x99FCA15B), UINT32_C(0x76CCCA42),
+        UINT32_C(0x42700198), UINT32_C(0xAD406A81), UINT32_C(0x2B09962C),
+        UINT32_C(0xC439FD35), UINT32_C(0xF08536EF), UINT32_C(0x1FB55DF6),
+        UINT32_C(0xF9FAB944), UINT32_C(0x16CAD25D), UINT32_C(0x22761987),
+        UINT32_C(0xCD46729E), UINT32_C(0x4B0F8E33), UINT32_C(0xA43FE52A),
+        UINT32_C(0x90832EF0), UINT32_C(0x7FB345E9), UINT32_C(0x59F09165),
+        UINT32_C(0xB6C0FA7C), UINT32_C(0x827C31A6), UINT32_C(0x6D4C5ABF),
+        UINT32_C(0xEB05A612), UINT32_C(0x0435CD0B), UINT32_C(0x308906D1),
+        UINT32_C(0xDFB96DC8), UINT32_C(0x39F6897A), UINT32_C(0xD6C6E263),
+        UINT32_C(0xE27A29B9), UINT32_C(0x0D4A42A0), UINT32_C(0x8B03BE0D),
+        UINT32_C(0x6433D514), UINT32_C(0x508F1ECE), UINT32_C(0xBFBF75D7),
+        UINT32_C(0x120CEC3D), UINT32_C(0xFD3C8724), UINT32_C(0xC9804CFE),
+        UINT32_C(0x26B027E7), UINT32_C(0xA0F9DB4A), UINT32_C(0x4FC9B053),
+        UINT32_C(0x7B757B89), UINT32_C(0x94451090), UINT32_C(0x720AF422),
+        UINT32_C(0x9D3A9F3B), UINT32_C(0xA98654E1), UINT32_C(0x46B63FF8),
+        UINT32_C(0xC0FFC355), UINT32_C(0x2FCFA84C), UINT32_C(0x1B736396),
+        UINT32_C(0xF443088F), UINT32_C(0xD200DC03), UINT32_C(0x3D30B71A),
+        UINT32_C(0x098C7CC0), UINT32_C(0xE6BC17D9), UINT32_C(0x60F5EB74),
+        UINT32_C(0x8FC5806D), UINT32_C(0xBB794BB7), UINT32_C(0x544920AE),
+        UINT32_C(0xB206C41C), UINT32_C(0x5D36AF05), UINT32_C(0x698A64DF),
+        UINT32_C(0x86BA0FC6), UINT32_C(0x00F3F36B), UINT32_C(0xEFC39872),
+        UINT32_C(0xDB7F53A8), UINT32_C(0x344F38B1), UINT32_C(0x97F8FAB0),
+        UINT32_C(0x78C891A9), UINT32_C(0x4C745A73), UINT32_C(0xA344316A),
+        UINT32_C(0x250DCDC7), UINT32_C(0xCA3DA6DE), UINT32_C(0xFE816D04),
+        UINT32_C(0x11B1061D), UINT32_C(0xF7FEE2AF), UINT32_C(0x18CE89B6),
+        UINT32_C(0x2C72426C), UINT32_C(0xC3422975), UINT32_C(0x450BD5D8),
+        UINT32_C(0xAA3BBEC1), UINT32_C(0x9E87751B), UINT32_C(0x71B71E02),
+        UINT32_C(0x57F4CA8E), UINT32_C(0xB8C4A197), UINT32_C(0x8C786A4D),
+        UINT32_C(0x63480154), UINT32_C(0xE501FDF9), UINT32_C(0x0A3196E0),
+        UINT32_C(0x3E8D5D3A), UINT32_C(0xD1BD3623), UINT32_C(0x37F2D291),
+        UINT32_C(0xD8C2B988), UINT32_C(0xEC7E7252), UINT32_C(0x034E194B),
+        UINT32_C(0x8507E5E6), UINT32_C(0x6A378EFF), UINT32_C(0x5E8B4525),
+        UINT32_C(0xB1BB2E3C)
+    },
+    {
+        UINT32_C(0x00000000), UINT32_C(0x68032CC8), UINT32_C(0xD0065990),
+        UINT32_C(0xB8057558), UINT32_C(0xA5E0C5D1), UINT32_C(0xCDE3E919),
+        UINT32_C(0x75E69C41), UINT32_C(0x1DE5B089), UINT32_C(0x4E2DFD53),
+        UINT32_C(0x262ED19B), UINT32_C(0x9E2BA4C3), UINT32_C(0xF628880B),
+        UINT32_C(0xEBCD3882), UINT32_C(0x83CE144A), UINT32_C(0x3BCB6112),
+        UINT32_C(0x53C84DDA), UINT32_C(0x9C5BFAA6), UINT32_C(0xF458D66E),
+        UINT32_C(0x4C5DA336), UINT32_C(0x245E8FFE), UINT32_C(0x39BB3F77),
+        UINT32_C(0x51B813BF), UINT32_C(0xE9BD66E7), UINT32_C(0x81BE4A2F),
+        UINT32_C(0xD27607F5), UINT32_C(0xBA752B3D), UINT32_C(0x02705E65),
+        UINT32_C(0x6A7372AD), UINT32_C(0x7796C224), UINT32_C(0x1F95EEEC),
+        UINT32_C(0xA7909BB4), UINT32_C(0xCF93B77C), UINT32_C(0x3D5B83BD),
+        UINT32_C(0x5558AF75), UINT32_C(0xED5DDA2D), UINT32_C(0x855EF6E5),
+        UINT32_C(0x98BB466C), UINT32_C(0xF0B86AA4), UINT32_C(0x48BD1FFC),
+        UINT32_C(0x20BE3334), UINT32_C(0x73767EEE), UINT32_C(0x1B755226),
+        UINT32_C(0xA370277E), UINT32_C(0xCB730BB6), UINT32_C(0xD696BB3F),
+        UINT32_C(0xBE9597F7), UINT32_C(0x0690E2AF), UINT32_C(0x6E93CE67),
+        UINT32_C(0xA100791B), UINT32_C(0xC90355D3), UINT32_C(0x7106208B),
+        UINT32_C(0x19050C43), UINT32_C(0x04E0BCCA), UINT32_C(0x6CE39002),
+        UINT32_C(0xD4E6E55A), UINT32_C(0xBCE5C992), UINT32_C(0xEF2D8448),
+        UINT32_C(0x872EA880), UINT32_C(0x3F2BDDD8), UINT32_C(0x5728F110),
+        UINT32_C(0x4ACD4199), UINT32_C(0x22CE6D51), UINT32_C(0x9ACB1809),
+        UINT32_C(0xF2C834C1), UINT32_C(0x7AB7077A), UINT32_C(0x12B42BB2),
+        UINT32_C(0xAAB15EEA), UINT32_C(0xC2B27222), UINT32_C(0xDF57C2AB),
+        UINT32_C(0xB754EE63), UINT32_C(0x0F519B3B), UINT32_C(0x6752B7F3),
+        UINT32_C(0x349AFA29), UINT32_C(0x5C99D6E1), UINT32_C(0xE49CA3B9),
+        UINT32_C(0x8C9F8F71), UINT32_C(0x917A3FF8), UINT32_C(0xF9791330),
+        UINT32_C(0x417C6668), UINT32_C(0x297F4AA0), UINT32_C(0xE6ECFDDC),
+        UINT32_C(0x8EEFD114), UINT32_C(0x36EAA44C), UINT32_C(0x5EE98884),
+        UINT32_C(0x430C380D), UINT32_C(0x2B0F14C5), UINT32_C(0x930A619D),
+        UINT32_C(0xFB094D55), UINT32_C(0xA8C1008F), UINT32_C(0xC0C22C47),
+        UINT32_C(0x78C7591F), UINT32_C(0x10C475D7), UINT32_C(0x0D21C55E),
+        UINT32_C(0x6522E996), UINT32_C(0xDD279CCE), UINT32_C(0xB524B006),
+        UINT32_C(0x47EC84C7), UINT32_C(0x2FEFA80F), UINT32_C(0x97EADD57),
+        UINT32_C(0xFFE9F19F), UINT32_C(0xE20C4116), UINT32_C(0x8A0F6DDE),
+        UINT32_C(0x320A1886), UINT32_C(0x5A09344E), UINT32_C(0x09C17994),
+        UINT32_C(0x61C2555C), UINT32_C(0xD9C72004), UINT32_C(0xB1C40CCC),
+        UINT32_C(0xAC21BC45), UINT32_C(0xC422908D), UINT32_C(0x7C27E5D5),
+        UINT32_C(0x1424C91D), UINT32_C(0xDBB77E61), UINT32_C(0xB3B452A9),
+        UINT32_C(0x0BB127F1), UINT32_C(0x63B20B39), UINT32_C(0x7E57BBB0),
+        UINT32_C(0x16549778), UINT32_C(0xAE51E220), UINT32_C(0xC652CEE8),
+        UINT32_C(0x959A8332), UINT32_C(0xFD99AFFA), UINT32_C(0x459CDAA2),
+        UINT32_C(0x2D9FF66A), UINT32_C(0x307A46E3), UINT32_C(0x58796A2B),
+        UINT32_C(0xE07C1F73), UINT32_C(0x887F33BB), UINT32_C(0xF56E0EF4),
+        UINT32_C(0x9D6D223C), UINT32_C(0x25685764), UINT32_C(0x4D6B7BAC),
+        UINT32_C(0x508ECB25), UINT32_C(0x388DE7ED), UINT32_C(0x808892B5),
+        UINT32_C(0xE88BBE7D), UINT32_C(0xBB43F3A7), UINT32_C(0xD340DF6F),
+        UINT32_C(0x6B45AA37), UINT32_C(0x034686FF), UINT32_C(0x1EA33676),
+        UINT32_C(0x76A01ABE), UINT32_C(0xCEA56FE6), UINT32_C(0xA6A6432E),
+        UINT32_C(0x6935F452), UINT32_C(0x0136D89A), UINT32_C(0xB933ADC2),
+        UINT32_C(0xD130810A), UINT32_C(0xCCD53183), UINT32_C(0xA4D61D4B),
+        UINT32_C(0x1CD36813), UINT32_C(0x74D044DB), UINT32_C(0x27180901),
+        UINT32_C(0x4F1B25C9), UINT32_C(0xF71E5091), UINT32_C(0x9F1D7C59),
+        UINT32_C(0x82F8CCD0), UINT32_C(0xEAFBE018), UINT32_C(0x52FE9540),
+        UINT32_C(0x3AFDB988), UINT32_C(0xC8358D49), UINT32_C(0xA036A181),
+        UINT32_C(0x1833D4D9), UINT32_C(0x7030F811), UINT32_C(0x6DD54898),
+        UINT32_C(0x05D66450), UINT32_C(0xBDD31108), UINT32_C(0xD5D03DC0),
+        UINT32_C(0x8618701A), UINT32_C(0xEE1B5CD2), UINT32_C(0x561E298A),
+        UINT32_C(0x3E1D0542), UINT32_C(0x23F8B5CB), UINT32_C(0x4BFB9903),
+        UINT32_C(0xF3FEEC5B), UINT32_C(0x9BFDC093), UINT32_C(0x546E77EF),
+        UINT32_C(0x3C6D5B27), UINT32_C(0x84682E7F), UINT32_C(0xEC6B02B7),
+        UINT32_C(0xF18EB23E), UINT32_C(0x998D9EF6), UINT32_C(0x2188EBAE),
+        UINT32_C(0x498BC766), UINT32_C(0x1A438ABC), UINT32_C(0x7240A674),
+        UINT32_C(0xCA45D32C), UINT32_C(0xA246FFE4), UINT32_C(0xBFA34F6D),
+        UINT32_C(0xD7A063A5), UINT32_C(0x6FA516FD), UINT32_C(0x07A63A35),
+        UINT32_C(0x8FD9098E), UINT32_C(0xE7DA2546), UINT32_C(0x5FDF501E),
+        UINT32_C(0x37DC7CD6), UINT32_C(0x2A39CC5F), UINT32_C(0x423AE097),
+        UINT32_C(0xFA3F95CF), UINT32_C(0x923CB907), UINT32_C(0xC1F4F4DD),
+        UINT32_C(0xA9F7D815), UINT32_C(0x11F2AD4D), UINT32_C(0x79F18185),
+        UINT32_C(0x6414310C), UINT32_C(0x0C171DC4), UINT32_C(0xB412689C),
+        UINT32_C(0xDC114454), UINT32_C(0x1382F328), UINT32_C(0x7B81DFE0),
+        UINT32_C(0xC384AAB8), UINT32_C(0xAB878670), UINT32_C(0xB66236F9),
+        UINT32_C(0xDE611A31), UINT32_C(0x66646F69), UINT32_C(0x0E6743A1),
+        UINT32_C(0x5DAF0E7B), UINT32_C(0x35AC22B3), UINT32_C(0x8DA957EB),
+        UINT32_C(0xE5AA7B23), UINT32_C(0xF84FCBAA), UINT32_C(0x904CE762),
+        UINT32_C(0x2849923A), UINT32_C(0x404ABEF2), UINT32_C(0xB2828A33),
+        UINT32_C(0xDA81A6FB), UINT32_C(0x6284D3A3), UINT32_C(0x0A87FF6B),
+        UINT32_C(0x17624FE2), UINT32_C(0x7F61632A), UINT32_C(0xC7641672),
+        UINT32_C(0xAF673ABA), UINT32_C(0xFCAF7760), UINT32_C(0x94AC5BA8),
+        UINT32_C(0x2CA92EF0), UINT32_C(0x44AA0238), UINT32_C(0x594FB2B1),
+        UINT32_C(0x314C9E79), UINT32_C(0x8949EB21), UINT32_C(0xE14AC7E9),
+        UINT32_C(0x2ED97095), UINT32_C(0x46DA5C5D), UINT32_C(0xFEDF2905),
+        UINT32_C(0x96DC05CD), UINT32_C(0x8B39B544), UINT32_C(0xE33A998C),
+        UINT32_C(0x5B3FECD4), UINT32_C(0x333CC01C), UINT32_C(0x60F48DC6),
+        UINT32_C(0x08F7A10E), UINT32_C(0xB0F2D456), UINT32_C(0xD8F1F89E),
+        UINT32_C(0xC5144817), UINT32_C(0xAD1764DF), UINT32_C(0x15121187),
+        UINT32_C(0x7D113D4F)
+    },
+    {
+        UINT32_C(0x00000000), UINT32_C(0x493C7D27), UINT32_C(0x9278FA4E),
+        UINT32_C(0xDB448769), UINT32_C(0x211D826D), UINT32_C(0x6821FF4A),
+        UINT32_C(0xB3657823), UINT32_C(0xFA590504), UINT32_C(0x423B04DA),
+        UINT32_C(0x0B0779FD), UINT32_C(0xD043FE94), UINT32_C(0x997F83B3),
+        UINT32_C(0x632686B7), UINT32_C(0x2A1AFB90), UINT32_C(0xF15E7CF9),
+        UINT32_C(0xB86201DE), UINT32_C(0x847609B4), UINT32_C(0xCD4A7493),
+        UINT32_C(0x160EF3FA), UINT32_C(0x5F328EDD), UINT32_C(0xA56B8BD9),
+        UINT32_C(0xEC57F6FE), UINT32_C(0x37137197), UINT32_C(0x7E2F0CB0),
+        UINT32_C(0xC64D0D6E), UINT32_C(0x8F717049), UINT32_C(0x5435F720),
+        UINT32_C(0x1D098A07), UINT32_C(0xE7508F03), UINT32_C(0xAE6CF224),
+        UINT32_C(0x7528754D), UINT32_C(0x3C14086A), UINT32_C(0x0D006599),
+        UINT32_C(0x443C18BE), UINT32_C(0x9F789FD7), UINT32_C(0xD644E2F0),
+        UINT32_C(0x2C1DE7F4), UINT32_C(0x65219AD3), UINT32_C(0xBE651DBA),
+        UINT32_C(0xF759609D), UINT32_C(0x4F3B6143), UINT32_C(0x06071C64),
+        UINT32_C(0xDD439B0D), UINT32_C(0x947FE62A), UINT32_C(0x6E26E32E),
+        UINT32_C(0x271A9E09), UINT32_C(0xFC5E1960), UINT32_C(0xB5626447),
+        UINT32_C(0x89766C2D), UINT32_C(0xC04A110A), UINT32_C(0x1B0E9663),
+        UINT32_C(0x5232EB44), UINT32_C(0xA86BEE40), UINT32_C(0xE1579367),
+        UINT32_C(0x3A13140E), UINT32_C(0x732F6929), UINT32_C(0xCB4D68F7),
+        UINT32_C(0x827115D0), UINT32_C(0x593592B9), UINT32_C(0x1009EF9E),
+        UINT32_C(0xEA50EA9A), UINT32_C(0xA36C97BD), UINT32_C(0x782810D4),
+        UINT32_C(0x31146DF3), UINT32_C(0x1A00CB32), UINT32_C(0x533CB615),
+        UINT32_C(0x8878317C), UINT32_C(0xC1444C5B), UINT32_C(0x3B1D495F),
+        UINT32_C(0x72213478), UINT32_C(0xA965B311), UINT32_C(0xE059CE36),
+        UINT32_C(0x583BCFE8), UINT32_C(0x1107B2CF), UINT32_C(0xCA4335A6),
+        UINT32_C(0x837F4881), UINT32_C(0x79264D85), UINT32_C(0x301A30A2),
+        UINT32_C(0xEB5EB7CB), UINT32_C(0xA262CAEC), UINT32_C(0x9E76C286),
+        UINT32_C(0xD74ABFA1), UINT32_C(0x0C0E38C8), UINT32_C(0x453245EF),
+        UINT32_C(0xBF6B40EB), UINT32_C(0xF6573DCC), UINT32_C(0x2D13BAA5),
+        UINT32_C(0x642FC782), UINT32_C(0xDC4DC65C), UINT32_C(0x9571BB7B),
+        UINT32_C(0x4E353C12), UINT32_C(0x07094135), UINT32_C(0xFD504431),
+        UINT32_C(0xB46C3916), UINT32_C(0x6F28BE7F), UINT32_C(0x2614C358),
+        UINT32_C(0x1700AEAB), UINT32_C(0x5E3CD38C), UINT32_C(0x857854E5),
+        UINT32_C(0xCC4429C2), UINT32_C(0x361D2CC6), UINT32_C(0x7F2151E1),
+        UINT32_C(0xA465D688), UINT32_C(0xED59ABAF), UINT32_C(0x553BAA71),
+        UINT32_C(0x1C07D756), UINT32_C(0xC743503F), UINT32_C(0x8E7F2D18),
+        UINT32_C(0x7426281C), UINT32_C(0x3D1A553B), UINT32_C(0xE65ED252),
+        UINT32_C(0xAF62AF75), UINT32_C(0x9376A71F), UINT32_C(0xDA4ADA38),
+        UINT32_C(0x010E5D51), UINT32_C(0x48322076), UINT32_C(0xB26B2572),
+        UINT32_C(0xFB575855), UINT32_C(0x2013DF3C), UINT32_C(0x692FA21B),
+        UINT32_C(0xD14DA3C5), UINT32_C(0x9871DEE2), UINT32_C(0x4335598B),
+        UINT32_C(0x0A0924AC), UINT32_C(0xF05021A8), UINT32_C(0xB96C5C8F),
+        UINT32_C(0x6228DBE6), UINT32_C(0x2B14A6C1), UINT32_C(0x34019664),
+        UINT32_C(0x7D3DEB43), UINT32_C(0xA6796C2A), UINT32_C(0xEF45110D),
+        UINT32_C(0x151C1409), UINT32_C(0x5C20692E), UINT32_C(0x8764EE47),
+        UINT32_C(0xCE589360), UINT32_C(0x763A92BE), UINT32_C(0x3F06EF99),
+        UINT32_C(0xE44268F0), UINT32_C(0xAD7E15D7), UINT32_C(0x572710D3),
+        UINT32_C(0x1E1B6DF4), UINT32_C(0xC55FEA9D), UINT32_C(0x8C6397BA),
+        UINT32_C(0xB0779FD0), UINT32_C(0xF94BE2F7), UINT32_C(0x220F659E),
+        UINT32_C(0x6B3318B9), UINT32_C(0x916A1DBD), UINT32_C(0xD856609A),
+        UINT32_C(0x0312E7F3), UINT32_C(0x4A2E9AD4), UINT32_C(0xF24C9B0A),
+        UINT32_C(0xBB70E62D), UINT32_C(0x60346144), UINT32_C(0x29081C63),
+        UINT32_C(0xD3511967), UINT32_C(0x9A6D6440), UINT32_C(0x4129E329),
+        UINT32_C(0x08159E0E), UINT32_C(0x3901F3FD), UINT32_C(0x703D8EDA),
+        UINT32_C(0xAB7909B3), UINT32_C(0xE2457494), UINT32_C(0x181C7190),
+        UINT32_C(0x51200CB7), UINT32_C(0x8A648BDE), UINT32_C(0xC358F6F9),
+        UINT32_C(0x7B3AF727), UINT32_C(0x32068A00), UINT32_C(0xE9420D69),
+        UINT32_C(0xA07E704E), UINT32_C(0x5A27754A), UINT32_C(0x131B086D),
+        UINT32_C(0xC85F8F04), UINT32_C(0x8163F223), UINT32_C(0xBD77FA49),
+        UINT32_C(0xF44B876E), UINT32_C(0x2F0F0007), UINT32_C(0x66337D20),
+        UINT32_C(0x9C6A7824), UINT32_C(0xD5560503), UINT32_C(0x0E12826A),
+        UINT32_C(0x472EFF4D), UINT32_C(0xFF4CFE93), UINT32_C(0xB67083B4),
+        UINT32_C(0x6D3404DD), UINT32_C(0x240879FA), UINT32_C(0xDE517CFE),
+        UINT32_C(0x976D01D9), UINT32_C(0x4C2986B0), UINT32_C(0x0515FB97),
+        UINT32_C(0x2E015D56), UINT32_C(0x673D2071), UINT32_C(0xBC79A718),
+        UINT32_C(0xF545DA3F), UINT32_C(0x0F1CDF3B), UINT32_C(0x4620A21C),
+        UINT32_C(0x9D642575), UINT32_C(0xD4585852), UINT32_C(0x6C3A598C),
+        UINT32_C(0x250624AB), UINT32_C(0xFE42A3C2), UINT32_C(0xB77EDEE5),
+        UINT32_C(0x4D27DBE1), UINT32_C(0x041BA6C6), UINT32_C(0xDF5F21AF),
+        UINT32_C(0x96635C88), UINT32_C(0xAA7754E2), UINT32_C(0xE34B29C5),
+        UINT32_C(0x380FAEAC), UINT32_C(0x7133D38B), UINT32_C(0x8B6AD68F),
+        UINT32_C(0xC256ABA8), UINT32_C(0x19122CC1), UINT32_C(0x502E51E6),
+        UINT32_C(0xE84C5038), UINT32_C(0xA1702D1F), UINT32_C(0x7A34AA76),
+        UINT32_C(0x3308D751), UINT32_C(0xC951D255), UINT32_C(0x806DAF72),
+        UINT32_C(0x5B29281B), UINT32_C(0x1215553C), UINT32_C(0x230138CF),
+        UINT32_C(0x6A3D45E8), UINT32_C(0xB179C281), UINT32_C(0xF845BFA6),
+        UINT32_C(0x021CBAA2), UINT32_C(0x4B20C785), UINT32_C(0x906440EC),
+        UINT32_C(0xD9583DCB), UINT32_C(0x613A3C15), UINT32_C(0x28064132),
+        UINT32_C(0xF342C65B), UINT32_C(0xBA7EBB7C), UINT32_C(0x4027BE78),
+        UINT32_C(0x091BC35F), UINT32_C(0xD25F4436), UINT32_C(0x9B633911),
+        UINT32_C(0xA777317B), UINT32_C(0xEE4B4C5C), UINT32_C(0x350FCB35),
+        UINT32_C(0x7C33B612), UINT32_C(0x866AB316), UINT32_C(0xCF56CE31),
+        UINT32_C(0x14124958), UINT32_C(0x5D2E347F), UINT32_C(0xE54C35A1),
+        UINT32_C(0xAC704886), UINT32_C(0x7734CFEF), UINT32_C(0x3E08B2C8),
+        UINT32_C(0xC451B7CC), UINT32_C(0x8D6DCAEB), UINT32_C(0x56294D82),
+        UINT32_C(0x1F1530A5)
+    }};
+
+uint32_t _CRC32C_Update(uint32_t crc, uint8_t byte) {
+  return (crc >> 8) ^ _CRC32C_Table[0][(uint8_t)crc ^ byte];
+}
+
+uint32_t _CRC32C_Sequence_update(uint32_t crc,
+                                 const void* bytes,
+                                 size_t size_in_bytes) {
+  const uint8_t* in = bytes;
+
+  /*
+   * Process eight bytes per iteration.  The bytes are combined explicitly so
+   * that the loop is independent of the byte order and the alignment.
+   */
+  while (size_in_bytes >= 8) {
+    crc ^= (uint32_t)in[0] | ((uint32_t)in[1] << 8) |
+           ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+    crc = _CRC32C_Table[7][crc & 0xff] ^ _CRC32C_Table[6][(crc >> 8) & 0xff] ^
+          _CRC32C_Table[5][(crc >> 16) & 0xff] ^ _CRC32C_Table[4][crc >> 24] ^
+          _CRC32C_Table[3][in[4]] ^ _CRC32C_Table[2][in[5]] ^
+          _CRC32C_Table[1][in[6]] ^ _CRC32C_Table[0][in[7]];
+    in += 8;
+    size_in_bytes -= 8;
+  }
+
+  while (size_in_bytes > 0) {
+    crc = (crc >> 8) ^ _CRC32C_Table[0][(uint8_t)crc ^ *in];
+    ++in;
+    --size_in_bytes;
+  }
+
+  return crc;
+}
@@ -45,6 +45,81 @@
 
 #define RTEMS_CAN_QUEUE_ROUND_ROBIN 1
 
+#define can_queue_for_each_filter_edge( qends, list, edge ) \
+  for ( \
+    edge = can_queue_first_filter_edge( qends, list ); \
+    edge; \
+    edge = can_queue_next_filter_edge( qends, edge ) )
+
+static inline unsigned int can_queue_filter_hash( uint32_t id )
+{
+  id &= CAN_FRAME_BFF_ID_MASK;
+
+  return ( id ^ ( id >> 5 ) ) & ( RTEMS_CAN_QUEUE_FILTER_HASH_SIZE - 1 );
+}
+
+static struct rtems_can_queue_edges_list *can_queue_filter_list(
+  struct rtems_can_queue_ends *qends,
+  const struct rtems_can_filter *filter
+)
+{
+  /*
+   * Only filters which require all base frame format identifier bits to
+   * match can be hashed. Such a filter cannot accept frames with an
+   * identifier hashed to another bucket.
+   */
+  if (
+    ( filter->id_mask & CAN_FRAME_BFF_ID_MASK ) == CAN_FRAME_BFF_ID_MASK
+  ) {
+    return &qends->filter_exact[ can_queue_filter_hash( filter->id ) ];
+  }
+
+  return &qends->filter_masked;
+}
+
+static struct rtems_can_queue_edge *can_queue_first_filter_edge(
+  struct rtems_can_queue_ends *qends,
+  struct rtems_can_queue_edges_list *list
+)
+{
+  struct rtems_can_queue_edge *edge;
+
+  rtems_mutex_lock( &qends->ends_lock );
+  edge = TAILQ_FIRST( list );
+
+  while ( edge && rtems_can_queue_fifo_test_flag( &edge->fifo, RTEMS_CAN_FIFOF_DEAD ) ) {
+    edge = TAILQ_NEXT( edge, filter_peers );
+  }
+  if ( edge ) {
+    rtems_can_queue_edge_incref( edge );
+  }
+
+  rtems_mutex_unlock( &qends->ends_lock );
+  return edge;
+}
+
+static struct rtems_can_queue_edge *can_queue_next_filter_edge(
+  struct rtems_can_queue_ends *qends,
+  struct rtems_can_queue_edge *edge
+)
+{
+  struct rtems_can_queue_edge *next;
+
+  rtems_mutex_lock( &qends->ends_lock );
+  next = TAILQ_NEXT( edge, filter_peers );
+
+  while ( next && rtems_can_queue_fifo_test_flag( &next->fifo, RTEMS_CAN_FIFOF_DEAD ) ) {
+    next = TAILQ_NEXT( next, filter_peers );
+  }
+  if ( next ) {
+    rtems_can_queue_edge_incref( next );
+  }
+
+  rtems_mutex_unlock( &qends->ends_lock );
+  rtems_can_queue_edge_decref( edge );
+  return next;
+}
+
 int rtems_can_queue_fifo_flush_slots( struct rtems_can_queue_fifo *fifo )
 {
   struct rtems_can_queue_slot *slot;
@@ -245,78 +320,107 @@ int rtems_can_queue_abort_inslot(
   return ret;
 }
 
-int rtems_can_queue_filter_frame_to_edges(
+static bool can_queue_frame_to_edge(
   struct rtems_can_queue_ends *qends,
   struct rtems_can_queue_edge *src_edge,
+  struct rtems_can_queue_edge *edge,
   struct can_frame *frame,
   unsigned int flags2add
 )
 {
-  struct rtems_can_queue_edge *edge;
   struct rtems_can_queue_slot *slot;
-  int destnr = 0;
-  int is_txerr = 0;
   int ret;
 
-  RTEMS_DEBUG_PRINT( "For frame ID 0x%08lx and flags 0x%02x\n",
-                     frame->header.can_id, frame->header.flags );
+  if ( rtems_can_queue_fifo_test_flag( &edge->fifo, RTEMS_CAN_FIFOF_BLOCK ) ) {
+    return false;
+  }
+
+  if (
+    src_edge != NULL &&
+    ( flags2add & CAN_FRAME_TXERR ) == 0 &&
+    edge->output_ends == src_edge->input_ends
+  ) {
+    flags2add |= CAN_FRAME_ECHO;
+  } else {
+    flags2add &= ~CAN_FRAME_ECHO;
+  }
 
-  is_txerr = ( ( flags2add & CAN_FRAME_TXERR ) == 0 ) ? 0 : 1;
+  if ( !rtems_can_queue_filter_match( &edge->filter, frame->header.can_id,
+                             frame->header.flags | flags2add ) ) {
+    return false;
+  }
 
-  rtems_can_queue_for_each_inedge( qends, edge ) {
-    if ( rtems_can_queue_fifo_test_flag( &edge->fifo, RTEMS_CAN_FIFOF_BLOCK ) ) {
-      continue;
-    }
+  ret = rtems_can_queue_fifo_get_inslot( &edge->fifo, &slot, 0 );
+  if ( ret != 0 ) {
+    return false;
+  }
 
-    if (
-      src_edge != NULL &&
-      is_txerr == 0 &&
-      edge->output_ends == src_edge->input_ends
-    ) {
-      flags2add |= CAN_FRAME_ECHO;
-    } else {
-      flags2add &= ~CAN_FRAME_ECHO;
-    }
+  if ( frame->header.dlen > edge->fifo.max_data_length ) {
+    rtems_can_queue_fifo_abort_inslot( &edge->fifo, slot );
+    return false;
+  }
 
-    if ( !rtems_can_queue_filter_match( &edge->filter, frame->header.can_id,
-                               frame->header.flags | flags2add ) ) {
-      continue;
-    }
+  slot->frame = *frame;
+  slot->frame.header.flags |= flags2add;
+  if ( slot->frame.header.flags & CAN_FRAME_ERR ) {
+    /* Invalidate CAN identifier if this is an error frame. This way
+     * the user will know this is not a regular frame even without
+     * flag check.
+     */
+    slot->frame.header.can_id |= CAN_ERR_ID_TAG;
+  }
 
-    ret = rtems_can_queue_fifo_get_inslot( &edge->fifo, &slot, 0 );
-    if ( ret == 0 ) {
-      if ( frame->header.dlen > edge->fifo.max_data_length ) {
-        rtems_can_queue_fifo_abort_inslot( &edge->fifo, slot );
-        continue;
-      }
+  ret = rtems_can_queue_fifo_put_inslot( &edge->fifo, slot );
+  if ( ret ) {
+    rtems_can_queue_activate_edge( qends, edge );
+    rtems_can_queue_notify_output_ends(
+      edge,
+      RTEMS_CAN_QUEUE_NOTIFY_PROC
+    );
+  }
 
-      slot->frame = *frame;
-      slot->frame.header.flags |= flags2add;
-      if ( slot->frame.header.flags & CAN_FRAME_ERR ) {
-        /* Invalidate CAN identifier if this is an error frame. This way
-         * the user will know this is not a regular frame even without
-         * flag check.
-         */
-        slot->frame.header.can_id |= CAN_ERR_ID_TAG;
-      }
+  return true;
+}
 
-      destnr++;
-      ret = rtems_can_queue_fifo_put_inslot( &edge->fifo, slot );
-      if ( ret ) {
-        rtems_can_queue_activate_edge( qends, edge );
-        rtems_can_queue_notify_output_ends(
-          edge,
-          RTEMS_CAN_QUEUE_NOTIFY_PROC
-        );
-      }
+int rtems_can_queue_filter_frame_to_edges(
+  struct rtems_can_queue_ends *qends,
+  struct rtems_can_queue_edge *src_edge,
+  struct can_frame *frame,
+  unsigned int flags2add
+)
+{
+  struct rtems_can_queue_edge *edge;
+  struct rtems_can_queue_edges_list *list;
+  int destnr = 0;
 
-      if ( is_txerr == 1 ) {
-        /* Send TX error frame to just one edge and skip all others. */
+  RTEMS_DEBUG_PRINT( "For frame ID 0x%08lx and flags 0x%02x\n",
+                     frame->header.can_id, frame->header.flags );
+
+  if ( ( flags2add & CAN_FRAME_TXERR ) != 0 ) {
+    /* Send TX error frame to just one edge and skip all others. */
+    rtems_can_queue_for_each_inedge( qends, edge ) {
+      if ( can_queue_frame_to_edge( qends, src_edge, edge, frame, flags2add ) ) {
+        destnr++;
         rtems_can_queue_edge_decref( edge );
         break;
       }
     }
+  } else {
+    list = &qends->filter_exact[ can_queue_filter_hash( frame->header.can_id ) ];
+    can_queue_for_each_filter_edge( qends, list, edge ) {
+      if ( can_queue_frame_to_edge( qends, src_edge, edge, frame, flags2add ) ) {
+        destnr++;
+      }
+    }
+
+    list = &qends->filter_masked;
+    can_queue_for_each_filter_edge( qends, list, edge ) {
+      if ( can_queue_frame_to_edge( qends, src_edge, edge, frame, flags2add ) ) {
+        destnr++;
+      }
+    }
   }
+
   RTEMS_DEBUG_PRINT( "Sent frame ID %d to %d edges\n", frame->header.can_id,
                      destnr );
 
@@ -527,6 +631,10 @@ int rtems_can_queue_ends_init( struct rtems_can_queue_ends *qends )
   TAILQ_INIT( &qends->idle );
   TAILQ_INIT( &qends->inlist );
   TAILQ_INIT( &qends->outlist );
+  for ( i = RTEMS_CAN_QUEUE_FILTER_HASH_SIZE; --i >= 0; ) {
+    TAILQ_INIT( &qends->filter_exact[i] );
+  }
+  TAILQ_INIT( &qends->filter_masked );
   rtems_mutex_init( &qends->ends_lock, "ends_lock" );
   return 0;
 }
@@ -556,6 +664,8 @@ int rtems_can_queue_connect_edge(
   rtems_mutex_lock( &qedge->fifo.fifo_lock );
   qedge->input_ends=input_ends;
   TAILQ_INSERT_TAIL( &input_ends->inlist, qedge, input_peers );
+  qedge->filterhead = can_queue_filter_list( input_ends, &qedge->filter );
+  TAILQ_INSERT_TAIL( qedge->filterhead, qedge, filter_peers );
   qedge->output_ends=output_ends;
   TAILQ_INSERT_TAIL( &output_ends->outlist, qedge, output_peers );
   TAILQ_INSERT_TAIL( &output_ends->idle, qedge, activepeers );
@@ -621,6 +731,10 @@ int rtems_can_queue_disconnect_edge( struct rtems_can_queue_edge *qedge )
     }
     if ( qedge->input_ends ) {
       TAILQ_REMOVE( &qedge->input_ends->inlist, qedge, input_peers );
+      if ( qedge->filterhead != NULL ) {
+        TAILQ_REMOVE( qedge->filterhead, qedge, filter_peers );
+        qedge->filterhead = NULL;
+      }
       qedge->input_ends=NULL;
     }
     ret = 1;
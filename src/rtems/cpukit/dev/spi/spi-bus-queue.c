@@ -0,0 +1,275 @@
+/**
+ * @file
+ *
+ * @brief Serial Peripheral Interface (SPI) Bus Request Queue Implementation
+ *
+ * @ingroup SPIBusQueue
+ */
+
+/*
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <dev/spi/spi.h>
+
+#include <errno.h>
+#include <string.h>
+
+static spi_bus_request *spi_bus_request_of_node(rtems_chain_node *node)
+{
+  return RTEMS_CONTAINER_OF(node, spi_bus_request, node);
+}
+
+static bool spi_bus_request_is_for_device(
+  const spi_bus_request *req,
+  uint8_t cs
+)
+{
+  uint32_t i;
+
+  if ((req->flags & SPI_BUS_REQUEST_MERGE) == 0) {
+    return false;
+  }
+
+  for (i = 0; i < req->msg_count; ++i) {
+    const spi_ioc_transfer *msg = &req->msgs[i];
+
+    if (msg->cs != cs) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static uint32_t spi_bus_queue_take_batch(
+  spi_bus_queue *queue,
+  uint32_t *msg_count
+)
+{
+  spi_bus_request *first;
+  uint8_t cs;
+  uint32_t req_count;
+  uint32_t n;
+
+  if (rtems_chain_is_empty(&queue->pending)) {
+    return 0;
+  }
+
+  first = spi_bus_request_of_node(
+    rtems_chain_get_first_unprotected(&queue->pending)
+  );
+  queue->batch[0] = first;
+  req_count = 1;
+  n = first->msg_count;
+  cs = first->msgs[0].cs;
+
+  if (
+    n >= SPI_BUS_QUEUE_MERGE_MAX
+      || !spi_bus_request_is_for_device(first, cs)
+  ) {
+    *msg_count = n;
+    return 1;
+  }
+
+  while (!rtems_chain_is_empty(&queue->pending)) {
+    spi_bus_request *next;
+
+    next = spi_bus_request_of_node(rtems_chain_first(&queue->pending));
+
+    if (
+      n + next->msg_count > SPI_BUS_QUEUE_MERGE_MAX
+        || !spi_bus_request_is_for_device(next, cs)
+    ) {
+      break;
+    }
+
+    if (req_count == 1) {
+      memcpy(&queue->msgs[0], first->msgs, n * sizeof(queue->msgs[0]));
+    }
+
+    rtems_chain_extract_unprotected(&next->node);
+    memcpy(
+      &queue->msgs[n],
+      next->msgs,
+      next->msg_count * sizeof(queue->msgs[0])
+    );
+    queue->batch[req_count] = next;
+    ++req_count;
+    n += next->msg_count;
+  }
+
+  *msg_count = n;
+  return req_count;
+}
+
+static int spi_bus_queue_transfer(
+  spi_bus *bus,
+  const spi_ioc_transfer *msgs,
+  uint32_t msg_count
+)
+{
+  int err;
+
+  rtems_recursive_mutex_lock(&bus->mutex);
+  err = (*bus->transfer)(bus, msgs, msg_count);
+  rtems_recursive_mutex_unlock(&bus->mutex);
+
+  return err;
+}
+
+static void spi_bus_queue_task(rtems_task_argument arg)
+{
+  spi_bus_queue *queue = (spi_bus_queue *) arg;
+
+  while (true) {
+    uint32_t req_count;
+    uint32_t msg_count;
+    uint32_t i;
+    int err;
+
+    rtems_mutex_lock(&queue->mutex);
+    req_count = spi_bus_queue_take_batch(queue, &msg_count);
+
+    if (req_count == 0) {
+      bool stop = queue->stop;
+
+      rtems_mutex_unlock(&queue->mutex);
+
+      if (stop) {
+        break;
+      }
+
+      rtems_binary_semaphore_wait(&queue->wakeup);
+      continue;
+    }
+
+    rtems_mutex_unlock(&queue->mutex);
+
+    if (req_count == 1) {
+      spi_bus_request *req = queue->batch[0];
+
+      err = spi_bus_queue_transfer(queue->bus, req->msgs, req->msg_count);
+    } else {
+      err = spi_bus_queue_transfer(queue->bus, queue->msgs, msg_count);
+    }
+
+    for (i = 0; i < req_count; ++i) {
+      spi_bus_request *req = queue->batch[i];
+
+      (*req->done)(req, err);
+    }
+  }
+
+  rtems_binary_semaphore_post(&queue->stopped);
+  rtems_task_exit();
+}
+
+int spi_bus_queue_submit(spi_bus_queue *queue, spi_bus_request *req)
+{
+  rtems_chain_node *node;
+
+  if (req->msg_count == 0 || req->done == NULL) {
+    return -EINVAL;
+  }
+
+  rtems_mutex_lock(&queue->mutex);
+
+  node = rtems_chain_last(&queue->pending);
+
+  while (
+    node != rtems_chain_head(&queue->pending)
+      && spi_bus_request_of_node(node)->priority > req->priority
+  ) {
+    node = rtems_chain_previous(node);
+  }
+
+  rtems_chain_insert_unprotected(node, &req->node);
+  rtems_mutex_unlock(&queue->mutex);
+  rtems_binary_semaphore_post(&queue->wakeup);
+  return 0;
+}
+
+static void spi_bus_queue_destroy_sync(spi_bus_queue *queue)
+{
+  rtems_binary_semaphore_destroy(&queue->stopped);
+  rtems_binary_semaphore_destroy(&queue->wakeup);
+  rtems_mutex_destroy(&queue->mutex);
+}
+
+int spi_bus_queue_init(
+  spi_bus_queue *queue,
+  spi_bus *bus,
+  rtems_task_priority priority
+)
+{
+  rtems_status_code sc;
+
+  queue->bus = bus;
+  queue->stop = false;
+  rtems_mutex_init(&queue->mutex, "SPI Bus Queue");
+  rtems_chain_initialize_empty(&queue->pending);
+  rtems_binary_semaphore_init(&queue->wakeup, "SPI Bus Queue Wakeup");
+  rtems_binary_semaphore_init(&queue->stopped, "SPI Bus Queue Stopped");
+
+  sc = rtems_task_create(
+    rtems_build_name('S', 'P', 'I', 'Q'),
+    priority,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &queue->task
+  );
+  if (sc != RTEMS_SUCCESSFUL) {
+    spi_bus_queue_destroy_sync(queue);
+    return -rtems_status_code_to_errno(sc);
+  }
+
+  sc = rtems_task_start(
+    queue->task,
+    spi_bus_queue_task,
+    (rtems_task_argument) queue
+  );
+  if (sc != RTEMS_SUCCESSFUL) {
+    (void) rtems_task_delete(queue->task);
+    spi_bus_queue_destroy_sync(queue);
+    return -rtems_status_code_to_errno(sc);
+  }
+
+  return 0;
+}
+
+void spi_bus_queue_destroy(spi_bus_queue *queue)
+{
+  rtems_mutex_lock(&queue->mutex);
+  queue->stop = true;
+  rtems_mutex_unlock(&queue->mutex);
+  rtems_binary_semaphore_post(&queue->wakeup);
+  rtems_binary_semaphore_wait(&queue->stopped);
+  spi_bus_queue_destroy_sync(queue);
+}
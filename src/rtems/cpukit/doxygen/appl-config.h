@@ -1735,6 +1735,94 @@
  */
 #define CONFIGURE_MAXIMUM_DRIVERS
 
+/* Generated from spec:/acfg/if/printk-buffer-size */
+
+/**
+ * @brief This configuration option is an integer define.
+ *
+ * @anchor CONFIGURE_PRINTK_BUFFER_SIZE
+ *
+ * The value of this configuration option defines the size in bytes of the
+ * printk() ring buffer of each processor, see <rtems/printkbuffer.h>.
+ *
+ * @par Default Value
+ * The default value is 0.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this configuration option:
+ *
+ * - The value of the configuration option shall be zero or greater than or
+ *   equal to 256.
+ *
+ * - The value of the configuration option shall be zero or a power of two.
+ *
+ * - The value of the configuration option shall be less than or equal to a
+ *   BSP-specific and application-specific value which depends on the size of
+ *   the memory available to the application.
+ * @endparblock
+ *
+ * @par Notes
+ * @parblock
+ * If the value of this configuration option is greater than zero, then
+ * printk(), vprintk(), and putk() copy the messages into the ring buffer of
+ * the current processor and a drain task outputs them in timestamp order.
+ * The ring buffers are statically allocated for each configured processor
+ * (@ref CONFIGURE_MAXIMUM_PROCESSORS).  Each message needs a header of 16
+ * bytes, messages longer than 128 characters are split.
+ *
+ * The drain task is a Classic API task, so it must be accounted for in @ref
+ * CONFIGURE_MAXIMUM_TASKS.  If the drain task cannot be created, then the
+ * messages are output directly.
+ * @endparblock
+ */
+#define CONFIGURE_PRINTK_BUFFER_SIZE
+
+/* Generated from spec:/acfg/if/printk-buffer-overflow-output */
+
+/**
+ * @brief This configuration option is a boolean feature define.
+ *
+ * @anchor CONFIGURE_PRINTK_BUFFER_OVERFLOW_OUTPUT
+ *
+ * In case this configuration option is defined, then a message which does
+ * not fit into the full printk() ring buffer is output directly by the
+ * caller, otherwise it is discarded and counted.
+ *
+ * @par Default Configuration
+ * If this configuration option is undefined, then the described feature is not
+ * enabled.
+ *
+ * @par Notes
+ * A directly output message may appear out of order with respect to buffered
+ * messages.  Use rtems_printk_buffer_get_discarded() to get the count of
+ * discarded messages.
+ */
+#define CONFIGURE_PRINTK_BUFFER_OVERFLOW_OUTPUT
+
+/* Generated from spec:/acfg/if/printk-buffer-task-priority */
+
+/**
+ * @brief This configuration option is an integer define.
+ *
+ * @anchor CONFIGURE_PRINTK_BUFFER_TASK_PRIORITY
+ *
+ * The value of this configuration option defines the priority of the printk()
+ * buffer drain task.
+ *
+ * @par Default Value
+ * The default value is 0.
+ *
+ * @par Constraints
+ * The value of the configuration option shall be zero or a valid Classic API
+ * task priority.
+ *
+ * @par Notes
+ * If the value is zero, then the drain task uses the priority
+ * ``RTEMS_MAXIMUM_PRIORITY - 1``.
+ */
+#define CONFIGURE_PRINTK_BUFFER_TASK_PRIORITY
+
 /** @} */
 
 /* Generated from spec:/acfg/if/group-eventrecord */
@@ -1894,6 +1982,33 @@
  */
 #define CONFIGURE_RECORD_PER_PROCESSOR_ITEMS
 
+/* Generated from spec:/acfg/if/latency-histograms */
+
+/**
+ * @brief This configuration option is a boolean feature define.
+ *
+ * @anchor CONFIGURE_LATENCY_HISTOGRAMS
+ *
+ * In case this configuration option is defined, then the latency histograms
+ * are enabled, see <rtems/latency.h>.
+ *
+ * @par Default Configuration
+ * If this configuration option is undefined, then the described feature is not
+ * enabled.
+ *
+ * @par Notes
+ * @parblock
+ * The histograms are statically allocated for each configured processor
+ * (@ref CONFIGURE_MAXIMUM_PROCESSORS), about 1.5KiB per processor.  The
+ * interrupt latencies are only recorded by BSPs which use the generic
+ * interrupt support.
+ *
+ * This configuration option cannot be used together with @ref
+ * CONFIGURE_RECORD_INTERRUPTS_ENABLED.
+ * @endparblock
+ */
+#define CONFIGURE_LATENCY_HISTOGRAMS
+
 /** @} */
 
 /* Generated from spec:/acfg/if/group-face */
@@ -2885,6 +3000,47 @@
  */
 #define CONFIGURE_MALLOC_DIRTY
 
+/* Generated from spec:/acfg/if/max-cached-task-stacks */
+
+/**
+ * @brief This configuration option is an integer define.
+ *
+ * @anchor CONFIGURE_MAXIMUM_CACHED_TASK_STACKS
+ *
+ * The value of this configuration option defines the maximum number of task
+ * stacks of deleted tasks which are kept for the reuse by new tasks.
+ *
+ * @par Default Value
+ * The default value is 0.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this configuration option:
+ *
+ * - The value of the configuration option shall be greater than or equal to
+ *   zero.
+ *
+ * - The value of the configuration option shall be less than or equal to
+ *   <a href="https://en.cppreference.com/w/c/types/integer">UINT32_MAX</a>.
+ * @endparblock
+ *
+ * @par Notes
+ * @parblock
+ * The task stack cache applies to the task stacks allocated by
+ * rtems_task_create() and pthread_create().  When such a task is deleted, its
+ * stack is kept in the cache.  A new task with exactly the same stack size
+ * reuses the most recently cached stack instead of allocating a new one.  If
+ * the cache is full, then the least recently cached stack is freed.  This
+ * speeds up applications which create and delete tasks frequently, for
+ * example one worker task for each request.
+ *
+ * The cached stacks are not available to other allocations.  Account for them
+ * through #CONFIGURE_EXTRA_TASK_STACKS.  The default value of zero disables
+ * the cache.
+ * @endparblock
+ */
+#define CONFIGURE_MAXIMUM_CACHED_TASK_STACKS
+
 /* Generated from spec:/acfg/if/max-file-descriptors */
 
 /**
@@ -3272,6 +3428,43 @@
  */
 #define CONFIGURE_MINIMUM_TASK_STACK_SIZE
 
+/* Generated from spec:/acfg/if/mutex-adaptive-spin-nanoseconds */
+
+/**
+ * @brief This configuration option is an integer define.
+ *
+ * @anchor CONFIGURE_MUTEX_ADAPTIVE_SPIN_NANOSECONDS
+ *
+ * The value of this configuration option defines the maximum time in
+ * nanoseconds a thread spins while the owner of a mutex executes on another
+ * processor before it blocks on the mutex.
+ *
+ * @par Default Value
+ * The default value is 0.
+ *
+ * @par Constraints
+ * The value of the configuration option shall be less than or equal to <a
+ * href="https://en.cppreference.com/w/c/types/integer">UINT32_MAX</a>.
+ *
+ * @par Notes
+ * @parblock
+ * If the value is zero, then threads block immediately on an owned mutex.
+ * Otherwise, the adaptive spinning applies to the self-contained mutexes
+ * (for example used by Newlib and the allocator lock), the Classic binary
+ * semaphores with the priority inheritance, priority ceiling, or no locking
+ * protocol, and the POSIX mutexes.  A thread does not spin if other threads
+ * are already blocked on the mutex.  Spinning avoids the context switch
+ * overhead for short critical sections, however, it wastes processor time if
+ * the owner executes for a long time.  The value should be in the range of
+ * the time needed to block and unblock a thread.
+ *
+ * This configuration option is only evaluated in SMP configurations of RTEMS
+ * (e.g. RTEMS was built with the SMP build configuration option enabled). In
+ * all other configurations it has no effect.
+ * @endparblock
+ */
+#define CONFIGURE_MUTEX_ADAPTIVE_SPIN_NANOSECONDS
+
 /* Generated from spec:/acfg/if/stack-checker-enabled */
 
 /**
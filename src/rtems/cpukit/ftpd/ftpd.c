@@ -244,6 +244,7 @@
 
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <arpa/ftp.h>
 #include <netinet/in.h>
 
@@ -280,6 +281,66 @@ static struct rtems_ftpd_configuration *ftpd_config;
 /* this is not prototyped in strict ansi mode */
 FILE *fdopen (int fildes, const char *mode);
 
+/* Routine used to write a vector of buffers to the file or socket */
+typedef ssize_t (*FTPD_WritevProc)(int, const struct iovec *, int);
+
+/* Direction of a data transfer */
+typedef enum
+{
+  FTPD_XFER_RETRIEVE, /* File to data socket ("RETR") */
+  FTPD_XFER_STORE     /* Data socket to file ("STOR") */
+} FTPD_Transfer_kind;
+
+/* Stack size of the transfer helper task */
+enum
+{
+  FTPD_XFER_STACKSIZE = RTEMS_MINIMUM_STACK_SIZE + 2 * 1024
+};
+
+/*Transfer structure.
+ *
+ * Each session owns two transfer buffers and a helper task.  During a data
+ * transfer the helper task performs the file I/O while the session task
+ * performs the socket I/O, so that both overlap.  The buffers circulate
+ * between a producer and a consumer: 'empty' counts buffers available to
+ * the producer, 'full' counts buffers available to the consumer.  A length
+ * less than or equal to zero in a full buffer terminates the transfer.
+ */
+typedef struct
+{
+  char                     *buf[2];     /* Cache aligned transfer buffers */
+  ssize_t                  len[2];      /* Lengths of the filled buffers */
+  rtems_counting_semaphore empty;       /* Buffers available to producer */
+  rtems_counting_semaphore full;        /* Buffers available to consumer */
+  rtems_binary_semaphore   start;       /* Start request for helper task */
+  rtems_binary_semaphore   done;        /* Helper task finished transfer */
+  rtems_id                 tid;         /* Helper task id */
+  FTPD_Transfer_kind       kind;        /* Transfer direction */
+  int                      xfer_mode;   /* Transfer mode (ASCII/binary) */
+  int                      fd;          /* File descriptor */
+  int                      sock;        /* Data socket */
+  FTPD_WritevProc          wrt;         /* Routine to write to the file */
+  volatile bool            abort;       /* Consumer failed, stop producing */
+  bool                     pended_cr;   /* CR at end of previous buffer */
+  int                      bare_lfs;    /* Bare LFs received in ASCII mode */
+  int                      file_res;    /* Result of the file I/O side */
+  uint64_t                 bytes;       /* Bytes passed to the consumer */
+} FTPD_Transfer_t;
+
+/*Transfer statistics.
+ *
+ * Statistics of the data transfers of the current session.
+ */
+typedef struct
+{
+  uint64_t                 bytes_retrieved;
+  uint64_t                 bytes_stored;
+  uint32_t                 files_retrieved;
+  uint32_t                 files_stored;
+  uint32_t                 errors;
+  rtems_interval           ticks;       /* Clock ticks spent in transfers */
+} FTPD_Transfer_stats_t;
+
 /*SessionInfo structure.
  *
  * The following structure is allocated for each session.
@@ -300,6 +361,8 @@ typedef struct
   char                *user;       /* user name (0 if not supplied) */
   char                user_buf[256]; /* user name buffer */
   bool                auth;        /* true if user/pass was valid, false if not or not supplied */
+  FTPD_Transfer_t     xfer;        /* Data transfer engine */
+  FTPD_Transfer_stats_t stats;     /* Data transfer statistics */
 } FTPD_SessionInfo_t;
 
 
@@ -405,7 +468,17 @@ task_pool_done(int count)
 {
   int i;
   for(i = 0; i < count; ++i)
-    rtems_task_delete(task_pool.info[i].tid);
+  {
+    FTPD_Transfer_t *xfer = &task_pool.info[i].xfer;
+    if (task_pool.info[i].tid != 0)
+      rtems_task_delete(task_pool.info[i].tid);
+    if (xfer->tid != 0)
+      rtems_task_delete(xfer->tid);
+    rtems_binary_semaphore_destroy(&xfer->start);
+    rtems_binary_semaphore_destroy(&xfer->done);
+    free(xfer->buf[0]);
+    free(xfer->buf[1]);
+  }
   free(task_pool.info);
   free(task_pool.queue);
   rtems_mutex_destroy(&task_pool.mutex);
@@ -415,6 +488,48 @@ task_pool_done(int count)
   task_pool.count = 0;
 }
 
+static void transfer_task(rtems_task_argument arg); /* Forward declare */
+
+/*
+ * transfer_init
+ *
+ * Allocate the transfer buffers of a session and start its helper task.
+ *
+ * Input parameters:
+ *   xfer     - transfer structure of the session
+ *   id       - last character of the task name
+ *   priority - priority the helper task is started with
+ *
+ * Output parameters:
+ *   returns RTEMS_SUCCESSFUL on success, an error status otherwise.
+ *
+ */
+static rtems_status_code
+transfer_init(FTPD_Transfer_t *xfer, char id, rtems_task_priority priority)
+{
+  rtems_status_code sc;
+
+  xfer->buf[0] = rtems_cache_aligned_malloc(FTPD_XFER_BLOCK_SIZE);
+  xfer->buf[1] = rtems_cache_aligned_malloc(FTPD_XFER_BLOCK_SIZE);
+  if (NULL == xfer->buf[0] || NULL == xfer->buf[1])
+    return RTEMS_NO_MEMORY;
+
+  sc = rtems_task_create(rtems_build_name('F', 'T', 'X', id),
+    priority, FTPD_XFER_STACKSIZE,
+    RTEMS_PREEMPT | RTEMS_NO_TIMESLICE |
+    RTEMS_NO_ASR | RTEMS_INTERRUPT_LEVEL(0),
+    RTEMS_FLOATING_POINT | RTEMS_LOCAL,
+    &xfer->tid);
+  if (sc == RTEMS_SUCCESSFUL)
+  {
+    sc = rtems_task_start(
+      xfer->tid, transfer_task, (rtems_task_argument)xfer);
+  }
+  else
+    xfer->tid = 0;
+  return sc;
+}
+
 /*
  * task_pool_init
  *
@@ -444,7 +559,7 @@ task_pool_init(int count, rtems_task_priority priority)
   rtems_counting_semaphore_init(&task_pool.sem, "FTPD", (unsigned int) count);
 
   task_pool.info = (FTPD_SessionInfo_t*)
-    malloc(sizeof(FTPD_SessionInfo_t) * count);
+    calloc(count, sizeof(FTPD_SessionInfo_t));
   task_pool.queue = (FTPD_SessionInfo_t**)
     malloc(sizeof(FTPD_SessionInfo_t*) * count);
   if (NULL == task_pool.info || NULL == task_pool.queue)
@@ -457,6 +572,8 @@ task_pool_init(int count, rtems_task_priority priority)
   for(i = 0; i < count; ++i)
   {
     FTPD_SessionInfo_t *info = &task_pool.info[i];
+    rtems_binary_semaphore_init(&info->xfer.start, "FTPD");
+    rtems_binary_semaphore_init(&info->xfer.done, "FTPD");
     sc = rtems_task_create(rtems_build_name('F', 'T', 'P', id),
       priority, FTPD_STACKSIZE,
       RTEMS_PREEMPT | RTEMS_NO_TIMESLICE |
@@ -467,8 +584,10 @@ task_pool_init(int count, rtems_task_priority priority)
     {
       sc = rtems_task_start(
         info->tid, session, (rtems_task_argument)info);
+      if (sc == RTEMS_SUCCESSFUL)
+        sc = transfer_init(&info->xfer, id, priority);
       if (sc != RTEMS_SUCCESSFUL)
-        task_pool_done(i);
+        task_pool_done(i + 1);
     }
     else
       task_pool_done(i + 1);
@@ -769,6 +888,443 @@ send_mode_reply(FTPD_SessionInfo_t *info)
     send_reply(info, 150, "Opening ASCII mode data connection.");
 }
 
+/*
+ * Double-buffered data transfer engine
+ *
+ */
+
+/* Maximum number of segments passed to a single writev() call */
+enum
+{
+  FTPD_XFER_IOV_MAX = 32
+};
+
+/*
+ * IovBatch structure.
+ *
+ * Collects segments of a buffer which are written with a single writev().
+ */
+typedef struct
+{
+  struct iovec iov[FTPD_XFER_IOV_MAX];
+  int          cnt;
+  size_t       total;
+} FTPD_IovBatch_t;
+
+/*
+ * iov_batch_flush
+ *
+ * Write all collected segments.
+ *
+ * Input parameters:
+ *   batch - segments to write
+ *   fd    - file or socket descriptor
+ *   wrt   - routine to write the segments
+ *
+ * Output parameters:
+ *   returns 1 on success, 0 on failure.
+ *
+ */
+static int
+iov_batch_flush(FTPD_IovBatch_t *batch, int fd, FTPD_WritevProc wrt)
+{
+  int res = 1;
+
+  if (batch->cnt > 0)
+    res = wrt(fd, batch->iov, batch->cnt) == (ssize_t) batch->total;
+  batch->cnt = 0;
+  batch->total = 0;
+  return res;
+}
+
+/*
+ * iov_batch_add
+ *
+ * Add a segment, write the collected segments if the batch is full.
+ *
+ * Input parameters:
+ *   batch - segments to write
+ *   fd    - file or socket descriptor
+ *   wrt   - routine to write the segments
+ *   b     - start of segment
+ *   n     - length of segment
+ *
+ * Output parameters:
+ *   returns 1 on success, 0 on failure.
+ *
+ */
+static int
+iov_batch_add(FTPD_IovBatch_t *batch, int fd, FTPD_WritevProc wrt,
+  char const *b, size_t n)
+{
+  if (n == 0)
+    return 1;
+  batch->iov[batch->cnt].iov_base = RTEMS_DECONST(char *, b);
+  batch->iov[batch->cnt].iov_len = n;
+  batch->total += n;
+  if (++batch->cnt < FTPD_XFER_IOV_MAX)
+    return 1;
+  return iov_batch_flush(batch, fd, wrt);
+}
+
+/*
+ * ascii_to_net
+ *
+ * Send a buffer in ASCII mode, i.e., convert LF to CR LF.
+ *
+ * Input parameters:
+ *   s - data socket
+ *   b - data to send
+ *   n - number of bytes in `b'
+ *
+ * Output parameters:
+ *   returns 1 on success, 0 on failure.
+ *
+ */
+static int
+ascii_to_net(int s, char const *b, size_t n)
+{
+  FTPD_IovBatch_t batch;
+  char const      *e = b + n;
+  int             res = 1;
+
+  batch.cnt = 0;
+  batch.total = 0;
+  while (res && b < e)
+  {
+    char const *lf = memchr(b, '\n', (size_t) (e - b));
+
+    if (lf == NULL)
+    {
+      res = iov_batch_add(&batch, s, writev, b, (size_t) (e - b));
+      b = e;
+    }
+    else
+    {
+      res = iov_batch_add(&batch, s, writev, b, (size_t) (lf - b))
+        && iov_batch_add(&batch, s, writev, "\r\n", 2);
+      b = lf + 1;
+    }
+  }
+  return res && iov_batch_flush(&batch, s, writev);
+}
+
+/*
+ * ascii_from_net
+ *
+ * Write a buffer received in ASCII mode to the file, i.e., convert CR LF to
+ * LF.  A CR at the end of the buffer is held back until the next buffer
+ * shows whether it is followed by a LF.
+ *
+ * Input parameters:
+ *   xfer - transfer structure of the session
+ *   fd   - file descriptor
+ *   wrt  - routine to write to `fd'
+ *   b    - received data
+ *   n    - number of bytes in `b', greater than zero
+ *
+ * Output parameters:
+ *   returns 1 on success, 0 on failure.
+ *
+ */
+static int
+ascii_from_net(FTPD_Transfer_t *xfer, int fd, FTPD_WritevProc wrt,
+  char const *b, size_t n)
+{
+  FTPD_IovBatch_t batch;
+  bool            split_crlf = false;
+  size_t          start = 0;
+  size_t          i;
+  int             res = 1;
+
+  batch.cnt = 0;
+  batch.total = 0;
+  if (xfer->pended_cr)
+  {
+    xfer->pended_cr = false;
+    if (b[0] == '\n')
+      split_crlf = true;
+    else
+      res = iov_batch_add(&batch, fd, wrt, "\r", 1);
+  }
+  for (i = 0; res && i < n; ++i)
+  {
+    if (b[i] != '\n')
+      continue;
+    if (i > 0 && b[i - 1] == '\r')
+    {
+      res = iov_batch_add(&batch, fd, wrt, b + start,
+        i - 1 - start);
+      start = i;
+    }
+    else if (i > 0 || !split_crlf)
+      ++xfer->bare_lfs;
+  }
+  if (res && b[n - 1] == '\r')
+  {
+    xfer->pended_cr = true;
+    --n;
+  }
+  return res
+    && iov_batch_add(&batch, fd, wrt, b + start, n - start)
+    && iov_batch_flush(&batch, fd, wrt);
+}
+
+/*
+ * transfer_produce
+ *
+ * Fill the transfer buffers from a file or socket until end of data, an
+ * error, or a consumer failure.  If both buffers are empty, they are filled
+ * with a single readv().
+ *
+ * Input parameters:
+ *   xfer - transfer structure of the session
+ *   fd   - file or socket descriptor to read from
+ *
+ * Output parameters:
+ *   returns 0 on end of data, -1 otherwise.
+ *
+ */
+static ssize_t
+transfer_produce(FTPD_Transfer_t *xfer, int fd)
+{
+  int     i = 0;
+  ssize_t n;
+
+  do
+  {
+    struct iovec iov[2];
+    int          cnt = 1;
+
+    rtems_counting_semaphore_wait(&xfer->empty);
+    if (xfer->abort)
+    {
+      n = -1;
+      xfer->len[i] = n;
+      rtems_counting_semaphore_post(&xfer->full);
+      break;
+    }
+
+    iov[0].iov_base = xfer->buf[i];
+    iov[0].iov_len = FTPD_XFER_BLOCK_SIZE;
+    if (rtems_counting_semaphore_try_wait(&xfer->empty) == 0)
+    {
+      iov[1].iov_base = xfer->buf[i ^ 1];
+      iov[1].iov_len = FTPD_XFER_BLOCK_SIZE;
+      cnt = 2;
+    }
+
+    n = readv(fd, iov, cnt);
+    if (xfer->abort)
+      n = -1;
+    if (n > FTPD_XFER_BLOCK_SIZE)
+    {
+      xfer->len[i] = FTPD_XFER_BLOCK_SIZE;
+      xfer->len[i ^ 1] = n - FTPD_XFER_BLOCK_SIZE;
+      rtems_counting_semaphore_post(&xfer->full);
+      rtems_counting_semaphore_post(&xfer->full);
+    }
+    else
+    {
+      xfer->len[i] = n;
+      rtems_counting_semaphore_post(&xfer->full);
+      if (cnt == 2)
+        rtems_counting_semaphore_post(&xfer->empty);
+      i ^= 1;
+    }
+  }
+  while (n > 0);
+
+  return n < 0 ? -1 : 0;
+}
+
+/*
+ * transfer_consume
+ *
+ * Write the filled transfer buffers to a file or socket until the producer
+ * terminates the transfer.  In binary mode two filled buffers are written
+ * with a single writev().  After a write error the remaining data is
+ * drained and the producer is told to stop.  For FTPD_XFER_STORE the data
+ * socket is shut down for reading, so that the producer does not receive
+ * the rest of the upload.
+ *
+ * Input parameters:
+ *   xfer - transfer structure of the session
+ *   fd   - file or socket descriptor to write to
+ *   wrt  - routine to write to `fd'
+ *
+ * Output parameters:
+ *   returns 1 on success, 0 on failure.
+ *
+ */
+static int
+transfer_consume(FTPD_Transfer_t *xfer, int fd, FTPD_WritevProc wrt)
+{
+  int i = 0;
+  int avail = 0;
+  int res = 1;
+
+  while (1)
+  {
+    struct iovec iov[2];
+    int          cnt = 1;
+    int          k;
+
+    if (avail == 0)
+    {
+      rtems_counting_semaphore_wait(&xfer->full);
+      avail = 1;
+    }
+    if (xfer->len[i] <= 0)
+      break;
+
+    iov[0].iov_base = xfer->buf[i];
+    iov[0].iov_len = (size_t) xfer->len[i];
+    if (avail == 1 && rtems_counting_semaphore_try_wait(&xfer->full) == 0)
+      avail = 2;
+    if (avail == 2 && xfer->xfer_mode == TYPE_I && xfer->len[i ^ 1] > 0)
+    {
+      iov[1].iov_base = xfer->buf[i ^ 1];
+      iov[1].iov_len = (size_t) xfer->len[i ^ 1];
+      cnt = 2;
+    }
+
+    if (res)
+    {
+      if (xfer->xfer_mode == TYPE_I)
+        res = wrt(fd, iov, cnt) == (ssize_t) (iov[0].iov_len +
+          (cnt == 2 ? iov[1].iov_len : 0));
+      else if (xfer->kind == FTPD_XFER_RETRIEVE)
+        res = ascii_to_net(fd, iov[0].iov_base, iov[0].iov_len);
+      else
+        res = ascii_from_net(xfer, fd, wrt, iov[0].iov_base, iov[0].iov_len);
+      if (!res)
+      {
+        xfer->abort = true;
+        /* Unblock the session task receiving the rest of the upload */
+        if (xfer->kind == FTPD_XFER_STORE)
+          shutdown(xfer->sock, SHUT_RD);
+      }
+    }
+
+    for (k = 0; k < cnt; ++k)
+    {
+      xfer->bytes += (uint64_t) xfer->len[i];
+      rtems_counting_semaphore_post(&xfer->empty);
+      i ^= 1;
+    }
+    avail -= cnt;
+    yield();
+  }
+
+  if (res && xfer->pended_cr)
+  {
+    /* A CR at the very end of the data is not part of a CR LF */
+    struct iovec cr = { "\r", 1 };
+    res = wrt(fd, &cr, 1) == 1;
+  }
+  return res;
+}
+
+/*
+ * transfer_task
+ *
+ * Helper task of a session.  Performs the file I/O of the data transfers
+ * started by transfer_run().
+ *
+ * Input parameters:
+ *   arg - pointer to corresponding Transfer structure.
+ *
+ * Output parameters:
+ *   NONE
+ */
+static void
+transfer_task(rtems_task_argument arg)
+{
+  FTPD_Transfer_t *const xfer = (FTPD_Transfer_t *)arg;
+
+  while (1)
+  {
+    rtems_binary_semaphore_wait(&xfer->start);
+    if (xfer->kind == FTPD_XFER_RETRIEVE)
+      xfer->file_res = transfer_produce(xfer, xfer->fd) == 0;
+    else
+      xfer->file_res = transfer_consume(xfer, xfer->fd, xfer->wrt);
+    rtems_binary_semaphore_post(&xfer->done);
+  }
+}
+
+/*
+ * transfer_run
+ *
+ * Transfer data between a file and the data socket.  The helper task of the
+ * session performs the file I/O, the calling session task performs the
+ * socket I/O.
+ *
+ * Input parameters:
+ *   info - corresponding SessionInfo structure
+ *   kind - transfer direction
+ *   fd   - file descriptor
+ *   s    - data socket
+ *   wrt  - routine to write to the file (FTPD_XFER_STORE only)
+ *
+ * Output parameters:
+ *   returns 1 on success, 0 on failure.  For FTPD_XFER_STORE only file write
+ *   errors are failures, the end of the data is given by the client closing
+ *   the data connection.
+ *
+ */
+static int
+transfer_run(FTPD_SessionInfo_t *info, FTPD_Transfer_kind kind, int fd,
+  int s, FTPD_WritevProc wrt)
+{
+  FTPD_Transfer_t       *xfer = &info->xfer;
+  FTPD_Transfer_stats_t *stats = &info->stats;
+  rtems_interval        start = rtems_clock_get_ticks_since_boot();
+  int                   res;
+
+  xfer->kind = kind;
+  xfer->xfer_mode = info->xfer_mode;
+  xfer->fd = fd;
+  xfer->sock = s;
+  xfer->wrt = wrt;
+  xfer->abort = false;
+  xfer->pended_cr = false;
+  xfer->bare_lfs = 0;
+  xfer->file_res = 0;
+  xfer->bytes = 0;
+  rtems_counting_semaphore_init(&xfer->empty, "FTPD", 2);
+  rtems_counting_semaphore_init(&xfer->full, "FTPD", 0);
+
+  rtems_binary_semaphore_post(&xfer->start);
+  if (kind == FTPD_XFER_RETRIEVE)
+    res = transfer_consume(xfer, s, writev);
+  else
+  {
+    (void) transfer_produce(xfer, s);
+    res = 1;
+  }
+  rtems_binary_semaphore_wait(&xfer->done);
+  res = res && xfer->file_res;
+
+  rtems_counting_semaphore_destroy(&xfer->empty);
+  rtems_counting_semaphore_destroy(&xfer->full);
+
+  if (kind == FTPD_XFER_RETRIEVE)
+  {
+    stats->bytes_retrieved += xfer->bytes;
+    stats->files_retrieved += res;
+  }
+  else
+  {
+    stats->bytes_stored += xfer->bytes;
+    stats->files_stored += res;
+  }
+  stats->errors += !res;
+  stats->ticks += rtems_clock_get_ticks_since_boot() - start;
+  return res;
+}
+
 /*
  * command_retrieve
  *
@@ -787,7 +1343,6 @@ command_retrieve(FTPD_SessionInfo_t  *info, char const *filename)
 {
   int                 s = -1;
   int                 fd = -1;
-  char                buf[FTPD_DATASIZE];
   struct stat         stat_buf;
   int                 res = 0;
 
@@ -817,55 +1372,7 @@ command_retrieve(FTPD_SessionInfo_t  *info, char const *filename)
 
   if (0 <= s)
   {
-    int n = -1;
-
-    if(info->xfer_mode == TYPE_I)
-    {
-      while ((n = read(fd, buf, FTPD_DATASIZE)) > 0)
-      {
-        if(send(s, buf, n, 0) != n)
-          break;
-        yield();
-      }
-    }
-    else if (info->xfer_mode == TYPE_A)
-    {
-      int rest = 0;
-      while (rest == 0 && (n = read(fd, buf, FTPD_DATASIZE)) > 0)
-      {
-        char const* e = buf;
-        char const* b;
-        int i;
-        rest = n;
-        do
-        {
-          char lf = '\0';
-
-          b = e;
-          for(i = 0; i < rest; ++i, ++e)
-          {
-            if(*e == '\n')
-            {
-              lf = '\n';
-              break;
-            }
-          }
-          if(send(s, b, i, 0) != i)
-            break;
-          if(lf == '\n')
-          {
-            if(send(s, "\r\n", 2, 0) != 2)
-              break;
-            ++e;
-            ++i;
-          }
-        }
-        while((rest -= i) > 0);
-        yield();
-      }
-    }
-
-    if (0 == n)
+    if (transfer_run(info, FTPD_XFER_RETRIEVE, fd, s, NULL))
     {
       if (0 == close(fd))
       {
@@ -892,22 +1399,26 @@ command_retrieve(FTPD_SessionInfo_t  *info, char const *filename)
 /*
  * discard
  *
- * Analog of `write' routine that just discards passed data
+ * Analog of `writev' routine that just discards passed data
  *
  * Input parameters:
- *   fd    - file descriptor (ignored)
- *   buf   - data to write (ignored)
- *   count - number of bytes in `buf'
+ *   fd     - file descriptor (ignored)
+ *   iov    - data to write
+ *   iovcnt - number of entries in `iov'
  *
  * Output parameters:
- *   returns `count'
+ *   returns total number of bytes in `iov'
  *
  */
 static ssize_t
-discard(int fd, void const* buf, size_t count)
+discard(int fd, const struct iovec *iov, int iovcnt)
 {
+  ssize_t count = 0;
+  int     i;
+
   (void)fd;
-  (void)buf;
+  for (i = 0; i < iovcnt; ++i)
+    count += (ssize_t) iov[i].iov_len;
   return count;
 }
 
@@ -930,12 +1441,11 @@ command_store(FTPD_SessionInfo_t *info, char const *filename)
   int                    n;
   unsigned long          size = 0;
   struct rtems_ftpd_hook *usehook = NULL;
-  char                   buf[FTPD_DATASIZE];
+  char                   buf[FTPD_BUFSIZE];
   int                    res = 1;
   int                    bare_lfs = 0;
   int                    null = 0;
-  typedef ssize_t (*WriteProc)(int, void const*, size_t);
-  WriteProc              wrt = &write;
+  FTPD_WritevProc        wrt = &writev;
 
   if(!can_write() || !info->auth)
   {
@@ -1046,80 +1556,8 @@ command_store(FTPD_SessionInfo_t *info, char const *filename)
       return;
     }
 
-    if(info->xfer_mode == TYPE_I)
-    {
-      while ((n = recv(s, buf, FTPD_DATASIZE, 0)) > 0)
-      {
-        if (wrt(fd, buf, n) != n)
-        {
-          res = 0;
-          break;
-        }
-        yield();
-      }
-    }
-    else if(info->xfer_mode == TYPE_A)
-    {
-      int rest = 0;
-      int pended_cr = 0;
-      while (res && rest == 0 && (n = recv(s, buf, FTPD_DATASIZE, 0)) > 0)
-      {
-        char const* e = buf;
-        char const* b;
-        int i;
-
-        rest = n;
-        if(pended_cr && *e != '\n')
-        {
-          char const lf = '\r';
-          pended_cr = 0;
-          if(wrt(fd, &lf, 1) != 1)
-          {
-            res = 0;
-            break;
-          }
-        }
-        do
-        {
-          int count;
-          int sub = 0;
-
-          b = e;
-          for(i = 0; i < rest; ++i, ++e)
-          {
-            int pcr = pended_cr;
-            pended_cr = 0;
-            if(*e == '\r')
-            {
-              pended_cr = 1;
-            }
-            else if(*e == '\n')
-            {
-              if(pcr)
-              {
-                sub = 2;
-                ++i;
-                ++e;
-                break;
-              }
-              ++bare_lfs;
-            }
-          }
-          if(res == 0)
-            break;
-          count = i - sub - pended_cr;
-          if(count > 0 && wrt(fd, b, count) != count)
-          {
-            res = 0;
-            break;
-          }
-          if(sub == 2 && wrt(fd, e - 1, 1) != 1)
-            res = 0;
-        }
-        while((rest -= i) > 0);
-        yield();
-      }
-    }
+    res = transfer_run(info, FTPD_XFER_STORE, fd, s, wrt);
+    bare_lfs = info->xfer.bare_lfs;
 
     if (0 > close(fd) || res == 0)
     {
@@ -1978,6 +2416,18 @@ session(rtems_task_argument arg)
      */
     chdir("/");
 
+    if (ftpd_config->verbose)
+    {
+      FTPD_Transfer_stats_t const *stats = &info->stats;
+
+      syslog(LOG_INFO, "ftpd: Session transfers: %" PRIu32 " files/%" PRIu64
+        " bytes retrieved, %" PRIu32 " files/%" PRIu64 " bytes stored, %"
+        PRIu32 " errors, %" PRIu32 " ticks",
+        stats->files_retrieved, stats->bytes_retrieved,
+        stats->files_stored, stats->bytes_stored,
+        stats->errors, (uint32_t) stats->ticks);
+    }
+
     /* Close connection and put ourselves back into the task pool. */
     close_data_socket(info);
     close_stream(info);
@@ -2065,6 +2515,7 @@ ftpd_daemon(rtems_task_argument args RTEMS_UNUSED)
               htons(ntohs(info->ctrl_addr.sin_port) - 1);
             info->idle = ftpd_timeout;
             info->user = NULL;
+            memset(&info->stats, 0, sizeof(info->stats));
             if (ftpd_config->login)
               info->auth = false;
             else
@@ -221,6 +221,14 @@ int rtems_can_queue_fifo_init_slots( struct rtems_can_queue_fifo *fifo );
 struct rtems_can_queue_edge;
 TAILQ_HEAD( rtems_can_queue_edges_list, rtems_can_queue_edge );
 
+#ifndef RTEMS_CAN_QUEUE_FILTER_HASH_SIZE
+/**
+ * @brief This define specifies the number of hash buckets of the filter
+ * index of @ref rtems_can_queue_ends. The value has to be a power of two.
+ */
+#define RTEMS_CAN_QUEUE_FILTER_HASH_SIZE ( 32 )
+#endif
+
 /**
  * @brief This structure represents one direction connection from messages
  * source ( @ref input_ends) to message consumer ( @ref output_ends) fifo
@@ -236,7 +244,8 @@ struct rtems_can_queue_edge {
   struct rtems_can_queue_fifo fifo;
   /**
    * @brief This member holds place where primitive @ref rtems_can_filter is
-   * located.
+   * located. The filter must not be changed while the edge is connected,
+   * since it determines the position of the edge in the filter index.
    */
   struct rtems_can_filter filter;
   /**
@@ -261,6 +270,17 @@ struct rtems_can_queue_edge {
    * @brief This member holds the pointer to the activepeers head.
    */
   struct rtems_can_queue_edges_list *peershead;
+  /**
+   * @brief This member holds the lists of peers FIFOs connected by their
+   * input side ( @ref input_ends ) to the same terminal which are placed in
+   * the same filter index list.
+   */
+  TAILQ_ENTRY( rtems_can_queue_edge ) filter_peers;
+  /**
+   * @brief This member holds the pointer to the filter index list head of
+   * the input side terminal or NULL if the edge is not indexed.
+   */
+  struct rtems_can_queue_edges_list *filterhead;
   /**
    * @brief This member holds the pointer to the FIFO input side terminal
    * (  @ref rtems_can_queue_ends ).
@@ -316,6 +336,19 @@ struct rtems_can_queue_ends {
    * Each of there edges is listed on one of @ref active or @ref idle lists.
    */
   struct rtems_can_queue_edges_list outlist;
+  /**
+   * @brief This member holds the hash buckets of the outgoing edges filter
+   * index. The edges with a filter which requires an exact match of the
+   * base frame format identifier bits are placed in the bucket selected by
+   * these bits.
+   */
+  struct rtems_can_queue_edges_list
+    filter_exact[RTEMS_CAN_QUEUE_FILTER_HASH_SIZE];
+  /**
+   * @brief This member holds the list of outgoing edges with a filter which
+   * cannot be placed in the @ref filter_exact hash buckets.
+   */
+  struct rtems_can_queue_edges_list filter_masked;
   /**
    * @brief This member holds the lock synchronizing operations between
    * threads accessing the ends.
@@ -501,7 +534,10 @@ int rtems_can_queue_abort_inslot(
  * @brief This function sends message into all edges which accept its ID.
  *
  * Sends message to all outgoing edges connected to the given ends, which
- * accepts message communication ID.
+ * accepts message communication ID. The candidate edges are looked up in
+ * the filter index of the ends, so only the edges placed in the hash bucket
+ * of the message ID and the edges with masked filters are checked. TX error
+ * messages are delivered to the first accepting edge in connection order.
  *
  * @param qends      Ends structure belonging to calling communication object
  * @param src_edge   Optional source edge for echo detection
@@ -40,6 +40,7 @@
 #include <linux/i2c-dev.h>
 
 #include <rtems.h>
+#include <rtems/chain.h>
 #include <rtems/seterr.h>
 #include <rtems/thread.h>
 
@@ -328,6 +329,160 @@ int i2c_bus_do_transfer(
 
 /** @} */
 
+/**
+ * @defgroup I2CBusQueue I2C Bus Request Queue
+ *
+ * @ingroup I2C
+ *
+ * @brief Asynchronous I2C transfers serviced by a bus worker task.
+ *
+ * A bus request queue accepts transfer requests from any number of tasks
+ * without blocking them on the bus.  The requests are ordered by priority and
+ * submitted to the bus by a dedicated worker task.  The completion of a
+ * request is signalled through its completion handler.  Back-to-back requests
+ * to the same device address may be merged into one bus transfer, so that the
+ * bus is obtained only once for the whole batch.
+ *
+ * @{
+ */
+
+#ifndef I2C_BUS_QUEUE_MERGE_MAX
+/**
+ * @brief Maximum count of messages in one merged bus transfer.
+ */
+#define I2C_BUS_QUEUE_MERGE_MAX 16
+#endif
+
+/**
+ * @brief I2C bus request flag to allow merging this request with adjacent
+ * requests to the same device address.
+ *
+ * Merged requests are transferred as one message sequence, so that there is
+ * a repeated start condition instead of a stop condition between the
+ * requests.  Use this flag only for devices which do not depend on the stop
+ * condition between transactions.
+ */
+#define I2C_BUS_REQUEST_MERGE (1u << 0)
+
+typedef struct i2c_bus_request i2c_bus_request;
+
+/**
+ * @brief I2C bus request completion handler.
+ *
+ * The handler is called in the context of the worker task of the bus request
+ * queue.  The request may be submitted again or freed by the handler.
+ *
+ * @param[in] req The completed request.
+ * @param[in] status The status of the bus transfer, this is zero in case of
+ * success, otherwise a negative error number.
+ */
+typedef void (*i2c_bus_request_done)(i2c_bus_request *req, int status);
+
+/**
+ * @brief I2C bus request.
+ */
+struct i2c_bus_request {
+  /**
+   * @brief Queue node, for internal use only.
+   */
+  rtems_chain_node node;
+
+  /**
+   * @brief The messages to transfer.
+   */
+  i2c_msg *msgs;
+
+  /**
+   * @brief The count of messages to transfer.  It must be positive.
+   */
+  uint32_t msg_count;
+
+  /**
+   * @brief The request priority.
+   *
+   * Lower values are more important, like task priorities.  Requests of equal
+   * priority are serviced in submission order.
+   */
+  uint32_t priority;
+
+  /**
+   * @brief The request flags, for example @ref I2C_BUS_REQUEST_MERGE.
+   */
+  uint32_t flags;
+
+  /**
+   * @brief The completion handler.
+   */
+  i2c_bus_request_done done;
+
+  /**
+   * @brief Argument for use by the completion handler.
+   */
+  void *arg;
+};
+
+/**
+ * @brief I2C bus request queue.
+ *
+ * The members are for internal use only.
+ */
+typedef struct {
+  i2c_bus *bus;
+  rtems_mutex mutex;
+  rtems_chain_control pending;
+  rtems_binary_semaphore wakeup;
+  rtems_binary_semaphore stopped;
+  bool stop;
+  rtems_id task;
+  i2c_bus_request *batch[I2C_BUS_QUEUE_MERGE_MAX];
+  i2c_msg msgs[I2C_BUS_QUEUE_MERGE_MAX];
+} i2c_bus_queue;
+
+/**
+ * @brief Initializes a bus request queue and starts its worker task.
+ *
+ * The worker task uses the Classic API, so it must be accounted for in the
+ * application configuration.
+ *
+ * @param[in] queue The bus request queue.
+ * @param[in] bus The bus control.  It must remain valid until the queue is
+ * destroyed.
+ * @param[in] priority The priority of the worker task.
+ *
+ * @retval 0 Successful operation.
+ * @retval negative Negative error number in case of an error.
+ */
+int i2c_bus_queue_init(
+  i2c_bus_queue *queue,
+  i2c_bus *bus,
+  rtems_task_priority priority
+);
+
+/**
+ * @brief Destroys a bus request queue.
+ *
+ * All requests submitted before this call are completed before the worker
+ * task terminates.  No requests may be submitted after this call.
+ *
+ * @param[in] queue The bus request queue.
+ */
+void i2c_bus_queue_destroy(i2c_bus_queue *queue);
+
+/**
+ * @brief Submits a bus request.
+ *
+ * The request is owned by the queue until its completion handler is called.
+ *
+ * @param[in] queue The bus request queue.
+ * @param[in] req The bus request.
+ *
+ * @retval 0 Successful operation.
+ * @retval -EINVAL The request has no messages or no completion handler.
+ */
+int i2c_bus_queue_submit(i2c_bus_queue *queue, i2c_bus_request *req);
+
+/** @} */
+
 /**
  * @defgroup I2CDevice I2C Device Driver
  *
@@ -39,6 +39,7 @@
 #include <linux/spi/spidev.h>
 
 #include <rtems.h>
+#include <rtems/chain.h>
 #include <rtems/seterr.h>
 #include <rtems/thread.h>
 
@@ -232,6 +233,159 @@ int spi_bus_register(
 
 /** @} */
 
+/**
+ * @defgroup SPIBusQueue SPI Bus Request Queue
+ *
+ * @ingroup SPI
+ *
+ * @brief Asynchronous SPI transfers serviced by a bus worker task.
+ *
+ * A bus request queue accepts transfer requests from any number of tasks
+ * without blocking them on the bus.  The requests are ordered by priority and
+ * submitted to the bus by a dedicated worker task.  The completion of a
+ * request is signalled through its completion handler.  Back-to-back requests
+ * to the same chip select may be merged into one bus transfer, so that the
+ * bus is obtained only once for the whole batch.
+ *
+ * @{
+ */
+
+#ifndef SPI_BUS_QUEUE_MERGE_MAX
+/**
+ * @brief Maximum count of messages in one merged bus transfer.
+ */
+#define SPI_BUS_QUEUE_MERGE_MAX 16
+#endif
+
+/**
+ * @brief SPI bus request flag to allow merging this request with adjacent
+ * requests to the same chip select.
+ *
+ * Merged requests are transferred as one message sequence, so the chip select
+ * state between the requests is determined by the cs_change member of the
+ * last message of the preceding request.
+ */
+#define SPI_BUS_REQUEST_MERGE (1u << 0)
+
+typedef struct spi_bus_request spi_bus_request;
+
+/**
+ * @brief SPI bus request completion handler.
+ *
+ * The handler is called in the context of the worker task of the bus request
+ * queue.  The request may be submitted again or freed by the handler.
+ *
+ * @param[in] req The completed request.
+ * @param[in] status The status of the bus transfer, this is zero in case of
+ * success, otherwise a negative error number.
+ */
+typedef void (*spi_bus_request_done)(spi_bus_request *req, int status);
+
+/**
+ * @brief SPI bus request.
+ */
+struct spi_bus_request {
+  /**
+   * @brief Queue node, for internal use only.
+   */
+  rtems_chain_node node;
+
+  /**
+   * @brief The messages to transfer.
+   */
+  const spi_ioc_transfer *msgs;
+
+  /**
+   * @brief The count of messages to transfer.  It must be positive.
+   */
+  uint32_t msg_count;
+
+  /**
+   * @brief The request priority.
+   *
+   * Lower values are more important, like task priorities.  Requests of equal
+   * priority are serviced in submission order.
+   */
+  uint32_t priority;
+
+  /**
+   * @brief The request flags, for example @ref SPI_BUS_REQUEST_MERGE.
+   */
+  uint32_t flags;
+
+  /**
+   * @brief The completion handler.
+   */
+  spi_bus_request_done done;
+
+  /**
+   * @brief Argument for use by the completion handler.
+   */
+  void *arg;
+};
+
+/**
+ * @brief SPI bus request queue.
+ *
+ * The members are for internal use only.
+ */
+typedef struct {
+  spi_bus *bus;
+  rtems_mutex mutex;
+  rtems_chain_control pending;
+  rtems_binary_semaphore wakeup;
+  rtems_binary_semaphore stopped;
+  bool stop;
+  rtems_id task;
+  spi_bus_request *batch[SPI_BUS_QUEUE_MERGE_MAX];
+  spi_ioc_transfer msgs[SPI_BUS_QUEUE_MERGE_MAX];
+} spi_bus_queue;
+
+/**
+ * @brief Initializes a bus request queue and starts its worker task.
+ *
+ * The worker task uses the Classic API, so it must be accounted for in the
+ * application configuration.
+ *
+ * @param[in] queue The bus request queue.
+ * @param[in] bus The bus control.  It must remain valid until the queue is
+ * destroyed.
+ * @param[in] priority The priority of the worker task.
+ *
+ * @retval 0 Successful operation.
+ * @retval negative Negative error number in case of an error.
+ */
+int spi_bus_queue_init(
+  spi_bus_queue *queue,
+  spi_bus *bus,
+  rtems_task_priority priority
+);
+
+/**
+ * @brief Destroys a bus request queue.
+ *
+ * All requests submitted before this call are completed before the worker
+ * task terminates.  No requests may be submitted after this call.
+ *
+ * @param[in] queue The bus request queue.
+ */
+void spi_bus_queue_destroy(spi_bus_queue *queue);
+
+/**
+ * @brief Submits a bus request.
+ *
+ * The request is owned by the queue until its completion handler is called.
+ *
+ * @param[in] queue The bus request queue.
+ * @param[in] req The bus request.
+ *
+ * @retval 0 Successful operation.
+ * @retval -EINVAL The request has no messages or no completion handler.
+ */
+int spi_bus_queue_submit(spi_bus_queue *queue, spi_bus_request *req);
+
+/** @} */
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -126,6 +126,126 @@ int _Base64url_Encode(
   int          wordlen
 );
 
+/**
+ * @brief Encodes the source buffer in base64 encoding to the destination
+ *   buffer.
+ *
+ * No word breaks are produced.  The encoded output is not terminated by a
+ * null character.
+ *
+ * @param[out] dst is the pointer to the destination buffer begin.  The buffer
+ *   shall have a size of at least _Base64_Encoded_size( srclen ) characters.
+ *
+ * @param src is the pointer to the source buffer begin.
+ *
+ * @param srclen is the length of the source buffer in bytes.
+ *
+ * @return Returns the count of characters stored in the destination buffer.
+ */
+size_t _Base64_Encode_block( char *dst, const void *src, size_t srclen );
+
+/**
+ * @brief Encodes the source buffer in base64url encoding to the destination
+ *   buffer.
+ *
+ * @param[out] dst is the pointer to the destination buffer begin.  The buffer
+ *   shall have a size of at least _Base64_Encoded_size( srclen ) characters.
+ *
+ * @param src is the pointer to the source buffer begin.
+ *
+ * @param srclen is the length of the source buffer in bytes.
+ *
+ * @return Returns the count of characters stored in the destination buffer.
+ *
+ * @see _Base64_Encode_block().
+ */
+size_t _Base64url_Encode_block( char *dst, const void *src, size_t srclen );
+
+/**
+ * @brief Gets the count of characters of the base64 or base64url encoding of
+ *   a source buffer without word breaks.
+ *
+ * @param srclen is the length of the source buffer in bytes.
+ *
+ * @return Returns the count of characters of the encoding.
+ */
+static inline size_t _Base64_Encoded_size( size_t srclen )
+{
+  return ( ( srclen + 2 ) / 3 ) * 4;
+}
+
+/**
+ * @brief This constant defines the count of source bytes encoded in one line
+ *   by _Base64_Encode_lines().
+ */
+#define BASE64_LINE_SOURCE_SIZE 57
+
+/**
+ * @brief This constant defines the count of characters of one line produced
+ *   by _Base64_Encode_lines() without the line break.
+ */
+#define BASE64_LINE_LENGTH 76
+
+/**
+ * @brief Contains the control of an encoder which outputs the base64 encoding
+ *   of a byte stream in lines of 76 characters.
+ */
+typedef struct {
+  IO_Put_char put_char;
+  void       *arg;
+  size_t      index;
+  uint8_t     buf[ BASE64_LINE_SOURCE_SIZE ];
+} Base64_Encode_lines_control;
+
+/**
+ * @brief Initializes the base64 line encoder.
+ *
+ * @param[out] self is the base64 line encoder control to initialize.
+ *
+ * @param put_char is the put character function used to output the encoded
+ *   lines.
+ *
+ * @param arg is the argument passed to the put character function.
+ */
+void _Base64_Encode_lines_initialize(
+  Base64_Encode_lines_control *self,
+  IO_Put_char                  put_char,
+  void                        *arg
+);
+
+/**
+ * @brief Encodes the source buffer as part of the byte stream.
+ *
+ * Each complete line of 76 characters is encoded into a local buffer and
+ * output followed by a new line character.  Complete lines are encoded
+ * directly from the source buffer.  Remaining bytes are kept in the control
+ * until the next call or _Base64_Encode_lines_flush().
+ *
+ * @param[in, out] self is the base64 line encoder control.
+ *
+ * @param src is the pointer to the source buffer begin.
+ *
+ * @param srclen is the length of the source buffer in bytes.
+ */
+void _Base64_Encode_lines(
+  Base64_Encode_lines_control *self,
+  const void                  *src,
+  size_t                       srclen
+);
+
+/**
+ * @brief Outputs the encoding of the remaining bytes of the byte stream.
+ *
+ * A new line character is output after the last line only if the line is
+ * complete with 76 characters.
+ *
+ * @param[in, out] self is the base64 line encoder control.
+ *
+ * @return Returns the count of characters of the last line if it is not
+ *   terminated by a new line character, otherwise zero.
+ */
+size_t _Base64_Encode_lines_flush( Base64_Encode_lines_control *self );
+
 /**
  * @brief Represents the base64 and base64url decoder state.
  */
@@ -189,6 +309,28 @@ Base64_Decode_status _Base64_Decode(
   char                   ch
 );
 
+/**
+ * @brief Decodes the characters of the source buffer.
+ *
+ * The decoder accepts base64 and base64url encodings.  White space is ignored.
+ * The result is the same as calling _Base64_Decode() for each character.
+ * Groups of four encoding characters are decoded at once.
+ *
+ * @param[in, out] self is the base64 decoder control.
+ *
+ * @param src is the pointer to the source buffer begin.
+ *
+ * @param srclen is the length of the source buffer in characters.
+ *
+ * @return Returns the status of the first character which could not be
+ *   decoded successfully, otherwise BASE64_DECODE_SUCCESS.
+ */
+Base64_Decode_status _Base64_Decode_block(
+  Base64_Decode_control *self,
+  const char            *src,
+  size_t                 srclen
+);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -90,6 +90,41 @@
   #endif
 #endif
 
+#ifdef CONFIGURE_LATENCY_HISTOGRAMS
+  #if CONFIGURE_RECORD_PER_PROCESSOR_ITEMS > 0 && \
+    defined(CONFIGURE_RECORD_INTERRUPTS_ENABLED)
+    #error "CONFIGURE_LATENCY_HISTOGRAMS and CONFIGURE_RECORD_INTERRUPTS_ENABLED cannot be used together"
+  #endif
+
+  #include <rtems/confdefs/percpu.h>
+  #include <rtems/latency.h>
+#endif
+
+#ifndef CONFIGURE_PRINTK_BUFFER_SIZE
+  #define CONFIGURE_PRINTK_BUFFER_SIZE 0
+#endif
+
+#if CONFIGURE_PRINTK_BUFFER_SIZE > 0
+  #if (CONFIGURE_PRINTK_BUFFER_SIZE & (CONFIGURE_PRINTK_BUFFER_SIZE - 1)) != 0
+    #error "CONFIGURE_PRINTK_BUFFER_SIZE must be a power of two"
+  #endif
+
+  #if CONFIGURE_PRINTK_BUFFER_SIZE < 256
+    #error "CONFIGURE_PRINTK_BUFFER_SIZE must be at least 256"
+  #endif
+
+  #ifndef CONFIGURE_PRINTK_BUFFER_TASK_PRIORITY
+    #define CONFIGURE_PRINTK_BUFFER_TASK_PRIORITY 0
+  #endif
+
+  #include <rtems/confdefs/percpu.h>
+  #include <rtems/printkbuffer.h>
+#else
+  #ifdef CONFIGURE_PRINTK_BUFFER_OVERFLOW_OUTPUT
+    #warning "CONFIGURE_PRINTK_BUFFER_OVERFLOW_OUTPUT defined without CONFIGURE_PRINTK_BUFFER_SIZE"
+  #endif
+#endif
+
 #if !defined(CONFIGURE_STACK_CHECKER_ENABLED) && defined(CONFIGURE_STACK_CHECKER_REPORTER)
   #error "Stack checker is disabled but a custom reporter is configured"
 #endif
@@ -107,6 +142,8 @@ extern "C" {
 #endif
 
 #if defined(_CONFIGURE_RECORD_NEED_EXTENSION) \
+  || defined(CONFIGURE_LATENCY_HISTOGRAMS) \
+  || CONFIGURE_PRINTK_BUFFER_SIZE > 0 \
   || defined(_CONFIGURE_ENABLE_NEWLIB_REENTRANCY) \
   || defined(CONFIGURE_STACK_CHECKER_ENABLED) \
   || defined(CONFIGURE_INITIAL_EXTENSIONS) \
@@ -115,6 +152,9 @@ extern "C" {
     #ifdef CONFIGURE_EXCEPTION_TO_SIGNAL_MAPPING
       { .fatal = _Exception_Raise_signal },
     #endif
+    #if CONFIGURE_PRINTK_BUFFER_SIZE > 0
+      { .fatal = _Printk_Buffer_Fatal },
+    #endif
     #ifdef _CONFIGURE_RECORD_NEED_EXTENSION
       {
         #ifdef CONFIGURE_RECORD_EXTENSIONS_ENABLED
@@ -142,6 +182,9 @@ extern "C" {
         #endif
       },
     #endif
+    #ifdef CONFIGURE_LATENCY_HISTOGRAMS
+      { .thread_switch = _Latency_Thread_switch },
+    #endif
     #ifdef _CONFIGURE_ENABLE_NEWLIB_REENTRANCY
       RTEMS_NEWLIB_EXTENSION,
     #endif
@@ -214,6 +257,58 @@ extern "C" {
   #endif
 #endif
 
+#ifdef CONFIGURE_LATENCY_HISTOGRAMS
+  static Latency_Control _Latency_Controls[ _CONFIGURE_MAXIMUM_PROCESSORS ];
+
+  const Latency_Configuration _Latency_Configuration = {
+    &_Latency_Controls[ 0 ]
+  };
+
+  rtems_interrupt_entry **bsp_interrupt_get_dispatch_table_slot(
+    rtems_vector_number index
+  );
+
+  rtems_interrupt_entry **bsp_interrupt_get_dispatch_table_slot(
+    rtems_vector_number index
+  )
+  {
+    return &_Latency_Interrupt_dispatch_table[ index ];
+  }
+
+  RTEMS_SYSINIT_ITEM(
+    _Latency_Interrupt_initialize,
+    RTEMS_SYSINIT_LAST,
+    RTEMS_SYSINIT_ORDER_MIDDLE
+  );
+#endif
+
+#if CONFIGURE_PRINTK_BUFFER_SIZE > 0
+  static Printk_Buffer_Control
+  _Printk_Buffer_Controls[ _CONFIGURE_MAXIMUM_PROCESSORS ];
+
+  static RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES ) char
+  _Printk_Buffer_Storage[ _CONFIGURE_MAXIMUM_PROCESSORS ]
+    [ CONFIGURE_PRINTK_BUFFER_SIZE ];
+
+  const Printk_Buffer_Configuration _Printk_Buffer_Configuration = {
+    &_Printk_Buffer_Controls[ 0 ],
+    &_Printk_Buffer_Storage[ 0 ][ 0 ],
+    CONFIGURE_PRINTK_BUFFER_SIZE,
+    #ifdef CONFIGURE_PRINTK_BUFFER_OVERFLOW_OUTPUT
+      true,
+    #else
+      false,
+    #endif
+    CONFIGURE_PRINTK_BUFFER_TASK_PRIORITY
+  };
+
+  RTEMS_SYSINIT_ITEM(
+    _Printk_Buffer_Initialize,
+    RTEMS_SYSINIT_DEVICE_DRIVERS,
+    RTEMS_SYSINIT_ORDER_LAST
+  );
+#endif
+
 #ifdef CONFIGURE_VERBOSE_SYSTEM_INITIALIZATION
   RTEMS_SYSINIT_ITEM(
     _Sysinit_Verbose,
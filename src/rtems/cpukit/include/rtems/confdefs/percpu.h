@@ -55,6 +55,7 @@
 #include <rtems/score/context.h>
 #include <rtems/score/percpu.h>
 #include <rtems/score/smp.h>
+#include <rtems/score/threadqimpl.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -73,6 +74,11 @@ extern "C" {
 
   Per_CPU_Control_envelope
     _Per_CPU_Information[ _CONFIGURE_MAXIMUM_PROCESSORS ];
+
+  #ifdef CONFIGURE_MUTEX_ADAPTIVE_SPIN_NANOSECONDS
+    uint32_t _Thread_queue_Adaptive_spin_nanoseconds =
+      CONFIGURE_MUTEX_ADAPTIVE_SPIN_NANOSECONDS;
+  #endif
 #endif
 
 /* Interrupt stack configuration */
@@ -83,6 +83,16 @@
   #define CONFIGURE_EXTRA_TASK_STACKS 0
 #endif
 
+#ifndef CONFIGURE_MAXIMUM_CACHED_TASK_STACKS
+  #define CONFIGURE_MAXIMUM_CACHED_TASK_STACKS 0
+#endif
+
+#if CONFIGURE_MAXIMUM_CACHED_TASK_STACKS > 0
+  #define _CONFIGURE_STACK_CACHE_ITEM_SIZE STACK_CACHE_ITEM_SIZE
+#else
+  #define _CONFIGURE_STACK_CACHE_ITEM_SIZE 0
+#endif
+
 #ifndef CONFIGURE_EXECUTIVE_RAM_SIZE
 
 #define CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE( _messages, _size ) \
@@ -130,9 +140,14 @@
     + rtems_resource_maximum_per_allocation( \
         _CONFIGURE_TASKS - CONFIGURE_MINIMUM_TASKS_WITH_USER_PROVIDED_STORAGE \
       ) \
-      * _Configure_From_stackspace( CONFIGURE_MINIMUM_TASK_STACK_SIZE ) \
+      * _Configure_From_stackspace( \
+        CONFIGURE_MINIMUM_TASK_STACK_SIZE + _CONFIGURE_STACK_CACHE_ITEM_SIZE \
+      ) \
     + rtems_resource_maximum_per_allocation( CONFIGURE_MAXIMUM_POSIX_THREADS ) \
-      * _Configure_From_stackspace( CONFIGURE_MINIMUM_POSIX_THREAD_STACK_SIZE ) \
+      * _Configure_From_stackspace( \
+        CONFIGURE_MINIMUM_POSIX_THREAD_STACK_SIZE \
+          + _CONFIGURE_STACK_CACHE_ITEM_SIZE \
+      ) \
     + _CONFIGURE_HEAP_HANDLER_OVERHEAD )
 
 #else /* CONFIGURE_EXECUTIVE_RAM_SIZE */
@@ -162,6 +177,8 @@ uint32_t rtems_minimum_stack_size = CONFIGURE_MINIMUM_TASK_STACK_SIZE;
 
 const uintptr_t _Stack_Space_size = _CONFIGURE_STACK_SPACE_SIZE;
 
+const uint32_t _Stack_Cache_maximum = CONFIGURE_MAXIMUM_CACHED_TASK_STACKS;
+
 #if defined(CONFIGURE_TASK_STACK_ALLOCATOR) \
   && defined(CONFIGURE_TASK_STACK_DEALLOCATOR)
   /*
@@ -0,0 +1,266 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPICPUUsageSampler
+ *
+ * @brief This header file provides the interfaces of the
+ *   @ref RTEMSAPICPUUsageSampler.
+ */
+
+/*
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_CPUUSESAMPLER_H
+#define _RTEMS_CPUUSESAMPLER_H
+
+#include <rtems.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup RTEMSAPICPUUsageSampler CPU Usage Sampler
+ *
+ * @ingroup RTEMSAPICPUUsageReporting
+ *
+ * @brief The CPU usage sampler records the CPU usage of each thread and each
+ *   processor in periodic samples.
+ *
+ * The samples are stored in a ring with a fixed count of entries.  Each
+ * sample contains the CPU time used by each thread and the busy time of each
+ * processor during the sample interval.  The CPU time used is computed
+ * incrementally from the CPU time used recorded by the previous sample.  The
+ * thread table is not sorted.
+ *
+ * Samples can be fetched by any task at any time through
+ * rtems_cpu_usage_sampler_get_sample().  Readers do not block the sampler and
+ * the sampler does not block readers.  A reader which is overtaken by the
+ * sampler retries the copy.
+ *
+ * @{
+ */
+
+/**
+ * @brief This structure defines the configuration of a CPU usage sampler.
+ */
+typedef struct {
+  /**
+   * @brief This member defines the sample period in clock ticks.
+   *
+   * If the period is zero, then no sampler task is created and samples are
+   * only taken by rtems_cpu_usage_sampler_take_sample().
+   */
+  rtems_interval period;
+
+  /**
+   * @brief This member defines the priority of the sampler task.
+   */
+  rtems_task_priority priority;
+
+  /**
+   * @brief This member defines the maximum count of threads recorded by a
+   *   sample.
+   */
+  uint32_t maximum_threads;
+
+  /**
+   * @brief This member defines the count of samples in the ring.
+   *
+   * It must be at least two.
+   */
+  uint32_t history;
+} rtems_cpu_usage_sampler_config;
+
+/**
+ * @brief This structure provides the CPU usage of a thread in a sample.
+ */
+typedef struct {
+  /**
+   * @brief This member contains the thread identifier.
+   */
+  rtems_id id;
+
+  /**
+   * @brief This member contains the CPU time used by the thread during the
+   *   sample interval in nanoseconds.
+   */
+  uint64_t used_ns;
+} rtems_cpu_usage_thread_sample;
+
+/**
+ * @brief This structure provides a sample.
+ *
+ * The caller of rtems_cpu_usage_sampler_get_sample() provides the storage for
+ * the thread and processor tables.
+ */
+typedef struct {
+  /**
+   * @brief This member contains the sample number.
+   *
+   * The first sample has the number one.
+   */
+  unsigned long number;
+
+  /**
+   * @brief This member contains the system uptime at the end of the sample
+   *   interval in nanoseconds.
+   */
+  uint64_t uptime_ns;
+
+  /**
+   * @brief This member contains the duration of the sample interval in
+   *   nanoseconds.
+   */
+  uint64_t interval_ns;
+
+  /**
+   * @brief This member references the thread table.
+   */
+  rtems_cpu_usage_thread_sample *threads;
+
+  /**
+   * @brief This member defines the count of entries available in the thread
+   *   table.
+   */
+  uint32_t thread_capacity;
+
+  /**
+   * @brief This member contains the count of entries copied to the thread
+   *   table.
+   */
+  uint32_t thread_count;
+
+  /**
+   * @brief This member contains the count of threads which could not be
+   *   recorded by the sampler since the maximum thread count was reached.
+   */
+  uint32_t threads_not_recorded;
+
+  /**
+   * @brief This member references the processor busy time table.
+   *
+   * The busy time of a processor is the sample interval minus the CPU time
+   * used by its idle thread in nanoseconds.
+   */
+  uint64_t *processor_busy_ns;
+
+  /**
+   * @brief This member defines the count of entries available in the
+   *   processor busy time table.
+   */
+  uint32_t processor_capacity;
+
+  /**
+   * @brief This member contains the count of entries copied to the processor
+   *   busy time table.
+   */
+  uint32_t processor_count;
+} rtems_cpu_usage_sample;
+
+/**
+ * @brief This type represents a CPU usage sampler.
+ */
+typedef struct rtems_cpu_usage_sampler rtems_cpu_usage_sampler;
+
+/**
+ * @brief Creates a CPU usage sampler.
+ *
+ * The memory of the sampler is allocated from the heap.  The sampler takes an
+ * initial sample which is not published, so that the first published sample
+ * covers the interval starting at the sampler creation.
+ *
+ * @param config is the sampler configuration.
+ *
+ * @param[out] sampler is the pointer to a sampler pointer.  The pointer to the
+ *   created sampler is stored in the referenced object if the call is
+ *   successful.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_NUMBER The history or the maximum thread count was
+ *   invalid.
+ *
+ * @retval ::RTEMS_NO_MEMORY There was not enough memory to allocate the
+ *   sampler.
+ *
+ * @retval ::RTEMS_TOO_MANY There was no inactive task object available to
+ *   create the sampler task.
+ */
+rtems_status_code rtems_cpu_usage_sampler_create(
+  const rtems_cpu_usage_sampler_config *config,
+  rtems_cpu_usage_sampler             **sampler
+);
+
+/**
+ * @brief Deletes the CPU usage sampler.
+ *
+ * No readers may use the sampler during and after the deletion.
+ *
+ * @param sampler is the sampler to delete.
+ */
+void rtems_cpu_usage_sampler_delete( rtems_cpu_usage_sampler *sampler );
+
+/**
+ * @brief Takes a sample and publishes it.
+ *
+ * This is done periodically by the sampler task if the sampler has one.
+ *
+ * @param sampler is the sampler.
+ */
+void rtems_cpu_usage_sampler_take_sample( rtems_cpu_usage_sampler *sampler );
+
+/**
+ * @brief Gets a published sample.
+ *
+ * @param sampler is the sampler.
+ *
+ * @param age is the age of the sample.  The latest sample has the age zero.
+ *   The age shall be less than the history minus one of the sampler.
+ *
+ * @param[in, out] sample is the sample.  The tables and their capacities shall
+ *   be set by the caller.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_NUMBER The age was invalid.
+ *
+ * @retval ::RTEMS_UNSATISFIED There was no sample of the age available.
+ */
+rtems_status_code rtems_cpu_usage_sampler_get_sample(
+  const rtems_cpu_usage_sampler *sampler,
+  uint32_t                       age,
+  rtems_cpu_usage_sample        *sample
+);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTEMS_CPUUSESAMPLER_H */
@@ -11,6 +11,7 @@
 
 /*
  * Copyright (C) 2024 embedded brains GmbH & Co. KG
+ * Copyright (C) 2026 The RTEMS Project
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -55,7 +56,6 @@ extern "C" {
  * @{
  */
 
-
 /**
  * @brief This constant represents the default CRC-24Q seed state.
  */
@@ -97,6 +97,174 @@ uint32_t _CRC24Q_Sequence_update(
   size_t      size_in_bytes
 );
 
+/**
+ * @brief This constant represents the default CRC-32 seed state.
+ */
+#define CRC32_SEED 0xffffffffU
+
+/**
+ * @brief This constant shall be exclusive-ored with the CRC-32 state to get
+ *   the CRC-32 value.
+ */
+#define CRC32_FINAL_XOR 0xffffffffU
+
+/**
+ * @brief Updates the CRC-32 state using a byte.
+ *
+ * The CRC-32 uses the reflected polynomial 0xedb88320.  It is the checksum
+ * used by Ethernet, zlib, and JFFS2.
+ *
+ * @param crc is the input CRC-32 state.
+ *
+ * @param byte is the byte updating the input CRC-32 state.
+ *
+ * @return Returns the updated CRC-32 state.  Use the #CRC32_FINAL_XOR to get
+ *   a valid CRC-32 value.
+ */
+uint32_t _CRC32_Update( uint32_t crc, uint8_t byte );
+
+/**
+ * @brief Updates the CRC-32 state using a sequence of bytes.
+ *
+ * Eight bytes are processed at once using a slicing-by-8 table.
+ *
+ * @param crc is the input CRC-32 state.
+ *
+ * @param bytes[in] is the sequence of bytes updating the input CRC-32 state.
+ *
+ * @param size_in_bytes is the size in bytes of the byte sequence.
+ *
+ * @return Returns the updated CRC-32 state.  Use the #CRC32_FINAL_XOR to get
+ *   a valid CRC-32 value.
+ */
+uint32_t _CRC32_Sequence_update(
+  uint32_t    crc,
+  const void *bytes,
+  size_t      size_in_bytes
+);
+
+/**
+ * @brief Combines the CRC-32 states of two consecutive byte sequences.
+ *
+ * This enables the calculation of the CRC-32 of segments in parallel.  Let A
+ * and B be two byte sequences.  Let crc_a be the CRC-32 state of A updated from
+ * an arbitrary seed state and let crc_b be the CRC-32 state of B updated from
+ * the zero state.  The result is the CRC-32 state of the concatenation of A
+ * and B updated from the seed state of A.  The relation also holds for CRC-32
+ * values of A and B which were both updated from #CRC32_SEED and
+ * exclusive-ored with #CRC32_FINAL_XOR.
+ *
+ * @param crc_a is the CRC-32 state of the first byte sequence.
+ *
+ * @param crc_b is the CRC-32 state of the second byte sequence.
+ *
+ * @param size_b is the size in bytes of the second byte sequence.
+ *
+ * @return Returns the CRC-32 state of the concatenated byte sequences.
+ */
+uint32_t _CRC32_Combine( uint32_t crc_a, uint32_t crc_b, size_t size_b );
+
+/**
+ * @brief This constant represents the default CRC-32C seed state.
+ */
+#define CRC32C_SEED 0xffffffffU
+
+/**
+ * @brief This constant shall be exclusive-ored with the CRC-32C state to get
+ *   the CRC-32C value.
+ */
+#define CRC32C_FINAL_XOR 0xffffffffU
+
+/**
+ * @brief Updates the CRC-32C state using a byte.
+ *
+ * The CRC-32C (Castagnoli) uses the reflected polynomial 0x82f63b78.  It is
+ * the checksum used by iSCSI, SCTP, and ext4.
+ *
+ * @param crc is the input CRC-32C state.
+ *
+ * @param byte is the byte updating the input CRC-32C state.
+ *
+ * @return Returns the updated CRC-32C state.  Use the #CRC32C_FINAL_XOR to get
+ *   a valid CRC-32C value.
+ */
+uint32_t _CRC32C_Update( uint32_t crc, uint8_t byte );
+
+/**
+ * @brief Updates the CRC-32C state using a sequence of bytes.
+ *
+ * Eight bytes are processed at once using a slicing-by-8 table.
+ *
+ * @param crc is the input CRC-32C state.
+ *
+ * @param bytes[in] is the sequence of bytes updating the input CRC-32C state.
+ *
+ * @param size_in_bytes is the size in bytes of the byte sequence.
+ *
+ * @return Returns the updated CRC-32C state.  Use the #CRC32C_FINAL_XOR to get
+ *   a valid CRC-32C value.
+ */
+uint32_t _CRC32C_Sequence_update(
+  uint32_t    crc,
+  const void *bytes,
+  size_t      size_in_bytes
+);
+
+/**
+ * @brief Combines the CRC-32C states of two consecutive byte sequences.
+ *
+ * @param crc_a is the CRC-32C state of the first byte sequence.
+ *
+ * @param crc_b is the CRC-32C state of the second byte sequence.
+ *
+ * @param size_b is the size in bytes of the second byte sequence.
+ *
+ * @return Returns the CRC-32C state of the concatenated byte sequences.
+ *
+ * @see _CRC32_Combine().
+ */
+uint32_t _CRC32C_Combine( uint32_t crc_a, uint32_t crc_b, size_t size_b );
+
+/**
+ * @brief This constant represents the default CRC-16/CCITT seed state.
+ */
+#define CRC16_CCITT_SEED 0U
+
+/**
+ * @brief Updates the CRC-16/CCITT state using a byte.
+ *
+ * The CRC-16/CCITT uses the polynomial 0x1021 without reflection and without
+ * a final exclusive-or.  With the #CRC16_CCITT_SEED it is the checksum used
+ * by XMODEM and the SD card data transfers.
+ *
+ * @param crc is the input CRC-16/CCITT state.
+ *
+ * @param byte is the byte updating the input CRC-16/CCITT state.
+ *
+ * @return Returns the updated CRC-16/CCITT state.
+ */
+uint16_t _CRC16_CCITT_Update( uint16_t crc, uint8_t byte );
+
+/**
+ * @brief Updates the CRC-16/CCITT state using a sequence of bytes.
+ *
+ * Eight bytes are processed at once using a slicing-by-8 table.
+ *
+ * @param crc is the input CRC-16/CCITT state.
+ *
+ * @param bytes[in] is the sequence of bytes updating the input CRC-16/CCITT
+ *   state.
+ *
+ * @param size_in_bytes is the size in bytes of the byte sequence.
+ *
+ * @return Returns the updated CRC-16/CCITT state.
+ */
+uint16_t _CRC16_CCITT_Sequence_update(
+  uint16_t    crc,
+  const void *bytes,
+  size_t      size_in_bytes
+);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -46,6 +46,8 @@ extern "C" {
 enum {
   FTPD_BUFSIZE  = 256,       /* Size for temporary buffers */
   FTPD_DATASIZE = 4 * 1024,      /* Size for file transfer buffers */
+  FTPD_XFER_BLOCK_SIZE = 32 * 1024, /* Size of each of the two per-session
+                                       transfer buffers */
   FTPD_STACKSIZE = RTEMS_MINIMUM_STACK_SIZE + FTPD_DATASIZE /* Tasks stack size */
 };
 
@@ -75,7 +77,16 @@ struct rtems_ftpd_configuration
    int                     port;               /* Well-known port     */
    struct rtems_ftpd_hook  *hooks;             /* List of hooks       */
    char const              *root;              /* Root for FTPD or 0 for / */
-   int                     tasks_count;        /* Max. connections    */
+   int                     tasks_count;        /* Max. connections.
+                                                  Each connection needs
+                                                  a task with a
+                                                  FTPD_STACKSIZE stack,
+                                                  a transfer task
+                                                  and two transfer
+                                                  buffers of
+                                                  FTPD_XFER_BLOCK_SIZE
+                                                  bytes (64KiB) from
+                                                  the heap */
    int                     idle;               /* Idle timeout in seoconds
                                                   or 0 for no (inf) timeout */
    int                     access;             /* 0 - r/w, 1 - read-only,
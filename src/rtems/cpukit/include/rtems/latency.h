@@ -0,0 +1,276 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPILatency
+ *
+ * @brief This header file provides the interfaces of the
+ *   @ref RTEMSAPILatency.
+ */
+
+/*
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_LATENCY_H
+#define _RTEMS_LATENCY_H
+
+#include <rtems/rtems/intr.h>
+#include <rtems/rtems/status.h>
+#include <rtems/score/atomic.h>
+#include <rtems/score/cpu.h>
+#include <rtems/counter.h>
+#include <rtems/printer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup RTEMSAPILatency Latency Histograms
+ *
+ * @ingroup RTEMSAPITracing
+ *
+ * @brief The latency histograms record the distribution of interrupt and
+ *   thread wake-up latencies on each processor.
+ *
+ * The histograms are enabled by the CONFIGURE_LATENCY_HISTOGRAMS application
+ * configuration option.  The interrupt dispatch of BSPs using the generic
+ * interrupt support wraps each interrupt handler and the thread switch
+ * extension completes the wake-up latency.  Each processor updates only its
+ * own histograms with atomic operations, so no locks are used.
+ *
+ * A histogram has log-linear buckets: values below four counter ticks have
+ * a bucket of their own, larger values use four buckets per power of two.
+ * The relative error of a value derived from a bucket is thus less than 25%.
+ *
+ * @{
+ */
+
+/**
+ * @brief This enumeration defines the kinds of latencies recorded on each
+ *   processor.
+ */
+typedef enum {
+  /**
+   * @brief This enumerator denotes the time from the interrupt entry
+   *   timestamp provided by rtems_latency_interrupt_entry() to the start of
+   *   the interrupt handlers.
+   *
+   * It is only recorded if the BSP calls rtems_latency_interrupt_entry() in
+   * its low-level interrupt entry.
+   */
+  RTEMS_LATENCY_INTERRUPT_ENTRY,
+
+  /**
+   * @brief This enumerator denotes the execution time of the interrupt
+   *   handlers of a vector.
+   */
+  RTEMS_LATENCY_INTERRUPT_HANDLER,
+
+  /**
+   * @brief This enumerator denotes the time from the end of interrupt
+   *   handlers which made a thread dispatch necessary to the switch to the
+   *   heir thread on the same processor.
+   */
+  RTEMS_LATENCY_THREAD_WAKEUP,
+
+  /**
+   * @brief This enumerator provides the count of latency kinds.
+   */
+  RTEMS_LATENCY_KIND_COUNT
+} rtems_latency_kind;
+
+/**
+ * @brief This constant defines the count of buckets of a histogram.
+ */
+#define RTEMS_LATENCY_BUCKET_COUNT 124
+
+/**
+ * @brief This structure provides a snapshot of a latency histogram.
+ *
+ * All latencies are in counter ticks, see rtems_counter_ticks_to_nanoseconds().
+ */
+typedef struct {
+  /**
+   * @brief This member contains the count of recorded latencies.
+   */
+  uint32_t count;
+
+  /**
+   * @brief This member contains the maximum recorded latency.
+   */
+  uint32_t max;
+
+  /**
+   * @brief This member contains the count of latencies of each bucket.
+   */
+  uint32_t buckets[ RTEMS_LATENCY_BUCKET_COUNT ];
+} rtems_latency_histogram;
+
+/**
+ * @brief Takes the interrupt entry timestamp of the current processor.
+ *
+ * BSPs may call this function in their low-level interrupt entry before the
+ * interrupt is dispatched.  The time from this point to the start of the
+ * interrupt handlers is recorded as RTEMS_LATENCY_INTERRUPT_ENTRY.  If the
+ * latency histograms are not configured, then the call has no effect.
+ *
+ * This function shall be called with interrupts disabled.
+ */
+void rtems_latency_interrupt_entry( void );
+
+/**
+ * @brief Gets a snapshot of a latency histogram.
+ *
+ * The snapshot is not atomic with respect to concurrent updates, so the sum
+ * of the bucket counts may differ slightly from the count.
+ *
+ * @param cpu_index is the index of the processor.
+ *
+ * @param kind is the latency kind.
+ *
+ * @param[out] snapshot is the histogram snapshot.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``snapshot`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_NUMBER The processor index or the kind was invalid.
+ *
+ * @retval ::RTEMS_NOT_CONFIGURED The latency histograms are not configured.
+ */
+rtems_status_code rtems_latency_get_histogram(
+  uint32_t                 cpu_index,
+  rtems_latency_kind       kind,
+  rtems_latency_histogram *snapshot
+);
+
+/**
+ * @brief Resets the latency histograms of all processors.
+ *
+ * Latencies recorded concurrently to the reset may get lost.
+ */
+void rtems_latency_reset( void );
+
+/**
+ * @brief Gets the smallest latency in counter ticks of the bucket.
+ *
+ * @param bucket is the bucket index.
+ *
+ * @return Returns the smallest latency of the bucket.
+ */
+uint32_t rtems_latency_bucket_lower_bound( size_t bucket );
+
+/**
+ * @brief Gets the bucket index of the latency.
+ *
+ * @param ticks is the latency in counter ticks.
+ *
+ * @return Returns the bucket index of the latency.
+ */
+static inline size_t rtems_latency_bucket( uint32_t ticks )
+{
+  int msb;
+
+  if ( ticks < 4 ) {
+    return ticks;
+  }
+
+  msb = 31 - __builtin_clz( ticks );
+
+  return (size_t) ( msb - 1 ) * 4 + ( ( ticks >> ( msb - 2 ) ) & 3 );
+}
+
+/**
+ * @brief Gets a percentile of the histogram.
+ *
+ * @param histogram is the histogram.
+ *
+ * @param per_mille is the percentile in per mille, for example 999 for the
+ *   99.9th percentile.
+ *
+ * @return Returns the upper bound in counter ticks of the bucket containing
+ *   the percentile, limited by the maximum.  Returns zero, if the histogram
+ *   is empty.
+ */
+uint32_t rtems_latency_percentile(
+  const rtems_latency_histogram *histogram,
+  uint32_t                       per_mille
+);
+
+/**
+ * @brief Prints the count, percentiles and maximum in nanoseconds of all
+ *   non-empty latency histograms.
+ *
+ * @param printer is the printer used to output the report.
+ */
+void rtems_latency_report( const rtems_printer *printer );
+
+/** @} */
+
+struct _Thread_Control;
+
+typedef struct {
+  Atomic_Uint count;
+  Atomic_Uint max;
+  Atomic_Uint buckets[ RTEMS_LATENCY_BUCKET_COUNT ];
+} Latency_Histogram;
+
+typedef struct {
+  RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES )
+    Latency_Histogram Histograms[ RTEMS_LATENCY_KIND_COUNT ];
+  rtems_counter_ticks interrupt_entry;
+  bool                interrupt_entry_valid;
+  rtems_counter_ticks wakeup_begin;
+  bool                wakeup_pending;
+} Latency_Control;
+
+typedef struct {
+  Latency_Control *controls;
+} Latency_Configuration;
+
+extern const Latency_Configuration _Latency_Configuration;
+
+extern rtems_interrupt_entry *_Latency_Interrupt_dispatch_table[];
+
+void _Latency_Interrupt_initialize( void );
+
+void _Latency_Add(
+  Latency_Control    *control,
+  rtems_latency_kind  kind,
+  rtems_counter_ticks ticks
+);
+
+void _Latency_Thread_switch(
+  struct _Thread_Control *executing,
+  struct _Thread_Control *heir
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTEMS_LATENCY_H */
@@ -2072,6 +2072,24 @@ rtems_status_code rtems_termios_register_isig_handler(
   rtems_termios_isig_handler handler
 );
 
+/**
+ * @brief Places received characters on the raw input queue.
+ *
+ * This function may be called from interrupt context.  If no input
+ * processing (IGNCR, ISTRIP, IUCLC, ICRNL, INLCR), no flow control, and no
+ * receive callback is active, then the characters are copied as a block to
+ * the raw input queue.  Drivers with DMA support should hand over complete
+ * receive buffers to benefit from this.
+ *
+ * @param ttyp is the termios structure pointer of the receiving tty.
+ *
+ * @param buf is the begin of the received characters.
+ *
+ * @param len is the count of received characters.
+ *
+ * @return Returns the count of characters dropped because of an overflow of
+ *   the raw input queue.
+ */
 int rtems_termios_enqueue_raw_characters(
   void *ttyp,
   const char *buf,
@@ -80,6 +80,14 @@ typedef struct {
    uint32_t                    open_count;
    struct sigevent             notification;
    int                         oflag;
+
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_PRIORITY_INDEX)
+   /**
+    * @brief This member provides the constant time insertion of messages by
+    *   priority.
+    */
+   CORE_message_queue_Priority_index Priority_index;
+#endif
 }  POSIX_Message_queue_Control;
 
 /**
@@ -0,0 +1,135 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPIPrintkBuffer
+ *
+ * @brief This header file provides the interfaces of the
+ *   @ref RTEMSAPIPrintkBuffer.
+ */
+
+/*
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_PRINTKBUFFER_H
+#define _RTEMS_PRINTKBUFFER_H
+
+#include <rtems/rtems/tasks.h>
+#include <rtems/score/atomic.h>
+#include <rtems/score/cpu.h>
+#include <rtems/score/interr.h>
+
+#include <stdarg.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup RTEMSAPIPrintkBuffer Buffered printk()
+ *
+ * @ingroup RTEMSAPIKernelCharIO
+ *
+ * @brief The printk() buffer decouples the kernel character output from the
+ *   callers of printk(), vprintk(), and putk().
+ *
+ * The buffer is enabled by the CONFIGURE_PRINTK_BUFFER_SIZE application
+ * configuration option.  Each processor has a ring buffer of its own.  A
+ * message is formatted on the stack of the caller and then copied into the
+ * ring buffer of the current processor with interrupts disabled on this
+ * processor only, so no locks are used.  Each message has a timestamp of the
+ * uptime.
+ *
+ * A drain task of low priority polls the ring buffers once per clock tick and
+ * outputs the messages of all processors in timestamp order via rtems_putc().
+ * Messages produced before the system initialization enabled the buffer are
+ * output directly.  The ring buffers are drained by a fatal extension, so
+ * that messages are not lost in case of a system termination.
+ *
+ * @{
+ */
+
+/**
+ * @brief Outputs all messages of the ring buffers.
+ *
+ * The messages are output in the context of the caller.  This function
+ * returns immediately, if the buffer is not configured.
+ *
+ * This function shall be called from task context.
+ */
+void rtems_printk_buffer_flush( void );
+
+/**
+ * @brief Gets the count of messages discarded by a processor since system
+ *   initialization because its ring buffer was full.
+ *
+ * @param cpu_index is the index of the processor.
+ *
+ * @return Returns the count of discarded messages.  Returns zero, if the
+ *   processor index is invalid or the buffer is not configured.
+ */
+uint32_t rtems_printk_buffer_get_discarded( uint32_t cpu_index );
+
+/** @} */
+
+/**
+ * @brief If this handler is not NULL, then vprintk() and putk() pass the
+ *   output to this handler.
+ */
+extern int ( *_Vprintk_Handler )( const char *fmt, va_list ap );
+
+typedef struct {
+  RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES ) Atomic_Uint head;
+  Atomic_Uint discarded;
+  RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES ) Atomic_Uint tail;
+  unsigned int discarded_reported;
+} Printk_Buffer_Control;
+
+typedef struct {
+  Printk_Buffer_Control *controls;
+  char                  *storage;
+  uint32_t               size;
+  bool                   output_on_overflow;
+  rtems_task_priority    task_priority;
+} Printk_Buffer_Configuration;
+
+extern const Printk_Buffer_Configuration _Printk_Buffer_Configuration;
+
+void _Printk_Buffer_Initialize( void );
+
+int _Printk_Buffer_Vprintk( const char *fmt, va_list ap );
+
+void _Printk_Buffer_Fatal(
+  Internal_errors_Source source,
+  bool                   always_set_to_false,
+  Internal_errors_t      code
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTEMS_PRINTKBUFFER_H */
@@ -2,6 +2,7 @@
 
 /*
  * Copyright (C) 2020 embedded brains GmbH & Co. KG
+ * Copyright (C) 2026 The RTEMS Project
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -29,6 +30,7 @@
 #define _RTEMS_RECORDDUMP_H
 
 #include <rtems/record.h>
+#include <rtems/base64.h>
 
 #include <zlib.h>
 
@@ -83,14 +85,12 @@ void rtems_record_dump_base64( void ( *put_char )( int, void * ), void *arg );
  * encoding.
  */
 typedef struct {
-  void        ( *put_char )( int, void * );
-  void          *arg;
-  int            out;
-  unsigned char  buf[ 57 ];
-  z_stream       stream;
-  char          *mem_begin;
-  size_t         mem_available;
-  char           mem[ 0x80000 ];
+  Base64_Encode_lines_control base64;
+  unsigned char               buf[ 16 * BASE64_LINE_SOURCE_SIZE ];
+  z_stream                    stream;
+  char                       *mem_begin;
+  size_t                      mem_available;
+  char                        mem[ 0x80000 ];
 } rtems_record_dump_base64_zlib_context;
 
 /**
@@ -237,7 +237,8 @@ int rtems_fdt_find_path_offset (rtems_fdt_handle* handle, const char* path);
 
 /**
  * Load a device tree blob or DTB file into memory and register it on the chain
- * of blobs.
+ * of blobs. The blob is indexed like a registered blob, see
+ * rtems_fdt_register().
  *
  * @param filename The name of the blob file to load.
  * @param handle The handle returns the reference to the blob once load.
@@ -248,6 +249,10 @@ int rtems_fdt_load (const char* const filename, rtems_fdt_handle* handle);
 /**
  * Register a device tree blob or DTB on to the chain of blobs.
  *
+ * An index of the node paths, phandles and compatible strings is built once
+ * for the blob. The path, phandle and compatible lookups use the index
+ * instead of walking the blob.
+ *
  * @param blob_desc A pointer to the blob.
  * @param handle The handle returns the reference to the blob once load.
  * @return int If less than 0 it is an error code else it is the blob descriptor.
@@ -273,6 +273,20 @@ typedef uint32_t rtems_attribute;
  */
 #define RTEMS_NO_PRIORITY_CEILING 0x00000000
 
+/* Generated from spec:/rtems/attr/if/partition-per-cpu-cache */
+
+/**
+ * @ingroup RTEMSAPIClassicAttr
+ *
+ * @brief This attribute constant indicates that the Classic API partition
+ *   created by rtems_partition_create() shall use a buffer cache for each
+ *   processor.
+ *
+ * @par Notes
+ * In uniprocessor configurations, this attribute has no effect.
+ */
+#define RTEMS_PARTITION_PER_CPU_CACHE 0x00000400
+
 /* Generated from spec:/rtems/attr/if/priority */
 
 /**
@@ -262,6 +262,20 @@ static inline bool _Attributes_Is_barrier_automatic(
    return ( attribute_set & RTEMS_BARRIER_AUTOMATIC_RELEASE ) ? true : false;
 }
 
+/**
+ *  @brief Checks if the partition per-CPU cache
+ *  attribute is enabled in the attribute_set.
+ *
+ *  This function returns TRUE if the partition per-CPU cache
+ *  attribute is enabled in the attribute_set and FALSE otherwise.
+ */
+static inline bool _Attributes_Is_partition_per_cpu_cache(
+  rtems_attribute attribute_set
+)
+{
+   return ( attribute_set & RTEMS_PARTITION_PER_CPU_CACHE ) ? true : false;
+}
+
 /**
  *  @brief Checks if the system task attribute
  *  is enabled in the attribute_set.
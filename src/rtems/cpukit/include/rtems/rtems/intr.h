@@ -64,6 +64,7 @@
 #include <rtems/rtems/options.h>
 #include <rtems/rtems/status.h>
 #include <rtems/rtems/types.h>
+#include <rtems/score/atomic.h>
 #include <rtems/score/basedefs.h>
 #include <rtems/score/chain.h>
 #include <rtems/score/cpu.h>
@@ -2314,6 +2315,49 @@ rtems_status_code rtems_interrupt_handler_iterate(
  */
 #define RTEMS_INTERRUPT_SERVER_DEFAULT 0
 
+/* Generated from spec:/rtems/intr/if/server-statistics */
+
+/**
+ * @ingroup RTEMSAPIClassicIntr
+ *
+ * @brief This structure provides the dispatch statistics of an interrupt
+ *   server.
+ *
+ * @par Notes
+ * The statistics are maintained by the interrupt server task without
+ * synchronization.  They are intended for system information and diagnostics,
+ * see also rtems_interrupt_server_get_statistics().
+ */
+typedef struct {
+  /**
+   * @brief This member is the count of interrupt server task wake-ups.
+   */
+  unsigned long wakeups;
+
+  /**
+   * @brief This member is the count of serviced interrupt server entries.
+   */
+  unsigned long dispatches;
+
+  /**
+   * @brief This member is the maximum count of interrupt server entries
+   *   serviced in one wake-up.
+   */
+  unsigned long max_batch;
+
+  /**
+   * @brief This member is the count of submissions which were merged into an
+   *   already pending entry with interrupt coalescing enabled.
+   */
+  unsigned long coalesced;
+
+  /**
+   * @brief This member is the count of submissions which were merged into an
+   *   already pending entry without interrupt coalescing enabled.
+   */
+  unsigned long errors;
+} rtems_interrupt_server_statistics;
+
 /* Generated from spec:/rtems/intr/if/server-control */
 
 /**
@@ -2335,17 +2379,11 @@ rtems_status_code rtems_interrupt_handler_iterate(
  * @endparblock
  */
 typedef struct rtems_interrupt_server_control {
-  #if defined(RTEMS_SMP)
-    /**
-     * @brief This member is the ISR lock protecting the server control state.
-     */
-    rtems_interrupt_lock lock;
-  #endif
-
   /**
-   * @brief This member is the chain of pending interrupt entries.
+   * @brief This member is the top of the lock-free stack of submitted
+   *   interrupt entries.
    */
-  Chain_Control entries;
+  Atomic_Uintptr submitted;
 
   /**
    * @brief This member is the identifier of the server task.
@@ -2353,9 +2391,9 @@ typedef struct rtems_interrupt_server_control {
   rtems_id server;
 
   /**
-   * @brief This member is the error count.
+   * @brief This member contains the dispatch statistics.
    */
-  unsigned long errors;
+  rtems_interrupt_server_statistics statistics;
 
   /**
    * @brief This member is the server index.
@@ -2968,6 +3006,110 @@ rtems_status_code rtems_interrupt_server_handler_iterate(
   void                               *arg
 );
 
+/* Generated from spec:/rtems/intr/if/server-set-coalescing */
+
+/**
+ * @ingroup RTEMSAPIClassicIntr
+ *
+ * @brief Sets the interrupt coalescing thresholds of the interrupt handlers
+ *   installed at the interrupt vector and interrupt server.
+ *
+ * @param server_index is the index of the interrupt server.  The constant
+ *   #RTEMS_INTERRUPT_SERVER_DEFAULT may be used to specify the default
+ *   interrupt server.
+ *
+ * @param vector is the interrupt vector number.
+ *
+ * @param count is the count of interrupts which triggers the service of the
+ *   handlers.  Values less than two disable interrupt coalescing.
+ *
+ * @param interval is the maximum time in clock ticks the service of the
+ *   handlers may be deferred.
+ *
+ * With interrupt coalescing enabled, the interrupt vector is not disabled by
+ * the interrupt server trigger until ``count`` interrupts occurred.  The
+ * handlers are serviced once either ``count`` interrupts occurred or
+ * ``interval`` clock ticks passed since the interrupt server noticed the first
+ * interrupt, whatever comes first.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no interrupt server associated with the
+ *   index specified by ``server_index``.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no interrupt vector associated with the
+ *   number specified by ``vector``.
+ *
+ * @retval ::RTEMS_UNSATISFIED There was no handler installed at the interrupt
+ *   vector and interrupt server.
+ *
+ * @par Notes
+ * Interrupt coalescing is only suitable for interrupt sources which do not
+ * assert the interrupt request again until it is serviced, for example edge
+ * triggered or message signalled interrupts.  The handlers shall process all
+ * events which accumulated since the last service.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * - The directive may be called from within task context.
+ *
+ * - The directive shall not be called from within the context of an interrupt
+ *   server.  Calling the directive from within the context of an interrupt
+ *   server is undefined behaviour.
+ *
+ * - The directive sends a request to another task and waits for a response.
+ *   This may cause the calling task to be blocked and unblocked.
+ * @endparblock
+ */
+rtems_status_code rtems_interrupt_server_set_coalescing(
+  uint32_t            server_index,
+  rtems_vector_number vector,
+  uint32_t            count,
+  rtems_interval      interval
+);
+
+/* Generated from spec:/rtems/intr/if/server-get-statistics */
+
+/**
+ * @ingroup RTEMSAPIClassicIntr
+ *
+ * @brief Gets the dispatch statistics of the interrupt server.
+ *
+ * @param server_index is the index of the interrupt server.  The constant
+ *   #RTEMS_INTERRUPT_SERVER_DEFAULT may be used to specify the default
+ *   interrupt server.
+ *
+ * @param[out] statistics is the pointer to an
+ *   rtems_interrupt_server_statistics object.  When the directive call is
+ *   successful, the dispatch statistics of the interrupt server will be stored
+ *   in this object.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``statistics`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no interrupt server associated with the
+ *   index specified by ``server_index``.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * - The directive may be called from within device driver initialization
+ *   context.
+ *
+ * - The directive may be called from within task context.
+ *
+ * - The directive will not cause the calling task to be preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_interrupt_server_get_statistics(
+  uint32_t                           server_index,
+  rtems_interrupt_server_statistics *statistics
+);
+
 /* Generated from spec:/rtems/intr/if/server-action */
 
 /**
@@ -3025,11 +3167,11 @@ typedef struct rtems_interrupt_server_action {
  * - Members of the type shall not be accessed directly by the application.
  * @endparblock
  */
-typedef struct {
+typedef struct rtems_interrupt_server_entry {
   /**
-   * @brief This member is the node for the interrupt entry processing.
+   * @brief This member is the link to the next submitted or deferred entry.
    */
-  Chain_Node node;
+  struct rtems_interrupt_server_entry *next;
 
   /**
    * @brief This member references the interrupt server used to process the
@@ -3046,6 +3188,30 @@ typedef struct {
    * @brief This member is the interrupt server actions list head.
    */
   rtems_interrupt_server_action *actions;
+
+  /**
+   * @brief This member contains the pending state and the count of
+   *   submissions since the last service of the entry.
+   */
+  Atomic_Uint state;
+
+  /**
+   * @brief This member is the count of submissions which triggers the service
+   *   of the entry, values less than two disable interrupt coalescing.
+   */
+  uint32_t coalescing_count;
+
+  /**
+   * @brief This member is the maximum time in clock ticks a submission may be
+   *   deferred by interrupt coalescing.
+   */
+  rtems_interval coalescing_interval;
+
+  /**
+   * @brief This member is the clock tick at which the interrupt server
+   *   deferred the service of the entry.
+   */
+  rtems_interval coalescing_begin;
 } rtems_interrupt_server_entry;
 
 /* Generated from spec:/rtems/intr/if/server-entry-initialize */
@@ -3199,10 +3365,12 @@ void rtems_interrupt_server_entry_destroy(
  *
  * @param entry is the interrupt server entry to submit.
  *
- * The directive appends the entry to the pending entries of the interrupt
- * server.  The interrupt server is notified that a new entry is pending.  Once
- * the interrupt server is scheduled it services the actions of all pending
- * entries.
+ * The directive pushes the entry to the lock-free stack of submitted entries
+ * of the interrupt server.  The interrupt server is notified if no other entry
+ * was pending.  Once the interrupt server is scheduled it services the actions
+ * of all pending entries in submission order.  Submitting an already pending
+ * entry has no effect apart from the interrupt coalescing count, see
+ * rtems_interrupt_server_entry_set_coalescing().
  *
  * @par Notes
  * @parblock
@@ -3303,6 +3471,54 @@ rtems_status_code rtems_interrupt_server_entry_move(
   uint32_t                      server_index
 );
 
+/* Generated from spec:/rtems/intr/if/server-entry-set-coalescing */
+
+/**
+ * @ingroup RTEMSAPIClassicIntr
+ *
+ * @brief Sets the interrupt coalescing thresholds of the interrupt server
+ *   entry.
+ *
+ * @param[in,out] entry is the interrupt server entry.
+ *
+ * @param count is the count of submissions which triggers the service of the
+ *   entry.  Values less than two disable interrupt coalescing.
+ *
+ * @param interval is the maximum time in clock ticks the service of the entry
+ *   may be deferred.
+ *
+ * With interrupt coalescing enabled, the actions of a submitted entry are
+ * serviced once either ``count`` submissions occurred or ``interval`` clock
+ * ticks passed since the interrupt server noticed the first submission,
+ * whatever comes first.  If the interrupt vector of the entry is valid, it is
+ * disabled by a submission only when the count threshold is reached.
+ *
+ * @par Notes
+ * No error checking is performed by the directive.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * - The directive may be called from within device driver initialization
+ *   context.
+ *
+ * - The directive may be called from within task context.
+ *
+ * - The interrupt server entry shall have been initialized by
+ *   rtems_interrupt_server_entry_initialize().
+ *
+ * - The directive shall not be called while the interrupt server entry is
+ *   pending on or serviced by its current interrupt server.  Calling the
+ *   directive under these conditions is undefined behaviour.
+ * @endparblock
+ */
+void rtems_interrupt_server_entry_set_coalescing(
+  rtems_interrupt_server_entry *entry,
+  uint32_t                      count,
+  rtems_interval                interval
+);
+
 /* Generated from spec:/rtems/intr/if/server-request */
 
 /**
@@ -3449,6 +3665,57 @@ static inline void rtems_interrupt_server_request_set_vector(
   request->entry.vector = vector;
 }
 
+/* Generated from spec:/rtems/intr/if/server-request-set-coalescing */
+
+/**
+ * @ingroup RTEMSAPIClassicIntr
+ *
+ * @brief Sets the interrupt coalescing thresholds of the interrupt server
+ *   request.
+ *
+ * @param[in,out] request is the interrupt server request to change.
+ *
+ * @param count is the count of submissions which triggers the service of the
+ *   request.  Values less than two disable interrupt coalescing.
+ *
+ * @param interval is the maximum time in clock ticks the service of the
+ *   request may be deferred.
+ *
+ * @par Notes
+ * See rtems_interrupt_server_entry_set_coalescing().
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * - The directive may be called from within device driver initialization
+ *   context.
+ *
+ * - The directive may be called from within task context.
+ *
+ * - The directive will not cause the calling task to be preempted.
+ *
+ * - The interrupt server request shall have been initialized by
+ *   rtems_interrupt_server_request_initialize().
+ *
+ * - The directive shall not be called while the interrupt server entry is
+ *   pending on or serviced by its current interrupt server.  Calling the
+ *   directive under these conditions is undefined behaviour.
+ * @endparblock
+ */
+static inline void rtems_interrupt_server_request_set_coalescing(
+  rtems_interrupt_server_request *request,
+  uint32_t                        count,
+  rtems_interval                  interval
+)
+{
+  rtems_interrupt_server_entry_set_coalescing(
+    &request->entry,
+    count,
+    interval
+  );
+}
+
 /* Generated from spec:/rtems/intr/if/server-request-destroy */
 
 /**
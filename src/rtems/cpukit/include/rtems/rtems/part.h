@@ -144,6 +144,14 @@ extern "C" {
  *   The memory space used for the partition must reside in shared memory.
  *   Setting the global attribute in a single node system has no effect.
  *
+ * In SMP configurations, the partition uses a **buffer cache for each
+ * processor** if the #RTEMS_PARTITION_PER_CPU_CACHE attribute is set.  Buffers
+ * are got from and returned to the cache of the current processor.  The caches
+ * exchange buffers with the partition in batches, so that the processors do
+ * not contend for the partition lock in the common case.  If the partition and
+ * the cache of the current processor have no unallocated buffers left, then a
+ * buffer is got from the cache of another processor.
+ *
  * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
  *
  * @retval ::RTEMS_INVALID_NAME The ``name`` parameter was invalid.
@@ -176,6 +184,9 @@ extern "C" {
  *   of global objects available to the application is configured through the
  *   @ref CONFIGURE_MP_MAXIMUM_GLOBAL_OBJECTS application configuration option.
  *
+ * @retval ::RTEMS_UNSATISFIED There was not enough memory available in the
+ *   RTEMS Workspace to allocate the processor-specific buffer caches.
+ *
  * @par Notes
  * @parblock
  * The partition buffer area specified by the ``starting_address`` must be
@@ -227,6 +238,9 @@ extern "C" {
  *   unlimited objects, the directive may allocate memory from the RTEMS
  *   Workspace.
  *
+ * - Where the #RTEMS_PARTITION_PER_CPU_CACHE attribute is set in SMP
+ *   configurations, the directive allocates memory from the RTEMS Workspace.
+ *
  * - The number of global objects available to the application is configured
  *   through the @ref CONFIGURE_MP_MAXIMUM_GLOBAL_OBJECTS application
  *   configuration option.
@@ -51,6 +51,44 @@ extern "C" {
  * @{
  */
 
+#if defined(RTEMS_SMP)
+/**
+ * @brief This constant defines the count of buffers moved in one batch
+ *   between a partition buffer cache and the chain of unallocated buffers.
+ *
+ * A partition buffer cache holds at most two batches.
+ */
+#define PARTITION_CACHE_BATCH_SIZE 8
+
+/**
+ * @brief The partition buffer cache holds unallocated buffers of a partition
+ *   for one processor.
+ *
+ * Getting and returning a buffer through the cache of the current processor
+ * does not access the shared partition state.
+ */
+typedef struct {
+  /**
+   * @brief This lock protects the cached buffers.
+   *
+   * The lock is usually only acquired by the owner processor.  Other
+   * processors acquire it while they hold the partition lock to get a buffer
+   * if there are no unallocated buffers left in the partition.
+   */
+  ISR_lock_Control Lock;
+
+  /**
+   * @brief This chain contains the cached buffers.
+   */
+  Chain_Control Buffers;
+
+  /**
+   * @brief This member contains the count of cached buffers.
+   */
+  uint32_t count;
+} RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES ) Partition_Cache;
+#endif
+
 /**
  * @brief The Partition Control Block (PTCB) represents a partition.
  */
@@ -96,6 +134,9 @@ typedef struct {
 
   /**
    * @brief This member contains the count of allocated buffers.
+   *
+   * In SMP configurations, the buffers held by the partition buffer caches
+   * are included in this count.
    */
   uintptr_t number_of_used_blocks;
 
@@ -103,6 +144,17 @@ typedef struct {
    * @brief This chain is used to manage unallocated buffers.
    */
   Chain_Control Memory;
+
+#if defined(RTEMS_SMP)
+  /**
+   * @brief This member references the partition buffer caches indexed by the
+   *   processor index.
+   *
+   * It is NULL, if the partition was not created with the
+   * #RTEMS_PARTITION_PER_CPU_CACHE attribute.
+   */
+  Partition_Cache *caches;
+#endif
 } Partition_Control;
 
 /**
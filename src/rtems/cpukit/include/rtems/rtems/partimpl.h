@@ -39,6 +39,7 @@
 
 #include <rtems/rtems/partdata.h>
 #include <rtems/score/objectimpl.h>
+#include <rtems/score/smp.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -110,6 +111,66 @@ static inline void _Partition_Release(
 #endif
 }
 
+#if defined(RTEMS_SMP)
+/**
+ * @brief Gets the partition buffer cache of the current processor.
+ *
+ * The caller shall disable interrupts on the current processor.
+ *
+ * @param the_partition is the partition control block.  The partition shall
+ *   use buffer caches.
+ *
+ * @return Returns the buffer cache of the current processor.
+ */
+static inline Partition_Cache *_Partition_Get_cache(
+  const Partition_Control *the_partition
+)
+{
+  return &the_partition->caches[ _SMP_Get_current_processor() ];
+}
+#endif
+
+/**
+ * @brief Gets the count of buffers allocated by the application.
+ *
+ * The partition buffer cache counts are read while the corresponding cache
+ * lock is owned.  The caller shall not own a partition buffer cache lock.
+ *
+ * @param the_partition is the partition control block.
+ *
+ * @return Returns the count of allocated buffers which are not held by a
+ *   partition buffer cache.
+ */
+static inline uintptr_t _Partition_Get_used_blocks(
+  const Partition_Control *the_partition
+)
+{
+  uintptr_t used_blocks;
+
+  used_blocks = the_partition->number_of_used_blocks;
+
+#if defined(RTEMS_SMP)
+  if ( the_partition->caches != NULL ) {
+    uint32_t cpu_max;
+    uint32_t cpu_index;
+
+    cpu_max = _SMP_Get_processor_maximum();
+
+    for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+      Partition_Cache  *cache;
+      ISR_lock_Context  lock_context;
+
+      cache = &the_partition->caches[ cpu_index ];
+      _ISR_lock_ISR_disable_and_acquire( &cache->Lock, &lock_context );
+      used_blocks -= cache->count;
+      _ISR_lock_Release_and_ISR_enable( &cache->Lock, &lock_context );
+    }
+  }
+#endif
+
+  return used_blocks;
+}
+
 /**@}*/
 
 #ifdef __cplusplus
@@ -67,6 +67,13 @@ extern "C" {
    *  a message.
    */
   #define RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION
+
+  /**
+   *  This macro is defined when an API is enabled that requires that the
+   *  Message Queue Handler include support for a priority index of the
+   *  pending messages.
+   */
+  #define RTEMS_SCORE_COREMSG_ENABLE_PRIORITY_INDEX
 #endif
 
 /**
@@ -104,6 +111,40 @@ typedef enum {
   );
 #endif
 
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+  /**
+   * @brief This constant defines the count of message priorities covered by
+   *   a message queue priority index.
+   *
+   * The index covers the message priorities from zero down to
+   * one minus this count.  This includes all POSIX message priorities.
+   */
+  #define CORE_MESSAGE_QUEUE_PRIORITY_INDEX_COUNT 64
+
+  /**
+   * @brief This structure provides a constant time priority insertion for
+   *   pending messages.
+   *
+   * The pending messages chain stays ordered by message priority.  The index
+   * records for each message priority the last pending message of this
+   * priority.  Bit @a i of the present bitmap is set, if and only if a
+   * message of priority @a -i is pending.
+   */
+  typedef struct {
+    /**
+     * @brief This member is the bitmap of message priorities with pending
+     *   messages.
+     */
+    uint64_t present;
+
+    /**
+     * @brief This member contains the last pending message for each message
+     *   priority present in the bitmap.
+     */
+    CORE_message_queue_Buffer *last[ CORE_MESSAGE_QUEUE_PRIORITY_INDEX_COUNT ];
+  } CORE_message_queue_Priority_index;
+#endif
+
 /**
  *  @brief Control block used to manage each message queue.
  *
@@ -157,6 +198,18 @@ struct CORE_message_queue_Control {
      */
     CORE_message_queue_Notify_Handler  notify_handler;
   #endif
+
+  #if defined(RTEMS_SCORE_COREMSG_ENABLE_PRIORITY_INDEX)
+    /**
+     * @brief This member references the optional priority index of the
+     *   pending messages.
+     *
+     * It may be NULL.  In this case priority messages are inserted by a
+     * linear search through the pending messages.
+     */
+    CORE_message_queue_Priority_index *priority_index;
+  #endif
+
   /** This chain is the set of inactive messages.  A message is inactive
    *  when it does not contain a pending message.
    */
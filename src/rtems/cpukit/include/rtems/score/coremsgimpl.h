@@ -565,10 +565,65 @@ static inline
   CORE_message_queue_Control *the_message_queue
 )
 {
-  return (CORE_message_queue_Buffer *)
+  CORE_message_queue_Buffer *the_message;
+
+  the_message = (CORE_message_queue_Buffer *)
     _Chain_Get_unprotected( &the_message_queue->Pending_messages );
+
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_PRIORITY_INDEX)
+  if (
+    the_message != NULL &&
+      the_message_queue->priority_index != NULL
+  ) {
+    CORE_message_queue_Priority_index *index;
+    unsigned int                       bucket;
+
+    index = the_message_queue->priority_index;
+    bucket = 0U - (unsigned int) the_message->priority;
+
+    /*
+     * The first pending message is the last message of its priority only if
+     * it is the only one.
+     */
+    if (
+      bucket < CORE_MESSAGE_QUEUE_PRIORITY_INDEX_COUNT &&
+        index->last[ bucket ] == the_message
+    ) {
+      index->present &= ~( UINT64_C( 1 ) << bucket );
+    }
+  }
+#endif
+
+  return the_message;
 }
 
+/**
+ * @brief Sets the priority index of the message queue.
+ *
+ * The message queue shall have no pending messages.
+ *
+ * @param[out] the_message_queue The message queue to set the priority index.
+ *
+ * @param[out] index The priority index to use.  It may be NULL.
+ */
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_PRIORITY_INDEX)
+  static inline void _CORE_message_queue_Set_priority_index(
+    CORE_message_queue_Control        *the_message_queue,
+    CORE_message_queue_Priority_index *index
+  )
+  {
+    if ( index != NULL ) {
+      index->present = 0;
+    }
+
+    the_message_queue->priority_index = index;
+  }
+#else
+  /* turn it into nothing if not enabled */
+  #define _CORE_message_queue_Set_priority_index( the_message_queue, index ) \
+    do { } while ( 0 )
+#endif
+
 #if defined(RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION)
   /**
    * @brief Checks if notification is enabled.
@@ -0,0 +1,216 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreEventCount
+ *
+ * @brief This header file provides the interfaces of the
+ *   @ref RTEMSScoreEventCount.
+ */
+
+/*
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_EVENTCOUNT_H
+#define _RTEMS_SCORE_EVENTCOUNT_H
+
+#include <rtems/score/atomic.h>
+
+#include <sys/lock.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RTEMSScoreEventCount Event Count Handler
+ *
+ * @ingroup RTEMSScore
+ *
+ * @brief This group contains the Event Count Handler implementation.
+ *
+ * An event count lets threads wait for a condition which is changed by
+ * lock-free data structures.  The waiters announce themselves through
+ * _Event_count_Prepare_wait(), check the condition again, and then block
+ * through _Event_count_Wait().  The party changing the condition calls
+ * _Event_count_Signal() afterwards.  In the absence of waiters, signalling is
+ * a memory fence followed by a load.  The blocking is done through a futex,
+ * see @ref RTEMSScoreFutex.
+ *
+ * @{
+ */
+
+/**
+ * @brief This structure represents an event count.
+ */
+typedef struct {
+  /**
+   * @brief This member contains the count of threads which prepared to wait.
+   */
+  Atomic_Uint waiters;
+
+  /**
+   * @brief This member contains the event sequence number.
+   *
+   * It is incremented by each signal which observed waiters.  It is used as
+   * the futex state.
+   */
+  Atomic_Uint sequence;
+
+  /**
+   * @brief This member provides the futex object used to block the waiters.
+   */
+  struct _Futex_Control Futex;
+} Event_count_Control;
+
+/**
+ * @brief This define provides an initializer for the static initialization
+ *   of an event count.
+ */
+#define EVENT_COUNT_INITIALIZER \
+  { ATOMIC_INITIALIZER_UINT( 0 ), ATOMIC_INITIALIZER_UINT( 0 ), \
+    _FUTEX_INITIALIZER }
+
+/**
+ * @brief Initializes the event count.
+ *
+ * @param[out] event_count is the event count to initialize.
+ */
+static inline void _Event_count_Initialize( Event_count_Control *event_count )
+{
+  _Atomic_Init_uint( &event_count->waiters, 0 );
+  _Atomic_Init_uint( &event_count->sequence, 0 );
+  _Futex_Initialize( &event_count->Futex );
+}
+
+/**
+ * @brief Destroys the event count.
+ *
+ * @param[in, out] event_count is the event count to destroy.
+ */
+static inline void _Event_count_Destroy( Event_count_Control *event_count )
+{
+  _Futex_Destroy( &event_count->Futex );
+}
+
+/**
+ * @brief Prepares the calling thread to wait for the event count.
+ *
+ * After this call, the caller shall check its wait condition again.  If the
+ * condition is satisfied, then the caller shall call
+ * _Event_count_Cancel_wait(), otherwise it shall call _Event_count_Wait().
+ *
+ * @param[in, out] event_count is the event count.
+ *
+ * @return Returns the ticket for _Event_count_Wait().
+ */
+static inline unsigned int _Event_count_Prepare_wait(
+  Event_count_Control *event_count
+)
+{
+  unsigned int ticket;
+
+  _Atomic_Fetch_add_uint( &event_count->waiters, 1, ATOMIC_ORDER_SEQ_CST );
+  ticket = _Atomic_Load_uint( &event_count->sequence, ATOMIC_ORDER_SEQ_CST );
+
+  /*
+   * Make sure that the waiter is visible before the wait condition is checked
+   * again, see _Event_count_Signal().
+   */
+  _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+
+  return ticket;
+}
+
+/**
+ * @brief Cancels a wait prepared by _Event_count_Prepare_wait().
+ *
+ * @param[in, out] event_count is the event count.
+ */
+static inline void _Event_count_Cancel_wait( Event_count_Control *event_count )
+{
+  _Atomic_Fetch_sub_uint( &event_count->waiters, 1, ATOMIC_ORDER_RELAXED );
+}
+
+/**
+ * @brief Waits for a signal of the event count.
+ *
+ * The wait is finished by a signal issued after the corresponding
+ * _Event_count_Prepare_wait() call.  The wait may finish spuriously, so the
+ * caller shall check its wait condition again.
+ *
+ * This function shall be called by a thread.  It shall not be called from
+ * within interrupt context or with thread dispatching disabled.
+ *
+ * @param[in, out] event_count is the event count.
+ *
+ * @param ticket is the ticket returned by _Event_count_Prepare_wait().
+ */
+void _Event_count_Wait( Event_count_Control *event_count, unsigned int ticket );
+
+/**
+ * @brief Wakes up all threads waiting for the event count.
+ *
+ * Use _Event_count_Signal() instead.
+ *
+ * @param[in, out] event_count is the event count.
+ */
+void _Event_count_Do_signal( Event_count_Control *event_count );
+
+/**
+ * @brief Signals the event count.
+ *
+ * The caller shall change the wait condition before the call.  If threads
+ * prepared to wait for the event count, then they are woken up.
+ *
+ * This function may be called from within interrupt context.
+ *
+ * @param[in, out] event_count is the event count.
+ */
+static inline void _Event_count_Signal( Event_count_Control *event_count )
+{
+  /*
+   * Make sure that the changed wait condition is visible before the waiters
+   * are checked, see _Event_count_Prepare_wait().
+   */
+  _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+
+  if (
+    RTEMS_PREDICT_FALSE(
+      _Atomic_Load_uint( &event_count->waiters, ATOMIC_ORDER_RELAXED ) != 0
+    )
+  ) {
+    _Event_count_Do_signal( event_count );
+  }
+}
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_SCORE_EVENTCOUNT_H */
@@ -0,0 +1,399 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreMPMCQueue
+ *
+ * @brief This header file provides the interfaces of the
+ *   @ref RTEMSScoreMPMCQueue.
+ */
+
+/*
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_MPMCQUEUE_H
+#define _RTEMS_SCORE_MPMCQUEUE_H
+
+#include <rtems/score/eventcount.h>
+#include <rtems/score/assert.h>
+#include <rtems/score/cpu.h>
+
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RTEMSScoreMPMCQueue MPMC Queue Handler
+ *
+ * @ingroup RTEMSScore
+ *
+ * @brief This group contains the Multi-Producer Multi-Consumer (MPMC) Queue
+ *   Handler implementation.
+ *
+ * The MPMC queue is a bounded FIFO queue of fixed-size items.  It is
+ * self-contained, so it has no object identifier and the storage area for the
+ * items is provided by the user.  Any count of threads of execution may send
+ * items to and receive items from the queue concurrently.
+ *
+ * Each storage cell of the queue has a sequence number which tells the
+ * producers and consumers whether the cell is free or contains an item for the
+ * current lap through the storage area.  The producers and the consumers
+ * claim cells through a compare and swap of the enqueue and dequeue position
+ * respectively.  No locks are used, see also Dmitry Vyukov, "Bounded MPMC
+ * queue",
+ * https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue.
+ *
+ * The non-blocking operations _MPMC_Queue_Try_send() and
+ * _MPMC_Queue_Try_receive() may be used in interrupt context.  If a producer
+ * claimed a cell and was interrupted before it finished the copy of the item,
+ * then the consumers observe an empty queue at this cell until the producer
+ * continues.  Likewise, an interrupted consumer may let the producers observe
+ * a full queue.  The blocking operations _MPMC_Queue_Send() and
+ * _MPMC_Queue_Receive() use an @ref RTEMSScoreEventCount to wait for free
+ * space or pending items.
+ *
+ * @{
+ */
+
+/**
+ * @brief Gets the size in bytes of a storage cell of an MPMC queue.
+ *
+ * @param _item_size is the item size in bytes.
+ */
+#define MPMC_QUEUE_CELL_SIZE( _item_size ) \
+  RTEMS_ALIGN_UP( \
+    sizeof( Atomic_Uint ) + ( _item_size ), \
+    RTEMS_ALIGNOF( Atomic_Uint ) \
+  )
+
+/**
+ * @brief Gets the size in bytes of the storage area of an MPMC queue.
+ *
+ * The storage area shall be aligned by RTEMS_ALIGNOF( Atomic_Uint ).
+ *
+ * @param _item_count is the maximum count of items pending on the queue.
+ *
+ * @param _item_size is the item size in bytes.
+ */
+#define MPMC_QUEUE_STORAGE_SIZE( _item_count, _item_size ) \
+  ( ( _item_count ) * MPMC_QUEUE_CELL_SIZE( _item_size ) )
+
+/**
+ * @brief This structure represents an MPMC queue.
+ */
+typedef struct {
+  /**
+   * @brief This member references the begin of the storage area.
+   */
+  char *cells;
+
+  /**
+   * @brief This member contains the item count of the queue minus one.
+   */
+  unsigned int mask;
+
+  /**
+   * @brief This member contains the item size in bytes.
+   */
+  size_t item_size;
+
+  /**
+   * @brief This member contains the storage cell size in bytes.
+   */
+  size_t cell_size;
+
+  /**
+   * @brief This member is used by the consumers to wait for pending items.
+   */
+  Event_count_Control Not_empty;
+
+  /**
+   * @brief This member is used by the producers to wait for free space.
+   */
+  Event_count_Control Not_full;
+
+  /**
+   * @brief This member contains the position of the next cell claimed by a
+   *   producer.
+   */
+  Atomic_Uint enqueue_position RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES );
+
+  /**
+   * @brief This member contains the position of the next cell claimed by a
+   *   consumer.
+   */
+  Atomic_Uint dequeue_position RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES );
+} MPMC_Queue_Control;
+
+/**
+ * @brief Gets the sequence number of the storage cell.
+ *
+ * @param queue is the queue.
+ *
+ * @param position is the position of the cell.
+ *
+ * @return Returns the sequence number of the cell.
+ */
+static inline Atomic_Uint *_MPMC_Queue_Get_sequence(
+  const MPMC_Queue_Control *queue,
+  unsigned int              position
+)
+{
+  return (Atomic_Uint *)
+    &queue->cells[ ( position & queue->mask ) * queue->cell_size ];
+}
+
+/**
+ * @brief Gets the item of the storage cell.
+ *
+ * @param sequence is the sequence number of the cell.
+ *
+ * @return Returns the item of the cell.
+ */
+static inline void *_MPMC_Queue_Get_item( Atomic_Uint *sequence )
+{
+  return sequence + 1;
+}
+
+/**
+ * @brief Initializes the MPMC queue.
+ *
+ * @param[out] queue is the queue to initialize.
+ *
+ * @param[out] storage is the begin of the storage area.  The size of the
+ *   storage area shall be MPMC_QUEUE_STORAGE_SIZE( @a item_count,
+ *   @a item_size ) bytes.
+ *
+ * @param item_count is the maximum count of items pending on the queue.  It
+ *   shall be a power of two greater than or equal to two.
+ *
+ * @param item_size is the size in bytes of each item.
+ */
+static inline void _MPMC_Queue_Initialize(
+  MPMC_Queue_Control *queue,
+  void               *storage,
+  unsigned int        item_count,
+  size_t              item_size
+)
+{
+  unsigned int i;
+
+  _Assert( item_count >= 2 );
+  _Assert( ( item_count & ( item_count - 1 ) ) == 0 );
+  _Assert( ( (uintptr_t) storage % RTEMS_ALIGNOF( Atomic_Uint ) ) == 0 );
+
+  queue->cells = (char *) storage;
+  queue->mask = item_count - 1;
+  queue->item_size = item_size;
+  queue->cell_size = MPMC_QUEUE_CELL_SIZE( item_size );
+  _Event_count_Initialize( &queue->Not_empty );
+  _Event_count_Initialize( &queue->Not_full );
+  _Atomic_Init_uint( &queue->enqueue_position, 0 );
+  _Atomic_Init_uint( &queue->dequeue_position, 0 );
+
+  for ( i = 0; i < item_count; ++i ) {
+    _Atomic_Init_uint( _MPMC_Queue_Get_sequence( queue, i ), i );
+  }
+}
+
+/**
+ * @brief Destroys the MPMC queue.
+ *
+ * No thread shall wait on the queue.
+ *
+ * @param[in, out] queue is the queue to destroy.
+ */
+static inline void _MPMC_Queue_Destroy( MPMC_Queue_Control *queue )
+{
+  _Event_count_Destroy( &queue->Not_empty );
+  _Event_count_Destroy( &queue->Not_full );
+}
+
+/**
+ * @brief Tries to send the item to the MPMC queue.
+ *
+ * This function may be called from within interrupt context.
+ *
+ * @param[in, out] queue is the queue.
+ *
+ * @param item is the item to send.  The item size of the queue defines the
+ *   count of bytes copied to the queue.
+ *
+ * @retval true The item was sent to the queue.
+ *
+ * @retval false The queue was full.
+ */
+static inline bool _MPMC_Queue_Try_send(
+  MPMC_Queue_Control *queue,
+  const void         *item
+)
+{
+  unsigned int  position;
+  Atomic_Uint  *sequence;
+
+  position = _Atomic_Load_uint( &queue->enqueue_position, ATOMIC_ORDER_RELAXED );
+
+  while ( true ) {
+    int delta;
+
+    sequence = _MPMC_Queue_Get_sequence( queue, position );
+    delta = (int) (
+      _Atomic_Load_uint( sequence, ATOMIC_ORDER_ACQUIRE ) - position
+    );
+
+    if ( delta == 0 ) {
+      if (
+        _Atomic_Compare_exchange_uint(
+          &queue->enqueue_position,
+          &position,
+          position + 1,
+          ATOMIC_ORDER_RELAXED,
+          ATOMIC_ORDER_RELAXED
+        )
+      ) {
+        break;
+      }
+    } else if ( delta < 0 ) {
+      return false;
+    } else {
+      position = _Atomic_Load_uint(
+        &queue->enqueue_position,
+        ATOMIC_ORDER_RELAXED
+      );
+    }
+  }
+
+  memcpy( _MPMC_Queue_Get_item( sequence ), item, queue->item_size );
+  _Atomic_Store_uint( sequence, position + 1, ATOMIC_ORDER_RELEASE );
+  _Event_count_Signal( &queue->Not_empty );
+
+  return true;
+}
+
+/**
+ * @brief Tries to receive an item from the MPMC queue.
+ *
+ * This function may be called from within interrupt context.
+ *
+ * @param[in, out] queue is the queue.
+ *
+ * @param[out] item is the destination of the item.  The item size of the
+ *   queue defines the count of bytes copied from the queue.
+ *
+ * @retval true An item was received from the queue.
+ *
+ * @retval false The queue was empty.
+ */
+static inline bool _MPMC_Queue_Try_receive(
+  MPMC_Queue_Control *queue,
+  void               *item
+)
+{
+  unsigned int  position;
+  Atomic_Uint  *sequence;
+
+  position = _Atomic_Load_uint( &queue->dequeue_position, ATOMIC_ORDER_RELAXED );
+
+  while ( true ) {
+    int delta;
+
+    sequence = _MPMC_Queue_Get_sequence( queue, position );
+    delta = (int) (
+      _Atomic_Load_uint( sequence, ATOMIC_ORDER_ACQUIRE ) - ( position + 1 )
+    );
+
+    if ( delta == 0 ) {
+      if (
+        _Atomic_Compare_exchange_uint(
+          &queue->dequeue_position,
+          &position,
+          position + 1,
+          ATOMIC_ORDER_RELAXED,
+          ATOMIC_ORDER_RELAXED
+        )
+      ) {
+        break;
+      }
+    } else if ( delta < 0 ) {
+      return false;
+    } else {
+      position = _Atomic_Load_uint(
+        &queue->dequeue_position,
+        ATOMIC_ORDER_RELAXED
+      );
+    }
+  }
+
+  memcpy( item, _MPMC_Queue_Get_item( sequence ), queue->item_size );
+  _Atomic_Store_uint(
+    sequence,
+    position + queue->mask + 1,
+    ATOMIC_ORDER_RELEASE
+  );
+  _Event_count_Signal( &queue->Not_full );
+
+  return true;
+}
+
+/**
+ * @brief Sends the item to the MPMC queue.
+ *
+ * If the queue is full, then the calling thread waits until a consumer
+ * received an item.
+ *
+ * This function shall be called by a thread.  It shall not be called from
+ * within interrupt context or with thread dispatching disabled.
+ *
+ * @param[in, out] queue is the queue.
+ *
+ * @param item is the item to send.
+ */
+void _MPMC_Queue_Send( MPMC_Queue_Control *queue, const void *item );
+
+/**
+ * @brief Receives an item from the MPMC queue.
+ *
+ * If the queue is empty, then the calling thread waits until a producer sent
+ * an item.
+ *
+ * This function shall be called by a thread.  It shall not be called from
+ * within interrupt context or with thread dispatching disabled.
+ *
+ * @param[in, out] queue is the queue.
+ *
+ * @param[out] item is the destination of the item.
+ */
+void _MPMC_Queue_Receive( MPMC_Queue_Control *queue, void *item );
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_SCORE_MPMCQUEUE_H */
@@ -0,0 +1,297 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreSPSCQueue
+ *
+ * @brief This header file provides the interfaces of the
+ *   @ref RTEMSScoreSPSCQueue.
+ */
+
+/*
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_SPSCQUEUE_H
+#define _RTEMS_SCORE_SPSCQUEUE_H
+
+#include <rtems/score/eventcount.h>
+#include <rtems/score/assert.h>
+#include <rtems/score/cpu.h>
+
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RTEMSScoreSPSCQueue SPSC Queue Handler
+ *
+ * @ingroup RTEMSScore
+ *
+ * @brief This group contains the Single-Producer Single-Consumer (SPSC) Queue
+ *   Handler implementation.
+ *
+ * The SPSC queue is a bounded FIFO queue of fixed-size items.  It is
+ * self-contained, so it has no object identifier and the storage area for the
+ * items is provided by the user.  At most one thread of execution may send
+ * items to the queue at a time and at most one thread of execution may
+ * receive items from the queue at a time.  The producer and the consumer may
+ * run concurrently on different processors.
+ *
+ * The non-blocking operations _SPSC_Queue_Try_send() and
+ * _SPSC_Queue_Try_receive() are wait-free and may be used in interrupt
+ * context.  The blocking operations _SPSC_Queue_Send() and
+ * _SPSC_Queue_Receive() use an @ref RTEMSScoreEventCount to wait for free
+ * space or pending items.
+ *
+ * @{
+ */
+
+/**
+ * @brief This structure represents an SPSC queue.
+ */
+typedef struct {
+  /**
+   * @brief This member references the begin of the item storage area.
+   */
+  char *items;
+
+  /**
+   * @brief This member contains the item count of the queue minus one.
+   */
+  unsigned int mask;
+
+  /**
+   * @brief This member contains the item size in bytes.
+   */
+  size_t item_size;
+
+  /**
+   * @brief This member is used by the consumer to wait for pending items.
+   */
+  Event_count_Control Not_empty;
+
+  /**
+   * @brief This member is used by the producer to wait for free space.
+   */
+  Event_count_Control Not_full;
+
+  /**
+   * @brief This member contains the count of items sent to the queue.
+   *
+   * It is only changed by the producer.
+   */
+  Atomic_Uint tail RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES );
+
+  /**
+   * @brief This member contains the head value last observed by the
+   *   producer.
+   */
+  unsigned int head_cache;
+
+  /**
+   * @brief This member contains the count of items received from the queue.
+   *
+   * It is only changed by the consumer.
+   */
+  Atomic_Uint head RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES );
+
+  /**
+   * @brief This member contains the tail value last observed by the
+   *   consumer.
+   */
+  unsigned int tail_cache;
+} SPSC_Queue_Control;
+
+/**
+ * @brief Initializes the SPSC queue.
+ *
+ * @param[out] queue is the queue to initialize.
+ *
+ * @param[out] storage is the begin of the item storage area.  The size of the
+ *   storage area shall be @a item_count times @a item_size bytes.
+ *
+ * @param item_count is the maximum count of items pending on the queue.  It
+ *   shall be a power of two.
+ *
+ * @param item_size is the size in bytes of each item.
+ */
+static inline void _SPSC_Queue_Initialize(
+  SPSC_Queue_Control *queue,
+  void               *storage,
+  unsigned int        item_count,
+  size_t              item_size
+)
+{
+  _Assert( item_count > 0 );
+  _Assert( ( item_count & ( item_count - 1 ) ) == 0 );
+
+  queue->items = (char *) storage;
+  queue->mask = item_count - 1;
+  queue->item_size = item_size;
+  _Event_count_Initialize( &queue->Not_empty );
+  _Event_count_Initialize( &queue->Not_full );
+  _Atomic_Init_uint( &queue->tail, 0 );
+  queue->head_cache = 0;
+  _Atomic_Init_uint( &queue->head, 0 );
+  queue->tail_cache = 0;
+}
+
+/**
+ * @brief Destroys the SPSC queue.
+ *
+ * No thread shall wait on the queue.
+ *
+ * @param[in, out] queue is the queue to destroy.
+ */
+static inline void _SPSC_Queue_Destroy( SPSC_Queue_Control *queue )
+{
+  _Event_count_Destroy( &queue->Not_empty );
+  _Event_count_Destroy( &queue->Not_full );
+}
+
+/**
+ * @brief Tries to send the item to the SPSC queue.
+ *
+ * This function may be called from within interrupt context.
+ *
+ * @param[in, out] queue is the queue.
+ *
+ * @param item is the item to send.  The item size of the queue defines the
+ *   count of bytes copied to the queue.
+ *
+ * @retval true The item was sent to the queue.
+ *
+ * @retval false The queue was full.
+ */
+static inline bool _SPSC_Queue_Try_send(
+  SPSC_Queue_Control *queue,
+  const void         *item
+)
+{
+  unsigned int tail;
+
+  tail = _Atomic_Load_uint( &queue->tail, ATOMIC_ORDER_RELAXED );
+
+  if ( tail - queue->head_cache > queue->mask ) {
+    queue->head_cache = _Atomic_Load_uint( &queue->head, ATOMIC_ORDER_ACQUIRE );
+
+    if ( tail - queue->head_cache > queue->mask ) {
+      return false;
+    }
+  }
+
+  memcpy(
+    &queue->items[ ( tail & queue->mask ) * queue->item_size ],
+    item,
+    queue->item_size
+  );
+  _Atomic_Store_uint( &queue->tail, tail + 1, ATOMIC_ORDER_RELEASE );
+  _Event_count_Signal( &queue->Not_empty );
+
+  return true;
+}
+
+/**
+ * @brief Tries to receive an item from the SPSC queue.
+ *
+ * This function may be called from within interrupt context.
+ *
+ * @param[in, out] queue is the queue.
+ *
+ * @param[out] item is the destination of the item.  The item size of the
+ *   queue defines the count of bytes copied from the queue.
+ *
+ * @retval true An item was received from the queue.
+ *
+ * @retval false The queue was empty.
+ */
+static inline bool _SPSC_Queue_Try_receive(
+  SPSC_Queue_Control *queue,
+  void               *item
+)
+{
+  unsigned int head;
+
+  head = _Atomic_Load_uint( &queue->head, ATOMIC_ORDER_RELAXED );
+
+  if ( head == queue->tail_cache ) {
+    queue->tail_cache = _Atomic_Load_uint( &queue->tail, ATOMIC_ORDER_ACQUIRE );
+
+    if ( head == queue->tail_cache ) {
+      return false;
+    }
+  }
+
+  memcpy(
+    item,
+    &queue->items[ ( head & queue->mask ) * queue->item_size ],
+    queue->item_size
+  );
+  _Atomic_Store_uint( &queue->head, head + 1, ATOMIC_ORDER_RELEASE );
+  _Event_count_Signal( &queue->Not_full );
+
+  return true;
+}
+
+/**
+ * @brief Sends the item to the SPSC queue.
+ *
+ * If the queue is full, then the calling thread waits until the consumer
+ * received an item.
+ *
+ * This function shall be called by a thread.  It shall not be called from
+ * within interrupt context or with thread dispatching disabled.
+ *
+ * @param[in, out] queue is the queue.
+ *
+ * @param item is the item to send.
+ */
+void _SPSC_Queue_Send( SPSC_Queue_Control *queue, const void *item );
+
+/**
+ * @brief Receives an item from the SPSC queue.
+ *
+ * If the queue is empty, then the calling thread waits until the producer
+ * sent an item.
+ *
+ * This function shall be called by a thread.  It shall not be called from
+ * within interrupt context or with thread dispatching disabled.
+ *
+ * @param[in, out] queue is the queue.
+ *
+ * @param[out] item is the destination of the item.
+ */
+void _SPSC_Queue_Receive( SPSC_Queue_Control *queue, void *item );
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_SCORE_SPSCQUEUE_H */
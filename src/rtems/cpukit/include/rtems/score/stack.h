@@ -40,6 +40,7 @@
 #define _RTEMS_SCORE_STACK_H
 
 #include <rtems/score/basedefs.h>
+#include <rtems/score/chain.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -73,6 +74,20 @@ typedef struct {
   size_t      size;
   /** This is the low memory address of stack. */
   void       *area;
+  /**
+   * @brief This member contains the known high water mark of the stack.
+   *
+   * It is maintained by the stack checker.  It is NULL, if no stack usage
+   * was detected so far.
+   */
+  void       *high_water_mark;
+  /**
+   * @brief This member indicates if the stack may have been used since the
+   *   high water mark was determined.
+   *
+   * It is maintained by the stack checker.
+   */
+  bool        is_dirty;
 }   Stack_Control;
 
 /**
@@ -165,6 +180,40 @@ extern const Stack_Allocator_allocate _Stack_Allocator_allocate;
  */
 extern const Stack_Allocator_free _Stack_Allocator_free;
 
+/**
+ * @brief The stack cache item is placed in front of each stack area allocated
+ *   through the stack cache.
+ */
+typedef struct {
+  /**
+   * @brief This member is used to register the item in the stack cache while
+   *   the stack area is not used by a thread.
+   */
+  Chain_Node Node;
+
+  /**
+   * @brief This member contains the size of the stack area following the
+   *   item.
+   */
+  size_t size;
+} Stack_Cache_item;
+
+/**
+ * @brief This constant defines the size of the stack cache item including the
+ *   padding which maintains the heap alignment of the stack area.
+ */
+#define STACK_CACHE_ITEM_SIZE \
+  RTEMS_ALIGN_UP( sizeof( Stack_Cache_item ), CPU_HEAP_ALIGNMENT )
+
+/**
+ * @brief The maximum count of stack areas held by the stack cache.
+ *
+ * If the value is zero, then the stack cache is disabled.
+ *
+ * Application provided via <rtems/confdefs.h>.
+ */
+extern const uint32_t _Stack_Cache_maximum;
+
 /**
  * @brief Do the stack allocator initialization during system initialize.
  *
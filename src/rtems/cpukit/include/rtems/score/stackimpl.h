@@ -71,6 +71,8 @@ static inline void _Stack_Initialize (
 {
   the_stack->area = starting_address;
   the_stack->size = size;
+  the_stack->high_water_mark = NULL;
+  the_stack->is_dirty = true;
 }
 
 /**
@@ -215,6 +217,35 @@ void *_Stack_Allocate( size_t stack_size );
  */
 void _Stack_Free( void *stack_area );
 
+/**
+ * @brief Allocates a stack area through the stack cache.
+ *
+ * If the stack cache is enabled, then the most recently cached stack area of
+ * exactly the requested size is reused.  If no such stack area is available,
+ * then a new stack area is allocated by _Stack_Allocate().
+ *
+ * The caller shall be the owner of the object allocator mutex.
+ *
+ * @param stack_size is the size of the stack area to allocate.
+ *
+ * @retval stack_area The allocated stack area.
+ * @retval NULL The allocation failed.
+ */
+void *_Stack_Cache_allocate( size_t stack_size );
+
+/**
+ * @brief Frees the stack area allocated by _Stack_Cache_allocate().
+ *
+ * If the stack cache is enabled, then the stack area is put into the stack
+ * cache.  If the stack cache is full, then the least recently cached stack
+ * area is freed by _Stack_Free().
+ *
+ * The caller shall be the owner of the object allocator mutex.
+ *
+ * @param stack_area is the stack area to free.
+ */
+void _Stack_Cache_free( void *stack_area );
+
 /** @} */
 
 #ifdef __cplusplus
@@ -714,6 +714,59 @@ static inline void _Thread_queue_Queue_release(
   _ISR_lock_ISR_enable( lock_context );
 }
 
+#if defined(RTEMS_SMP)
+/**
+ * @brief The time in nanoseconds a thread spins at most while the owner of a
+ *   mutex executes on another processor.
+ *
+ * If the value is zero, then threads block immediately on owned mutexes.  The
+ * value is defined by the CONFIGURE_MUTEX_ADAPTIVE_SPIN_NANOSECONDS
+ * application configuration option.
+ */
+extern uint32_t _Thread_queue_Adaptive_spin_nanoseconds;
+
+/**
+ * @brief Spins while the owner of the thread queue executes on another
+ *   processor.
+ *
+ * Use _Thread_queue_Spin_on_owner() instead.
+ *
+ * @param queue is the thread queue queue of the mutex.
+ */
+void _Thread_queue_Do_spin_on_owner( const Thread_queue_Queue *queue );
+#endif
+
+/**
+ * @brief Spins while the owner of the thread queue executes on another
+ *   processor.
+ *
+ * This function shall be called by mutex obtain operations which are willing
+ * to wait before the thread queue is acquired, so with interrupts enabled.
+ * The function returns immediately, if the thread queue has no owner, if the
+ * owner is the executing thread, if the owner does not execute, or if there
+ * are already threads enqueued.  Otherwise, it spins until one of these
+ * conditions changes or the configured adaptive spin time elapsed.  Spinning
+ * keeps the short critical sections of other processors free of the
+ * enqueue, priority inheritance, and context switch overhead.  The caller
+ * shall check the mutex owner afterwards as usual and block if necessary.
+ *
+ * In uniprocessor configurations, this function does nothing.
+ *
+ * @param queue is the thread queue queue of the mutex.
+ */
+static inline void _Thread_queue_Spin_on_owner(
+  const Thread_queue_Queue *queue
+)
+{
+#if defined(RTEMS_SMP)
+  if ( RTEMS_PREDICT_FALSE( queue->owner != NULL ) ) {
+    _Thread_queue_Do_spin_on_owner( queue );
+  }
+#else
+  (void) queue;
+#endif
+}
+
 /**
  * @brief Copies the thread queue name to the specified buffer.
  *
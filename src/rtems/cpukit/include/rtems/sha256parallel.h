@@ -0,0 +1,145 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPISHA256Parallel
+ *
+ * @brief This header file provides the interfaces of the
+ *   @ref RTEMSAPISHA256Parallel.
+ */
+
+/*
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SHA256PARALLEL_H
+#define _RTEMS_SHA256PARALLEL_H
+
+#include <rtems.h>
+#include <sha256.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RTEMSAPISHA256Parallel Parallel SHA-256 Hashing
+ *
+ * @ingroup RTEMSAPI
+ *
+ * @brief This group contains a service to calculate the SHA-256 digests of
+ *   many independent buffers or files concurrently.
+ *
+ * The jobs are distributed dynamically to worker tasks.  Each worker hashes
+ * up to #SHA256_MB_LANES jobs in lockstep using the multi-buffer transform of
+ * SHA256_Update_multi().  A lane which finished its job is refilled with the
+ * next pending job.
+ *
+ * @{
+ */
+
+/**
+ * @brief This constant defines the size in bytes of the chunks processed per
+ *   lane and step.
+ */
+#define RTEMS_SHA256_PARALLEL_CHUNK_SIZE 4096
+
+/**
+ * @brief This structure describes a job of rtems_sha256_parallel().
+ */
+typedef struct {
+  /**
+   * @brief If this member is not NULL, then the file with this path is
+   *   hashed, otherwise the data buffer is hashed.
+   */
+  const char *path;
+
+  /**
+   * @brief This member references the begin of the data buffer to hash.
+   */
+  const void *data;
+
+  /**
+   * @brief This member defines the size in bytes of the data buffer.
+   */
+  size_t size;
+
+  /**
+   * @brief This member is set to zero if the digest is valid, otherwise to the
+   *   error number of the failed file operation.
+   */
+  int error;
+
+  /**
+   * @brief This member is set to the SHA-256 digest of the data.
+   */
+  unsigned char digest[ SHA256_DIGEST_LENGTH ];
+} rtems_sha256_parallel_job;
+
+/**
+ * @brief Calculates the SHA-256 digests of the jobs concurrently.
+ *
+ * The calling task works on the jobs together with worker_count - 1 worker
+ * tasks.  The worker tasks are created with the current priority of the
+ * calling task and are deleted before the directive returns.  If a worker
+ * task cannot be created, then the jobs are processed by fewer tasks.
+ *
+ * @param[in, out] jobs is the array of jobs.
+ *
+ * @param job_count is the count of jobs in the array.
+ *
+ * @param worker_count is the count of tasks working on the jobs including the
+ *   calling task.  If the value is zero, then the processor count of the
+ *   home scheduler of the calling task is used.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.  Check
+ *   the error member of the jobs.
+ *
+ * @retval ::RTEMS_NO_MEMORY There was not enough memory to allocate the
+ *   worker contexts.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive shall be called from within task context.
+ *
+ * * The application shall configure worker_count - 1 tasks in addition to
+ *   the tasks it uses otherwise.
+ * @endparblock
+ */
+rtems_status_code rtems_sha256_parallel(
+  rtems_sha256_parallel_job *jobs,
+  size_t                     job_count,
+  uint32_t                   worker_count
+);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_SHA256PARALLEL_H */
@@ -45,6 +45,7 @@
 extern "C" {
 #endif
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <rtems/fs.h>
 
@@ -278,6 +279,25 @@ typedef struct tftp_net_config {
    * transfer may not use the option values specified here.
    */
   tftp_options options;
+
+  /**
+   * @brief This member enables the read-ahead of data packets.
+   *
+   * Without read-ahead, the client acknowledges a window of data packets
+   * only when the user asks for more data after having consumed the last
+   * packet of the window.  The server idles while the user processes the
+   * data.  With read-ahead, the client sends the acknowledgment as soon
+   * as the last packet of a window has been received.  The server then
+   * transmits the next window while the user consumes the current one.
+   * The packets of the next window are buffered by the socket until
+   * the user reads them.  Hence, the socket receive buffer should be
+   * able to hold at least one window of packets.
+   *
+   * This member has no effect when writing files.
+   *
+   * The default value is @c false.
+   */
+  bool read_ahead;
 } tftp_net_config;
 
 /**
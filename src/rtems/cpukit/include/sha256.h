@@ -49,6 +49,11 @@ void	SHA256_Init(SHA256_CTX *);
 void	SHA256_Update(SHA256_CTX *, const void *, size_t);
 void	SHA256_Final(unsigned char [__min_size(SHA256_DIGEST_LENGTH)],
     SHA256_CTX *);
+#ifdef __rtems__
+#define SHA256_MB_LANES	4
+void	SHA256_Update_multi(SHA256_CTX * const [], const void * const [],
+    const size_t [], size_t);
+#endif /* __rtems__ */
 #ifndef _KERNEL
 char   *SHA256_End(SHA256_CTX *, char *);
 char   *SHA256_Data(const void *, unsigned int, char *);
@@ -0,0 +1,518 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPIPrintkBuffer
+ *
+ * @brief This source file contains the implementation of the buffered
+ *   printk().
+ */
+
+/*
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/printkbuffer.h>
+#include <rtems/bspIo.h>
+#include <rtems/counter.h>
+#include <rtems/thread.h>
+#include <rtems/dev/io.h>
+#include <rtems/rtems/object.h>
+#include <rtems/score/assert.h>
+#include <rtems/score/isrlevel.h>
+#include <rtems/score/percpu.h>
+#include <rtems/score/smpimpl.h>
+#include <rtems/score/timecounter.h>
+
+#include <inttypes.h>
+#include <string.h>
+
+/*
+ * Messages longer than this chunk size are split into several ring buffer
+ * entries.  The chunk is on the stack of the printk() caller.
+ */
+#define PRINTK_BUFFER_CHUNK_SIZE 128
+
+/*
+ * The drain owner state consists of the draining and the fatal flags.  A
+ * consumer of the ring buffers shall set the draining flag while it outputs a
+ * message.  The fatal error handler sets the fatal flag and never clears it,
+ * so that no other consumer may start afterwards.
+ */
+#define PRINTK_BUFFER_DRAINING 0x1U
+
+#define PRINTK_BUFFER_FATAL 0x2U
+
+/*
+ * This is the maximum time the fatal error handler waits for a consumer on
+ * another processor to finish the output of a message.
+ */
+#define PRINTK_BUFFER_FATAL_TIMEOUT_NS 100000000
+
+typedef struct {
+  int64_t  timestamp;
+  uint32_t size;
+} Printk_Buffer_Message;
+
+typedef struct {
+  size_t n;
+  char   text[ PRINTK_BUFFER_CHUNK_SIZE ];
+} Printk_Buffer_Chunk;
+
+RTEMS_WEAK const Printk_Buffer_Configuration _Printk_Buffer_Configuration;
+
+static rtems_mutex _Printk_Buffer_Mutex = RTEMS_MUTEX_INITIALIZER( "printk" );
+
+static Atomic_Uint _Printk_Buffer_Owner = ATOMIC_INITIALIZER_UINT( 0 );
+
+static char *_Printk_Buffer_Ring(
+  const Printk_Buffer_Configuration *config,
+  uint32_t                           cpu_index
+)
+{
+  return &config->storage[ cpu_index * config->size ];
+}
+
+static unsigned int _Printk_Buffer_Message_size( size_t text_size )
+{
+  return RTEMS_ALIGN_UP(
+    sizeof( Printk_Buffer_Message ) + text_size,
+    sizeof( int64_t )
+  );
+}
+
+static void _Printk_Buffer_Copy_in(
+  const Printk_Buffer_Configuration *config,
+  char                              *ring,
+  unsigned int                       index,
+  const void                        *src,
+  size_t                             n
+)
+{
+  size_t offset;
+  size_t first;
+
+  offset = index & ( config->size - 1 );
+  first = config->size - offset;
+
+  if ( first > n ) {
+    first = n;
+  }
+
+  memcpy( &ring[ offset ], src, first );
+  memcpy( &ring[ 0 ], (const char *) src + first, n - first );
+}
+
+static void _Printk_Buffer_Copy_out(
+  const Printk_Buffer_Configuration *config,
+  const char                        *ring,
+  unsigned int                       index,
+  void                              *dst,
+  size_t                             n
+)
+{
+  size_t offset;
+  size_t first;
+
+  offset = index & ( config->size - 1 );
+  first = config->size - offset;
+
+  if ( first > n ) {
+    first = n;
+  }
+
+  memcpy( dst, &ring[ offset ], first );
+  memcpy( (char *) dst + first, &ring[ 0 ], n - first );
+}
+
+static void _Printk_Buffer_Produce( const char *text, size_t size )
+{
+  const Printk_Buffer_Configuration *config;
+  Printk_Buffer_Control             *control;
+  Printk_Buffer_Message              message;
+  ISR_Level                          level;
+  uint32_t                           cpu_index;
+  unsigned int                       head;
+  unsigned int                       tail;
+  unsigned int                       message_size;
+  char                              *ring;
+
+  config = &_Printk_Buffer_Configuration;
+  message_size = _Printk_Buffer_Message_size( size );
+
+  /*
+   * The ring buffer of a processor has exactly one producer at a time since
+   * interrupts are disabled on the current processor and the thread cannot
+   * migrate.  The drain task is the only consumer.
+   */
+  _ISR_Local_disable( level );
+  cpu_index = _Per_CPU_Get_index( _Per_CPU_Get() );
+  control = &config->controls[ cpu_index ];
+  head = _Atomic_Load_uint( &control->head, ATOMIC_ORDER_RELAXED );
+  tail = _Atomic_Load_uint( &control->tail, ATOMIC_ORDER_ACQUIRE );
+
+  if ( config->size - ( head - tail ) < message_size ) {
+    _ISR_Local_enable( level );
+
+    if ( config->output_on_overflow ) {
+      size_t i;
+
+      for ( i = 0; i < size; ++i ) {
+        rtems_putc( text[ i ] );
+      }
+    } else {
+      _Atomic_Fetch_add_uint( &control->discarded, 1, ATOMIC_ORDER_RELAXED );
+    }
+
+    return;
+  }
+
+  message.timestamp = _Timecounter_Sbinuptime();
+  message.size = (uint32_t) size;
+  ring = _Printk_Buffer_Ring( config, cpu_index );
+  _Printk_Buffer_Copy_in( config, ring, head, &message, sizeof( message ) );
+  _Printk_Buffer_Copy_in(
+    config,
+    ring,
+    head + sizeof( message ),
+    text,
+    size
+  );
+  _Atomic_Store_uint(
+    &control->head,
+    head + message_size,
+    ATOMIC_ORDER_RELEASE
+  );
+  _ISR_Local_enable( level );
+}
+
+static void _Printk_Buffer_Put_char( int c, void *arg )
+{
+  Printk_Buffer_Chunk *chunk;
+
+  chunk = arg;
+  chunk->text[ chunk->n ] = (char) c;
+  ++chunk->n;
+
+  if ( chunk->n == sizeof( chunk->text ) ) {
+    _Printk_Buffer_Produce( chunk->text, chunk->n );
+    chunk->n = 0;
+  }
+}
+
+int _Printk_Buffer_Vprintk( const char *fmt, va_list ap )
+{
+  Printk_Buffer_Chunk chunk;
+  int                 len;
+
+  chunk.n = 0;
+  len = _IO_Vprintf( _Printk_Buffer_Put_char, &chunk, fmt, ap );
+
+  if ( chunk.n > 0 ) {
+    _Printk_Buffer_Produce( chunk.text, chunk.n );
+  }
+
+  return len;
+}
+
+static bool _Printk_Buffer_Output_oldest(
+  const Printk_Buffer_Configuration *config,
+  uint32_t                           cpu_max
+)
+{
+  Printk_Buffer_Message oldest;
+  Printk_Buffer_Control *control;
+  const char           *ring;
+  uint32_t              oldest_cpu;
+  uint32_t              cpu_index;
+  unsigned int          oldest_tail;
+  unsigned int          i;
+
+  oldest_cpu = cpu_max;
+  oldest_tail = 0;
+  memset( &oldest, 0, sizeof( oldest ) );
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Printk_Buffer_Message message;
+    unsigned int          head;
+    unsigned int          tail;
+
+    control = &config->controls[ cpu_index ];
+    tail = _Atomic_Load_uint( &control->tail, ATOMIC_ORDER_RELAXED );
+    head = _Atomic_Load_uint( &control->head, ATOMIC_ORDER_ACQUIRE );
+
+    if ( head == tail ) {
+      continue;
+    }
+
+    _Printk_Buffer_Copy_out(
+      config,
+      _Printk_Buffer_Ring( config, cpu_index ),
+      tail,
+      &message,
+      sizeof( message )
+    );
+
+    if ( oldest_cpu == cpu_max || message.timestamp < oldest.timestamp ) {
+      oldest = message;
+      oldest_cpu = cpu_index;
+      oldest_tail = tail;
+    }
+  }
+
+  if ( oldest_cpu == cpu_max ) {
+    return false;
+  }
+
+  ring = _Printk_Buffer_Ring( config, oldest_cpu );
+
+  for ( i = 0; i < oldest.size; ++i ) {
+    unsigned int index;
+
+    index = oldest_tail + sizeof( oldest ) + i;
+    rtems_putc( ring[ index & ( config->size - 1 ) ] );
+  }
+
+  control = &config->controls[ oldest_cpu ];
+  _Atomic_Store_uint(
+    &control->tail,
+    oldest_tail + _Printk_Buffer_Message_size( oldest.size ),
+    ATOMIC_ORDER_RELEASE
+  );
+  return true;
+}
+
+static void _Printk_Buffer_Report_discarded(
+  const Printk_Buffer_Configuration *config,
+  uint32_t                           cpu_max
+)
+{
+  uint32_t cpu_index;
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Printk_Buffer_Control *control;
+    unsigned int           discarded;
+
+    control = &config->controls[ cpu_index ];
+    discarded = _Atomic_Load_uint( &control->discarded, ATOMIC_ORDER_RELAXED );
+
+    if ( discarded != control->discarded_reported ) {
+      _IO_Printf(
+        rtems_put_char,
+        NULL,
+        "\n*** PRINTK BUFFER: PROCESSOR %" PRIu32 " DISCARDED %u MESSAGES ***\n",
+        cpu_index,
+        discarded - control->discarded_reported
+      );
+      control->discarded_reported = discarded;
+    }
+  }
+}
+
+static void _Printk_Buffer_Drain( const Printk_Buffer_Configuration *config )
+{
+  uint32_t cpu_max;
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  while ( _Printk_Buffer_Output_oldest( config, cpu_max ) ) {
+    /* Output the next message */
+  }
+
+  _Printk_Buffer_Report_discarded( config, cpu_max );
+}
+
+static bool _Printk_Buffer_Acquire( void )
+{
+  unsigned int owner;
+
+  owner = 0;
+  return _Atomic_Compare_exchange_uint(
+    &_Printk_Buffer_Owner,
+    &owner,
+    PRINTK_BUFFER_DRAINING,
+    ATOMIC_ORDER_ACQUIRE,
+    ATOMIC_ORDER_RELAXED
+  );
+}
+
+static void _Printk_Buffer_Release( void )
+{
+  _Atomic_Fetch_and_uint(
+    &_Printk_Buffer_Owner,
+    ~PRINTK_BUFFER_DRAINING,
+    ATOMIC_ORDER_RELEASE
+  );
+}
+
+/*
+ * Output one message at a time, so that the fatal error handler has to wait
+ * for at most one message.  Stop once the fatal error handler took over.
+ */
+static void _Printk_Buffer_Drain_owned(
+  const Printk_Buffer_Configuration *config
+)
+{
+  uint32_t cpu_max;
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  while ( _Printk_Buffer_Acquire() ) {
+    if ( !_Printk_Buffer_Output_oldest( config, cpu_max ) ) {
+      _Printk_Buffer_Report_discarded( config, cpu_max );
+      _Printk_Buffer_Release();
+      break;
+    }
+
+    _Printk_Buffer_Release();
+  }
+}
+
+void rtems_printk_buffer_flush( void )
+{
+  const Printk_Buffer_Configuration *config;
+
+  config = &_Printk_Buffer_Configuration;
+
+  if ( config->size == 0 ) {
+    return;
+  }
+
+  rtems_mutex_lock( &_Printk_Buffer_Mutex );
+  _Printk_Buffer_Drain_owned( config );
+  rtems_mutex_unlock( &_Printk_Buffer_Mutex );
+}
+
+uint32_t rtems_printk_buffer_get_discarded( uint32_t cpu_index )
+{
+  const Printk_Buffer_Configuration *config;
+
+  config = &_Printk_Buffer_Configuration;
+
+  if ( config->size == 0 || cpu_index >= _SMP_Get_processor_maximum() ) {
+    return 0;
+  }
+
+  return _Atomic_Load_uint(
+    &config->controls[ cpu_index ].discarded,
+    ATOMIC_ORDER_RELAXED
+  );
+}
+
+static rtems_task _Printk_Buffer_Task( rtems_task_argument arg )
+{
+  (void) arg;
+
+  while ( true ) {
+    rtems_printk_buffer_flush();
+    (void) rtems_task_wake_after( 1 );
+  }
+}
+
+void _Printk_Buffer_Initialize( void )
+{
+  rtems_status_code   sc;
+  rtems_id            id;
+  rtems_task_priority priority;
+
+  priority = _Printk_Buffer_Configuration.task_priority;
+
+  if ( priority == 0 ) {
+    priority = RTEMS_MAXIMUM_PRIORITY - 1;
+  }
+
+  sc = rtems_task_create(
+    rtems_build_name( 'P', 'R', 'N', 'K' ),
+    priority,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+
+  if ( sc != RTEMS_SUCCESSFUL ) {
+    /* Without a drain task, keep the direct output */
+    return;
+  }
+
+  sc = rtems_task_start( id, _Printk_Buffer_Task, 0 );
+  _Assert_Unused_variable_equals( sc, RTEMS_SUCCESSFUL );
+
+  _Vprintk_Handler = _Printk_Buffer_Vprintk;
+}
+
+void _Printk_Buffer_Fatal(
+  Internal_errors_Source source,
+  bool                   always_set_to_false,
+  Internal_errors_t      code
+)
+{
+  unsigned int        owner;
+  rtems_counter_ticks start;
+  rtems_counter_ticks timeout;
+
+  (void) source;
+  (void) always_set_to_false;
+  (void) code;
+
+  /*
+   * The mutex may be owned by an arbitrary thread, so output all further
+   * messages directly.  The drain task may still run on another processor.
+   * Stop it through the fatal flag and wait until it finished the output of
+   * its current message.  Drain the ring buffers here only if it did so in
+   * time.  A consumer interrupted on this processor never finishes, so this
+   * case ends through the timeout as well.
+   */
+  _Vprintk_Handler = NULL;
+  owner = _Atomic_Fetch_or_uint(
+    &_Printk_Buffer_Owner,
+    PRINTK_BUFFER_FATAL,
+    ATOMIC_ORDER_ACQUIRE
+  );
+
+  if ( ( owner & PRINTK_BUFFER_FATAL ) != 0 ) {
+    return;
+  }
+
+  start = rtems_counter_read();
+  timeout = rtems_counter_nanoseconds_to_ticks(
+    PRINTK_BUFFER_FATAL_TIMEOUT_NS
+  );
+
+  while (
+    _Atomic_Load_uint( &_Printk_Buffer_Owner, ATOMIC_ORDER_ACQUIRE )
+      != PRINTK_BUFFER_FATAL
+  ) {
+    if ( rtems_counter_difference( rtems_counter_read(), start ) > timeout ) {
+      return;
+    }
+  }
+
+  _Printk_Buffer_Drain( &_Printk_Buffer_Configuration );
+}
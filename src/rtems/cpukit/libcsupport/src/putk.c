@@ -39,6 +39,9 @@
 #endif
 
 #include <rtems/bspIo.h>
+#include <rtems/printkbuffer.h>
+
+#include <string.h>
 
 /**
  * Kernel putk (e.g. puts) function requiring minimal infrastrure.
@@ -48,6 +51,11 @@ int putk(const char *s)
   const char *p;
   int len_out = 0;
 
+  if (_Vprintk_Handler != NULL) {
+    (void) printk("%s\n", s);
+    return (int) strlen(s) + 1;
+  }
+
   for (p=s ; *p ; p++, len_out++ )
     rtems_putc(*p);
   rtems_putc('\n');
@@ -1159,6 +1159,27 @@ oproc (unsigned char c, rtems_termios_tty *tty, bool wait)
   return doTransmit (buf, len, tty, wait, true) > 0;
 }
 
+/*
+ * Return the count of leading characters which oproc() would transmit
+ * unchanged and which advance the column by one.  These characters can be
+ * transmitted as a block.
+ */
+static size_t
+plainOutputRun (const char *buf, size_t len, const rtems_termios_tty *tty)
+{
+  size_t n;
+
+  if (tty->termios.c_oflag & OLCUC)
+    return 0;
+
+  for (n = 0; n < len; ++n) {
+    if (iscntrl ((unsigned char) buf[n]))
+      break;
+  }
+
+  return n;
+}
+
 static uint32_t
 rtems_termios_write_tty (rtems_libio_t *iop, rtems_termios_tty *tty,
                          const char *buf, uint32_t len)
@@ -1169,6 +1190,23 @@ rtems_termios_write_tty (rtems_libio_t *iop, rtems_termios_tty *tty,
     uint32_t todo = len;
 
     while (todo > 0) {
+      size_t n = plainOutputRun (buf, todo, tty);
+
+      if (n > 0) {
+        size_t sent = doTransmit (buf, n, tty, wait, false);
+
+        tty->column += (int) sent;
+        buf += sent;
+        todo -= sent;
+        wait = false;
+
+        if (sent < n) {
+          break;
+        }
+
+        continue;
+      }
+
       if (!oproc (*buf, tty, wait)) {
         break;
       }
@@ -1510,6 +1548,113 @@ fillBufferPoll (struct rtems_termios_tty *tty)
   return RTEMS_TERMIOS_IPROC_CONTINUE;
 }
 
+/*
+ * Return true, if characters read from the raw input queue need no
+ * per-character input processing and no flow control handling.  In this case,
+ * the characters are copied in blocks directly to the caller.
+ */
+static bool
+canDequeueRawBlock (const rtems_termios_tty *tty)
+{
+  return (tty->flow_ctrl & (FL_MDRTS | FL_MDXON | FL_MDXOF)) == 0 &&
+    (tty->termios.c_lflag & (ICANON | ISIG | ECHO)) == 0;
+}
+
+/*
+ * Move up to len characters from the raw input queue to the buffer
+ */
+static size_t
+dequeueRawBlock (struct rtems_termios_tty *tty, char *buf, size_t len)
+{
+  rtems_termios_device_context *ctx = tty->device_context;
+  rtems_interrupt_lock_context lock_context;
+  unsigned int size;
+  unsigned int head;
+  unsigned int tail;
+  size_t done;
+
+  done = 0;
+
+  rtems_termios_device_lock_acquire (ctx, &lock_context);
+
+  size = tty->rawInBuf.Size;
+  head = tty->rawInBuf.Head;
+  tail = tty->rawInBuf.Tail;
+
+  while (done < len && head != tail) {
+    unsigned int first;
+    size_t n;
+
+    first = (head + 1) % size;
+
+    /* Copy at most up to the tail or the end of the ring buffer */
+    if (first <= tail)
+      n = tail - first + 1;
+    else
+      n = size - first;
+
+    if (n > len - done)
+      n = len - done;
+
+    memcpy (&buf[done], &tty->rawInBuf.theBuf[first], n);
+    head = first + n - 1;
+    done += n;
+  }
+
+  tty->rawInBuf.Head = head;
+
+  if (((tail + size - head) % size) < tty->lowwater)
+    tty->flow_ctrl &= ~FL_IREQXOF;
+
+  rtems_termios_device_lock_release (ctx, &lock_context);
+
+  return done;
+}
+
+/*
+ * Read from the raw input queue directly into the buffer of the caller.  This
+ * follows the non-canonical mode rules of fillBufferQueue() with the size of
+ * the caller buffer instead of the cooked buffer size.
+ */
+static uint32_t
+readRawQueue (struct rtems_termios_tty *tty, char *buffer, uint32_t count)
+{
+  rtems_interval timeout = tty->rawInBufSemaphoreFirstTimeout;
+  uint32_t done = 0;
+
+  for (;;) {
+    size_t n;
+
+    n = dequeueRawBlock (tty, &buffer[done], count - done);
+
+    if (n > 0) {
+      done += (uint32_t) n;
+      timeout = tty->rawInBufSemaphoreTimeout;
+
+      if (done >= tty->termios.c_cc[VMIN])
+        break;
+    }
+
+    if (done == count)
+      break;
+
+    /*
+     * Wait for characters
+     */
+    if (tty->rawInBufSemaphoreWait) {
+      if (rtems_binary_semaphore_wait_timed_ticks (
+            &tty->rawInBuf.Semaphore, timeout) != 0) {
+        break;
+      }
+    } else {
+      if (rtems_binary_semaphore_try_wait (&tty->rawInBuf.Semaphore) != 0)
+        break;
+    }
+  }
+
+  return done;
+}
+
 /*
  * Fill the input buffer from the raw input queue
  */
@@ -1628,10 +1773,15 @@ rtems_termios_read_tty (
   if (tty->cindex == tty->ccount) {
     tty->cindex = tty->ccount = 0;
     tty->read_start_column = tty->column;
-    if (tty->handler.poll_read != NULL && tty->handler.mode == TERMIOS_POLLED)
+    if (tty->handler.poll_read != NULL && tty->handler.mode == TERMIOS_POLLED) {
       rc = fillBufferPoll (tty);
-    else
+    } else if (canDequeueRawBlock (tty)) {
+      /* Bypass the cooked buffer in raw mode */
+      count -= readRawQueue (tty, buffer, count);
+      rc = RTEMS_TERMIOS_IPROC_CONTINUE;
+    } else {
       rc = fillBufferQueue (tty);
+    }
   } else {
     rc = RTEMS_TERMIOS_IPROC_CONTINUE;
   }
@@ -1639,10 +1789,16 @@ rtems_termios_read_tty (
   /*
    * If there are characters in the buffer, then copy them to the caller.
    */
-  while (count && (tty->cindex < tty->ccount)) {
-    *buffer++ = tty->cbuf[tty->cindex++];
-    count--;
-   }
+  if (count > 0 && tty->cindex < tty->ccount) {
+    uint32_t n = (uint32_t) (tty->ccount - tty->cindex);
+
+    if (n > count)
+      n = count;
+
+    memcpy (buffer, &tty->cbuf[tty->cindex], n);
+    tty->cindex += n;
+    count -= n;
+  }
   tty->tty_rcvwakeup = false;
   *count_read = initial_count - count;
 
@@ -1712,6 +1868,67 @@ mustCallReceiveCallback (const rtems_termios_tty *tty, unsigned char c,
   }
 }
 
+/*
+ * Return true, if received characters need no per-character input
+ * processing, no flow control handling, and no receive callback checks.  In
+ * this case, the characters are copied in blocks to the raw input queue.
+ */
+static bool
+canEnqueueRawBlock (const rtems_termios_tty *tty)
+{
+  return (tty->flow_ctrl & (FL_MDRTS | FL_MDXON | FL_MDXOF)) == 0 &&
+    (tty->termios.c_iflag & (IGNCR | ISTRIP | IUCLC | ICRNL | INLCR)) == 0 &&
+    tty->tty_rcv.sw_pfn == NULL;
+}
+
+/*
+ * Copy characters to the raw input queue.
+ * Returns the number of characters dropped because of overflow.
+ */
+static int
+enqueueRawBlock (struct rtems_termios_tty *tty, const char *buf, size_t len)
+{
+  rtems_termios_device_context *ctx = tty->device_context;
+  rtems_interrupt_lock_context lock_context;
+  unsigned int size;
+  unsigned int tail;
+  unsigned int capacity;
+
+  rtems_termios_device_lock_acquire (ctx, &lock_context);
+
+  size = tty->rawInBuf.Size;
+  tail = tty->rawInBuf.Tail;
+  capacity = (tty->rawInBuf.Head + size - tail - 1) % size;
+
+  while (len > 0 && capacity > 0) {
+    unsigned int first;
+    size_t n;
+
+    first = (tail + 1) % size;
+
+    /* Copy at most up to the end of the ring buffer */
+    n = size - first;
+
+    if (n > capacity)
+      n = capacity;
+
+    if (n > len)
+      n = len;
+
+    memcpy (&tty->rawInBuf.theBuf[first], buf, n);
+    tail = first + n - 1;
+    capacity -= n;
+    buf += n;
+    len -= n;
+  }
+
+  tty->rawInBuf.Tail = tail;
+
+  rtems_termios_device_lock_release (ctx, &lock_context);
+
+  return (int) len;
+}
+
 /*
  * Place characters on raw queue.
  * NOTE: This routine runs in the context of the
@@ -1744,6 +1961,11 @@ rtems_termios_enqueue_raw_characters (void *ttyp, const char *buf, int len)
     return 0;
   }
 
+  if (canEnqueueRawBlock (tty)) {
+    dropped = enqueueRawBlock (tty, buf, (size_t) len);
+    len = 0;
+  }
+
   while (len--) {
     c = *buf++;
     /* FIXME: implement IXANY: any character restarts output */
@@ -39,8 +39,19 @@
 
 #include <rtems/bspIo.h>
 #include <rtems/dev/io.h>
+#include <rtems/printkbuffer.h>
+
+int ( *_Vprintk_Handler )( const char *fmt, va_list ap );
 
 int vprintk( const char *fmt, va_list ap )
 {
+  int ( *handler )( const char *, va_list );
+
+  handler = _Vprintk_Handler;
+
+  if ( handler != NULL ) {
+    return ( *handler )( fmt, ap );
+  }
+
   return _IO_Vprintf( rtems_put_char, NULL, fmt, ap );
 }
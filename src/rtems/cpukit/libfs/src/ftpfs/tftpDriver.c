@@ -286,6 +286,12 @@ struct tftpStream {
     int32_t blocknum_of_first_packet_of_window;
     int error;
 
+    /*
+     * Number of timeouts and out-of-order packets encountered so far.
+     * Each of these events triggers a retransmission.
+     */
+    uint32_t loss_events;
+
     /*
      * Configuration and TFTP options
      *
@@ -682,6 +688,38 @@ static int process_error_packet_option_negotiation (
     return GOT_FIRST_OUT_OF_ORDER_PACKET;
 }
 
+/*
+ * Read-ahead: Acknowledge a completely received window immediately
+ * instead of waiting for the user to ask for the data following the
+ * window.  The server can then send the next window while the user
+ * consumes the current one.  If this ACK gets lost, the timeout in
+ * communicate_with_server() will cause its retransmission.
+ */
+static void send_ack_ahead (struct tftpStream *tp)
+{
+    ssize_t plen;
+    union tftpPacket *send_buf;
+
+    if (!tp->config.read_ahead) {
+        return;
+    }
+
+    plen = prepare_ack_packet_for_sending (tp, false, &send_buf, NULL, NULL);
+    if (plen != DO_NOT_SEND_PACKET) {
+        /*
+         * Errors during send are handled like a lost packet.
+         */
+        (void) sendto (
+            tp->socket,
+            send_buf,
+            plen,
+            0,
+            (struct sockaddr *) &tp->farAddress,
+            sizeof (tp->farAddress)
+        );
+    }
+}
+
 static int process_data_packet (struct tftpStream *tp, ssize_t len)
 {
     ssize_t plen;
@@ -751,6 +789,9 @@ static int process_data_packet (struct tftpStream *tp, ssize_t len)
         );
     }
     tp->prepare_packet_for_sending = prepare_ack_packet_for_sending;
+    if (!tp->at_eof) {
+        send_ack_ahead (tp);
+    }
     return GOT_EXPECTED_PACKET;
 }
 
@@ -882,6 +923,7 @@ static int process_oack_packet (struct tftpStream *tp, ssize_t len)
          */
         tp->nleft = 0;
         tp->prepare_packet_for_sending = prepare_ack_packet_for_sending;
+        send_ack_ahead (tp);
     } else {
         tp->blocknum_of_first_packet_of_window = 1;
         tp->blocknum = (uint16_t) tp->blocknum_of_first_packet_of_window;
@@ -1075,6 +1117,7 @@ static int communicate_with_server (
                 tp->error = 0;
             } else if (tp->error <= GOT_FIRST_OUT_OF_ORDER_PACKET) {
                 force_retransmission = true;
+                tp->loss_events++;
                 tp->error = 0;
             } /* else ... tp->error > 0 means "exit this function with error" */
         } else if (len >= 0) {
@@ -1087,6 +1130,7 @@ static int communicate_with_server (
              * Timeout or other problems to receive packets
              * Attempt a retransmission
              */
+            tp->loss_events++;
             if (++retryCount >= (int) tp->config.retransmissions) {
                 tp->error = tp->retransmission_error_code;
                 break;
@@ -1185,6 +1229,7 @@ static struct tftpStream *create_stream(
     tp->ignore_out_of_order_packets        = false;
     tp->blocknum_of_first_packet_of_window = INT32_MIN;
     tp->error                              = 0;
+    tp->loss_events                        = 0;
 
     return tp;
 }
@@ -1250,7 +1295,8 @@ void tftp_initialize_net_config (tftp_net_config *config)
     .options = {
       .block_size    = TFTP_DEFAULT_BLOCK_SIZE,
       .window_size   = TFTP_DEFAULT_WINDOW_SIZE
-    }
+    },
+    .read_ahead      = false
   };
 
   if (config != NULL) {
@@ -1520,6 +1566,18 @@ ssize_t tftp_write(
     return count;
 }
 
+void _Tftp_Get_transfer_info(
+    void         *tftp_handle,
+    tftp_options *server_options,
+    uint32_t     *loss_events
+)
+{
+    struct tftpStream *tp = tftp_handle;
+
+    *server_options = tp->server_options;
+    *loss_events    = tp->loss_events;
+}
+
 void _Tftp_Destroy(
     void *tftp_handle
 )
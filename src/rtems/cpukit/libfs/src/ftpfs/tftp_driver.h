@@ -79,6 +79,26 @@ void _Tftp_Destroy(
   void *tftp_handle
 );
 
+/**
+ * @brief Get the option values agreed with the server and the number of
+ *   packet losses encountered by a TFTP client connection.
+ *
+ * The TFTP file system uses this information to adapt the option values
+ * requested for later transfers when it was mounted with the @c adaptive
+ * option.
+ *
+ * @param tftp_handle is the reference returned by a call to tftp_open().
+ * @param[out] server_options references a place where the option values
+ *   used for the transfer of data are stored.
+ * @param[out] loss_events references a place where the number of timeouts
+ *   and out-of-order packets encountered so far is stored.
+ */
+void _Tftp_Get_transfer_info(
+  void *tftp_handle,
+  tftp_options *server_options,
+  uint32_t *loss_events
+);
+
 /* Only non-private to ease unit testing */
 ssize_t _Tftpfs_Parse_options(
   const char *option_str,
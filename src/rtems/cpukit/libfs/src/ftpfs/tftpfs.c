@@ -64,7 +64,8 @@
 /*
  * Flags for filesystem info.
  */
-#define TFTPFS_VERBOSE (1 << 0)
+#define TFTPFS_VERBOSE  (1 << 0)
+#define TFTPFS_ADAPTIVE (1 << 1)
 
 /*
  * TFTP File system info.
@@ -75,6 +76,12 @@ typedef struct tftpfs_info_s {
   size_t nStreams;
   void ** volatile tftpStreams;
   tftp_net_config tftp_config;
+  /*
+   * With TFTPFS_ADAPTIVE, tftp_config.options are the option values
+   * requested for the next transfer and max_options are the largest
+   * values which will ever be requested.
+   */
+  tftp_options max_options;
 } tftpfs_info_t;
 
 #define tftpfs_info_mount_table(_mt) ((tftpfs_info_t*) ((_mt)->fs_info))
@@ -107,6 +114,8 @@ ssize_t _Tftpfs_Parse_options(
   const char *cur_pos = option_str;
   size_t verbose_len = strlen ("verbose");
   size_t rfc1350_len = strlen ("rfc1350");
+  size_t readahead_len = strlen ("readahead");
+  size_t adaptive_len = strlen ("adaptive");
   int len;
 
   while(cur_pos != NULL && *cur_pos != '\0') {
@@ -117,6 +126,12 @@ ssize_t _Tftpfs_Parse_options(
       tftp_config->options.block_size = TFTP_RFC1350_BLOCK_SIZE;
       tftp_config->options.window_size = TFTP_RFC1350_WINDOW_SIZE;
       len = (int) rfc1350_len;
+    } else if (strncmp (cur_pos, "readahead", readahead_len) == 0) {
+      tftp_config->read_ahead = true;
+      len = (int) readahead_len;
+    } else if (strncmp (cur_pos, "adaptive", adaptive_len) == 0) {
+      *flags |= TFTPFS_ADAPTIVE;
+      len = (int) adaptive_len;
     } else if (sscanf(
         cur_pos,
         "blocksize=%"SCNu16"%n",
@@ -194,6 +209,7 @@ int rtems_tftpfs_initialize(
     errno_store = EINVAL;
     goto error;
   }
+  fs->max_options = fs->tftp_config.options;
 
   mt_entry->fs_info = fs;
   mt_entry->mt_fs_root->location.node_access = root_path;
@@ -351,6 +367,7 @@ static int rtems_tftp_open_worker(
     char                 *cp1;
     char                 *remoteFilename;
     char                 *hostname;
+    tftp_net_config      config;
     int                  err;
 
     /*
@@ -383,11 +400,14 @@ static int rtems_tftp_open_worker(
     /*
      * Establish the connection
      */
+    rtems_mutex_lock (&fs->tftp_mutex);
+    config = fs->tftp_config;
+    rtems_mutex_unlock (&fs->tftp_mutex);
     err = tftp_open (
         hostname,
         remoteFilename,
         (oflag & O_ACCMODE) == O_RDONLY,
-        &fs->tftp_config,
+        &config,
         &tp
     );
     if (err != 0) {
@@ -479,6 +499,56 @@ static ssize_t rtems_tftp_read(
     return result;
 }
 
+/*
+ * Adapt the option values requested for the next transfers to the
+ * behaviour of the server and the network observed during a transfer.
+ *
+ * Values reduced by the server become the new upper limits since the
+ * server will not accept more anyway.  Packet losses halve the window
+ * size or - if the window size is already one - the block size.  Large
+ * blocks are fragmented by IP and the loss of a single fragment loses
+ * the whole block.  A transfer without losses doubles the block size and
+ * then increments the window size until the upper limits are reached.
+ */
+static void rtems_tftp_adapt_options (tftpfs_info_t *fs, void *tp)
+{
+    tftp_options  agreed;
+    tftp_options *requested;
+    uint32_t      loss_events;
+
+    _Tftp_Get_transfer_info (tp, &agreed, &loss_events);
+
+    rtems_mutex_lock (&fs->tftp_mutex);
+    requested = &fs->tftp_config.options;
+    if (agreed.block_size < requested->block_size) {
+        requested->block_size = agreed.block_size;
+        fs->max_options.block_size = agreed.block_size;
+    }
+    if (agreed.window_size < requested->window_size) {
+        requested->window_size = agreed.window_size;
+        fs->max_options.window_size = agreed.window_size;
+    }
+
+    if (loss_events > 0) {
+        if (requested->window_size > TFTP_RFC1350_WINDOW_SIZE) {
+            requested->window_size /= 2;
+        } else if (requested->block_size / 2 >= TFTP_RFC1350_BLOCK_SIZE) {
+            requested->block_size /= 2;
+        } else if (requested->block_size > TFTP_RFC1350_BLOCK_SIZE) {
+            requested->block_size = TFTP_RFC1350_BLOCK_SIZE;
+        }
+    } else if (requested->block_size < fs->max_options.block_size) {
+        if (requested->block_size > fs->max_options.block_size / 2) {
+            requested->block_size = fs->max_options.block_size;
+        } else {
+            requested->block_size *= 2;
+        }
+    } else if (requested->window_size < fs->max_options.window_size) {
+        requested->window_size++;
+    }
+    rtems_mutex_unlock (&fs->tftp_mutex);
+}
+
 /*
  * Close a TFTP stream
  */
@@ -499,6 +569,9 @@ static int rtems_tftp_close(
         rtems_set_errno_and_return_minus_one (EIO);
 
     releaseStream (fs, iop->data0);
+    if (fs->flags & TFTPFS_ADAPTIVE) {
+        rtems_tftp_adapt_options (fs, tp);
+    }
     e = tftp_close (tp);
     if (e)
         rtems_set_errno_and_return_minus_one (e);
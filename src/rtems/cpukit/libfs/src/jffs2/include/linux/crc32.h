@@ -1,9 +1,9 @@
 #ifndef CRC32_H
 #define CRC32_H
 
-#include <zlib.h>
+#include <rtems/crc.h>
 
 #undef crc32
-#define crc32(val, s, len) (crc32_z(val ^ 0xffffffff, (unsigned char *)s, len) ^ 0xffffffff)
+#define crc32(val, s, len) _CRC32_Sequence_update(val, s, len)
 
 #endif
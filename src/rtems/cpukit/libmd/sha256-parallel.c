@@ -0,0 +1,365 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPISHA256Parallel
+ *
+ * @brief This source file contains the implementation of
+ *   rtems_sha256_parallel().
+ */
+
+/*
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/sha256parallel.h>
+#include <rtems/score/atomic.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+typedef struct {
+  rtems_sha256_parallel_job *job;
+  int                        fd;
+  size_t                     offset;
+  SHA256_CTX                 ctx;
+  unsigned char              buf[ RTEMS_SHA256_PARALLEL_CHUNK_SIZE ];
+} sha256_parallel_lane;
+
+typedef struct sha256_parallel_context sha256_parallel_context;
+
+typedef struct {
+  sha256_parallel_context *parallel;
+  sha256_parallel_lane     lanes[ SHA256_MB_LANES ];
+} sha256_parallel_worker;
+
+struct sha256_parallel_context {
+  rtems_sha256_parallel_job *jobs;
+  size_t                     job_count;
+  Atomic_Uintptr             next_job;
+  Atomic_Uint                active_workers;
+  rtems_id                   caller;
+  sha256_parallel_worker     workers[ RTEMS_ZERO_LENGTH_ARRAY ];
+};
+
+static bool sha256_parallel_start_job(
+  sha256_parallel_context *ctx,
+  sha256_parallel_lane    *lane
+)
+{
+  rtems_sha256_parallel_job *job;
+  uintptr_t                  index;
+
+  index = _Atomic_Fetch_add_uintptr(
+    &ctx->next_job,
+    1,
+    ATOMIC_ORDER_RELAXED
+  );
+
+  if ( index >= ctx->job_count ) {
+    return false;
+  }
+
+  job = &ctx->jobs[ index ];
+  job->error = 0;
+  lane->job = job;
+  lane->fd = -1;
+  lane->offset = 0;
+  SHA256_Init( &lane->ctx );
+
+  if ( job->path != NULL ) {
+    lane->fd = open( job->path, O_RDONLY );
+
+    if ( lane->fd < 0 ) {
+      job->error = errno;
+    }
+  }
+
+  return true;
+}
+
+static void sha256_parallel_finish_job( sha256_parallel_lane *lane )
+{
+  rtems_sha256_parallel_job *job;
+
+  job = lane->job;
+
+  if ( lane->fd >= 0 ) {
+    (void) close( lane->fd );
+  }
+
+  if ( job->error == 0 ) {
+    SHA256_Final( job->digest, &lane->ctx );
+  } else {
+    memset( job->digest, 0, sizeof( job->digest ) );
+  }
+
+  lane->job = NULL;
+}
+
+/*
+ * Gets the next chunk of the job of the lane.  Returns zero, if the job is
+ * done.
+ */
+static size_t sha256_parallel_next_chunk(
+  sha256_parallel_lane *lane,
+  const void          **chunk
+)
+{
+  rtems_sha256_parallel_job *job;
+  ssize_t                    n;
+
+  job = lane->job;
+
+  if ( job->error != 0 ) {
+    return 0;
+  }
+
+  if ( job->path == NULL ) {
+    size_t left;
+
+    left = job->size - lane->offset;
+
+    if ( left > RTEMS_SHA256_PARALLEL_CHUNK_SIZE ) {
+      left = RTEMS_SHA256_PARALLEL_CHUNK_SIZE;
+    }
+
+    *chunk = (const unsigned char *) job->data + lane->offset;
+    lane->offset += left;
+    return left;
+  }
+
+  n = read( lane->fd, lane->buf, sizeof( lane->buf ) );
+
+  if ( n < 0 ) {
+    job->error = errno;
+    return 0;
+  }
+
+  *chunk = lane->buf;
+  return (size_t) n;
+}
+
+static void sha256_parallel_work( sha256_parallel_worker *worker )
+{
+  sha256_parallel_context *ctx;
+  bool                     more_jobs;
+
+  ctx = worker->parallel;
+  more_jobs = true;
+
+  while ( true ) {
+    SHA256_CTX *hash[ SHA256_MB_LANES ];
+    const void *in[ SHA256_MB_LANES ];
+    size_t      len[ SHA256_MB_LANES ];
+    size_t      n;
+    size_t      i;
+
+    n = 0;
+
+    for ( i = 0; i < SHA256_MB_LANES; ++i ) {
+      sha256_parallel_lane *lane;
+      size_t                size;
+
+      lane = &worker->lanes[ i ];
+
+      while ( true ) {
+        if ( lane->job == NULL ) {
+          if ( !more_jobs || !sha256_parallel_start_job( ctx, lane ) ) {
+            more_jobs = false;
+            break;
+          }
+        }
+
+        size = sha256_parallel_next_chunk( lane, &in[ n ] );
+
+        if ( size > 0 ) {
+          hash[ n ] = &lane->ctx;
+          len[ n ] = size;
+          ++n;
+          break;
+        }
+
+        sha256_parallel_finish_job( lane );
+      }
+    }
+
+    if ( n == 0 ) {
+      break;
+    }
+
+    SHA256_Update_multi( hash, in, len, n );
+  }
+}
+
+static void sha256_parallel_worker_done( sha256_parallel_context *ctx )
+{
+  unsigned int active;
+
+  active = _Atomic_Fetch_sub_uint(
+    &ctx->active_workers,
+    1,
+    ATOMIC_ORDER_ACQ_REL
+  );
+
+  if ( active == 1 ) {
+    (void) rtems_event_transient_send( ctx->caller );
+  }
+}
+
+static rtems_task sha256_parallel_task( rtems_task_argument arg )
+{
+  sha256_parallel_worker  *worker;
+  sha256_parallel_context *ctx;
+
+  worker = (sha256_parallel_worker *) arg;
+  ctx = worker->parallel;
+  sha256_parallel_work( worker );
+  sha256_parallel_worker_done( ctx );
+  rtems_task_exit();
+}
+
+static uint32_t sha256_parallel_processor_count( void )
+{
+  rtems_status_code sc;
+  rtems_id          scheduler_id;
+  cpu_set_t         cpuset;
+  int               count;
+
+  sc = rtems_task_get_scheduler( RTEMS_SELF, &scheduler_id );
+
+  if ( sc != RTEMS_SUCCESSFUL ) {
+    return 1;
+  }
+
+  sc = rtems_scheduler_get_processor_set(
+    scheduler_id,
+    sizeof( cpuset ),
+    &cpuset
+  );
+
+  if ( sc != RTEMS_SUCCESSFUL ) {
+    return 1;
+  }
+
+  count = CPU_COUNT( &cpuset );
+  return count > 0 ? (uint32_t) count : 1;
+}
+
+rtems_status_code rtems_sha256_parallel(
+  rtems_sha256_parallel_job *jobs,
+  size_t                     job_count,
+  uint32_t                   worker_count
+)
+{
+  sha256_parallel_context *ctx;
+  rtems_task_priority      priority;
+  rtems_status_code        sc;
+  uint32_t                 i;
+
+  if ( worker_count == 0 ) {
+    worker_count = sha256_parallel_processor_count();
+  }
+
+  /* Each worker should get at least one job */
+  if ( worker_count > job_count ) {
+    worker_count = job_count > 0 ? (uint32_t) job_count : 1;
+  }
+
+  ctx = calloc(
+    1,
+    sizeof( *ctx ) + worker_count * sizeof( ctx->workers[ 0 ] )
+  );
+
+  if ( ctx == NULL ) {
+    return RTEMS_NO_MEMORY;
+  }
+
+  ctx->jobs = jobs;
+  ctx->job_count = job_count;
+  ctx->caller = rtems_task_self();
+  _Atomic_Init_uintptr( &ctx->next_job, 0 );
+  _Atomic_Init_uint( &ctx->active_workers, 1 );
+
+  for ( i = 0; i < worker_count; ++i ) {
+    ctx->workers[ i ].parallel = ctx;
+  }
+
+  (void) rtems_task_set_priority(
+    RTEMS_SELF,
+    RTEMS_CURRENT_PRIORITY,
+    &priority
+  );
+
+  for ( i = 1; i < worker_count; ++i ) {
+    rtems_id id;
+
+    sc = rtems_task_create(
+      rtems_build_name( 'S', 'H', 'A', 'P' ),
+      priority,
+      2 * RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &id
+    );
+
+    if ( sc != RTEMS_SUCCESSFUL ) {
+      break;
+    }
+
+    _Atomic_Fetch_add_uint( &ctx->active_workers, 1, ATOMIC_ORDER_RELAXED );
+    sc = rtems_task_start(
+      id,
+      sha256_parallel_task,
+      (rtems_task_argument) &ctx->workers[ i ]
+    );
+
+    if ( sc != RTEMS_SUCCESSFUL ) {
+      _Atomic_Fetch_sub_uint( &ctx->active_workers, 1, ATOMIC_ORDER_RELAXED );
+      (void) rtems_task_delete( id );
+      break;
+    }
+  }
+
+  sha256_parallel_work( &ctx->workers[ 0 ] );
+
+  /* Wait for the other workers, the last one sends the transient event */
+  if (
+    _Atomic_Fetch_sub_uint( &ctx->active_workers, 1, ATOMIC_ORDER_ACQ_REL ) != 1
+  ) {
+    (void) rtems_event_transient_receive( RTEMS_WAIT, RTEMS_NO_TIMEOUT );
+  }
+
+  free( ctx );
+  return RTEMS_SUCCESSFUL;
+}
@@ -279,6 +279,201 @@ SHA256_Update(SHA256_CTX * ctx, const void *in, size_t len)
 	memcpy(ctx->buf, src, len);
 }
 
+#ifdef __rtems__
+/* Multi-buffer round function, the lanes are processed in lockstep */
+#define RNDm(S, W, i, ii)					\
+	for (l = 0; l < SHA256_MB_LANES; l++) {			\
+		RND(S[(64 - i) % 8][l], S[(65 - i) % 8][l],	\
+		    S[(66 - i) % 8][l], S[(67 - i) % 8][l],	\
+		    S[(68 - i) % 8][l], S[(69 - i) % 8][l],	\
+		    S[(70 - i) % 8][l], S[(71 - i) % 8][l],	\
+		    W[i + ii][l] + K[i + ii])			\
+	}
+
+/* Multi-buffer message schedule computation */
+#define MSCHm(W, ii, i)						\
+	for (l = 0; l < SHA256_MB_LANES; l++) {			\
+		W[i + ii + 16][l] = s1(W[i + ii + 14][l]) +	\
+		    W[i + ii + 9][l] + s0(W[i + ii + 1][l]) +	\
+		    W[i + ii][l];				\
+	}
+
+/*
+ * SHA256 multi-buffer block compression function.  The states of
+ * SHA256_MB_LANES independent streams are transformed via one input block of
+ * each stream.  The working variables and the message schedule are stored
+ * lane by lane, so that the independent lanes of one round are next to each
+ * other.  This gives the processor independent instructions to overlap and
+ * enables the compiler to use SIMD instructions.
+ */
+static void
+SHA256_Transform_multi(uint32_t * const state[SHA256_MB_LANES],
+    const unsigned char * const block[SHA256_MB_LANES])
+{
+	uint32_t W[64][SHA256_MB_LANES];
+	uint32_t S[8][SHA256_MB_LANES];
+	int i;
+	int j;
+	int l;
+
+	/* 1. Prepare the first part of the message schedule W. */
+	for (j = 0; j < 16; j++)
+		for (l = 0; l < SHA256_MB_LANES; l++)
+			W[j][l] = be32dec(block[l] + j * 4);
+
+	/* 2. Initialize working variables. */
+	for (j = 0; j < 8; j++)
+		for (l = 0; l < SHA256_MB_LANES; l++)
+			S[j][l] = state[l][j];
+
+	/* 3. Mix. */
+	for (i = 0; i < 64; i += 16) {
+		RNDm(S, W, 0, i);
+		RNDm(S, W, 1, i);
+		RNDm(S, W, 2, i);
+		RNDm(S, W, 3, i);
+		RNDm(S, W, 4, i);
+		RNDm(S, W, 5, i);
+		RNDm(S, W, 6, i);
+		RNDm(S, W, 7, i);
+		RNDm(S, W, 8, i);
+		RNDm(S, W, 9, i);
+		RNDm(S, W, 10, i);
+		RNDm(S, W, 11, i);
+		RNDm(S, W, 12, i);
+		RNDm(S, W, 13, i);
+		RNDm(S, W, 14, i);
+		RNDm(S, W, 15, i);
+
+		if (i == 48)
+			break;
+		MSCHm(W, 0, i);
+		MSCHm(W, 1, i);
+		MSCHm(W, 2, i);
+		MSCHm(W, 3, i);
+		MSCHm(W, 4, i);
+		MSCHm(W, 5, i);
+		MSCHm(W, 6, i);
+		MSCHm(W, 7, i);
+		MSCHm(W, 8, i);
+		MSCHm(W, 9, i);
+		MSCHm(W, 10, i);
+		MSCHm(W, 11, i);
+		MSCHm(W, 12, i);
+		MSCHm(W, 13, i);
+		MSCHm(W, 14, i);
+		MSCHm(W, 15, i);
+	}
+
+	/* 4. Mix local working variables into global state */
+	for (j = 0; j < 8; j++)
+		for (l = 0; l < SHA256_MB_LANES; l++)
+			state[l][j] += S[j][l];
+}
+
+/*
+ * Add bytes into up to SHA256_MB_LANES hashes.  The complete blocks of the
+ * lanes are processed in lockstep by the multi-buffer transform as long as
+ * at least two lanes have complete blocks.  Lanes without a complete block
+ * work on a scratch state.
+ */
+static void
+SHA256_Update_lanes(SHA256_CTX * const ctx[], const void * const in[],
+    const size_t len[], size_t n)
+{
+	uint32_t scratch[8];
+	uint32_t *state[SHA256_MB_LANES];
+	const unsigned char *block[SHA256_MB_LANES];
+	const unsigned char *src[SHA256_MB_LANES];
+	size_t left[SHA256_MB_LANES];
+	size_t active;
+	size_t l;
+
+	for (l = 0; l < n; l++) {
+		uint32_t r;
+		size_t m;
+
+		src[l] = in[l];
+		left[l] = len[l];
+
+		/* Complete a partial block of previous updates first */
+		r = (ctx[l]->count >> 3) & 0x3f;
+		if (r != 0) {
+			m = 64 - r;
+			if (m > left[l])
+				m = left[l];
+			SHA256_Update(ctx[l], src[l], m);
+			src[l] += m;
+			left[l] -= m;
+		}
+
+		/* Account for the complete blocks */
+		ctx[l]->count += (uint64_t)(left[l] & ~(size_t)0x3f) << 3;
+	}
+
+	while (1) {
+		active = 0;
+
+		for (l = 0; l < SHA256_MB_LANES; l++) {
+			if (l < n && left[l] >= 64) {
+				state[l] = ctx[l]->state;
+				block[l] = src[l];
+				src[l] += 64;
+				left[l] -= 64;
+				active++;
+			} else {
+				state[l] = scratch;
+				block[l] = PAD;
+			}
+		}
+
+		if (active == 0)
+			break;
+
+		if (active == 1) {
+			/* Finish the last lane with the single-buffer transform */
+			for (l = 0; state[l] == scratch; l++)
+				;
+			SHA256_Transform(state[l], block[l]);
+			while (left[l] >= 64) {
+				SHA256_Transform(state[l], src[l]);
+				src[l] += 64;
+				left[l] -= 64;
+			}
+		} else {
+			SHA256_Transform_multi(state, block);
+		}
+	}
+
+	/* Copy left over data into the buffers */
+	for (l = 0; l < n; l++) {
+		if (left[l] > 0) {
+			memcpy(ctx[l]->buf, src[l], left[l]);
+			ctx[l]->count += left[l] << 3;
+		}
+	}
+}
+
+/*
+ * Add bytes into several independent hashes.  This is equivalent to
+ * SHA256_Update(ctx[i], in[i], len[i]) for each i < n.
+ */
+void
+SHA256_Update_multi(SHA256_CTX * const ctx[], const void * const in[],
+    const size_t len[], size_t n)
+{
+	size_t i;
+	size_t m;
+
+	for (i = 0; i < n; i += m) {
+		m = n - i;
+		if (m > SHA256_MB_LANES)
+			m = SHA256_MB_LANES;
+		SHA256_Update_lanes(&ctx[i], &in[i], &len[i], m);
+	}
+}
+#endif /* __rtems__ */
+
 /*
  * SHA-256 finalization.  Pads the input data, exports the hash value,
  * and clears the context state.
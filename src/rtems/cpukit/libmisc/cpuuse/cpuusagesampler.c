@@ -0,0 +1,483 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPICPUUsageSampler
+ *
+ * @brief This source file contains the implementation of the
+ *   @ref RTEMSAPICPUUsageSampler.
+ */
+
+/*
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <rtems/cpuusesampler.h>
+#include <rtems/thread.h>
+#include <rtems/score/atomic.h>
+#include <rtems/score/percpu.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems/score/todimpl.h>
+
+/*
+ * A sample slot is followed by the thread table and the processor busy time
+ * table.  While the sampler writes to a slot, the sequence is odd.  A
+ * published slot of sample number N has the sequence 2 * N.
+ */
+typedef struct {
+  Atomic_Ulong sequence;
+  uint64_t     uptime_ns;
+  uint64_t     interval_ns;
+  uint32_t     thread_count;
+  uint32_t     threads_not_recorded;
+} CPU_usage_Sample_slot;
+
+struct rtems_cpu_usage_sampler {
+  rtems_mutex               mutex;
+  rtems_binary_semaphore    wakeup;
+  rtems_binary_semaphore    stopped;
+  rtems_id                  task;
+  rtems_interval            period;
+  uint32_t                  maximum_threads;
+  uint32_t                  processor_maximum;
+  uint32_t                  history;
+  size_t                    slot_size;
+  char                     *slots;
+  Atomic_Ulong              latest;
+  unsigned long             number;
+  Timestamp_Control         uptime;
+
+  /*
+   * The CPU time used by the threads recorded by the previous sample and the
+   * current sample.  The thread iteration visits the threads in ascending
+   * identifier order, so the previous value of a thread is found by a cursor
+   * which moves forward only.
+   */
+  rtems_id                 *previous_ids;
+  Timestamp_Control        *previous_used;
+  uint32_t                  previous_count;
+  uint32_t                  cursor;
+  rtems_id                 *current_ids;
+  Timestamp_Control        *current_used;
+  CPU_usage_Sample_slot    *slot;
+  uint64_t                 *idle_ns;
+};
+
+static CPU_usage_Sample_slot *CPU_usage_Sampler_get_slot(
+  const rtems_cpu_usage_sampler *sampler,
+  unsigned long                  number
+)
+{
+  return (CPU_usage_Sample_slot *)
+    ( sampler->slots + ( number % sampler->history ) * sampler->slot_size );
+}
+
+static rtems_cpu_usage_thread_sample *CPU_usage_Sampler_get_threads(
+  const CPU_usage_Sample_slot *slot
+)
+{
+  return (rtems_cpu_usage_thread_sample *) RTEMS_DECONST(
+    CPU_usage_Sample_slot *,
+    slot + 1
+  );
+}
+
+static uint64_t *CPU_usage_Sampler_get_busy(
+  const rtems_cpu_usage_sampler *sampler,
+  const CPU_usage_Sample_slot   *slot
+)
+{
+  return (uint64_t *)
+    &CPU_usage_Sampler_get_threads( slot )[ sampler->maximum_threads ];
+}
+
+static Timestamp_Control CPU_usage_Sampler_get_previous(
+  rtems_cpu_usage_sampler *sampler,
+  rtems_id                 id
+)
+{
+  uint32_t cursor;
+
+  cursor = sampler->cursor;
+
+  while (
+    cursor < sampler->previous_count && sampler->previous_ids[ cursor ] < id
+  ) {
+    ++cursor;
+  }
+
+  sampler->cursor = cursor;
+
+  if (
+    cursor < sampler->previous_count && sampler->previous_ids[ cursor ] == id
+  ) {
+    return sampler->previous_used[ cursor ];
+  }
+
+  return 0;
+}
+
+static bool CPU_usage_Sampler_visit( Thread_Control *the_thread, void *arg )
+{
+  rtems_cpu_usage_sampler *sampler;
+  CPU_usage_Sample_slot   *slot;
+  rtems_id                 id;
+  Timestamp_Control        used;
+  Timestamp_Control        previous;
+  Timestamp_Control        delta;
+  uint64_t                 delta_ns;
+
+  sampler = arg;
+  slot = sampler->slot;
+  id = the_thread->Object.id;
+  used = _Thread_Get_CPU_time_used( the_thread );
+  previous = CPU_usage_Sampler_get_previous( sampler, id );
+
+  /*
+   * A thread identifier may be reused by a thread created after the previous
+   * sample, in this case the CPU time used may be less than the previous
+   * value.
+   */
+  if ( used >= previous ) {
+    _Timestamp_Subtract( &previous, &used, &delta );
+  } else {
+    delta = used;
+  }
+
+  delta_ns = _Timestamp_Get_as_nanoseconds( &delta );
+
+  if ( the_thread->is_idle ) {
+    sampler->idle_ns[ _Per_CPU_Get_index( _Thread_Get_CPU( the_thread ) ) ] +=
+      delta_ns;
+  }
+
+  if ( slot->thread_count < sampler->maximum_threads ) {
+    rtems_cpu_usage_thread_sample *thread_sample;
+    uint32_t                       index;
+
+    index = slot->thread_count;
+    sampler->current_ids[ index ] = id;
+    sampler->current_used[ index ] = used;
+    thread_sample = &CPU_usage_Sampler_get_threads( slot )[ index ];
+    thread_sample->id = id;
+    thread_sample->used_ns = delta_ns;
+    slot->thread_count = index + 1;
+  } else {
+    ++slot->threads_not_recorded;
+  }
+
+  return false;
+}
+
+static void CPU_usage_Sampler_record(
+  rtems_cpu_usage_sampler *sampler,
+  unsigned long            number
+)
+{
+  CPU_usage_Sample_slot *slot;
+  Timestamp_Control      uptime;
+  Timestamp_Control      interval;
+  uint64_t              *busy_ns;
+  rtems_id              *ids;
+  Timestamp_Control     *used;
+  uint32_t               cpu_index;
+
+  slot = CPU_usage_Sampler_get_slot( sampler, number );
+
+  if ( number > 0 ) {
+    _Atomic_Store_ulong(
+      &slot->sequence,
+      2 * number - 1,
+      ATOMIC_ORDER_RELAXED
+    );
+    _Atomic_Fence( ATOMIC_ORDER_RELEASE );
+  }
+
+  sampler->slot = slot;
+  sampler->cursor = 0;
+  slot->thread_count = 0;
+  slot->threads_not_recorded = 0;
+  memset(
+    sampler->idle_ns,
+    0,
+    sampler->processor_maximum * sizeof( *sampler->idle_ns )
+  );
+
+  _TOD_Get_uptime( &uptime );
+  rtems_task_iterate( CPU_usage_Sampler_visit, sampler );
+
+  _Timestamp_Subtract( &sampler->uptime, &uptime, &interval );
+  sampler->uptime = uptime;
+  slot->uptime_ns = _Timestamp_Get_as_nanoseconds( &uptime );
+  slot->interval_ns = _Timestamp_Get_as_nanoseconds( &interval );
+  busy_ns = CPU_usage_Sampler_get_busy( sampler, slot );
+
+  for ( cpu_index = 0; cpu_index < sampler->processor_maximum; ++cpu_index ) {
+    uint64_t idle_ns;
+
+    idle_ns = sampler->idle_ns[ cpu_index ];
+
+    if ( slot->interval_ns > idle_ns ) {
+      busy_ns[ cpu_index ] = slot->interval_ns - idle_ns;
+    } else {
+      busy_ns[ cpu_index ] = 0;
+    }
+  }
+
+  ids = sampler->previous_ids;
+  sampler->previous_ids = sampler->current_ids;
+  sampler->current_ids = ids;
+  used = sampler->previous_used;
+  sampler->previous_used = sampler->current_used;
+  sampler->current_used = used;
+  sampler->previous_count = slot->thread_count;
+
+  if ( number > 0 ) {
+    _Atomic_Store_ulong( &slot->sequence, 2 * number, ATOMIC_ORDER_RELEASE );
+    _Atomic_Store_ulong( &sampler->latest, number, ATOMIC_ORDER_RELEASE );
+  }
+}
+
+void rtems_cpu_usage_sampler_take_sample( rtems_cpu_usage_sampler *sampler )
+{
+  rtems_mutex_lock( &sampler->mutex );
+  ++sampler->number;
+  CPU_usage_Sampler_record( sampler, sampler->number );
+  rtems_mutex_unlock( &sampler->mutex );
+}
+
+rtems_status_code rtems_cpu_usage_sampler_get_sample(
+  const rtems_cpu_usage_sampler *sampler,
+  uint32_t                       age,
+  rtems_cpu_usage_sample        *sample
+)
+{
+  if ( age >= sampler->history - 1 ) {
+    return RTEMS_INVALID_NUMBER;
+  }
+
+  while ( true ) {
+    const CPU_usage_Sample_slot *slot;
+    unsigned long                latest;
+    unsigned long                number;
+    unsigned long                sequence;
+    uint32_t                     thread_count;
+    uint32_t                     processor_count;
+
+    latest = _Atomic_Load_ulong( &sampler->latest, ATOMIC_ORDER_ACQUIRE );
+
+    if ( latest <= age ) {
+      return RTEMS_UNSATISFIED;
+    }
+
+    number = latest - age;
+    slot = CPU_usage_Sampler_get_slot( sampler, number );
+    sequence = _Atomic_Load_ulong( &slot->sequence, ATOMIC_ORDER_ACQUIRE );
+
+    if ( sequence != 2 * number ) {
+      continue;
+    }
+
+    sample->number = number;
+    sample->uptime_ns = slot->uptime_ns;
+    sample->interval_ns = slot->interval_ns;
+    sample->threads_not_recorded = slot->threads_not_recorded;
+
+    thread_count = slot->thread_count;
+
+    if ( thread_count > sample->thread_capacity ) {
+      thread_count = sample->thread_capacity;
+    }
+
+    sample->thread_count = thread_count;
+    memcpy(
+      sample->threads,
+      CPU_usage_Sampler_get_threads( slot ),
+      thread_count * sizeof( *sample->threads )
+    );
+
+    processor_count = sampler->processor_maximum;
+
+    if ( processor_count > sample->processor_capacity ) {
+      processor_count = sample->processor_capacity;
+    }
+
+    sample->processor_count = processor_count;
+    memcpy(
+      sample->processor_busy_ns,
+      CPU_usage_Sampler_get_busy( sampler, slot ),
+      processor_count * sizeof( *sample->processor_busy_ns )
+    );
+
+    _Atomic_Fence( ATOMIC_ORDER_ACQUIRE );
+
+    if (
+      _Atomic_Load_ulong( &slot->sequence, ATOMIC_ORDER_RELAXED ) == sequence
+    ) {
+      return RTEMS_SUCCESSFUL;
+    }
+  }
+}
+
+static void CPU_usage_Sampler_task( rtems_task_argument arg )
+{
+  rtems_cpu_usage_sampler *sampler;
+
+  sampler = (rtems_cpu_usage_sampler *) arg;
+
+  while (
+    rtems_binary_semaphore_wait_timed_ticks(
+      &sampler->wakeup,
+      sampler->period
+    ) != 0
+  ) {
+    rtems_cpu_usage_sampler_take_sample( sampler );
+  }
+
+  rtems_binary_semaphore_post( &sampler->stopped );
+  rtems_task_exit();
+}
+
+static void CPU_usage_Sampler_destroy( rtems_cpu_usage_sampler *sampler )
+{
+  rtems_binary_semaphore_destroy( &sampler->stopped );
+  rtems_binary_semaphore_destroy( &sampler->wakeup );
+  rtems_mutex_destroy( &sampler->mutex );
+  free( sampler );
+}
+
+rtems_status_code rtems_cpu_usage_sampler_create(
+  const rtems_cpu_usage_sampler_config *config,
+  rtems_cpu_usage_sampler             **sampler_p
+)
+{
+  rtems_cpu_usage_sampler *sampler;
+  uint32_t                 processor_maximum;
+  size_t                   slot_size;
+  size_t                   used_size;
+  size_t                   idle_size;
+  size_t                   ids_size;
+  size_t                   size;
+  char                    *data;
+
+  if ( config->history < 2 || config->maximum_threads == 0 ) {
+    return RTEMS_INVALID_NUMBER;
+  }
+
+  processor_maximum = rtems_scheduler_get_processor_maximum();
+  slot_size = sizeof( CPU_usage_Sample_slot ) +
+    config->maximum_threads * sizeof( rtems_cpu_usage_thread_sample ) +
+    processor_maximum * sizeof( uint64_t );
+  slot_size = RTEMS_ALIGN_UP( slot_size, sizeof( uint64_t ) );
+  used_size = config->maximum_threads * sizeof( Timestamp_Control );
+  idle_size = processor_maximum * sizeof( uint64_t );
+  ids_size = config->maximum_threads * sizeof( rtems_id );
+  size = RTEMS_ALIGN_UP( sizeof( *sampler ), sizeof( uint64_t ) ) +
+    config->history * slot_size + 2 * used_size + idle_size + 2 * ids_size;
+
+  sampler = calloc( 1, size );
+
+  if ( sampler == NULL ) {
+    return RTEMS_NO_MEMORY;
+  }
+
+  data = (char *) sampler +
+    RTEMS_ALIGN_UP( sizeof( *sampler ), sizeof( uint64_t ) );
+  sampler->slots = data;
+  data += config->history * slot_size;
+  sampler->previous_used = (Timestamp_Control *) data;
+  data += used_size;
+  sampler->current_used = (Timestamp_Control *) data;
+  data += used_size;
+  sampler->idle_ns = (uint64_t *) data;
+  data += idle_size;
+  sampler->previous_ids = (rtems_id *) data;
+  data += ids_size;
+  sampler->current_ids = (rtems_id *) data;
+
+  sampler->period = config->period;
+  sampler->maximum_threads = config->maximum_threads;
+  sampler->processor_maximum = processor_maximum;
+  sampler->history = config->history;
+  sampler->slot_size = slot_size;
+  _Atomic_Init_ulong( &sampler->latest, 0 );
+  rtems_mutex_init( &sampler->mutex, "CPU Usage Sampler" );
+  rtems_binary_semaphore_init( &sampler->wakeup, "CPU Usage Sampler Wakeup" );
+  rtems_binary_semaphore_init( &sampler->stopped, "CPU Usage Sampler Stop" );
+
+  /* Record the baseline which is not published */
+  _TOD_Get_uptime( &sampler->uptime );
+  CPU_usage_Sampler_record( sampler, 0 );
+
+  if ( sampler->period > 0 ) {
+    rtems_status_code sc;
+
+    sc = rtems_task_create(
+      rtems_build_name( 'C', 'P', 'U', 'S' ),
+      config->priority,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &sampler->task
+    );
+
+    if ( sc != RTEMS_SUCCESSFUL ) {
+      CPU_usage_Sampler_destroy( sampler );
+      return sc;
+    }
+
+    sc = rtems_task_start(
+      sampler->task,
+      CPU_usage_Sampler_task,
+      (rtems_task_argument) sampler
+    );
+
+    if ( sc != RTEMS_SUCCESSFUL ) {
+      (void) rtems_task_delete( sampler->task );
+      CPU_usage_Sampler_destroy( sampler );
+      return sc;
+    }
+  }
+
+  *sampler_p = sampler;
+  return RTEMS_SUCCESSFUL;
+}
+
+void rtems_cpu_usage_sampler_delete( rtems_cpu_usage_sampler *sampler )
+{
+  if ( sampler->period > 0 ) {
+    rtems_binary_semaphore_post( &sampler->wakeup );
+    rtems_binary_semaphore_wait( &sampler->stopped );
+  }
+
+  CPU_usage_Sampler_destroy( sampler );
+}
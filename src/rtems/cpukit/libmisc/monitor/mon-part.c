@@ -38,7 +38,7 @@
 #include <rtems.h>
 #include <rtems/monitor.h>
 #include <rtems/rtems/attrimpl.h>
-#include <rtems/rtems/partdata.h>
+#include <rtems/rtems/partimpl.h>
 #include <stdio.h>
 #include <string.h>    /* memcpy() */
 
@@ -55,7 +55,7 @@ rtems_monitor_part_canonical(
     canonical_part->length = (uint32_t) ( (uintptr_t)
         rtems_part->limit_address + 1 - (uintptr_t) rtems_part->base_address );
     canonical_part->buf_size = rtems_part->buffer_size;
-    canonical_part->used_blocks = rtems_part->number_of_used_blocks;
+    canonical_part->used_blocks = _Partition_Get_used_blocks( rtems_part );
 }
 
 
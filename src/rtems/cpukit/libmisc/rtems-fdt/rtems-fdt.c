@@ -47,12 +47,40 @@ typedef struct
   int         offset;       /**< The offset of the item in the FDT blob. */
 } rtems_fdt_index_entry;
 
+/**
+ * A phandle lookup entry.
+ */
+typedef struct
+{
+  uint32_t    phandle;      /**< The phandle of the node. */
+  int         offset;       /**< The offset of the node in the FDT blob. */
+} rtems_fdt_phandle_entry;
+
+/**
+ * A compatible lookup entry. There is an entry for each string in the
+ * 'compatible' property of a node.
+ */
+typedef struct
+{
+  const char* compatible;   /**< The compatible string in the FDT blob. */
+  int         offset;       /**< The offset of the node in the FDT blob. */
+} rtems_fdt_compatible_entry;
+
 typedef struct
 {
   int                    num_entries;    /**< The number of entries in this index. */
   rtems_fdt_index_entry* entries;        /**< An ordered set of entries which we
                                           *  can binary search. */
+  rtems_fdt_index_entry* offsets;        /**< The entries ordered by offset. */
   char*                  names;          /**< Storage allocated for all the path names. */
+  bool                   lookups;        /**< The phandle and compatible
+                                          *  entries are available. */
+  int                    num_phandles;   /**< The number of phandle entries. */
+  rtems_fdt_phandle_entry* phandles;     /**< The phandle entries ordered by
+                                          *  phandle and offset. */
+  int                    num_compatibles; /**< The number of compatible entries. */
+  rtems_fdt_compatible_entry* compatibles; /**< The compatible entries ordered
+                                            *  by string and offset. */
 } rtems_fdt_index;
 
 
@@ -123,6 +151,142 @@ static int rtems_fdt_index_compare(const void* a, const void* b)
   return rtems_fdt_node_path_compare(e1->name, e2->name, 0);
 }
 
+/**
+ * Compare phandle entries
+ */
+static int rtems_fdt_phandle_compare(const void* a, const void* b)
+{
+  const rtems_fdt_phandle_entry* e1 = (const rtems_fdt_phandle_entry*) a;
+  const rtems_fdt_phandle_entry* e2 = (const rtems_fdt_phandle_entry*) b;
+  if (e1->phandle != e2->phandle)
+    return e1->phandle < e2->phandle ? -1 : 1;
+  return e1->offset - e2->offset;
+}
+
+/**
+ * Compare compatible entries
+ */
+static int rtems_fdt_compatible_compare(const void* a, const void* b)
+{
+  const rtems_fdt_compatible_entry* e1 = (const rtems_fdt_compatible_entry*) a;
+  const rtems_fdt_compatible_entry* e2 = (const rtems_fdt_compatible_entry*) b;
+  int cmp = strcmp(e1->compatible, e2->compatible);
+  if (cmp != 0)
+    return cmp;
+  return e1->offset - e2->offset;
+}
+
+/**
+ * Create the phandle and compatible lookup tables of an index. The tables
+ * cover all nodes including the root node. They are optional, if there is
+ * not enough memory the lookups fall back to walking the blob.
+ */
+static void
+rtems_fdt_init_lookup_index (rtems_fdt_index* index, const void* blob)
+{
+  rtems_fdt_phandle_entry*    phandles = NULL;
+  rtems_fdt_compatible_entry* compatibles = NULL;
+  int                         num_phandles = 0;
+  int                         num_compatibles = 0;
+  int                         pass;
+
+  /*
+   * The first pass counts the entries, the second pass populates them.
+   */
+  for (pass = 0; pass < 2; ++pass)
+  {
+    int depth = 0;
+    int offset = fdt_path_offset(blob, "/");
+
+    num_phandles = 0;
+    num_compatibles = 0;
+
+    while (offset >= 0 && depth >= 0)
+    {
+      uint32_t    phandle = fdt_get_phandle(blob, offset);
+      int         len = 0;
+      const char* compatible = fdt_getprop(blob, offset, "compatible", &len);
+
+      if (phandle != 0)
+      {
+        if (phandles)
+        {
+          phandles[num_phandles].phandle = phandle;
+          phandles[num_phandles].offset = offset;
+        }
+        ++num_phandles;
+      }
+
+      while (compatible && len > 0)
+      {
+        size_t slen = strnlen(compatible, len);
+        if (slen == (size_t) len)
+        {
+          /* Not terminated, the property is invalid. */
+          break;
+        }
+        if (compatibles)
+        {
+          compatibles[num_compatibles].compatible = compatible;
+          compatibles[num_compatibles].offset = offset;
+        }
+        ++num_compatibles;
+        compatible += slen + 1;
+        len -= slen + 1;
+      }
+
+      offset = fdt_next_node(blob, offset, &depth);
+    }
+
+    if (pass == 0)
+    {
+      if (num_phandles != 0)
+      {
+        phandles = rtems_calloc(num_phandles, sizeof(rtems_fdt_phandle_entry));
+      }
+      if (num_compatibles != 0)
+      {
+        compatibles = rtems_calloc(num_compatibles,
+                                   sizeof(rtems_fdt_compatible_entry));
+      }
+      if ((num_phandles != 0 && !phandles) ||
+          (num_compatibles != 0 && !compatibles))
+      {
+        free(phandles);
+        free(compatibles);
+        return;
+      }
+      if (!phandles && !compatibles)
+      {
+        /* Nothing to record, the tables are valid and empty. */
+        break;
+      }
+    }
+  }
+
+  if (num_phandles != 0)
+  {
+    qsort(phandles,
+          num_phandles,
+          sizeof(rtems_fdt_phandle_entry),
+          rtems_fdt_phandle_compare);
+  }
+
+  if (num_compatibles != 0)
+  {
+    qsort(compatibles,
+          num_compatibles,
+          sizeof(rtems_fdt_compatible_entry),
+          rtems_fdt_compatible_compare);
+  }
+
+  index->phandles = phandles;
+  index->num_phandles = num_phandles;
+  index->compatibles = compatibles;
+  index->num_compatibles = num_compatibles;
+  index->lookups = true;
+}
+
 /**
  * Create an index based on the contents of an FDT blob.
  */
@@ -130,6 +294,7 @@ static int
 rtems_fdt_init_index (rtems_fdt_handle* fdt, rtems_fdt_blob* blob)
 {
   rtems_fdt_index_entry* entries = NULL;
+  rtems_fdt_index_entry* offsets = NULL;
   int                    num_entries = 0;
   int                    entry = 0;
   size_t                 total_name_memory = 0;
@@ -142,6 +307,8 @@ rtems_fdt_init_index (rtems_fdt_handle* fdt, rtems_fdt_blob* blob)
   char*                  names = NULL;
   char*                  names_pos = NULL;
 
+  memset(&blob->index, 0, sizeof(blob->index));
+
   /*
    * Count the number of entries in the blob first.
    */
@@ -204,9 +371,17 @@ rtems_fdt_init_index (rtems_fdt_handle* fdt, rtems_fdt_blob* blob)
     return -RTEMS_FDT_ERR_NO_MEMORY;
   }
 
+  offsets = rtems_calloc(num_entries, sizeof(rtems_fdt_index_entry));
+  if (!offsets)
+  {
+    free(entries);
+    return -RTEMS_FDT_ERR_NO_MEMORY;
+  }
+
   names = rtems_calloc(1, total_name_memory);
   if (!names)
   {
+    free(offsets);
     free(entries);
     return -RTEMS_FDT_ERR_NO_MEMORY;
   }
@@ -251,13 +426,19 @@ rtems_fdt_init_index (rtems_fdt_handle* fdt, rtems_fdt_blob* blob)
     if (offset < 0)
     {
       free(entries);
+      free(offsets);
       free(names);
       return offset;
     }
   }
 
+  /*
+   * The nodes are visited in offset order, keep that order for the lookups
+   * by offset before sorting the entries by name.
+   */
   if (num_entries != 0)
   {
+    memcpy(offsets, entries, num_entries * sizeof(rtems_fdt_index_entry));
     qsort(entries,
           num_entries,
           sizeof(rtems_fdt_index_entry),
@@ -265,9 +446,12 @@ rtems_fdt_init_index (rtems_fdt_handle* fdt, rtems_fdt_blob* blob)
   }
 
   fdt->blob->index.entries = entries;
+  fdt->blob->index.offsets = offsets;
   fdt->blob->index.num_entries = num_entries;
   fdt->blob->index.names = names;
 
+  rtems_fdt_init_lookup_index(&fdt->blob->index, blob->blob);
+
   return 0;
 }
 
@@ -280,12 +464,23 @@ rtems_fdt_release_index (rtems_fdt_index* index)
   if (index->entries)
   {
     free(index->entries);
+    free(index->offsets);
     free(index->names);
 
     index->num_entries = 0;
     index->entries = NULL;
+    index->offsets = NULL;
     index->names = NULL;
   }
+
+  free(index->phandles);
+  free(index->compatibles);
+
+  index->lookups = false;
+  index->num_phandles = 0;
+  index->phandles = NULL;
+  index->num_compatibles = 0;
+  index->compatibles = NULL;
 }
 
 /**
@@ -361,12 +556,12 @@ rtems_fdt_index_find_name_by_offset(rtems_fdt_index* index,
   while (min < max)
   {
     int middle = (min + max) / 2;
-    if (offset < index->entries[middle].offset)
+    if (offset < index->offsets[middle].offset)
     {
       /* Look lower than here. */
       max = middle;
     }
-    else if (offset > index->entries[middle].offset)
+    else if (offset > index->offsets[middle].offset)
     {
       /* Look higher than here. */
       min = middle + 1;
@@ -374,7 +569,7 @@ rtems_fdt_index_find_name_by_offset(rtems_fdt_index* index,
     else
     {
       /* Found it. */
-      return index->entries[middle].name;
+      return index->offsets[middle].name;
     }
   }
 
@@ -382,6 +577,90 @@ rtems_fdt_index_find_name_by_offset(rtems_fdt_index* index,
   return NULL;
 }
 
+/**
+ * For a given phandle, find the offset of the first node with it.
+ */
+static int
+rtems_fdt_index_find_by_phandle(rtems_fdt_index* index,
+                                uint32_t         phandle)
+{
+  int min = 0;
+  int max = index->num_phandles;
+
+  if (phandle == 0 || phandle == (uint32_t) -1)
+  {
+    return -FDT_ERR_BADPHANDLE;
+  }
+
+  /*
+   * Binary search for the lowest entry with the phandle.
+   */
+  while (min < max)
+  {
+    int middle = (min + max) / 2;
+    if (index->phandles[middle].phandle < phandle)
+    {
+      /* Look higher than here. */
+      min = middle + 1;
+    }
+    else
+    {
+      /* Look lower than or at here. */
+      max = middle;
+    }
+  }
+
+  if (min < index->num_phandles && index->phandles[min].phandle == phandle)
+  {
+    return index->phandles[min].offset;
+  }
+
+  /* Didn't find it. */
+  return -FDT_ERR_NOTFOUND;
+}
+
+/**
+ * For a given compatible string, find the offset of the first node after
+ * the start offset which lists it.
+ */
+static int
+rtems_fdt_index_find_by_compatible(rtems_fdt_index* index,
+                                   int              startoffset,
+                                   const char*      compatible)
+{
+  int min = 0;
+  int max = index->num_compatibles;
+
+  /*
+   * Binary search for the lowest entry with the compatible string and an
+   * offset after the start offset.
+   */
+  while (min < max)
+  {
+    int middle = (min + max) / 2;
+    int cmp = strcmp(index->compatibles[middle].compatible, compatible);
+    if (cmp < 0 || (cmp == 0 && index->compatibles[middle].offset <= startoffset))
+    {
+      /* Look higher than here. */
+      min = middle + 1;
+    }
+    else
+    {
+      /* Look lower than or at here. */
+      max = middle;
+    }
+  }
+
+  if (min < index->num_compatibles &&
+      strcmp(index->compatibles[min].compatible, compatible) == 0)
+  {
+    return index->compatibles[min].offset;
+  }
+
+  /* Didn't find it. */
+  return -FDT_ERR_NOTFOUND;
+}
+
 void
 rtems_fdt_init_handle (rtems_fdt_handle* handle)
 {
@@ -911,7 +1190,7 @@ rtems_fdt_supernode_atdepth_offset (rtems_fdt_handle* handle,
 {
   if (!handle->blob)
     return -RTEMS_FDT_ERR_INVALID_HANDLE;
-  return fdt_supernode_atdepth_offset(handle,
+  return fdt_supernode_atdepth_offset(handle->blob->blob,
                                       nodeoffset,
                                       supernodedepth,
                                       nodedepth);
@@ -942,7 +1221,7 @@ rtems_fdt_node_offset_by_prop_value (rtems_fdt_handle* handle,
 {
   if (!handle->blob)
     return -RTEMS_FDT_ERR_INVALID_HANDLE;
-  return fdt_node_offset_by_prop_value (handle,
+  return fdt_node_offset_by_prop_value (handle->blob->blob,
                                         startoffset,
                                         propname,
                                         propval,
@@ -954,6 +1233,8 @@ rtems_fdt_node_offset_by_phandle (rtems_fdt_handle* handle, uint32_t phandle)
 {
   if (!handle->blob)
     return -RTEMS_FDT_ERR_INVALID_HANDLE;
+  if (handle->blob->index.lookups)
+    return rtems_fdt_index_find_by_phandle (&handle->blob->index, phandle);
   return fdt_node_offset_by_phandle (handle->blob->blob, phandle);
 }
 
@@ -964,7 +1245,7 @@ rtems_fdt_node_check_compatible (rtems_fdt_handle* handle,
 {
   if (!handle->blob)
     return -RTEMS_FDT_ERR_INVALID_HANDLE;
-  return fdt_node_check_compatible (handle, nodeoffset, compatible);
+  return fdt_node_check_compatible (handle->blob->blob, nodeoffset, compatible);
 }
 
 int
@@ -974,6 +1255,10 @@ rtems_fdt_node_offset_by_compatible (rtems_fdt_handle* handle,
 {
   if (!handle->blob)
     return -RTEMS_FDT_ERR_INVALID_HANDLE;
+  if (handle->blob->index.lookups)
+    return rtems_fdt_index_find_by_compatible (&handle->blob->index,
+                                               startoffset,
+                                               compatible);
   return fdt_node_offset_by_compatible (handle->blob->blob,
                                         startoffset,
                                         compatible);
@@ -0,0 +1,80 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ * @brief LATENCY Command Implementation
+ */
+
+/*
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <string.h>
+
+#include <rtems.h>
+#include <rtems/latency.h>
+#include <rtems/printer.h>
+#include <rtems/shell.h>
+#include "internal.h"
+
+static int rtems_shell_main_latency(
+  int   argc,
+  char *argv[]
+)
+{
+  rtems_printer printer;
+
+  /*
+   *  When invoked with no arguments, print the report.  With -r, the
+   *  histograms are reset after the report.
+   */
+  if ( argc == 1 || ( argc == 2 && !strcmp( argv[1], "-r" ) ) ) {
+    rtems_print_printer_fprintf(&printer, stdout);
+    rtems_latency_report(&printer);
+
+    if ( argc == 2 ) {
+      printf( "Resetting latency histograms\n" );
+      rtems_latency_reset();
+    }
+
+    return 0;
+  }
+
+  fprintf( stderr, "%s: [-r]\n", argv[0] );
+  return -1;
+}
+
+rtems_shell_cmd_t rtems_shell_LATENCY_Command = {
+  .name = "latency",
+  .usage = "[-r] print and optionally reset the latency histograms",
+  .topic = "rtems",
+  .command = rtems_shell_main_latency,
+  .alias = NULL,
+  .next = NULL
+};
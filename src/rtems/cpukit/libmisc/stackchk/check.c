@@ -180,6 +180,15 @@ static void Stack_check_Add_sanity_pattern( Stack_Control *stack )
   );
 }
 
+/*
+ *  Forget the known high water mark, the stack must be scanned again.
+ */
+static void Stack_check_Reset_high_water_mark( Stack_Control *stack )
+{
+  stack->high_water_mark = NULL;
+  stack->is_dirty = true;
+}
+
 static bool Stack_check_Is_sanity_pattern_valid( const Stack_Control *stack )
 {
   return memcmp(
@@ -201,6 +210,7 @@ bool rtems_stack_checker_create_extension(
 
   Stack_check_Dope_stack( &the_thread->Start.Initial_stack );
   Stack_check_Add_sanity_pattern( &the_thread->Start.Initial_stack );
+  Stack_check_Reset_high_water_mark( &the_thread->Start.Initial_stack );
 
   return true;
 }
@@ -247,6 +257,7 @@ void rtems_stack_checker_begin_extension( Thread_Control *executing )
     }
 
     Stack_check_Dope_stack( stack );
+    Stack_check_Reset_high_water_mark( stack );
   }
 
 #if defined(RTEMS_SMP)
@@ -338,6 +349,12 @@ void rtems_stack_checker_switch_extension(
   bool pattern_ok;
   const Stack_Control *stack;
 
+  /*
+   *  The thread ran since its last dispatch, so its stack usage may have
+   *  changed.  A usage report has to scan this stack again.
+   */
+  running->Start.Initial_stack.is_dirty = true;
+
   /*
    *  Check for an out of bounds stack pointer or an overwrite
    */
@@ -392,19 +409,31 @@ bool rtems_stack_checker_is_blown( void )
   return false;
 }
 
+/*
+ *  Check four words at once, so that the scan of large unused stack areas
+ *  needs only one branch per block.
+ */
+static inline bool Stack_check_Is_pattern_block( const uint32_t *p )
+{
+  return ( ( p[ 0 ] ^ U32_PATTERN ) | ( p[ 1 ] ^ U32_PATTERN ) |
+    ( p[ 2 ] ^ U32_PATTERN ) | ( p[ 3 ] ^ U32_PATTERN ) ) == 0;
+}
+
 /*
  * Stack_check_find_high_water_mark
+ *
+ * Only the area beyond the known high water mark is scanned, since the stack
+ * usage cannot shrink.  If no further usage is found, then the known high
+ * water mark is returned.
  */
 static inline void *Stack_check_Find_high_water_mark(
   const void *s,
-  size_t      n
+  size_t      n,
+  void       *known
 )
 {
-  const uint32_t   *base, *ebase;
-  uint32_t   length;
-
-  base = s;
-  length = n/4;
+  const uint32_t *low;
+  const uint32_t *high;
 
   #if ( CPU_STACK_GROWS_UP == TRUE )
     /*
@@ -412,26 +441,96 @@ static inline void *Stack_check_Find_high_water_mark(
      * match pattern
      */
 
-    base += length - 1;
-    for (ebase = s; base > ebase; base--)
-      if (*base != U32_PATTERN)
-        return (void *) base;
+    high = (const uint32_t *) s + n / 4;
+
+    if ( known != NULL ) {
+      low = (const uint32_t *) known + 1;
+    } else {
+      low = s;
+    }
+
+    while ( high - low >= 4 && Stack_check_Is_pattern_block( high - 4 ) ) {
+      high -= 4;
+    }
+
+    while ( high > low ) {
+      --high;
+
+      if ( *high != U32_PATTERN ) {
+        return RTEMS_DECONST( uint32_t *, high );
+      }
+    }
   #else
     /*
      * start at lower memory and find first word that does not
      * match pattern
      */
 
-    for (ebase = base + length; base < ebase; base++)
-      if (*base != U32_PATTERN)
-        return (void *) base;
+    low = s;
+
+    if ( known != NULL ) {
+      high = known;
+    } else {
+      high = low + n / 4;
+    }
+
+    while ( high - low >= 4 && Stack_check_Is_pattern_block( low ) ) {
+      low += 4;
+    }
+
+    for ( ; low < high; ++low ) {
+      if ( *low != U32_PATTERN ) {
+        return RTEMS_DECONST( uint32_t *, low );
+      }
+    }
   #endif
 
-  return NULL;
+  return known;
+}
+
+/*
+ *  Get the high water mark of a stack.  A stack which is not in use and which
+ *  was not used since the last scan is not scanned again.
+ */
+static void *Stack_check_Get_high_water_mark(
+  Stack_Control *stack,
+  const void    *begin,
+  size_t         size,
+  bool           is_in_use
+)
+{
+  void *high_water_mark;
+
+  if ( !stack->is_dirty && !is_in_use ) {
+    return stack->high_water_mark;
+  }
+
+  if ( !is_in_use ) {
+    stack->is_dirty = false;
+  }
+
+  high_water_mark = Stack_check_Find_high_water_mark(
+    begin,
+    size,
+    stack->high_water_mark
+  );
+  stack->high_water_mark = high_water_mark;
+
+  return high_water_mark;
+}
+
+static bool Stack_check_Is_executing( const Thread_Control *the_thread )
+{
+#if defined(RTEMS_SMP)
+  return _Thread_Is_executing_on_a_processor( the_thread );
+#else
+  return _Thread_Is_executing( the_thread );
+#endif
 }
 
 static void Stack_check_Visit_stack(
-  const Stack_Control        *stack,
+  Stack_Control              *stack,
+  bool                        is_in_use,
   const void                 *current,
   const char                 *name,
   rtems_id                    id,
@@ -455,8 +554,12 @@ static void Stack_check_Visit_stack(
   if ( Stack_check_Initialized ) {
     void *high_water_mark;
 
-    high_water_mark =
-      Stack_check_Find_high_water_mark( info.begin, info.size );
+    high_water_mark = Stack_check_Get_high_water_mark(
+      stack,
+      info.begin,
+      info.size,
+      is_in_use
+    );
 
     if ( high_water_mark != NULL ) {
       info.used =
@@ -489,6 +592,7 @@ static bool Stack_check_Visit_thread(
   _Thread_Get_name( the_thread, name, sizeof( name ) );
   Stack_check_Visit_stack(
     &the_thread->Start.Initial_stack,
+    Stack_check_Is_executing( the_thread ),
     (void *) sp,
     name,
     the_thread->Object.id,
@@ -499,7 +603,7 @@ static bool Stack_check_Visit_thread(
 }
 
 static void Stack_check_Visit_interrupt_stack(
-  const Stack_Control        *stack,
+  Stack_Control              *stack,
   uint32_t                    id,
   rtems_stack_checker_visitor visit,
   void                       *arg
@@ -507,6 +611,7 @@ static void Stack_check_Visit_interrupt_stack(
 {
   Stack_check_Visit_stack(
     stack,
+    true,
     NULL,
     "Interrupt Stack",
     id,
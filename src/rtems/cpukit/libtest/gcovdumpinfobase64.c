@@ -11,6 +11,7 @@
 
 /*
  * Copyright (C) 2021, 2022 embedded brains GmbH & Co. KG
+ * Copyright (C) 2026 The RTEMS Project
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -40,71 +41,43 @@
 
 #include <rtems/test-gcov.h>
 
-#include <limits.h>
-#include <string.h>
-
 #include <rtems/base64.h>
 
-typedef struct {
-  IO_Put_char put_char;
-  void       *arg;
-  int         out;
-  size_t      index;
-  char        buf[ 57 ];
-} Gcov_Base64_context;
-
-static void _Gcov_Base64_put_char( int c, void *arg )
+static void _Gcov_Base64_dump( const void *data, unsigned length, void *arg )
 {
-  Gcov_Base64_context *ctx;
-
-  ctx = arg;
-
-  ( *ctx->put_char )( c, ctx->arg );
-  ++ctx->out;
-
-  if ( ctx->out >= 76 ) {
-    ctx->out = 0;
-    ( *ctx->put_char )( '\n', ctx->arg );
-  }
+  _Base64_Encode_lines( arg, data, length );
 }
 
-static void _Gcov_Base64_encode( int c, void *arg )
+static void _Gcov_Base64_filename( const char *filename, void *arg )
 {
-  Gcov_Base64_context *ctx;
-  size_t                  index;
-
-  ctx = arg;
-  index = ctx->index;
-  ctx->buf[ index ] = (char) c;
-
-  if ( index == RTEMS_ARRAY_SIZE( ctx->buf ) - 1 ) {
-    index = 0;
-    _Base64_Encode(
-      _Gcov_Base64_put_char,
-      ctx,
-      ctx->buf,
-      sizeof( ctx->buf ),
-      NULL,
-      INT_MAX
-    );
-  } else {
-    ++index;
-  }
+  __gcov_filename_to_gcfn( filename, _Gcov_Base64_dump, arg );
+}
 
-  ctx->index = index;
+static void *_Gcov_Base64_allocate( unsigned length, void *arg )
+{
+  (void) length;
+  (void) arg;
+  return NULL;
 }
 
 void _Gcov_Dump_info_base64( IO_Put_char put_char, void *arg )
 {
-  Gcov_Base64_context ctx;
-
-  memset( &ctx, 0, sizeof( ctx ) );
-  ctx.put_char = put_char;
-  ctx.arg = arg;
-  _Gcov_Dump_info( _Gcov_Base64_encode, &ctx );
+  Base64_Encode_lines_control     ctx;
+  const struct gcov_info * const *item;
+
+  _Base64_Encode_lines_initialize( &ctx, put_char, arg );
+
+  RTEMS_LINKER_SET_FOREACH( gcov_info, item ) {
+    __gcov_info_to_gcda(
+      *item,
+      _Gcov_Base64_filename,
+      _Gcov_Base64_dump,
+      _Gcov_Base64_allocate,
+      &ctx
+    );
+  }
 
-  if ( ctx.index > 0 ) {
-    _Base64_Encode( put_char, arg, ctx.buf, ctx.index, NULL, INT_MAX );
+  if ( _Base64_Encode_lines_flush( &ctx ) > 0 ) {
     ( *put_char )( '\n', arg );
   }
 }
@@ -0,0 +1,307 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPILatency
+ *
+ * @brief This source file contains the implementation of the latency
+ *   histograms.
+ */
+
+/*
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/latency.h>
+#include <rtems/score/percpu.h>
+#include <rtems/score/smpimpl.h>
+
+#include <inttypes.h>
+
+/*
+ * The application configuration provides the histograms through
+ * CONFIGURE_LATENCY_HISTOGRAMS, otherwise this empty configuration is used.
+ */
+RTEMS_WEAK const Latency_Configuration _Latency_Configuration;
+
+static Latency_Control *_Latency_Get_control( const Per_CPU_Control *cpu )
+{
+  Latency_Control *controls;
+
+  controls = _Latency_Configuration.controls;
+
+  if ( controls == NULL ) {
+    return NULL;
+  }
+
+  return &controls[ _Per_CPU_Get_index( cpu ) ];
+}
+
+void _Latency_Add(
+  Latency_Control    *control,
+  rtems_latency_kind  kind,
+  rtems_counter_ticks ticks
+)
+{
+  Latency_Histogram *histogram;
+  unsigned int       max;
+
+  histogram = &control->Histograms[ kind ];
+  _Atomic_Fetch_add_uint(
+    &histogram->buckets[ rtems_latency_bucket( ticks ) ],
+    1,
+    ATOMIC_ORDER_RELAXED
+  );
+  _Atomic_Fetch_add_uint( &histogram->count, 1, ATOMIC_ORDER_RELAXED );
+
+  /* An interrupt may update the maximum between the load and the exchange */
+  max = _Atomic_Load_uint( &histogram->max, ATOMIC_ORDER_RELAXED );
+
+  while (
+    ticks > max &&
+    !_Atomic_Compare_exchange_uint(
+      &histogram->max,
+      &max,
+      ticks,
+      ATOMIC_ORDER_RELAXED,
+      ATOMIC_ORDER_RELAXED
+    )
+  ) {
+    /* Try again */
+  }
+}
+
+void rtems_latency_interrupt_entry( void )
+{
+  Latency_Control *control;
+
+  control = _Latency_Get_control( _Per_CPU_Get() );
+
+  if ( control != NULL ) {
+    control->interrupt_entry = rtems_counter_read();
+    control->interrupt_entry_valid = true;
+  }
+}
+
+void _Latency_Thread_switch(
+  struct _Thread_Control *executing,
+  struct _Thread_Control *heir
+)
+{
+  Latency_Control *control;
+
+  (void) executing;
+  (void) heir;
+
+  control = _Latency_Get_control( _Per_CPU_Get() );
+
+  if ( control != NULL && control->wakeup_pending ) {
+    control->wakeup_pending = false;
+    _Latency_Add(
+      control,
+      RTEMS_LATENCY_THREAD_WAKEUP,
+      rtems_counter_difference( rtems_counter_read(), control->wakeup_begin )
+    );
+  }
+}
+
+rtems_status_code rtems_latency_get_histogram(
+  uint32_t                 cpu_index,
+  rtems_latency_kind       kind,
+  rtems_latency_histogram *snapshot
+)
+{
+  const Latency_Histogram *histogram;
+  size_t                   i;
+
+  if ( snapshot == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  if ( _Latency_Configuration.controls == NULL ) {
+    return RTEMS_NOT_CONFIGURED;
+  }
+
+  if (
+    cpu_index >= _SMP_Get_processor_maximum() ||
+    (unsigned int) kind >= RTEMS_LATENCY_KIND_COUNT
+  ) {
+    return RTEMS_INVALID_NUMBER;
+  }
+
+  histogram = &_Latency_Configuration.controls[ cpu_index ].Histograms[ kind ];
+  snapshot->count = _Atomic_Load_uint( &histogram->count, ATOMIC_ORDER_RELAXED );
+  snapshot->max = _Atomic_Load_uint( &histogram->max, ATOMIC_ORDER_RELAXED );
+
+  for ( i = 0; i < RTEMS_LATENCY_BUCKET_COUNT; ++i ) {
+    snapshot->buckets[ i ] =
+      _Atomic_Load_uint( &histogram->buckets[ i ], ATOMIC_ORDER_RELAXED );
+  }
+
+  return RTEMS_SUCCESSFUL;
+}
+
+void rtems_latency_reset( void )
+{
+  Latency_Control *controls;
+  uint32_t         cpu_max;
+  uint32_t         cpu_index;
+
+  controls = _Latency_Configuration.controls;
+
+  if ( controls == NULL ) {
+    return;
+  }
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    int kind;
+
+    for ( kind = 0; kind < RTEMS_LATENCY_KIND_COUNT; ++kind ) {
+      Latency_Histogram *histogram;
+      size_t             i;
+
+      histogram = &controls[ cpu_index ].Histograms[ kind ];
+      _Atomic_Store_uint( &histogram->count, 0, ATOMIC_ORDER_RELAXED );
+      _Atomic_Store_uint( &histogram->max, 0, ATOMIC_ORDER_RELAXED );
+
+      for ( i = 0; i < RTEMS_LATENCY_BUCKET_COUNT; ++i ) {
+        _Atomic_Store_uint( &histogram->buckets[ i ], 0, ATOMIC_ORDER_RELAXED );
+      }
+    }
+  }
+}
+
+uint32_t rtems_latency_bucket_lower_bound( size_t bucket )
+{
+  if ( bucket < 4 ) {
+    return (uint32_t) bucket;
+  }
+
+  return ( 4 + (uint32_t) ( bucket % 4 ) ) << ( bucket / 4 - 1 );
+}
+
+uint32_t rtems_latency_percentile(
+  const rtems_latency_histogram *histogram,
+  uint32_t                       per_mille
+)
+{
+  uint64_t rank;
+  uint64_t sum;
+  size_t   i;
+
+  if ( histogram->count == 0 ) {
+    return 0;
+  }
+
+  /* Nearest rank */
+  rank = ( (uint64_t) histogram->count * per_mille + 999 ) / 1000;
+
+  if ( rank == 0 ) {
+    rank = 1;
+  }
+
+  sum = 0;
+
+  for ( i = 0; i < RTEMS_LATENCY_BUCKET_COUNT - 1; ++i ) {
+    sum += histogram->buckets[ i ];
+
+    if ( sum >= rank ) {
+      uint32_t upper;
+
+      upper = rtems_latency_bucket_lower_bound( i + 1 ) - 1;
+      return upper < histogram->max ? upper : histogram->max;
+    }
+  }
+
+  return histogram->max;
+}
+
+static const char * const _Latency_Kind_names[ RTEMS_LATENCY_KIND_COUNT ] = {
+  "INTERRUPT ENTRY",
+  "INTERRUPT HANDLER",
+  "THREAD WAKEUP"
+};
+
+void rtems_latency_report( const rtems_printer *printer )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  if ( _Latency_Configuration.controls == NULL ) {
+    rtems_printf( printer, "latency histograms not configured\n" );
+    return;
+  }
+
+  rtems_printf(
+    printer,
+    "CPU KIND                    COUNT    P50[ns]    P99[ns]  P99.9[ns]"
+    "    MAX[ns]\n"
+  );
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    int kind;
+
+    for ( kind = 0; kind < RTEMS_LATENCY_KIND_COUNT; ++kind ) {
+      rtems_latency_histogram histogram;
+
+      (void) rtems_latency_get_histogram(
+        cpu_index,
+        (rtems_latency_kind) kind,
+        &histogram
+      );
+
+      if ( histogram.count == 0 ) {
+        continue;
+      }
+
+      rtems_printf(
+        printer,
+        "%3" PRIu32 " %-18s %10" PRIu32 " %10" PRIu64 " %10" PRIu64
+        " %10" PRIu64 " %10" PRIu64 "\n",
+        cpu_index,
+        _Latency_Kind_names[ kind ],
+        histogram.count,
+        rtems_counter_ticks_to_nanoseconds(
+          rtems_latency_percentile( &histogram, 500 )
+        ),
+        rtems_counter_ticks_to_nanoseconds(
+          rtems_latency_percentile( &histogram, 990 )
+        ),
+        rtems_counter_ticks_to_nanoseconds(
+          rtems_latency_percentile( &histogram, 999 )
+        ),
+        rtems_counter_ticks_to_nanoseconds( histogram.max )
+      );
+    }
+  }
+}
@@ -2,6 +2,7 @@
 
 /*
  * Copyright (C) 2020 embedded brains GmbH & Co. KG
+ * Copyright (C) 2026 The RTEMS Project
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -31,81 +32,16 @@
 
 #include <rtems/recorddump.h>
 
-#include <limits.h>
-#include <string.h>
-
-#include <rtems/base64.h>
-
-typedef struct {
-  IO_Put_char  put_char;
-  void        *arg;
-  int          out;
-  size_t       index;
-  char         buf[ 57 ];
-} dump_context;
-
-static void put_char( int c, void *arg )
-{
-  dump_context *ctx;
-
-  ctx = arg;
-
-  ( *ctx->put_char )( c, ctx->arg );
-  ++ctx->out;
-
-  if ( ctx->out >= 76 ) {
-    ctx->out = 0;
-    ( *ctx->put_char )( '\n', ctx->arg );
-  }
-}
-
 static void chunk( void *arg, const void *data, size_t length )
 {
-  dump_context *ctx;
-  size_t        index;
-  const char   *in;
-  const void   *end;
-
-  ctx = arg;
-  index = ctx->index;
-  in = data;
-  end = in + length;
-
-  while ( in != end ) {
-    ctx->buf[ index ] = *in;
-    ++in;
-
-    if ( index == RTEMS_ARRAY_SIZE( ctx->buf ) - 1 ) {
-      index = 0;
-      _Base64_Encode(
-        put_char,
-        ctx,
-        ctx->buf,
-        sizeof( ctx->buf ),
-        NULL,
-        INT_MAX
-      );
-    } else {
-      ++index;
-    }
-  }
-
-  ctx->index = index;
-}
-
-static void flush( dump_context *ctx )
-{
-  _Base64_Encode( put_char, ctx, ctx->buf, ctx->index, NULL, INT_MAX );
+  _Base64_Encode_lines( arg, data, length );
 }
 
 void rtems_record_dump_base64( IO_Put_char put_char, void *arg )
 {
-  dump_context ctx;
-
-  memset( &ctx, 0, sizeof( ctx ) );
-  ctx.put_char = put_char;
-  ctx.arg = arg;
+  Base64_Encode_lines_control ctx;
 
+  _Base64_Encode_lines_initialize( &ctx, put_char, arg );
   rtems_record_dump( chunk, &ctx );
-  flush( &ctx );
+  (void) _Base64_Encode_lines_flush( &ctx );
 }
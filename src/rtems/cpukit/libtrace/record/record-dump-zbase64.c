@@ -2,6 +2,7 @@
 
 /*
  * Copyright (C) 2020 embedded brains GmbH & Co. KG
+ * Copyright (C) 2026 The RTEMS Project
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -31,11 +32,6 @@
 
 #include <rtems/recorddump.h>
 
-#include <limits.h>
-#include <string.h>
-
-#include <rtems/base64.h>
-
 static void *dump_zalloc( void *opaque, unsigned items, unsigned size )
 {
   rtems_record_dump_base64_zlib_context *ctx;
@@ -62,19 +58,15 @@ static void dump_zfree( void *opaque, void *ptr )
   (void) ptr;
 }
 
-static void put_char( int c, void *arg )
+static void encode( rtems_record_dump_base64_zlib_context *ctx )
 {
-  rtems_record_dump_base64_zlib_context *ctx;
-
-  ctx = arg;
-
-  ( *ctx->put_char )( c, ctx->arg );
-  ++ctx->out;
-
-  if ( ctx->out >= 76 ) {
-    ctx->out = 0;
-    ( *ctx->put_char )( '\n', ctx->arg );
-  }
+  _Base64_Encode_lines(
+    &ctx->base64,
+    ctx->buf,
+    sizeof( ctx->buf ) - ctx->stream.avail_out
+  );
+  ctx->stream.next_out = &ctx->buf[ 0 ];
+  ctx->stream.avail_out = sizeof( ctx->buf );
 }
 
 static void chunk( void *arg, const void *data, size_t length )
@@ -94,10 +86,7 @@ static void chunk( void *arg, const void *data, size_t length )
     }
 
     if ( ctx->stream.avail_out == 0 ) {
-      ctx->stream.next_out = &ctx->buf[ 0 ];
-      ctx->stream.avail_out = sizeof( ctx->buf );
-
-      _Base64_Encode( put_char, ctx, ctx->buf, sizeof( ctx->buf ), NULL, INT_MAX );
+      encode( ctx );
     }
   }
 }
@@ -113,21 +102,12 @@ static void flush( rtems_record_dump_base64_zlib_context *ctx )
     }
 
     if ( ctx->stream.avail_out == 0 ) {
-      ctx->stream.next_out = &ctx->buf[ 0 ];
-      ctx->stream.avail_out = sizeof( ctx->buf );
-
-      _Base64_Encode( put_char, ctx, ctx->buf, sizeof( ctx->buf ), NULL, INT_MAX );
+      encode( ctx );
     }
   }
 
-  _Base64_Encode(
-    put_char,
-    ctx,
-    ctx->buf,
-    sizeof( ctx->buf ) - ctx->stream.avail_out,
-    NULL,
-    INT_MAX
-  );
+  encode( ctx );
+  (void) _Base64_Encode_lines_flush( &ctx->base64 );
 }
 
 void rtems_record_dump_zlib_base64(
@@ -138,9 +118,7 @@ void rtems_record_dump_zlib_base64(
 {
   int err;
 
-  ctx->put_char = put_char;
-  ctx->arg = arg;
-  ctx->out = 0;
+  _Base64_Encode_lines_initialize( &ctx->base64, put_char, arg );
   ctx->stream.zalloc = dump_zalloc;
   ctx->stream.zfree = dump_zfree;
   ctx->stream.opaque = ctx;
@@ -132,6 +132,11 @@ static mqd_t _POSIX_Message_queue_Create(
     rtems_set_errno_and_return_value( ENOSPC, MQ_OPEN_FAILED );
   }
 
+  _CORE_message_queue_Set_priority_index(
+    &the_mq->Message_queue,
+    &the_mq->Priority_index
+  );
+
   _Objects_Open_string(
     &_POSIX_Message_queue_Information,
     &the_mq->Object,
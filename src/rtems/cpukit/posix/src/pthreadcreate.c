@@ -239,8 +239,8 @@ int pthread_create(
   }
 
   if ( config.stack_area == NULL ) {
-    config.stack_free = _Stack_Free;
-    config.stack_area = _Stack_Allocate( config.stack_size );
+    config.stack_free = _Stack_Cache_free;
+    config.stack_area = _Stack_Cache_allocate( config.stack_size );
   } else {
     config.stack_free = _Objects_Free_nothing;
   }
@@ -44,7 +44,9 @@
 #include <rtems/rtems/support.h>
 #include <rtems/score/address.h>
 #include <rtems/score/chainimpl.h>
+#include <rtems/score/heapimpl.h>
 #include <rtems/score/sysstate.h>
+#include <rtems/score/wkspace.h>
 #include <rtems/sysinit.h>
 
 static Partition_Control *_Partition_Allocate( void )
@@ -52,6 +54,47 @@ static Partition_Control *_Partition_Allocate( void )
   return (Partition_Control *) _Objects_Allocate( &_Partition_Information );
 }
 
+#if defined(RTEMS_SMP)
+static bool _Partition_Initialize_caches(
+  Partition_Control *the_partition,
+  rtems_attribute    attribute_set
+)
+{
+  Partition_Cache *caches;
+  uint32_t         cpu_max;
+  uint32_t         cpu_index;
+
+  the_partition->caches = NULL;
+
+  if ( !_Attributes_Is_partition_per_cpu_cache( attribute_set ) ) {
+    return true;
+  }
+
+  cpu_max = _SMP_Get_processor_maximum();
+  caches = _Heap_Allocate_aligned(
+    &_Workspace_Area,
+    cpu_max * sizeof( *caches ),
+    CPU_CACHE_LINE_BYTES
+  );
+
+  if ( caches == NULL ) {
+    return false;
+  }
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Partition_Cache *cache;
+
+    cache = &caches[ cpu_index ];
+    _ISR_lock_Initialize( &cache->Lock, "Partition Cache" );
+    _Chain_Initialize_empty( &cache->Buffers );
+    cache->count = 0;
+  }
+
+  the_partition->caches = caches;
+  return true;
+}
+#endif
+
 static void _Partition_Initialize(
   Partition_Control *the_partition,
   void              *starting_address,
@@ -146,6 +189,14 @@ rtems_status_code rtems_partition_create(
     return RTEMS_TOO_MANY;
   }
 
+#if defined(RTEMS_SMP)
+  if ( !_Partition_Initialize_caches( the_partition, attribute_set ) ) {
+    _Objects_Free( &_Partition_Information, &the_partition->Object );
+    _Objects_Allocator_unlock();
+    return RTEMS_UNSATISFIED;
+  }
+#endif
+
 #if defined(RTEMS_MULTIPROCESSING)
   if ( _Attributes_Is_global( attribute_set ) &&
        !( _Objects_MP_Allocate_and_open( &_Partition_Information, name,
@@ -41,6 +41,43 @@
 
 #include <rtems/rtems/partimpl.h>
 #include <rtems/rtems/attrimpl.h>
+#include <rtems/score/smpimpl.h>
+#include <rtems/score/threaddispatch.h>
+#include <rtems/score/wkspace.h>
+
+#if defined(RTEMS_SMP)
+static void _Partition_Destroy_caches( Partition_Control *the_partition )
+{
+  Partition_Cache *caches;
+  Per_CPU_Control *cpu_self;
+  uint32_t         cpu_max;
+  uint32_t         cpu_index;
+
+  caches = the_partition->caches;
+
+  if ( caches == NULL ) {
+    return;
+  }
+
+  /*
+   * The partition is closed, so no new directive call can get it.  Directive
+   * calls which got the partition before it was closed access the caches with
+   * interrupts disabled.  Wait until each other processor had interrupts
+   * enabled before the caches are freed.
+   */
+  cpu_self = _Thread_Dispatch_disable();
+  _SMP_Synchronize();
+  _Thread_Dispatch_enable( cpu_self );
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    _ISR_lock_Destroy( &caches[ cpu_index ].Lock );
+  }
+
+  _Workspace_Free( caches );
+}
+#endif
 
 rtems_status_code rtems_partition_delete(
   rtems_id id
@@ -66,7 +103,7 @@ rtems_status_code rtems_partition_delete(
 
   _Partition_Acquire_critical( the_partition, &lock_context );
 
-  if ( the_partition->number_of_used_blocks != 0 ) {
+  if ( _Partition_Get_used_blocks( the_partition ) != 0 ) {
     _Partition_Release( the_partition, &lock_context );
     _Objects_Allocator_unlock();
     return RTEMS_RESOURCE_IN_USE;
@@ -91,6 +128,9 @@ rtems_status_code rtems_partition_delete(
   }
 #endif
 
+#if defined(RTEMS_SMP)
+  _Partition_Destroy_caches( the_partition );
+#endif
   _ISR_lock_Destroy( &the_partition->Lock );
   _Objects_Free( &_Partition_Information, &the_partition->Object );
   _Objects_Allocator_unlock();
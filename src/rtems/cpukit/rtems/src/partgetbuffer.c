@@ -47,6 +47,97 @@ static void *_Partition_Allocate_buffer( Partition_Control *the_partition )
   return _Chain_Get_unprotected( &the_partition->Memory );
 }
 
+#if defined(RTEMS_SMP)
+static void *_Partition_Steal_cached_buffer( Partition_Control *the_partition )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Partition_Cache  *cache;
+    ISR_lock_Context  lock_context;
+    void             *the_buffer;
+
+    cache = &the_partition->caches[ cpu_index ];
+    _ISR_lock_Acquire( &cache->Lock, &lock_context );
+    the_buffer = _Chain_Get_unprotected( &cache->Buffers );
+
+    if ( the_buffer != NULL ) {
+      --cache->count;
+    }
+
+    _ISR_lock_Release( &cache->Lock, &lock_context );
+
+    if ( the_buffer != NULL ) {
+      return the_buffer;
+    }
+  }
+
+  return NULL;
+}
+
+static void *_Partition_Allocate_cached_buffer(
+  Partition_Control *the_partition,
+  ISR_lock_Context  *lock_context
+)
+{
+  Partition_Cache  *cache;
+  ISR_lock_Context  cache_lock_context;
+  void             *the_buffer;
+
+  cache = _Partition_Get_cache( the_partition );
+  _ISR_lock_Acquire( &cache->Lock, &cache_lock_context );
+  the_buffer = _Chain_Get_unprotected( &cache->Buffers );
+
+  if ( the_buffer != NULL ) {
+    --cache->count;
+    _ISR_lock_Release( &cache->Lock, &cache_lock_context );
+    _ISR_lock_ISR_enable( lock_context );
+    return the_buffer;
+  }
+
+  _ISR_lock_Release( &cache->Lock, &cache_lock_context );
+
+  /*
+   * The cache of the current processor is empty.  Refill it with a batch of
+   * buffers from the partition.  Only the current processor adds buffers to
+   * its cache and interrupts are disabled, so the cache stays empty until we
+   * acquired the cache lock again.
+   */
+  _Partition_Acquire_critical( the_partition, lock_context );
+  the_buffer = _Partition_Allocate_buffer( the_partition );
+
+  if ( the_buffer != NULL ) {
+    uintptr_t count;
+
+    _ISR_lock_Acquire( &cache->Lock, &cache_lock_context );
+
+    for ( count = 0; count < PARTITION_CACHE_BATCH_SIZE; ++count ) {
+      Chain_Node *node;
+
+      node = _Chain_Get_unprotected( &the_partition->Memory );
+
+      if ( node == NULL ) {
+        break;
+      }
+
+      _Chain_Append_unprotected( &cache->Buffers, node );
+    }
+
+    cache->count += (uint32_t) count;
+    _ISR_lock_Release( &cache->Lock, &cache_lock_context );
+    the_partition->number_of_used_blocks += 1 + count;
+  } else {
+    the_buffer = _Partition_Steal_cached_buffer( the_partition );
+  }
+
+  _Partition_Release( the_partition, lock_context );
+  return the_buffer;
+}
+#endif
+
 rtems_status_code rtems_partition_get_buffer(
   rtems_id   id,
   void     **buffer
@@ -70,6 +161,22 @@ rtems_status_code rtems_partition_get_buffer(
 #endif
   }
 
+#if defined(RTEMS_SMP)
+  if ( the_partition->caches != NULL ) {
+    the_buffer = _Partition_Allocate_cached_buffer(
+      the_partition,
+      &lock_context
+    );
+
+    if ( the_buffer == NULL ) {
+      return RTEMS_UNSATISFIED;
+    }
+
+    *buffer = the_buffer;
+    return RTEMS_SUCCESSFUL;
+  }
+#endif
+
   _Partition_Acquire_critical( the_partition, &lock_context );
   the_buffer = _Partition_Allocate_buffer( the_partition );
 
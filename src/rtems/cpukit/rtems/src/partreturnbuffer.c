@@ -84,6 +84,58 @@ static void _Partition_Free_buffer(
   _Chain_Append_unprotected( &the_partition->Memory, the_buffer );
 }
 
+#if defined(RTEMS_SMP)
+static void _Partition_Free_cached_buffer(
+  Partition_Control *the_partition,
+  void              *the_buffer,
+  ISR_lock_Context  *lock_context
+)
+{
+  Partition_Cache  *cache;
+  ISR_lock_Context  cache_lock_context;
+  uintptr_t         count;
+
+  cache = _Partition_Get_cache( the_partition );
+  _ISR_lock_Acquire( &cache->Lock, &cache_lock_context );
+
+  if ( cache->count < 2 * PARTITION_CACHE_BATCH_SIZE ) {
+    _Chain_Prepend_unprotected( &cache->Buffers, the_buffer );
+    ++cache->count;
+    _ISR_lock_Release( &cache->Lock, &cache_lock_context );
+    _ISR_lock_ISR_enable( lock_context );
+    return;
+  }
+
+  _ISR_lock_Release( &cache->Lock, &cache_lock_context );
+
+  /*
+   * The cache of the current processor is full.  Flush a batch of the least
+   * recently returned buffers to the partition.  The partition lock shall be
+   * acquired before the cache lock.
+   */
+  _Partition_Acquire_critical( the_partition, lock_context );
+  _ISR_lock_Acquire( &cache->Lock, &cache_lock_context );
+  _Chain_Prepend_unprotected( &cache->Buffers, the_buffer );
+
+  for ( count = 0; count < PARTITION_CACHE_BATCH_SIZE; ++count ) {
+    Chain_Node *node;
+
+    if ( _Chain_Is_empty( &cache->Buffers ) ) {
+      break;
+    }
+
+    node = _Chain_Last( &cache->Buffers );
+    _Chain_Extract_unprotected( node );
+    _Partition_Free_buffer( the_partition, node );
+  }
+
+  cache->count = cache->count + 1 - (uint32_t) count;
+  _ISR_lock_Release( &cache->Lock, &cache_lock_context );
+  the_partition->number_of_used_blocks -= count;
+  _Partition_Release( the_partition, lock_context );
+}
+#endif
+
 rtems_status_code rtems_partition_return_buffer(
   rtems_id  id,
   void     *buffer
@@ -102,6 +154,18 @@ rtems_status_code rtems_partition_return_buffer(
 #endif
   }
 
+#if defined(RTEMS_SMP)
+  if ( the_partition->caches != NULL ) {
+    if ( !_Partition_Is_address_a_buffer_begin( the_partition, buffer ) ) {
+      _ISR_lock_ISR_enable( &lock_context );
+      return RTEMS_INVALID_ADDRESS;
+    }
+
+    _Partition_Free_cached_buffer( the_partition, buffer, &lock_context );
+    return RTEMS_SUCCESSFUL;
+  }
+#endif
+
   _Partition_Acquire_critical( the_partition, &lock_context );
 
   if ( !_Partition_Is_address_a_buffer_begin( the_partition, buffer ) ) {
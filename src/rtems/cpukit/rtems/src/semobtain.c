@@ -69,6 +69,49 @@ THREAD_QUEUE_OBJECT_ASSERT(
 );
 #endif
 
+#if defined(RTEMS_SMP)
+static bool _Semaphore_Spin_on_owner(
+  Semaphore_Control    *the_semaphore,
+  rtems_option          option_set,
+  Thread_queue_Context *queue_context
+)
+{
+  Semaphore_Variant   variant;
+  Thread_queue_Queue *queue;
+
+  if (
+    _Thread_queue_Adaptive_spin_nanoseconds == 0
+      || _Options_Is_no_wait( option_set )
+  ) {
+    return false;
+  }
+
+  variant = _Semaphore_Get_variant( _Semaphore_Get_flags( the_semaphore ) );
+
+  if (
+    variant != SEMAPHORE_VARIANT_MUTEX_INHERIT_PRIORITY
+      && variant != SEMAPHORE_VARIANT_MUTEX_PRIORITY_CEILING
+      && variant != SEMAPHORE_VARIANT_MUTEX_NO_PROTOCOL
+  ) {
+    return false;
+  }
+
+  queue = &the_semaphore->Core_control.Mutex.Recursive.Mutex.Wait_queue.Queue;
+
+  if ( queue->owner == NULL ) {
+    return false;
+  }
+
+  /*
+   * The semaphore may get deleted while interrupts are enabled, so the caller
+   * has to look it up again.
+   */
+  _ISR_lock_ISR_enable( &queue_context->Lock_context.Lock_context );
+  _Thread_queue_Spin_on_owner( queue );
+  return true;
+}
+#endif
+
 rtems_status_code rtems_semaphore_obtain(
   rtems_id        id,
   rtems_option    option_set,
@@ -93,6 +136,16 @@ rtems_status_code rtems_semaphore_obtain(
 #endif
   }
 
+#if defined(RTEMS_SMP)
+  if ( _Semaphore_Spin_on_owner( the_semaphore, option_set, &queue_context ) ) {
+    the_semaphore = _Semaphore_Get( id, &queue_context );
+
+    if ( the_semaphore == NULL ) {
+      return RTEMS_INVALID_ID;
+    }
+  }
+#endif
+
   executing = _Thread_Executing;
   wait = !_Options_Is_no_wait( option_set );
 
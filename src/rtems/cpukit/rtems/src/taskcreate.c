@@ -50,11 +50,11 @@ static rtems_status_code _RTEMS_tasks_Allocate_and_prepare_stack(
 {
   size_t size;
 
-  thread_config->stack_free = _Stack_Free;
+  thread_config->stack_free = _Stack_Cache_free;
   size = _Stack_Ensure_minimum( config->storage_size );
   size = _Stack_Extend_size( size, thread_config->is_fp );
   thread_config->stack_size = size;
-  thread_config->stack_area = _Stack_Allocate( size );
+  thread_config->stack_area = _Stack_Cache_allocate( size );
 
   if ( thread_config->stack_area == NULL ) {
     return RTEMS_UNSATISFIED;
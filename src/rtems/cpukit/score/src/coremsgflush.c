@@ -96,6 +96,12 @@ uint32_t   _CORE_message_queue_Flush(
     message_queue_first->previous = inactive_head;
 
     _Chain_Initialize_empty( &the_message_queue->Pending_messages );
+
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_PRIORITY_INDEX)
+    if ( the_message_queue->priority_index != NULL ) {
+      the_message_queue->priority_index->present = 0;
+    }
+#endif
   }
 
   _CORE_message_queue_Release( the_message_queue, queue_context );
@@ -58,6 +58,63 @@ static bool _CORE_message_queue_Order(
    return *left_priority <
      _CORE_message_queue_Get_message_priority( right_message );
 }
+
+static void _CORE_message_queue_Insert_by_priority(
+  CORE_message_queue_Control *the_message_queue,
+  CORE_message_queue_Buffer  *the_message,
+  int                         priority
+)
+{
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_PRIORITY_INDEX)
+  CORE_message_queue_Priority_index *index;
+  unsigned int                       bucket;
+
+  index = the_message_queue->priority_index;
+  bucket = 0U - (unsigned int) priority;
+
+  if (
+    index != NULL &&
+      bucket < CORE_MESSAGE_QUEUE_PRIORITY_INDEX_COUNT
+  ) {
+    uint64_t present;
+
+    /*
+     * The new message goes after the last pending message of the nearest
+     * priority which is higher than or equal to its priority.
+     */
+    present = index->present & ( UINT64_MAX << bucket );
+
+    if ( present != 0 ) {
+      CORE_message_queue_Buffer *previous;
+
+      previous = index->last[ __builtin_ctzll( present ) ];
+      _Chain_Insert_unprotected( &previous->Node, &the_message->Node );
+    } else {
+      /*
+       * Only urgent messages and messages of priorities outside the index can
+       * precede the new message.
+       */
+      _Chain_Insert_ordered_unprotected(
+        &the_message_queue->Pending_messages,
+        &the_message->Node,
+        &priority,
+        _CORE_message_queue_Order
+      );
+    }
+
+    index->present |= UINT64_C( 1 ) << bucket;
+    index->last[ bucket ] = the_message;
+    return;
+  }
+#endif
+
+  _Chain_Insert_ordered_unprotected(
+    &the_message_queue->Pending_messages,
+    &the_message->Node,
+    &priority,
+    _CORE_message_queue_Order
+  );
+}
 #endif
 
 void _CORE_message_queue_Insert_message(
@@ -89,14 +146,10 @@ void _CORE_message_queue_Insert_message(
     _Chain_Append_unprotected( pending_messages, &the_message->Node );
 #if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
   } else  if ( submit_type != CORE_MESSAGE_QUEUE_URGENT_REQUEST ) {
-    int priority;
-
-    priority = _CORE_message_queue_Get_message_priority( the_message );
-    _Chain_Insert_ordered_unprotected(
-      pending_messages,
-      &the_message->Node,
-      &priority,
-      _CORE_message_queue_Order
+    _CORE_message_queue_Insert_by_priority(
+      the_message_queue,
+      the_message,
+      _CORE_message_queue_Get_message_priority( the_message )
     );
 #endif
   } else {
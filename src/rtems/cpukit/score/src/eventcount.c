@@ -0,0 +1,68 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreEventCount
+ *
+ * @brief This source file contains the implementation of
+ *   _Event_count_Wait() and _Event_count_Do_signal().
+ */
+
+/*
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/eventcount.h>
+
+#include <limits.h>
+
+/*
+ * The event sequence number is the futex state.  The futex operations compare
+ * the state with the expected value while they own the futex lock.
+ */
+RTEMS_STATIC_ASSERT(
+  sizeof( Atomic_Uint ) == sizeof( int ),
+  EVENT_COUNT_SEQUENCE_SIZE
+);
+
+void _Event_count_Wait( Event_count_Control *event_count, unsigned int ticket )
+{
+  (void) _Futex_Wait(
+    &event_count->Futex,
+    (int *) &event_count->sequence,
+    (int) ticket
+  );
+  _Atomic_Fetch_sub_uint( &event_count->waiters, 1, ATOMIC_ORDER_RELAXED );
+}
+
+void _Event_count_Do_signal( Event_count_Control *event_count )
+{
+  _Atomic_Fetch_add_uint( &event_count->sequence, 1, ATOMIC_ORDER_SEQ_CST );
+  (void) _Futex_Wake( &event_count->Futex, INT_MAX );
+}
@@ -192,6 +192,7 @@ void _Mutex_Acquire( struct _Mutex_Control *_mutex )
   Thread_Control       *owner;
 
   mutex = _Mutex_Get( _mutex );
+  _Thread_queue_Spin_on_owner( &mutex->Queue.Queue );
   _Thread_queue_Context_initialize( &queue_context );
   _Thread_queue_Context_ISR_disable( &queue_context, level );
   executing = _Mutex_Queue_acquire_critical( mutex, &queue_context );
@@ -220,6 +221,7 @@ int _Mutex_Acquire_timed(
   Thread_Control       *owner;
 
   mutex = _Mutex_Get( _mutex );
+  _Thread_queue_Spin_on_owner( &mutex->Queue.Queue );
   _Thread_queue_Context_initialize( &queue_context );
   _Thread_queue_Context_ISR_disable( &queue_context, level );
   executing = _Mutex_Queue_acquire_critical( mutex, &queue_context );
@@ -306,6 +308,7 @@ void _Mutex_recursive_Acquire( struct _Mutex_recursive_Control *_mutex )
   Thread_Control          *owner;
 
   mutex = _Mutex_recursive_Get( _mutex );
+  _Thread_queue_Spin_on_owner( &mutex->Mutex.Queue.Queue );
   _Thread_queue_Context_initialize( &queue_context );
   _Thread_queue_Context_ISR_disable( &queue_context, level );
   executing = _Mutex_Queue_acquire_critical( &mutex->Mutex, &queue_context );
@@ -337,6 +340,7 @@ int _Mutex_recursive_Acquire_timed(
   Thread_Control          *owner;
 
   mutex = _Mutex_recursive_Get( _mutex );
+  _Thread_queue_Spin_on_owner( &mutex->Mutex.Queue.Queue );
   _Thread_queue_Context_initialize( &queue_context );
   _Thread_queue_Context_ISR_disable( &queue_context, level );
   executing = _Mutex_Queue_acquire_critical( &mutex->Mutex, &queue_context );
@@ -0,0 +1,73 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreSPSCQueue
+ *
+ * @brief This source file contains the implementation of
+ *   _SPSC_Queue_Send() and _SPSC_Queue_Receive().
+ */
+
+/*
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/spscqueue.h>
+
+void _SPSC_Queue_Send( SPSC_Queue_Control *queue, const void *item )
+{
+  while ( !_SPSC_Queue_Try_send( queue, item ) ) {
+    unsigned int ticket;
+
+    ticket = _Event_count_Prepare_wait( &queue->Not_full );
+
+    if ( _SPSC_Queue_Try_send( queue, item ) ) {
+      _Event_count_Cancel_wait( &queue->Not_full );
+      break;
+    }
+
+    _Event_count_Wait( &queue->Not_full, ticket );
+  }
+}
+
+void _SPSC_Queue_Receive( SPSC_Queue_Control *queue, void *item )
+{
+  while ( !_SPSC_Queue_Try_receive( queue, item ) ) {
+    unsigned int ticket;
+
+    ticket = _Event_count_Prepare_wait( &queue->Not_empty );
+
+    if ( _SPSC_Queue_Try_receive( queue, item ) ) {
+      _Event_count_Cancel_wait( &queue->Not_empty );
+      break;
+    }
+
+    _Event_count_Wait( &queue->Not_empty, ticket );
+  }
+}
@@ -0,0 +1,107 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreThreadQueue
+ *
+ * @brief This source file contains the implementation of
+ *   _Thread_queue_Do_spin_on_owner().
+ */
+
+/*
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/threadqimpl.h>
+#include <rtems/score/threadimpl.h>
+
+#if defined(RTEMS_SMP)
+RTEMS_WEAK uint32_t _Thread_queue_Adaptive_spin_nanoseconds;
+
+static CPU_Counter_ticks _Thread_queue_Adaptive_spin_ticks(
+  uint32_t nanoseconds
+)
+{
+  uint64_t ticks;
+
+  ticks = (uint64_t) nanoseconds * _CPU_Counter_frequency();
+  ticks = ( ticks + 999999999 ) / 1000000000;
+
+  return (CPU_Counter_ticks) ticks;
+}
+
+void _Thread_queue_Do_spin_on_owner( const Thread_queue_Queue *queue )
+{
+  const volatile Thread_queue_Queue *volatile_queue;
+  Thread_Control                    *owner;
+  uint32_t                           nanoseconds;
+  CPU_Counter_ticks                  limit;
+  CPU_Counter_ticks                  begin;
+
+  nanoseconds = _Thread_queue_Adaptive_spin_nanoseconds;
+
+  if ( nanoseconds == 0 ) {
+    return;
+  }
+
+  /*
+   * The thread queue is inspected without the thread queue lock.  This is
+   * harmless, since the outcome is only a hint.  The caller re-evaluates the
+   * owner with the lock held.  The owner thread control block stays in the
+   * object pool, even if the owner is deleted in the meantime.
+   */
+  volatile_queue = queue;
+  owner = volatile_queue->owner;
+
+  if (
+    owner == NULL
+      || owner == _Thread_Get_executing()
+      || volatile_queue->heads != NULL
+      || !_Thread_Is_executing_on_a_processor( owner )
+  ) {
+    return;
+  }
+
+  limit = _Thread_queue_Adaptive_spin_ticks( nanoseconds );
+  begin = _CPU_Counter_read();
+
+  /*
+   * Do not spin once threads are enqueued.  They wait already and should get
+   * the mutex in priority order when it is surrendered.
+   */
+  while (
+    volatile_queue->owner == owner
+      && volatile_queue->heads == NULL
+      && _Thread_Is_executing_on_a_processor( owner )
+      && _CPU_Counter_read() - begin < limit
+  ) {
+    /* Wait */
+  }
+}
+#endif
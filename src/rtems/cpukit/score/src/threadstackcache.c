@@ -0,0 +1,122 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreStack
+ *
+ * @brief This source file contains the implementation of
+ *   _Stack_Cache_allocate() and _Stack_Cache_free().
+ */
+
+/*
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/stackimpl.h>
+#include <rtems/score/chainimpl.h>
+
+static Chain_Control _Stack_Cache = CHAIN_INITIALIZER_EMPTY( _Stack_Cache );
+
+static uint32_t _Stack_Cache_count;
+
+static Stack_Cache_item *_Stack_Cache_get_item( void *stack_area )
+{
+  return (Stack_Cache_item *) ( (char *) stack_area - STACK_CACHE_ITEM_SIZE );
+}
+
+static void *_Stack_Cache_get_area( Stack_Cache_item *item )
+{
+  return (char *) item + STACK_CACHE_ITEM_SIZE;
+}
+
+void *_Stack_Cache_allocate( size_t stack_size )
+{
+  const Chain_Node *tail;
+  Chain_Node       *node;
+  Stack_Cache_item *item;
+
+  if ( _Stack_Cache_maximum == 0 ) {
+    return _Stack_Allocate( stack_size );
+  }
+
+  tail = _Chain_Immutable_tail( &_Stack_Cache );
+  node = _Chain_First( &_Stack_Cache );
+
+  while ( node != tail ) {
+    item = (Stack_Cache_item *) node;
+
+    if ( item->size == stack_size ) {
+      _Chain_Extract_unprotected( node );
+      --_Stack_Cache_count;
+      return _Stack_Cache_get_area( item );
+    }
+
+    node = _Chain_Next( node );
+  }
+
+  if ( stack_size > SIZE_MAX - STACK_CACHE_ITEM_SIZE ) {
+    return NULL;
+  }
+
+  item = _Stack_Allocate( stack_size + STACK_CACHE_ITEM_SIZE );
+
+  if ( item == NULL ) {
+    return NULL;
+  }
+
+  item->size = stack_size;
+  return _Stack_Cache_get_area( item );
+}
+
+void _Stack_Cache_free( void *stack_area )
+{
+  Stack_Cache_item *item;
+
+  if ( _Stack_Cache_maximum == 0 ) {
+    _Stack_Free( stack_area );
+    return;
+  }
+
+  if ( stack_area == NULL ) {
+    return;
+  }
+
+  if ( _Stack_Cache_count < _Stack_Cache_maximum ) {
+    ++_Stack_Cache_count;
+  } else {
+    Chain_Node *last;
+
+    last = _Chain_Last( &_Stack_Cache );
+    _Chain_Extract_unprotected( last );
+    _Stack_Free( last );
+  }
+
+  item = _Stack_Cache_get_item( stack_area );
+  _Chain_Prepend_unprotected( &_Stack_Cache, &item->Node );
+}
@@ -1,114 +1,204 @@
-/* init.c - LA VERSIÓN DEFINITIVA (Benchmarks + Luces + Configuración Segura) */
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
 #ifdef HAVE_CONFIG_H
 #include "config.h"
 #endif
 
-#include <rtems.h>
-#include <stdint.h>
 #include <stdlib.h>
-#include "user.h" /* Tus 10 benchmarks */
 
-/* --- DIRECCIONES DE HARDWARE STM32F4 (Discovery) --- */
-#define RCC_AHB1ENR  (*((volatile uint32_t *)0x40023830))
-#define GPIOD_MODER  (*((volatile uint32_t *)0x40020C00))
-#define GPIOD_ODR    (*((volatile uint32_t *)0x40020C14))
+#include <rtems/counter.h>
 
-/* Prototipo obligatorio */
-rtems_task Init(rtems_task_argument arg);
+#include "tmacros.h"
 
-/* Configura PD12-PD15 como salidas */
-static void led_setup(void) {
-    RCC_AHB1ENR |= (1 << 3); /* Reloj GPIOD */
-    GPIOD_MODER &= ~(0xFF000000); 
-    GPIOD_MODER |=  (0x55000000); /* Salida */
-}
+/* The run statistics are shared with the runner of the ABSURD sources */
+#include "../../../../ABSURD/code/runner/runstats.c"
+#include "user.h"
 
-/* Pausa "tonta" (Busy Wait) - NO depende de drivers de RTEMS */
-static void busy_wait(int count) {
-    for(volatile int k=0; k < count; k++);
-}
+const char rtems_test_name[] = "ABSURD";
 
-/* Controla el patrón de luces (Serpiente 8 pasos) */
-static void set_led_progress(int step) {
-    uint32_t current_state = GPIOD_ODR;
-    current_state &= ~(0xF000); /* Limpiar */
-
-    switch (step % 8) {
-        /* Llenado */
-        case 1: current_state |= (1 << 12); break; // G
-        case 2: current_state |= (1 << 12) | (1 << 13); break; // G+O
-        case 3: current_state |= (1 << 12) | (1 << 13) | (1 << 14); break; // G+O+R
-        case 4: current_state |= (0xF000); break; // ALL
-        /* Vaciado */
-        case 5: current_state |= (1 << 13) | (1 << 14) | (1 << 15); break; // -G
-        case 6: current_state |= (1 << 14) | (1 << 15); break; // -O
-        case 7: current_state |= (1 << 15); break; // B
-        case 0: break; // OFF
-    }
-    GPIOD_ODR = current_state;
-}
+#ifndef ABSURD_RUNS
+#define ABSURD_RUNS 20
+#endif
 
-typedef void (*bench_fn_t)(void);
-typedef struct { const char *name; bench_fn_t fn; } bench_t;
-
-/* TUS 10 BENCHMARKS */
-static bench_t benches[] = {
-  { "Fibonacci",       fibonacci },
-  { "Matrix NN",       matrix_nn },
-  { "Binary Search",   binary_search },
-  { "Bsqrt",           bsqrt },
-  { "Eq Root",         eq_root },
-  { "Exp Int",         exp_int },
-  { "MC Integral",     mc_integral },
-  { "Select Nmax",     select_nmax },
-  { "Unstruct",        unstruct },
-  { "Multi Search",    multi_search },
+#define ABSURD_SEED 123
+
+typedef struct {
+  const char *name;
+  void ( *fn )( void );
+} bench_t;
+
+static const bench_t benches[] = {
+  { "fibonacci", fibonacci },
+  { "matrix_nn", matrix_nn },
+  { "binary_search", binary_search },
+  { "bsqrt", bsqrt },
+  { "eq_root", eq_root },
+  { "exp_int", exp_int },
+  { "mc_integral", mc_integral },
+  { "select_nmax", select_nmax },
+  { "unstruct", unstruct },
+  { "multi_search", multi_search }
 };
 
-static void run_all(void) {
-  size_t n = sizeof(benches) / sizeof(benches[0]);
+static rtems_counter_ticks measure_begin;
+
+static rtems_counter_ticks measure_ticks;
 
-  for (size_t i = 0; i < n; i++) {
-    /* 1. Ponemos la luz correspondiente al paso */
-    set_led_progress(i + 1);
+static unsigned int measure_count;
 
-    /* 2. Ejecutamos el benchmark (¡Cálculos reales!) */
-    benches[i].fn();
+static unsigned int check_failures;
+
+static unsigned int total_check_failures;
+
+static unsigned long long samples[ ABSURD_RUNS ];
+
+void absurd_measure_start( void )
+{
+  measure_begin = rtems_counter_read();
+}
+
+/*
+ * A benchmark may have several measured regions.  The time of a run is the
+ * sum of its regions, like in the runner of the ABSURD sources.
+ */
+void absurd_measure_stop( void )
+{
+  measure_ticks += rtems_counter_difference(
+    rtems_counter_read(),
+    measure_begin
+  );
+  ++measure_count;
+}
 
-    /* 3. Esperamos un poco para ver la luz (aprox 0.5 segs) */
-    busy_wait(3000000); 
+void absurd_check_result( int ok )
+{
+  if ( !ok ) {
+    ++check_failures;
   }
 }
 
-rtems_task Init(rtems_task_argument arg) {
-    (void) arg;
+static void run_bench( const bench_t *bench, bool last )
+{
+  absurd_run_stats stats;
+  size_t           i;
+
+  check_failures = 0;
+
+  for ( i = 0; i < ABSURD_RUNS; ++i ) {
+    /* Every run shall process the same input */
+    srand( ABSURD_SEED );
+    measure_ticks = 0;
+    measure_count = 0;
+    ( *bench->fn )();
+    rtems_test_assert( measure_count > 0 );
+    samples[ i ] = rtems_counter_ticks_to_nanoseconds( measure_ticks );
+  }
 
-    /* 1. Configurar Hardware */
-    led_setup();
+  absurd_run_stats_compute( samples, ABSURD_RUNS, &stats );
+  total_check_failures += check_failures;
+
+  printf(
+    "    {\n"
+    "      \"name\": \"%s\",\n"
+    "      \"cold-ns\": %llu,\n"
+    "      \"min-ns\": %llu,\n"
+    "      \"median-ns\": %llu,\n"
+    "      \"p99-ns\": %llu,\n"
+    "      \"max-ns\": %llu,\n"
+    "      \"mean-ns\": %llu,\n"
+    "      \"observed-wcet-ns\": %llu,\n"
+    "      \"check-failures\": %u\n"
+    "    }%s\n",
+    bench->name,
+    stats.cold,
+    stats.min,
+    stats.median,
+    stats.p99,
+    stats.max,
+    stats.mean,
+    stats.observed_wcet,
+    check_failures,
+    last ? "" : ","
+  );
+}
 
-    /* 2. Destello inicial ROJO para confirmar arranque */
-    GPIOD_ODR |= (1 << 14);
-    busy_wait(1000000);
-    GPIOD_ODR &= ~(1 << 14);
+static void Init( rtems_task_argument arg )
+{
+  size_t n;
+  size_t i;
+
+  (void) arg;
+
+  TEST_BEGIN();
+  RTEMS_STATIC_ASSERT( ABSURD_RUNS >= 2, ABSURD_RUNS );
+
+  n = RTEMS_ARRAY_SIZE( benches );
+  printf(
+    "*** BEGIN OF JSON DATA ***\n"
+    "{\n"
+    "  \"runs\": %u,\n"
+    "  \"seed\": %u,\n"
+    "  \"counter-frequency\": %" PRIu32 ",\n"
+    "  \"benchmarks\": [\n",
+    (unsigned int) ABSURD_RUNS,
+    (unsigned int) ABSURD_SEED,
+    rtems_counter_frequency()
+  );
+
+  for ( i = 0; i < n; ++i ) {
+    run_bench( &benches[ i ], i + 1 == n );
+  }
 
-    /* 3. Correr Benchmarks */
-    run_all();
+  printf( "  ]\n}\n*** END OF JSON DATA ***\n" );
 
-    /* 4. FINAL: Encender todo */
-    GPIOD_ODR |= (0xF000);
+  if ( total_check_failures != 0 ) {
+    printf( "*** %u FAILED CHECKS ***\n", total_check_failures );
+    rtems_test_exit( 1 );
+  }
 
-    /* 5. Morir aquí (Bucle infinito) */
-    while(1);
-    
-    rtems_shutdown_executive(0);
+  TEST_END();
+  rtems_test_exit( 0 );
 }
 
-/* --- CONFIGURACIÓN "A PRUEBA DE BALAS" (Igual que Opción A) --- */
-/* Desactivamos Clock y Consola para evitar cuelgues */
-#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
 #define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_FLOATING_POINT
+
+/* For the recursion of fibonacci and the printf() of the report */
+#define CONFIGURE_INIT_TASK_STACK_SIZE ( 32 * 1024 )
+
 #define CONFIGURE_RTEMS_INIT_TASKS_TABLE
-/* Aumentamos stack por si Matrix o Fibonacci gastan mucho */
-#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024) 
+
 #define CONFIGURE_INIT
+
 #include <rtems/confdefs.h>
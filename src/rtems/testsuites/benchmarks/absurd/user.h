@@ -5,6 +5,7 @@
 #include <math.h>
 
 /* --- 1. Constantes de configuración --- */
+#define CLASS_A         /* fibonacci: N = 10 */
 #define ITERATIONS      1000
 #define ARRAY_LENGTH    1000
 #define MATRIX_SIZE     50
@@ -12,11 +13,15 @@
 #define TRUE            1
 #define FALSE           0
 
-/* --- 2. Macros "Dummy" --- */
+/* --- 2. Medición: init.c cronometra cada ejecución con rtems_counter_read() --- */
+void absurd_measure_start(void);
+void absurd_measure_stop(void);
+void absurd_check_result(int ok);
+
 #define MEASURE_GLOBAL_VARIABLES()
-#define MEASURE_START()
-#define MEASURE_STOP()
-#define CHECK_RESULT(cond)  (void)(cond)
+#define MEASURE_START()     absurd_measure_start()
+#define MEASURE_STOP()      absurd_measure_stop()
+#define CHECK_RESULT(cond)  absurd_check_result((cond) ? 1 : 0)
 
 /* --- 3. Funciones de Aleatoriedad --- */
 static inline double random_get(void) {
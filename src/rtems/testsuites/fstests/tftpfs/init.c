@@ -204,6 +204,48 @@ static const T_fixture fixture_small_opt_size = {
   .initial_context = &tftp_context
 };
 
+static void setup_read_ahead( void *context )
+{
+  tftp_test_context *ctx = context;
+  _Tftp_Reset();
+  ctx->fd0 = -1;
+  ctx->tftp_handle = NULL;
+  mount_tftp_fs(
+    tftpfs_mount_point,
+    "readahead,blocksize=" RTEMS_XSTRING(SMALL_BLOCK_SIZE)
+    ",windowsize=" RTEMS_XSTRING(SMALL_WINDOW_SIZE)
+  );
+}
+
+static const T_fixture fixture_read_ahead = {
+  .setup = setup_read_ahead,
+  .stop = NULL,
+  .teardown = teardown,
+  .scope = NULL,
+  .initial_context = &tftp_context
+};
+
+static void setup_adaptive( void *context )
+{
+  tftp_test_context *ctx = context;
+  _Tftp_Reset();
+  ctx->fd0 = -1;
+  ctx->tftp_handle = NULL;
+  mount_tftp_fs(
+    tftpfs_mount_point,
+    "adaptive,blocksize=" RTEMS_XSTRING(SMALL_BLOCK_SIZE)
+    ",windowsize=" RTEMS_XSTRING(SMALL_WINDOW_SIZE)
+  );
+}
+
+static const T_fixture fixture_adaptive = {
+  .setup = setup_adaptive,
+  .stop = NULL,
+  .teardown = teardown,
+  .scope = NULL,
+  .initial_context = &tftp_context
+};
+
 static void setup_mount_point( void *context )
 {
   (void) context;
@@ -711,6 +753,7 @@ T_TEST_CASE( tftp_initialize_net_config )
   T_eq_u32( config.first_timeout, 400 );
   T_eq_u16( config.options.block_size, 1456 );
   T_eq_u16( config.options.window_size, 8 );
+  T_false( config.read_ahead );
 }
 
 /*
@@ -1116,6 +1159,50 @@ T_TEST_CASE( _Tftpfs_Parse_options_surplus_comma )
   T_eq_u32( flags, 0 );
 }
 
+/*
+ * This is a classical unit test for the function _Tftpfs_Parse_options().
+ * Tests:
+ *   * Option "readahead" has the desired effect.
+ */
+T_TEST_CASE( _Tftpfs_Parse_options_readahead )
+{
+  size_t err_pos;
+  uint32_t flags = 0;
+  tftp_net_config config;
+
+  tftp_initialize_net_config( &config );
+  err_pos = _Tftpfs_Parse_options( "readahead", &config, &flags );
+  T_eq_sz( err_pos, 0 );
+  T_eq_u16( config.options.block_size, TFTP_DEFAULT_BLOCK_SIZE );
+  T_eq_u16( config.options.window_size, TFTP_DEFAULT_WINDOW_SIZE );
+  T_true( config.read_ahead );
+  T_eq_u32( flags, 0 );
+}
+
+/*
+ * This is a classical unit test for the function _Tftpfs_Parse_options().
+ * Tests:
+ *   * Option "adaptive" has the desired effect.
+ */
+T_TEST_CASE( _Tftpfs_Parse_options_adaptive )
+{
+  size_t err_pos;
+  uint32_t flags = 0;
+  tftp_net_config config;
+
+  tftp_initialize_net_config( &config );
+  err_pos = _Tftpfs_Parse_options(
+    "adaptive,blocksize=1468,windowsize=16",
+    &config,
+    &flags
+  );
+  T_eq_sz( err_pos, 0 );
+  T_eq_u16( config.options.block_size, 1468 );
+  T_eq_u16( config.options.window_size, 16 );
+  T_false( config.read_ahead );
+  T_gt_u32( flags, 0 );
+}
+
 /*
  * This is a classical unit test for the function _Tftpfs_Parse_options().
  * Tests:
@@ -5379,6 +5466,435 @@ T_TEST_CASE_FIXTURE( read_file_windowsize_trouble, &fixture_small_opt_size )
   T_no_more_interactions();
 }
 
+/*
+ * Read a file using windowsize = 4 and the read-ahead mount option.
+ * The reader stops within the last DATA packet of the first window
+ * and closes the file.
+ * Tests:
+ *   * The client sends the ACK for the OACK already during open().
+ *   * The client acknowledges a window as soon as the last DATA packet
+ *     of the window has been received and before the user has consumed
+ *     the data of this packet.
+ *   * The client sends an error to the server after the user stops reading
+ *     the file.
+ *   * The test reads a file from the file system in chunks of 10 bytes.
+ */
+T_TEST_CASE_FIXTURE( read_file_read_ahead, &fixture_read_ahead )
+{
+  tftp_test_context *ctx = T_fixture_context();
+  int i;
+  int bytes_read;
+  uint16_t block_num = 0;
+  size_t pos_in_file = 0;
+  const char options[] =
+    TFTP_OPTION_WINDOWSIZE"\0"
+    RTEMS_XSTRING( SMALL_WINDOW_SIZE ) "\0"
+    TFTP_OPTION_BLKSIZE "\0"
+    RTEMS_XSTRING( SMALL_BLOCK_SIZE );
+
+  /* T_set_verbosity( T_VERBOSE ); */
+  _Tftp_Add_interaction_socket( AF_INET, SOCK_DGRAM, 0, TFTP_FIRST_FD );
+  _Tftp_Add_interaction_send_rrq(
+    TFTP_FIRST_FD,
+    tftpfs_file,
+    TFTP_STD_PORT,
+    tftpfs_ipv4_loopback,
+    SMALL_BLOCK_SIZE,
+    SMALL_WINDOW_SIZE,
+    true
+  );
+  _Tftp_Add_interaction_recv_oack(
+    TFTP_FIRST_FD,
+    FIRST_TIMEOUT_MILLISECONDS,
+    SERV_PORT,
+    tftpfs_ipv4_loopback,
+    options,
+    sizeof( options ),
+    true
+  );
+  _Tftp_Add_interaction_send_ack(
+    TFTP_FIRST_FD,
+    block_num,
+    SERV_PORT,
+    tftpfs_ipv4_loopback,
+    true
+  );
+  for ( i = 0; i < SMALL_WINDOW_SIZE; ++i ) {
+    _Tftp_Add_interaction_recv_data(
+      TFTP_FIRST_FD,
+      FIRST_TIMEOUT_MILLISECONDS,
+      SERV_PORT,
+      tftpfs_ipv4_loopback,
+      ++block_num,
+      pos_in_file,
+      SMALL_BLOCK_SIZE, /* Number of bytes transferred */
+      get_file_content,
+      true
+    );
+    pos_in_file += SMALL_BLOCK_SIZE;
+  }
+  _Tftp_Add_interaction_send_ack(
+    TFTP_FIRST_FD,
+    block_num, /* Sent before the user has read all data of this block */
+    SERV_PORT,
+    tftpfs_ipv4_loopback,
+    true
+  );
+  _Tftp_Add_interaction_send_error(
+    TFTP_FIRST_FD,
+    TFTP_ERROR_CODE_NO_USER,
+    SERV_PORT,
+    tftpfs_ipv4_loopback,
+    true
+  );
+  _Tftp_Add_interaction_close( TFTP_FIRST_FD, 0 );
+
+  bytes_read = read_tftp_file(
+    create_tftpfs_path( tftpfs_ipv4_loopback, tftpfs_file ),
+    10, /* Bytes read per call to read() */
+    40, /* Max bytes read from this file */
+    &ctx->fd0
+  );
+  T_eq_int( bytes_read, 40 );
+  T_no_more_interactions();
+}
+
+/*
+ * Read a file using windowsize = 4 and the read-ahead mount option.
+ * The ACK sent ahead for the first window does not reach the server.
+ * Tests:
+ *   * The client does not send the ACK of a window a second time when the
+ *     user asks for more data after having consumed the window.
+ *   * The client re-sends the ACK of the window after a timeout.
+ *   * The client uses the longer timeout after the re-transmission.
+ *   * File transfer ends exactly with the last packet of a window
+ *     (the second last packet is full and the last one is empty).
+ *   * The test reads a file from the file system in chunks of 100 bytes.
+ */
+T_TEST_CASE_FIXTURE( read_file_read_ahead_lost_ack, &fixture_read_ahead )
+{
+  tftp_test_context *ctx = T_fixture_context();
+  int i;
+  int bytes_read;
+  uint16_t block_num = 0;
+  size_t pos_in_file = 0;
+  const char options[] =
+    TFTP_OPTION_WINDOWSIZE"\0"
+    RTEMS_XSTRING( SMALL_WINDOW_SIZE ) "\0"
+    TFTP_OPTION_BLKSIZE "\0"
+    RTEMS_XSTRING( SMALL_BLOCK_SIZE );
+
+  /* T_set_verbosity( T_VERBOSE ); */
+  _Tftp_Add_interaction_socket( AF_INET, SOCK_DGRAM, 0, TFTP_FIRST_FD );
+  _Tftp_Add_interaction_send_rrq(
+    TFTP_FIRST_FD,
+    tftpfs_file,
+    TFTP_STD_PORT,
+    tftpfs_ipv4_loopback,
+    SMALL_BLOCK_SIZE,
+    SMALL_WINDOW_SIZE,
+    true
+  );
+  _Tftp_Add_interaction_recv_oack(
+    TFTP_FIRST_FD,
+    FIRST_TIMEOUT_MILLISECONDS,
+    SERV_PORT,
+    tftpfs_ipv4_loopback,
+    options,
+    sizeof( options ),
+    true
+  );
+  _Tftp_Add_interaction_send_ack(
+    TFTP_FIRST_FD,
+    block_num,
+    SERV_PORT,
+    tftpfs_ipv4_loopback,
+    true
+  );
+  for ( i = 0; i < SMALL_WINDOW_SIZE; ++i ) {
+    _Tftp_Add_interaction_recv_data(
+      TFTP_FIRST_FD,
+      FIRST_TIMEOUT_MILLISECONDS,
+      SERV_PORT,
+      tftpfs_ipv4_loopback,
+      ++block_num,
+      pos_in_file,
+      SMALL_BLOCK_SIZE, /* Number of bytes transferred */
+      get_file_content,
+      true
+    );
+    pos_in_file += SMALL_BLOCK_SIZE;
+  }
+  _Tftp_Add_interaction_send_ack(
+    TFTP_FIRST_FD,
+    block_num, /* The packet is assumed to be lost/does not reach the server */
+    SERV_PORT,
+    tftpfs_ipv4_loopback,
+    true
+  );
+  _Tftp_Add_interaction_recv_nothing(
+    TFTP_FIRST_FD,
+    FIRST_TIMEOUT_MILLISECONDS /* Timeout: No packet received within timeout period */
+  );
+  _Tftp_Add_interaction_send_ack(
+    TFTP_FIRST_FD,
+    block_num,
+    SERV_PORT,
+    tftpfs_ipv4_loopback,
+    true
+  );
+  _Tftp_Add_interaction_recv_data(
+    TFTP_FIRST_FD,
+    TIMEOUT_MILLISECONDS,
+    SERV_PORT,
+    tftpfs_ipv4_loopback,
+    ++block_num,
+    pos_in_file,
+    0, /* Number of bytes transferred */
+    get_file_content,
+    true
+  );
+  _Tftp_Add_interaction_send_ack(
+    TFTP_FIRST_FD,
+    block_num,
+    SERV_PORT,
+    tftpfs_ipv4_loopback,
+    true
+  );
+  _Tftp_Add_interaction_close( TFTP_FIRST_FD, 0 );
+
+  bytes_read = read_tftp_file(
+    create_tftpfs_path( tftpfs_ipv4_loopback, tftpfs_file ),
+    100, /* Bytes read per call to read() */
+    SIZE_MAX,
+    &ctx->fd0
+  );
+  T_eq_int( bytes_read, pos_in_file );
+  T_no_more_interactions();
+}
+
+/*
+ * Read three files using the adaptive mount option with
+ * windowsize = 4 and blocksize = 12.
+ * Tests:
+ *   * The first request uses the option values from the mount options.
+ *   * A timeout during the first transfer halves the window size
+ *     requested for the second transfer.
+ *   * The server reduces the block size in the OACK of the second transfer.
+ *     The client requests this block size for the third transfer.
+ *   * The second transfer is free of packet losses.  Since the block size
+ *     is at its limit, the client requests a window size increased
+ *     by one for the third transfer.
+ *   * The user closes the third file without reading from it.
+ */
+T_TEST_CASE_FIXTURE( read_files_adaptive_options, &fixture_adaptive )
+{
+  tftp_test_context *ctx = T_fixture_context();
+  int bytes_read;
+  uint16_t block_num = 0;
+  size_t pos_in_file = 0;
+  const char options_1[] =
+    TFTP_OPTION_WINDOWSIZE"\0"
+    RTEMS_XSTRING( SMALL_WINDOW_SIZE ) "\0"
+    TFTP_OPTION_BLKSIZE "\0"
+    RTEMS_XSTRING( SMALL_BLOCK_SIZE );
+  const char options_2[] =
+    TFTP_OPTION_WINDOWSIZE"\0" "2\0"
+    TFTP_OPTION_BLKSIZE "\0" "8";
+  const char options_3[] =
+    TFTP_OPTION_WINDOWSIZE"\0" "3\0"
+    TFTP_OPTION_BLKSIZE "\0" "8";
+
+  /* T_set_verbosity( T_VERBOSE ); */
+
+  /* First transfer: A DATA packet is lost */
+  _Tftp_Add_interaction_socket( AF_INET, SOCK_DGRAM, 0, TFTP_FIRST_FD );
+  _Tftp_Add_interaction_send_rrq(
+    TFTP_FIRST_FD,
+    tftpfs_file,
+    TFTP_STD_PORT,
+    tftpfs_ipv4_loopback,
+    SMALL_BLOCK_SIZE,
+    SMALL_WINDOW_SIZE,
+    true
+  );
+  _Tftp_Add_interaction_recv_oack(
+    TFTP_FIRST_FD,
+    FIRST_TIMEOUT_MILLISECONDS,
+    SERV_PORT,
+    tftpfs_ipv4_loopback,
+    options_1,
+    sizeof( options_1 ),
+    true
+  );
+  _Tftp_Add_interaction_send_ack(
+    TFTP_FIRST_FD,
+    block_num,
+    SERV_PORT,
+    tftpfs_ipv4_loopback,
+    true
+  );
+  _Tftp_Add_interaction_recv_data(
+    TFTP_FIRST_FD,
+    FIRST_TIMEOUT_MILLISECONDS,
+    SERV_PORT,
+    tftpfs_ipv4_loopback,
+    ++block_num,
+    pos_in_file,
+    SMALL_BLOCK_SIZE, /* Number of bytes transferred */
+    get_file_content,
+    true
+  );
+  pos_in_file += SMALL_BLOCK_SIZE;
+  _Tftp_Add_interaction_recv_nothing(
+    TFTP_FIRST_FD,
+    FIRST_TIMEOUT_MILLISECONDS /* Timeout: No packet received within timeout period */
+  );
+  _Tftp_Add_interaction_send_ack(
+    TFTP_FIRST_FD,
+    block_num,
+    SERV_PORT,
+    tftpfs_ipv4_loopback,
+    true
+  );
+  _Tftp_Add_interaction_recv_data(
+    TFTP_FIRST_FD,
+    TIMEOUT_MILLISECONDS,
+    SERV_PORT,
+    tftpfs_ipv4_loopback,
+    ++block_num,
+    pos_in_file,
+    0, /* Number of bytes transferred */
+    get_file_content,
+    true
+  );
+  _Tftp_Add_interaction_send_ack(
+    TFTP_FIRST_FD,
+    block_num,
+    SERV_PORT,
+    tftpfs_ipv4_loopback,
+    true
+  );
+  _Tftp_Add_interaction_close( TFTP_FIRST_FD, 0 );
+
+  bytes_read = read_tftp_file(
+    create_tftpfs_path( tftpfs_ipv4_loopback, tftpfs_file ),
+    100, /* Bytes read per call to read() */
+    SIZE_MAX,
+    &ctx->fd0
+  );
+  T_eq_int( bytes_read, pos_in_file );
+  T_no_more_interactions();
+
+  /* Second transfer: The server reduces the block size */
+  block_num = 0;
+  pos_in_file = 0;
+  _Tftp_Add_interaction_socket( AF_INET, SOCK_DGRAM, 0, TFTP_FIRST_FD );
+  _Tftp_Add_interaction_send_rrq(
+    TFTP_FIRST_FD,
+    tftpfs_file,
+    TFTP_STD_PORT,
+    tftpfs_ipv4_loopback,
+    SMALL_BLOCK_SIZE,
+    SMALL_WINDOW_SIZE / 2,
+    true
+  );
+  _Tftp_Add_interaction_recv_oack(
+    TFTP_FIRST_FD,
+    FIRST_TIMEOUT_MILLISECONDS,
+    SERV_PORT,
+    tftpfs_ipv4_loopback,
+    options_2,
+    sizeof( options_2 ),
+    true
+  );
+  _Tftp_Add_interaction_send_ack(
+    TFTP_FIRST_FD,
+    block_num,
+    SERV_PORT,
+    tftpfs_ipv4_loopback,
+    true
+  );
+  _Tftp_Add_interaction_recv_data(
+    TFTP_FIRST_FD,
+    FIRST_TIMEOUT_MILLISECONDS,
+    SERV_PORT,
+    tftpfs_ipv4_loopback,
+    ++block_num,
+    pos_in_file,
+    8, /* Number of bytes transferred */
+    get_file_content,
+    true
+  );
+  pos_in_file += 8;
+  _Tftp_Add_interaction_recv_data(
+    TFTP_FIRST_FD,
+    FIRST_TIMEOUT_MILLISECONDS,
+    SERV_PORT,
+    tftpfs_ipv4_loopback,
+    ++block_num,
+    pos_in_file,
+    0, /* Number of bytes transferred */
+    get_file_content,
+    true
+  );
+  _Tftp_Add_interaction_send_ack(
+    TFTP_FIRST_FD,
+    block_num,
+    SERV_PORT,
+    tftpfs_ipv4_loopback,
+    true
+  );
+  _Tftp_Add_interaction_close( TFTP_FIRST_FD, 0 );
+
+  bytes_read = read_tftp_file(
+    create_tftpfs_path( tftpfs_ipv4_loopback, tftpfs_file ),
+    100, /* Bytes read per call to read() */
+    SIZE_MAX,
+    &ctx->fd0
+  );
+  T_eq_int( bytes_read, pos_in_file );
+  T_no_more_interactions();
+
+  /* Third transfer: Check the option values of the request */
+  _Tftp_Add_interaction_socket( AF_INET, SOCK_DGRAM, 0, TFTP_FIRST_FD );
+  _Tftp_Add_interaction_send_rrq(
+    TFTP_FIRST_FD,
+    tftpfs_file,
+    TFTP_STD_PORT,
+    tftpfs_ipv4_loopback,
+    8,
+    SMALL_WINDOW_SIZE / 2 + 1,
+    true
+  );
+  _Tftp_Add_interaction_recv_oack(
+    TFTP_FIRST_FD,
+    FIRST_TIMEOUT_MILLISECONDS,
+    SERV_PORT,
+    tftpfs_ipv4_loopback,
+    options_3,
+    sizeof( options_3 ),
+    true
+  );
+  _Tftp_Add_interaction_send_error(
+    TFTP_FIRST_FD,
+    TFTP_ERROR_CODE_NO_USER,
+    SERV_PORT,
+    tftpfs_ipv4_loopback,
+    true
+  );
+  _Tftp_Add_interaction_close( TFTP_FIRST_FD, 0 );
+
+  bytes_read = read_tftp_file(
+    create_tftpfs_path( tftpfs_ipv4_loopback, tftpfs_file ),
+    100, /* Bytes read per call to read() */
+    0, /* Max bytes read from this file */
+    &ctx->fd0
+  );
+  T_eq_int( bytes_read, 0 );
+  T_no_more_interactions();
+}
+
 /*
  * Write a file to the server using an option to increase block size.
  * The file is 2 DATA packet and 1 byte long.  No timeouts, packet loss, ...
@@ -0,0 +1,231 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/ioctl.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/counter.h>
+
+#include <dev/can/can.h>
+#include <dev/can/can-bus.h>
+#include <dev/can/can-virtual.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "CAN 1";
+
+#define BUS_PATH "/dev/can0"
+
+#define MAX_USERS 64
+
+#define FRAME_COUNT 4096
+
+#define ID_BASE 0x100
+
+static const size_t user_counts[] = { 1, 16, 64 };
+
+typedef struct {
+  struct rtems_can_bus bus;
+  int sender;
+  int receivers[MAX_USERS];
+} test_context;
+
+static test_context test_instance;
+
+static void setup(test_context *ctx)
+{
+  int rv;
+
+  ctx->bus.chip = rtems_can_virtual_initialize();
+  rtems_test_assert(ctx->bus.chip != NULL);
+
+  rv = rtems_can_bus_register(&ctx->bus, BUS_PATH);
+  rtems_test_assert(rv == 0);
+}
+
+static void open_users(test_context *ctx, size_t users)
+{
+  struct rtems_can_queue_param queue;
+  size_t i;
+  int rv;
+
+  ctx->sender = open(BUS_PATH, O_RDWR);
+  rtems_test_assert(ctx->sender >= 0);
+
+  rv = ioctl(ctx->sender, RTEMS_CAN_DISCARD_QUEUES, RTEMS_CAN_QUEUE_RX);
+  rtems_test_assert(rv == 0);
+
+  rv = ioctl(ctx->sender, RTEMS_CAN_CHIP_START);
+  rtems_test_assert(rv == 0);
+
+  memset(&queue, 0, sizeof(queue));
+  queue.direction = RTEMS_CAN_QUEUE_RX;
+  queue.filter.id_mask = CAN_FRAME_BFF_ID_MASK;
+  queue.filter.flags_mask = CAN_FRAME_ECHO | CAN_FRAME_TXERR | CAN_FRAME_ERR;
+
+  for (i = 0; i < users; ++i) {
+    ctx->receivers[i] = open(BUS_PATH, O_RDWR);
+    rtems_test_assert(ctx->receivers[i] >= 0);
+
+    rv = ioctl(ctx->receivers[i], RTEMS_CAN_DISCARD_QUEUES, RTEMS_CAN_QUEUE_RX);
+    rtems_test_assert(rv == 0);
+
+    /* Each user receives exactly one identifier */
+    queue.filter.id = ID_BASE + (uint32_t) i;
+    rv = ioctl(ctx->receivers[i], RTEMS_CAN_CREATE_QUEUE, &queue);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static void close_users(test_context *ctx, size_t users)
+{
+  size_t i;
+  int rv;
+
+  for (i = 0; i < users; ++i) {
+    rv = close(ctx->receivers[i]);
+    rtems_test_assert(rv == 0);
+  }
+
+  rv = close(ctx->sender);
+  rtems_test_assert(rv == 0);
+}
+
+static void transfer(test_context *ctx, size_t users)
+{
+  struct can_frame tx;
+  struct can_frame rx;
+  size_t frame_size;
+  size_t i;
+  ssize_t n;
+
+  memset(&tx, 0, sizeof(tx));
+  tx.header.dlen = CAN_FRAME_STANDARD_DLEN;
+  frame_size = sizeof(tx.header) + tx.header.dlen;
+
+  for (i = 0; i < FRAME_COUNT; ++i) {
+    size_t user = i % users;
+
+    tx.header.can_id = ID_BASE + (uint32_t) user;
+    memcpy(&tx.data[0], &i, sizeof(i));
+
+    n = write(ctx->sender, &tx, frame_size);
+    rtems_test_assert(n == (ssize_t) frame_size);
+
+    n = read(ctx->receivers[user], &rx, sizeof(rx));
+    rtems_test_assert(n == (ssize_t) frame_size);
+    rtems_test_assert(rx.header.can_id == tx.header.can_id);
+    rtems_test_assert(memcmp(&rx.data[0], &i, sizeof(i)) == 0);
+  }
+}
+
+static void test_users(test_context *ctx, size_t users, const char *sep)
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  uint64_t ns;
+
+  open_users(ctx, users);
+
+  a = rtems_counter_read();
+  transfer(ctx, users);
+  b = rtems_counter_read();
+
+  close_users(ctx, users);
+
+  ns = rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(b, a));
+
+  printf(
+    "%s{\n"
+    "      \"users\": %zu,\n"
+    "      \"frames\": %d,\n"
+    "      \"duration-ns\": %" PRIu64 ",\n"
+    "      \"frames-per-second\": %" PRIu64 "\n"
+    "    }",
+    sep,
+    users,
+    FRAME_COUNT,
+    ns,
+    ns > 0 ? (uint64_t) FRAME_COUNT * 1000000000 / ns : 0
+  );
+}
+
+static void test(test_context *ctx)
+{
+  const char *sep;
+  size_t i;
+
+  setup(ctx);
+
+  printf(
+    "*** BEGIN OF JSON DATA ***\n"
+    "{\n"
+    "  \"samples\": ["
+  );
+
+  sep = "\n    ";
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(user_counts); ++i) {
+    test_users(ctx, user_counts[i], sep);
+    sep = ", ";
+  }
+
+  printf("\n  ]\n}\n*** END OF JSON DATA ***\n");
+}
+
+static void Init(rtems_task_argument arg)
+{
+  (void) arg;
+
+  TEST_BEGIN();
+  test(&test_instance);
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS (MAX_USERS + 8)
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,337 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <rtems/counter.h>
+#include <rtems/cpuusesampler.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "CPUUSE 1";
+
+#define IDLE_TASK_COUNT 64
+
+#define HISTORY 4
+
+#define MAXIMUM_THREADS (IDLE_TASK_COUNT + 8)
+
+#define BUSY_NS 10000000
+
+#define SAMPLE_COUNT 16
+
+typedef struct {
+  rtems_id init;
+  rtems_id busy;
+  rtems_id idle[IDLE_TASK_COUNT];
+  rtems_cpu_usage_thread_sample threads[MAXIMUM_THREADS];
+  uint64_t busy_ns[CPU_MAXIMUM_PROCESSORS];
+  rtems_cpu_usage_sample sample;
+} test_context;
+
+static test_context test_instance;
+
+static void busy_task(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+  rtems_status_code sc;
+
+  rtems_counter_delay_nanoseconds(BUSY_NS);
+
+  sc = rtems_event_transient_send(ctx->init);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_task_exit();
+}
+
+static void idle_task(rtems_task_argument arg)
+{
+  rtems_event_set events;
+
+  (void) arg;
+
+  (void) rtems_event_receive(
+    RTEMS_ALL_EVENTS,
+    RTEMS_EVENT_ANY | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &events
+  );
+  rtems_test_assert(0);
+}
+
+static rtems_id create_task(
+  test_context *ctx,
+  rtems_task_entry entry
+)
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_task_create(
+    rtems_build_name('T', 'A', 'S', 'K'),
+    2,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(id, entry, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  return id;
+}
+
+static void init_sample(test_context *ctx)
+{
+  ctx->sample.threads = ctx->threads;
+  ctx->sample.thread_capacity = RTEMS_ARRAY_SIZE(ctx->threads);
+  ctx->sample.processor_busy_ns = ctx->busy_ns;
+  ctx->sample.processor_capacity = RTEMS_ARRAY_SIZE(ctx->busy_ns);
+}
+
+static uint64_t get_used_ns(const test_context *ctx, rtems_id id)
+{
+  uint32_t i;
+
+  for (i = 0; i < ctx->sample.thread_count; ++i) {
+    if (ctx->sample.threads[i].id == id) {
+      return ctx->sample.threads[i].used_ns;
+    }
+  }
+
+  rtems_test_assert(0);
+  return 0;
+}
+
+static uint64_t get_busy_ns(const test_context *ctx)
+{
+  uint64_t busy_ns;
+  uint32_t i;
+
+  busy_ns = 0;
+
+  for (i = 0; i < ctx->sample.processor_count; ++i) {
+    busy_ns += ctx->sample.processor_busy_ns[i];
+  }
+
+  return busy_ns;
+}
+
+static void test_invalid_config(void)
+{
+  rtems_cpu_usage_sampler_config config = {
+    .history = 1,
+    .maximum_threads = MAXIMUM_THREADS
+  };
+  rtems_cpu_usage_sampler *sampler;
+  rtems_status_code sc;
+
+  sc = rtems_cpu_usage_sampler_create(&config, &sampler);
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+
+  config.history = HISTORY;
+  config.maximum_threads = 0;
+  sc = rtems_cpu_usage_sampler_create(&config, &sampler);
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+}
+
+static void test_usage(test_context *ctx)
+{
+  rtems_cpu_usage_sampler_config config = {
+    .history = HISTORY,
+    .maximum_threads = MAXIMUM_THREADS
+  };
+  rtems_cpu_usage_sampler *sampler;
+  rtems_status_code sc;
+  rtems_id busy;
+
+  sc = rtems_cpu_usage_sampler_create(&config, &sampler);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  init_sample(ctx);
+  sc = rtems_cpu_usage_sampler_get_sample(sampler, 0, &ctx->sample);
+  rtems_test_assert(sc == RTEMS_UNSATISFIED);
+
+  sc = rtems_cpu_usage_sampler_get_sample(sampler, HISTORY - 1, &ctx->sample);
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+
+  busy = create_task(ctx, busy_task);
+  sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_cpu_usage_sampler_take_sample(sampler);
+
+  sc = rtems_cpu_usage_sampler_get_sample(sampler, 0, &ctx->sample);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->sample.number == 1);
+  rtems_test_assert(ctx->sample.interval_ns >= BUSY_NS);
+  rtems_test_assert(ctx->sample.threads_not_recorded == 0);
+  rtems_test_assert(ctx->sample.processor_count > 0);
+  rtems_test_assert(get_used_ns(ctx, busy) >= BUSY_NS);
+  rtems_test_assert(get_busy_ns(ctx) >= BUSY_NS);
+
+  sc = rtems_cpu_usage_sampler_get_sample(sampler, 1, &ctx->sample);
+  rtems_test_assert(sc == RTEMS_UNSATISFIED);
+
+  /* The busy task did not run in the second interval */
+  rtems_cpu_usage_sampler_take_sample(sampler);
+
+  sc = rtems_cpu_usage_sampler_get_sample(sampler, 0, &ctx->sample);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->sample.number == 2);
+  rtems_test_assert(get_used_ns(ctx, rtems_task_self()) > 0);
+
+  sc = rtems_cpu_usage_sampler_get_sample(sampler, 1, &ctx->sample);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->sample.number == 1);
+  rtems_test_assert(get_used_ns(ctx, busy) >= BUSY_NS);
+
+  rtems_cpu_usage_sampler_delete(sampler);
+}
+
+static void test_sampler_task(test_context *ctx)
+{
+  rtems_cpu_usage_sampler_config config = {
+    .period = 1,
+    .priority = 1,
+    .history = HISTORY,
+    .maximum_threads = MAXIMUM_THREADS
+  };
+  rtems_cpu_usage_sampler *sampler;
+  rtems_status_code sc;
+
+  sc = rtems_cpu_usage_sampler_create(&config, &sampler);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_wake_after(4);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  init_sample(ctx);
+  sc = rtems_cpu_usage_sampler_get_sample(sampler, 0, &ctx->sample);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->sample.number >= 2);
+
+  rtems_cpu_usage_sampler_delete(sampler);
+}
+
+static void test_overhead(test_context *ctx)
+{
+  rtems_cpu_usage_sampler_config config = {
+    .history = HISTORY,
+    .maximum_threads = MAXIMUM_THREADS
+  };
+  rtems_cpu_usage_sampler *sampler;
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  rtems_counter_ticks c;
+  rtems_status_code sc;
+  uint64_t sample_ns;
+  uint64_t get_ns;
+  size_t i;
+
+  for (i = 0; i < IDLE_TASK_COUNT; ++i) {
+    ctx->idle[i] = create_task(ctx, idle_task);
+  }
+
+  /* Let the idle tasks block */
+  sc = rtems_task_wake_after(1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_cpu_usage_sampler_create(&config, &sampler);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  init_sample(ctx);
+  sample_ns = 0;
+  get_ns = 0;
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    a = rtems_counter_read();
+    rtems_cpu_usage_sampler_take_sample(sampler);
+    b = rtems_counter_read();
+    sc = rtems_cpu_usage_sampler_get_sample(sampler, 0, &ctx->sample);
+    c = rtems_counter_read();
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    rtems_test_assert(ctx->sample.thread_count > IDLE_TASK_COUNT);
+
+    sample_ns += rtems_counter_ticks_to_nanoseconds(
+      rtems_counter_difference(b, a)
+    );
+    get_ns += rtems_counter_ticks_to_nanoseconds(
+      rtems_counter_difference(c, b)
+    );
+  }
+
+  printf(
+    "*** BEGIN OF JSON DATA ***\n"
+    "{\n"
+    "  \"threads\": %" PRIu32 ",\n"
+    "  \"take-sample-ns\": %" PRIu64 ",\n"
+    "  \"get-sample-ns\": %" PRIu64 "\n"
+    "}\n"
+    "*** END OF JSON DATA ***\n",
+    ctx->sample.thread_count,
+    sample_ns / SAMPLE_COUNT,
+    get_ns / SAMPLE_COUNT
+  );
+
+  rtems_cpu_usage_sampler_delete(sampler);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  (void) arg;
+
+  TEST_BEGIN();
+  ctx->init = rtems_task_self();
+  test_invalid_config();
+  test_usage(ctx);
+  test_sampler_task(ctx);
+  test_overhead(ctx);
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS (3 + IDLE_TASK_COUNT)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
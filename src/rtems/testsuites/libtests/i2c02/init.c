@@ -0,0 +1,462 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <dev/i2c/i2c.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rtems/counter.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "I2C 2";
+
+#define CLIENT_COUNT 4
+
+#define REQUEST_COUNT 256
+
+#define WORKER_PRIORITY 4
+
+#define CLIENT_PRIORITY 3
+
+/* Simulated controller costs for the start/stop framing and each message */
+#define TRANSFER_NS 20000
+
+#define MSG_NS 10000
+
+#define DEVICE_ADDRESS 0x48
+
+typedef enum {
+  MODE_SYNC,
+  MODE_QUEUE,
+  MODE_QUEUE_MERGE
+} test_mode;
+
+static const char * const mode_names[] = {
+  "sync",
+  "queue",
+  "queue-merge"
+};
+
+typedef struct {
+  i2c_bus base;
+  uint32_t transfer_count;
+  uint32_t msg_count;
+} test_bus;
+
+typedef struct test_context test_context;
+
+typedef struct {
+  test_context *ctx;
+  size_t index;
+  i2c_bus_request req;
+  i2c_msg msg;
+  uint8_t buf[2];
+  rtems_binary_semaphore done;
+  rtems_counter_ticks submitted;
+} test_client;
+
+struct test_context {
+  test_bus bus;
+  i2c_bus_queue queue;
+  rtems_id init;
+  test_mode mode;
+  test_client clients[CLIENT_COUNT];
+  rtems_counter_ticks latencies[CLIENT_COUNT * REQUEST_COUNT];
+  size_t order[8];
+  size_t order_count;
+};
+
+static test_context test_instance;
+
+static int test_transfer(i2c_bus *base, i2c_msg *msgs, uint32_t msg_count)
+{
+  test_bus *bus = (test_bus *) base;
+
+  ++bus->transfer_count;
+  bus->msg_count += msg_count;
+  rtems_counter_delay_nanoseconds(TRANSFER_NS + msg_count * MSG_NS);
+
+  return 0;
+}
+
+static void order_done(i2c_bus_request *req, int status)
+{
+  test_context *ctx = &test_instance;
+
+  rtems_test_assert(status == 0);
+  rtems_test_assert(ctx->order_count < RTEMS_ARRAY_SIZE(ctx->order));
+  ctx->order[ctx->order_count] = (size_t) (uintptr_t) req->arg;
+  ++ctx->order_count;
+}
+
+static void setup_request(
+  i2c_bus_request *req,
+  i2c_msg *msg,
+  uint8_t *buf,
+  uint16_t addr,
+  uint32_t priority,
+  uint32_t flags,
+  size_t index
+)
+{
+  memset(msg, 0, sizeof(*msg));
+  msg->addr = addr;
+  msg->flags = I2C_M_RD;
+  msg->len = 2;
+  msg->buf = buf;
+
+  memset(req, 0, sizeof(*req));
+  req->msgs = msg;
+  req->msg_count = 1;
+  req->priority = priority;
+  req->flags = flags;
+  req->done = order_done;
+  req->arg = (void *) (uintptr_t) index;
+}
+
+static void wait_for_order_count(test_context *ctx, size_t count)
+{
+  while (ctx->order_count < count) {
+    rtems_status_code sc;
+
+    sc = rtems_task_wake_after(1);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void test_priority_order(test_context *ctx)
+{
+  static const uint32_t priorities[] = { 5, 1, 3, 1 };
+  static const size_t expected[] = { 1, 3, 2, 0 };
+  i2c_bus_request reqs[RTEMS_ARRAY_SIZE(priorities)];
+  i2c_msg msgs[RTEMS_ARRAY_SIZE(priorities)];
+  uint8_t buf[2];
+  size_t i;
+  int err;
+
+  ctx->order_count = 0;
+  ctx->bus.transfer_count = 0;
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(priorities); ++i) {
+    setup_request(
+      &reqs[i],
+      &msgs[i],
+      buf,
+      DEVICE_ADDRESS,
+      priorities[i],
+      0,
+      i
+    );
+    err = i2c_bus_queue_submit(&ctx->queue, &reqs[i]);
+    rtems_test_assert(err == 0);
+  }
+
+  wait_for_order_count(ctx, RTEMS_ARRAY_SIZE(priorities));
+  rtems_test_assert(ctx->bus.transfer_count == RTEMS_ARRAY_SIZE(priorities));
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(expected); ++i) {
+    rtems_test_assert(ctx->order[i] == expected[i]);
+  }
+}
+
+static void test_merge(test_context *ctx)
+{
+  static const uint16_t addrs[] = {
+    DEVICE_ADDRESS,
+    DEVICE_ADDRESS,
+    DEVICE_ADDRESS,
+    DEVICE_ADDRESS + 1,
+    DEVICE_ADDRESS
+  };
+  i2c_bus_request reqs[RTEMS_ARRAY_SIZE(addrs)];
+  i2c_msg msgs[RTEMS_ARRAY_SIZE(addrs)];
+  uint8_t buf[2];
+  size_t i;
+  int err;
+
+  ctx->order_count = 0;
+  ctx->bus.transfer_count = 0;
+  ctx->bus.msg_count = 0;
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(addrs); ++i) {
+    setup_request(
+      &reqs[i],
+      &msgs[i],
+      buf,
+      addrs[i],
+      1,
+      I2C_BUS_REQUEST_MERGE,
+      i
+    );
+    err = i2c_bus_queue_submit(&ctx->queue, &reqs[i]);
+    rtems_test_assert(err == 0);
+  }
+
+  wait_for_order_count(ctx, RTEMS_ARRAY_SIZE(addrs));
+
+  /* The first three requests share one transfer */
+  rtems_test_assert(ctx->bus.transfer_count == 3);
+  rtems_test_assert(ctx->bus.msg_count == RTEMS_ARRAY_SIZE(addrs));
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(addrs); ++i) {
+    rtems_test_assert(ctx->order[i] == i);
+  }
+}
+
+static void test_invalid_request(test_context *ctx)
+{
+  i2c_bus_request req;
+  int err;
+
+  memset(&req, 0, sizeof(req));
+  err = i2c_bus_queue_submit(&ctx->queue, &req);
+  rtems_test_assert(err == -EINVAL);
+}
+
+static void client_done(i2c_bus_request *req, int status)
+{
+  test_client *client = req->arg;
+
+  rtems_test_assert(status == 0);
+  rtems_binary_semaphore_post(&client->done);
+}
+
+static void client_task(rtems_task_argument arg)
+{
+  test_client *client = (test_client *) arg;
+  test_context *ctx = client->ctx;
+  rtems_counter_ticks *latencies;
+  size_t i;
+
+  latencies = &ctx->latencies[client->index * REQUEST_COUNT];
+
+  for (i = 0; i < REQUEST_COUNT; ++i) {
+    rtems_counter_ticks a;
+    int err;
+
+    a = rtems_counter_read();
+
+    if (ctx->mode == MODE_SYNC) {
+      err = i2c_bus_transfer(&ctx->bus.base, &client->msg, 1);
+      rtems_test_assert(err == 0);
+    } else {
+      err = i2c_bus_queue_submit(&ctx->queue, &client->req);
+      rtems_test_assert(err == 0);
+      rtems_binary_semaphore_wait(&client->done);
+    }
+
+    latencies[i] = rtems_counter_difference(rtems_counter_read(), a);
+  }
+
+  (void) rtems_event_send(ctx->init, RTEMS_EVENT_0 << client->index);
+  rtems_task_exit();
+}
+
+static int compare_ticks(const void *ap, const void *bp)
+{
+  rtems_counter_ticks a = *(const rtems_counter_ticks *) ap;
+  rtems_counter_ticks b = *(const rtems_counter_ticks *) bp;
+
+  return (a > b) - (a < b);
+}
+
+static uint64_t percentile_ns(const test_context *ctx, size_t percent)
+{
+  size_t n = RTEMS_ARRAY_SIZE(ctx->latencies);
+
+  return rtems_counter_ticks_to_nanoseconds(
+    ctx->latencies[(n - 1) * percent / 100]
+  );
+}
+
+static void run_clients(test_context *ctx, test_mode mode, const char *sep)
+{
+  rtems_event_set events;
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  rtems_status_code sc;
+  size_t total;
+  size_t i;
+  uint64_t ns;
+
+  ctx->mode = mode;
+  ctx->bus.transfer_count = 0;
+
+  for (i = 0; i < CLIENT_COUNT; ++i) {
+    test_client *client = &ctx->clients[i];
+
+    client->ctx = ctx;
+    client->index = i;
+    rtems_binary_semaphore_init(&client->done, "Client");
+    setup_request(
+      &client->req,
+      &client->msg,
+      client->buf,
+      DEVICE_ADDRESS,
+      1,
+      mode == MODE_QUEUE_MERGE ? I2C_BUS_REQUEST_MERGE : 0,
+      i
+    );
+    client->req.done = client_done;
+    client->req.arg = client;
+  }
+
+  a = rtems_counter_read();
+
+  for (i = 0; i < CLIENT_COUNT; ++i) {
+    rtems_id id;
+
+    sc = rtems_task_create(
+      rtems_build_name('C', 'L', 'N', 'T'),
+      CLIENT_PRIORITY,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &id
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_start(
+      id,
+      client_task,
+      (rtems_task_argument) &ctx->clients[i]
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_event_receive(
+    (RTEMS_EVENT_0 << CLIENT_COUNT) - 1,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &events
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  b = rtems_counter_read();
+
+  for (i = 0; i < CLIENT_COUNT; ++i) {
+    rtems_binary_semaphore_destroy(&ctx->clients[i].done);
+  }
+
+  ns = rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(b, a));
+  total = CLIENT_COUNT * REQUEST_COUNT;
+  qsort(
+    ctx->latencies,
+    total,
+    sizeof(ctx->latencies[0]),
+    compare_ticks
+  );
+
+  printf(
+    "%s{\n"
+    "      \"mode\": \"%s\",\n"
+    "      \"clients\": %d,\n"
+    "      \"transactions\": %zu,\n"
+    "      \"bus-transfers\": %" PRIu32 ",\n"
+    "      \"duration-ns\": %" PRIu64 ",\n"
+    "      \"transactions-per-second\": %" PRIu64 ",\n"
+    "      \"latency-p50-ns\": %" PRIu64 ",\n"
+    "      \"latency-p90-ns\": %" PRIu64 ",\n"
+    "      \"latency-p99-ns\": %" PRIu64 ",\n"
+    "      \"latency-max-ns\": %" PRIu64 "\n"
+    "    }",
+    sep,
+    mode_names[mode],
+    CLIENT_COUNT,
+    total,
+    ctx->bus.transfer_count,
+    ns,
+    ns > 0 ? (uint64_t) total * 1000000000 / ns : 0,
+    percentile_ns(ctx, 50),
+    percentile_ns(ctx, 90),
+    percentile_ns(ctx, 99),
+    percentile_ns(ctx, 100)
+  );
+}
+
+static void test(test_context *ctx)
+{
+  int err;
+
+  ctx->init = rtems_task_self();
+
+  err = i2c_bus_init(&ctx->bus.base);
+  rtems_test_assert(err == 0);
+  ctx->bus.base.transfer = test_transfer;
+
+  err = i2c_bus_queue_init(&ctx->queue, &ctx->bus.base, WORKER_PRIORITY);
+  rtems_test_assert(err == 0);
+
+  test_invalid_request(ctx);
+  test_priority_order(ctx);
+  test_merge(ctx);
+
+  printf(
+    "*** BEGIN OF JSON DATA ***\n"
+    "{\n"
+    "  \"samples\": ["
+  );
+
+  run_clients(ctx, MODE_SYNC, "\n    ");
+  run_clients(ctx, MODE_QUEUE, ", ");
+  run_clients(ctx, MODE_QUEUE_MERGE, ", ");
+
+  printf("\n  ]\n}\n*** END OF JSON DATA ***\n");
+
+  i2c_bus_queue_destroy(&ctx->queue);
+  i2c_bus_destroy(&ctx->bus.base);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  (void) arg;
+
+  TEST_BEGIN();
+  test(&test_instance);
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS (2 + 2 * CLIENT_COUNT)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,493 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/irq-extension.h>
+
+#include <bsp/irq-generic.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "IRQS 2";
+
+#define RAISE_COUNT 1000
+
+#define REQUEST_COUNT 4
+
+#define SERVER_PRIORITY 2
+
+#define LONG_INTERVAL 100000
+
+typedef struct {
+  rtems_id init_task;
+  uint32_t server_index;
+  uint32_t other_server_index;
+  rtems_vector_number vector;
+  rtems_interrupt_server_request requests[REQUEST_COUNT];
+  rtems_interrupt_server_request sync;
+  rtems_interrupt_server_request other_sync;
+  uint32_t serviced;
+  const char *case_sep;
+} test_context;
+
+static test_context test_instance;
+
+static rtems_interrupt_server_control server_control;
+
+static rtems_interrupt_server_control other_server_control;
+
+static const rtems_interrupt_server_config server_config = {
+  .name = rtems_build_name('I', 'R', 'Q', 'B'),
+  .priority = SERVER_PRIORITY,
+  .storage_size = RTEMS_MINIMUM_STACK_SIZE,
+  .modes = RTEMS_DEFAULT_MODES,
+  .attributes = RTEMS_DEFAULT_ATTRIBUTES
+};
+
+static const rtems_interrupt_server_config other_server_config = {
+  .name = rtems_build_name('I', 'R', 'Q', 'O'),
+  .priority = SERVER_PRIORITY,
+  .storage_size = RTEMS_MINIMUM_STACK_SIZE,
+  .modes = RTEMS_DEFAULT_MODES,
+  .attributes = RTEMS_DEFAULT_ATTRIBUTES
+};
+
+static void has_installed(
+  void *arg,
+  const char *info,
+  rtems_option options,
+  rtems_interrupt_handler handler,
+  void *handler_arg
+)
+{
+  bool *installed;
+
+  (void) info;
+  (void) options;
+  (void) handler;
+  (void) handler_arg;
+
+  installed = arg;
+  *installed = true;
+}
+
+static rtems_vector_number get_raisable_vector(void)
+{
+  rtems_vector_number vector;
+
+  for (vector = 0; vector < BSP_INTERRUPT_VECTOR_COUNT; ++vector) {
+    rtems_status_code sc;
+    rtems_interrupt_attributes attr;
+    bool installed;
+
+    sc = rtems_interrupt_get_attributes(vector, &attr);
+
+    if (
+      sc != RTEMS_SUCCESSFUL || !attr.is_maskable || !attr.can_raise
+        || !attr.can_enable || !attr.can_clear
+    ) {
+      continue;
+    }
+
+    installed = false;
+    sc = rtems_interrupt_handler_iterate(vector, has_installed, &installed);
+
+    if (sc == RTEMS_SUCCESSFUL && !installed) {
+      break;
+    }
+  }
+
+  return vector;
+}
+
+static void request_handler(void *arg)
+{
+  test_context *ctx;
+
+  ctx = arg;
+  ++ctx->serviced;
+}
+
+static void sync_handler(void *arg)
+{
+  test_context *ctx;
+  rtems_status_code sc;
+
+  ctx = arg;
+  sc = rtems_event_transient_send(ctx->init_task);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void interrupt_handler(void *arg)
+{
+  test_context *ctx;
+  size_t i;
+
+  ctx = arg;
+  (void) rtems_interrupt_clear(ctx->vector);
+
+  for (i = 0; i < REQUEST_COUNT; ++i) {
+    rtems_interrupt_server_request_submit(&ctx->requests[i]);
+  }
+}
+
+static void run_case(
+  test_context *ctx,
+  const char *name,
+  rtems_task_priority priority,
+  uint32_t coalescing_count
+)
+{
+  rtems_status_code sc;
+  rtems_interrupt_server_statistics before;
+  rtems_interrupt_server_statistics after;
+  rtems_task_priority previous;
+  rtems_counter_ticks t0;
+  rtems_counter_ticks d;
+  size_t i;
+
+  for (i = 0; i < REQUEST_COUNT; ++i) {
+    rtems_interrupt_server_request_set_coalescing(
+      &ctx->requests[i],
+      coalescing_count,
+      1
+    );
+  }
+
+  ctx->serviced = 0;
+
+  sc = rtems_interrupt_server_get_statistics(ctx->server_index, &before);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_set_priority(RTEMS_SELF, priority, &previous);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  t0 = rtems_counter_read();
+
+  for (i = 0; i < RAISE_COUNT; ++i) {
+    sc = rtems_interrupt_raise(ctx->vector);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  rtems_interrupt_server_request_submit(&ctx->sync);
+  sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  d = rtems_counter_difference(rtems_counter_read(), t0);
+
+  sc = rtems_task_set_priority(RTEMS_SELF, previous, &previous);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* Let the coalescing interval of deferred requests expire */
+  rtems_task_wake_after(2);
+
+  sc = rtems_interrupt_server_get_statistics(ctx->server_index, &after);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_test_assert(ctx->serviced > 0);
+  rtems_test_assert(ctx->serviced <= RAISE_COUNT * REQUEST_COUNT);
+
+  printf(
+    "%s{\n"
+    "    \"case\": \"%s\",\n"
+    "    \"interrupts\": %i,\n"
+    "    \"requests-per-interrupt\": %i,\n"
+    "    \"coalescing-count\": %" PRIu32 ",\n"
+    "    \"ns-per-interrupt\": %" PRIu64 ",\n"
+    "    \"serviced\": %" PRIu32 ",\n"
+    "    \"wakeups\": %lu,\n"
+    "    \"dispatches\": %lu,\n"
+    "    \"max-batch\": %lu,\n"
+    "    \"merged\": %lu\n"
+    "  }",
+    ctx->case_sep,
+    name,
+    RAISE_COUNT,
+    REQUEST_COUNT,
+    coalescing_count,
+    rtems_counter_ticks_to_nanoseconds(d) / RAISE_COUNT,
+    ctx->serviced,
+    after.wakeups - before.wakeups,
+    after.dispatches - before.dispatches,
+    after.max_batch,
+    after.coalesced - before.coalesced + after.errors - before.errors
+  );
+  ctx->case_sep = ", ";
+}
+
+static void synchronize(rtems_interrupt_server_request *sync)
+{
+  rtems_status_code sc;
+
+  rtems_interrupt_server_request_submit(sync);
+  sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void install_deferred_handler(test_context *ctx, uint32_t count)
+{
+  rtems_status_code sc;
+
+  sc = rtems_interrupt_server_handler_install(
+    ctx->server_index,
+    ctx->vector,
+    "IRQS2",
+    RTEMS_INTERRUPT_UNIQUE,
+    request_handler,
+    ctx
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_interrupt_server_set_coalescing(
+    ctx->server_index,
+    ctx->vector,
+    count,
+    LONG_INTERVAL
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_interrupt_vector_enable(ctx->vector);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  ctx->serviced = 0;
+
+  /* The server defers the entry until the count threshold is reached */
+  sc = rtems_interrupt_raise(ctx->vector);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  synchronize(&ctx->sync);
+  rtems_test_assert(ctx->serviced == 0);
+}
+
+static void check_removed(test_context *ctx)
+{
+  rtems_status_code sc;
+  bool installed;
+
+  installed = false;
+  sc = rtems_interrupt_handler_iterate(ctx->vector, has_installed, &installed);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(!installed);
+  rtems_test_assert(ctx->serviced == 0);
+}
+
+static void test_remove_deferred(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  install_deferred_handler(ctx, 16);
+
+  /* The server shall drop the deferred entry before it is freed */
+  sc = rtems_interrupt_server_handler_remove(
+    ctx->server_index,
+    ctx->vector,
+    request_handler,
+    ctx
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  synchronize(&ctx->sync);
+  check_removed(ctx);
+}
+
+static void test_move_deferred(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  install_deferred_handler(ctx, 2);
+
+  /* The source server shall forward the deferred entry */
+  sc = rtems_interrupt_server_move(
+    ctx->server_index,
+    ctx->vector,
+    ctx->other_server_index
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* Reach the count threshold, the destination server services the entry */
+  sc = rtems_interrupt_raise(ctx->vector);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  synchronize(&ctx->other_sync);
+  rtems_test_assert(ctx->serviced == 1);
+
+  /* Defer the entry on the destination server and remove it there */
+  ctx->serviced = 0;
+  sc = rtems_interrupt_raise(ctx->vector);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  synchronize(&ctx->other_sync);
+  rtems_test_assert(ctx->serviced == 0);
+
+  sc = rtems_interrupt_server_handler_remove(
+    ctx->other_server_index,
+    ctx->vector,
+    request_handler,
+    ctx
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  synchronize(&ctx->other_sync);
+  synchronize(&ctx->sync);
+  check_removed(ctx);
+}
+
+static void test(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_task_priority priority;
+  size_t i;
+
+  ctx->init_task = rtems_task_self();
+  ctx->vector = get_raisable_vector();
+
+  if (ctx->vector == BSP_INTERRUPT_VECTOR_COUNT) {
+    printf("no raisable interrupt vector available\n");
+    return;
+  }
+
+  sc = rtems_interrupt_server_create(
+    &server_control,
+    &server_config,
+    &ctx->server_index
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (i = 0; i < REQUEST_COUNT; ++i) {
+    sc = rtems_interrupt_server_request_initialize(
+      ctx->server_index,
+      &ctx->requests[i],
+      request_handler,
+      ctx
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_interrupt_server_request_initialize(
+    ctx->server_index,
+    &ctx->sync,
+    sync_handler,
+    ctx
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_interrupt_server_create(
+    &other_server_control,
+    &other_server_config,
+    &ctx->other_server_index
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_interrupt_server_request_initialize(
+    ctx->other_server_index,
+    &ctx->other_sync,
+    sync_handler,
+    ctx
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_interrupt_handler_install(
+    ctx->vector,
+    "IRQS2",
+    RTEMS_INTERRUPT_UNIQUE,
+    interrupt_handler,
+    ctx
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_interrupt_vector_enable(ctx->vector);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_set_priority(RTEMS_SELF, RTEMS_CURRENT_PRIORITY, &priority);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(priority < SERVER_PRIORITY);
+
+  printf("*** BEGIN OF JSON DATA ***\n[\n  ");
+  ctx->case_sep = "";
+
+  /* The server preempts the task after each interrupt */
+  run_case(ctx, "immediate", SERVER_PRIORITY + 1, 0);
+
+  /* The server services all interrupts in one batch */
+  run_case(ctx, "batched", priority, 0);
+
+  /* The server services the requests after 16 interrupts */
+  run_case(ctx, "coalescing", SERVER_PRIORITY + 1, 16);
+
+  printf("\n]\n*** END OF JSON DATA ***\n");
+
+  sc = rtems_interrupt_vector_disable(ctx->vector);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_interrupt_handler_remove(ctx->vector, interrupt_handler, ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (i = 0; i < REQUEST_COUNT; ++i) {
+    rtems_interrupt_server_request_destroy(&ctx->requests[i]);
+  }
+
+  test_remove_deferred(ctx);
+  test_move_deferred(ctx);
+
+  rtems_interrupt_server_request_destroy(&ctx->sync);
+  rtems_interrupt_server_request_destroy(&ctx->other_sync);
+
+  sc = rtems_interrupt_server_delete(ctx->server_index);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_interrupt_server_delete(ctx->other_server_index);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  (void) arg;
+
+  TEST_BEGIN();
+  test(&test_instance);
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 3
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_PRIORITY 1
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,280 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/latency.h>
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/printer.h>
+
+#include <string.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "LATENCY 1";
+
+static void test_buckets(void)
+{
+  uint32_t ticks;
+  size_t bucket;
+
+  for (bucket = 0; bucket < RTEMS_LATENCY_BUCKET_COUNT; ++bucket) {
+    uint32_t lower;
+
+    lower = rtems_latency_bucket_lower_bound(bucket);
+    rtems_test_assert(rtems_latency_bucket(lower) == bucket);
+
+    if (bucket > 0) {
+      rtems_test_assert(rtems_latency_bucket(lower - 1) == bucket - 1);
+    }
+  }
+
+  rtems_test_assert(rtems_latency_bucket(0) == 0);
+  rtems_test_assert(rtems_latency_bucket(3) == 3);
+  rtems_test_assert(rtems_latency_bucket(4) == 4);
+  rtems_test_assert(rtems_latency_bucket(7) == 7);
+  rtems_test_assert(rtems_latency_bucket(8) == 8);
+  rtems_test_assert(rtems_latency_bucket(9) == 8);
+  rtems_test_assert(
+    rtems_latency_bucket(0xffffffff) == RTEMS_LATENCY_BUCKET_COUNT - 1
+  );
+
+  /* The bucket width shall be at most a quarter of the lower bound */
+  for (ticks = 4; ticks < 100000; ticks += 7) {
+    uint32_t lower;
+
+    lower = rtems_latency_bucket_lower_bound(rtems_latency_bucket(ticks));
+    rtems_test_assert(lower <= ticks);
+    rtems_test_assert(ticks - lower <= lower / 4);
+  }
+}
+
+static void test_percentile(void)
+{
+  rtems_latency_histogram histogram;
+
+  memset(&histogram, 0, sizeof(histogram));
+  rtems_test_assert(rtems_latency_percentile(&histogram, 500) == 0);
+
+  histogram.count = 1000;
+  histogram.max = 200;
+  histogram.buckets[rtems_latency_bucket(10)] = 990;
+  histogram.buckets[rtems_latency_bucket(100)] = 9;
+  histogram.buckets[rtems_latency_bucket(200)] = 1;
+
+  rtems_test_assert(rtems_latency_percentile(&histogram, 500) == 11);
+  rtems_test_assert(rtems_latency_percentile(&histogram, 990) == 11);
+  rtems_test_assert(rtems_latency_percentile(&histogram, 999) == 111);
+  rtems_test_assert(rtems_latency_percentile(&histogram, 1000) == 200);
+}
+
+static uint32_t bucket_sum(const rtems_latency_histogram *histogram)
+{
+  uint32_t sum;
+  size_t i;
+
+  sum = 0;
+
+  for (i = 0; i < RTEMS_LATENCY_BUCKET_COUNT; ++i) {
+    sum += histogram->buckets[i];
+  }
+
+  return sum;
+}
+
+static void test_histograms(void)
+{
+  rtems_status_code sc;
+  rtems_latency_histogram histogram;
+  rtems_printer printer;
+  int i;
+
+  sc = rtems_latency_get_histogram(0, RTEMS_LATENCY_INTERRUPT_HANDLER, NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_latency_get_histogram(
+    rtems_scheduler_get_processor_maximum(),
+    RTEMS_LATENCY_INTERRUPT_HANDLER,
+    &histogram
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+
+  sc = rtems_latency_get_histogram(0, RTEMS_LATENCY_KIND_COUNT, &histogram);
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+
+  rtems_latency_reset();
+
+  sc = rtems_latency_get_histogram(
+    0,
+    RTEMS_LATENCY_INTERRUPT_HANDLER,
+    &histogram
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* The clock tick may have been recorded right after the reset */
+  rtems_test_assert(histogram.count <= 1);
+
+  for (i = 0; i < 10; ++i) {
+    rtems_task_wake_after(1);
+  }
+
+  sc = rtems_latency_get_histogram(
+    0,
+    RTEMS_LATENCY_INTERRUPT_HANDLER,
+    &histogram
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(histogram.count >= 10);
+  rtems_test_assert(bucket_sum(&histogram) == histogram.count);
+  rtems_test_assert(
+    rtems_latency_bucket(histogram.max) <= RTEMS_LATENCY_BUCKET_COUNT - 1
+  );
+
+  /* Each clock tick wakes up the Init task */
+  sc = rtems_latency_get_histogram(
+    0,
+    RTEMS_LATENCY_THREAD_WAKEUP,
+    &histogram
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(histogram.count >= 10);
+  rtems_test_assert(bucket_sum(&histogram) == histogram.count);
+
+  rtems_print_printer_printf(&printer);
+  rtems_latency_report(&printer);
+}
+
+static volatile bool asr_done;
+
+static void asr(rtems_signal_set signals)
+{
+  rtems_test_assert(signals == RTEMS_SIGNAL_0);
+  asr_done = true;
+}
+
+static void send_signal(rtems_id timer_id, void *arg)
+{
+  rtems_status_code sc;
+
+  (void) timer_id;
+
+  sc = rtems_signal_send(*(rtems_id *) arg, RTEMS_SIGNAL_0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static uint32_t get_wakeup_count(void)
+{
+  rtems_status_code sc;
+  rtems_latency_histogram histogram;
+
+  sc = rtems_latency_get_histogram(
+    0,
+    RTEMS_LATENCY_THREAD_WAKEUP,
+    &histogram
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  return histogram.count;
+}
+
+static void test_signal_from_isr(void)
+{
+  rtems_status_code sc;
+  rtems_id task_id;
+  rtems_id timer_id;
+  uint32_t count;
+
+  task_id = rtems_task_self();
+
+  sc = rtems_signal_catch(asr, RTEMS_DEFAULT_MODES);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_timer_create(rtems_build_name('T', 'I', 'M', 'R'), &timer_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* Start with a clock tick, so that the timer fires while we are busy */
+  rtems_task_wake_after(1);
+
+  sc = rtems_timer_fire_after(timer_id, 1, send_signal, &task_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /*
+   * The signal sent by the clock tick interrupt requests a thread dispatch to
+   * carry out the ASR, however, the executing thread remains the heir.  This
+   * shall not start a wake-up measurement.
+   */
+  while (!asr_done) {
+    /* Wait */
+  }
+
+  count = get_wakeup_count();
+
+  /*
+   * The next clock tick wakes us up.  Only this wake-up shall be recorded, a
+   * stale measurement start would be recorded by the switch to the idle
+   * thread.
+   */
+  rtems_task_wake_after(1);
+  rtems_test_assert(get_wakeup_count() == count + 1);
+
+  sc = rtems_timer_delete(timer_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  (void) arg;
+
+  TEST_BEGIN();
+  test_buckets();
+  test_percentile();
+  test_histograms();
+  test_signal_from_isr();
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_LATENCY_HISTOGRAMS
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -32,8 +32,11 @@
 #include "tmacros.h"
 
 #include <libfdt.h>
+#include <stdio.h>
 #include <string.h>
 
+#include <rtems/rtems-fdt.h>
+
 #include "some.h"
 
 /*
@@ -134,6 +137,243 @@ static void test(void)
   rtems_test_assert(cell == 0x12345678);
 }
 
+#define BUS_COUNT 32
+
+#define DEVICES_PER_BUS 32
+
+#define DEVICE_COUNT (BUS_COUNT * DEVICES_PER_BUS)
+
+#define COMPATIBLE_COUNT 16
+
+static uint64_t big_fdt[256 * 1024 / sizeof(uint64_t)];
+
+/*
+ * Create a large synthetic device tree.  Each device node has a phandle, a
+ * reference to another device node, and two compatible strings.
+ */
+static void make_big_fdt(void *fdt)
+{
+  char name[32];
+  char compatible[64];
+  int status;
+  int b;
+  int d;
+
+  status = fdt_create(fdt, sizeof(big_fdt));
+  rtems_test_assert(status == 0);
+  status = fdt_finish_reservemap(fdt);
+  rtems_test_assert(status == 0);
+  status = fdt_begin_node(fdt, "");
+  rtems_test_assert(status == 0);
+  status = fdt_property_string(fdt, "compatible", "rtems,big");
+  rtems_test_assert(status == 0);
+
+  for (b = 0; b < BUS_COUNT; ++b) {
+    snprintf(name, sizeof(name), "bus@%x", b);
+    status = fdt_begin_node(fdt, name);
+    rtems_test_assert(status == 0);
+    status = fdt_property_string(fdt, "compatible", "simple-bus");
+    rtems_test_assert(status == 0);
+
+    for (d = 0; d < DEVICES_PER_BUS; ++d) {
+      uint32_t phandle = (uint32_t) (b * DEVICES_PER_BUS + d + 1);
+      int len;
+
+      snprintf(name, sizeof(name), "dev@%x", d);
+      status = fdt_begin_node(fdt, name);
+      rtems_test_assert(status == 0);
+      len = snprintf(
+        compatible,
+        sizeof(compatible),
+        "rtems,dev-%d",
+        (int) (phandle % COMPATIBLE_COUNT)
+      );
+      strcpy(&compatible[len + 1], "rtems,generic");
+      len += 1 + sizeof("rtems,generic");
+      status = fdt_property(fdt, "compatible", compatible, len);
+      rtems_test_assert(status == 0);
+      status = fdt_property_u32(fdt, "phandle", phandle);
+      rtems_test_assert(status == 0);
+      status = fdt_property_u32(fdt, "clocks", DEVICE_COUNT + 1 - phandle);
+      rtems_test_assert(status == 0);
+      status = fdt_end_node(fdt);
+      rtems_test_assert(status == 0);
+    }
+
+    status = fdt_end_node(fdt);
+    rtems_test_assert(status == 0);
+  }
+
+  status = fdt_end_node(fdt);
+  rtems_test_assert(status == 0);
+  status = fdt_finish(fdt);
+  rtems_test_assert(status == 0);
+}
+
+/*
+ * Probe all device nodes by compatible string and resolve their clocks
+ * reference like a BSP does at boot time.
+ */
+static int probe_libfdt(const void *fdt)
+{
+  char compatible[32];
+  int probed = 0;
+  int c;
+
+  for (c = 0; c < COMPATIBLE_COUNT; ++c) {
+    int node;
+
+    snprintf(compatible, sizeof(compatible), "rtems,dev-%d", c);
+    node = fdt_node_offset_by_compatible(fdt, -1, compatible);
+
+    while (node >= 0) {
+      const fdt32_t *clocks;
+      int len;
+
+      clocks = fdt_getprop(fdt, node, "clocks", &len);
+      rtems_test_assert(len == 4);
+      rtems_test_assert(
+        fdt_node_offset_by_phandle(fdt, fdt32_to_cpu(*clocks)) >= 0
+      );
+      ++probed;
+      node = fdt_node_offset_by_compatible(fdt, node, compatible);
+    }
+  }
+
+  return probed;
+}
+
+static int probe_rtems_fdt(rtems_fdt_handle *handle)
+{
+  char compatible[32];
+  int probed = 0;
+  int c;
+
+  for (c = 0; c < COMPATIBLE_COUNT; ++c) {
+    int node;
+
+    snprintf(compatible, sizeof(compatible), "rtems,dev-%d", c);
+    node = rtems_fdt_node_offset_by_compatible(handle, -1, compatible);
+
+    while (node >= 0) {
+      const void *clocks;
+      int len;
+
+      clocks = rtems_fdt_getprop(handle, node, "clocks", &len);
+      rtems_test_assert(len == 4);
+      rtems_test_assert(
+        rtems_fdt_node_offset_by_phandle(
+          handle,
+          rtems_fdt_get_uint32(clocks)
+        ) >= 0
+      );
+      ++probed;
+      node = rtems_fdt_node_offset_by_compatible(handle, node, compatible);
+    }
+  }
+
+  return probed;
+}
+
+static void test_compatible(
+  rtems_fdt_handle *handle,
+  const void *fdt,
+  const char *compatible,
+  int expected_count
+)
+{
+  int node;
+  int count = 0;
+
+  node = fdt_node_offset_by_compatible(fdt, -1, compatible);
+  rtems_test_assert(
+    rtems_fdt_node_offset_by_compatible(handle, -1, compatible) == node
+  );
+
+  while (node >= 0) {
+    int next;
+
+    ++count;
+    next = fdt_node_offset_by_compatible(fdt, node, compatible);
+    rtems_test_assert(
+      rtems_fdt_node_offset_by_compatible(handle, node, compatible) == next
+    );
+    node = next;
+  }
+
+  rtems_test_assert(node == -FDT_ERR_NOTFOUND);
+  rtems_test_assert(count == expected_count);
+}
+
+static void test_index(void)
+{
+  const void *fdt = big_fdt;
+  rtems_fdt_handle handle;
+  char compatible[32];
+  char path[64];
+  uint64_t t0;
+  uint64_t t1;
+  uint64_t t2;
+  uint32_t phandle;
+  int status;
+  int node;
+  int c;
+
+  make_big_fdt(big_fdt);
+
+  rtems_fdt_init_handle(&handle);
+  status = rtems_fdt_register(fdt, &handle);
+  rtems_test_assert(status == 0);
+
+  for (phandle = 1; phandle <= DEVICE_COUNT; ++phandle) {
+    const char *name;
+    int len;
+
+    node = fdt_node_offset_by_phandle(fdt, phandle);
+    rtems_test_assert(node >= 0);
+    rtems_test_assert(rtems_fdt_node_offset_by_phandle(&handle, phandle) == node);
+
+    status = fdt_get_path(fdt, node, path, sizeof(path));
+    rtems_test_assert(status == 0);
+    name = rtems_fdt_get_name(&handle, node, &len);
+    rtems_test_assert(name != NULL);
+    rtems_test_assert(strcmp(name, path) == 0);
+    rtems_test_assert(len == (int) strlen(path));
+    rtems_test_assert(rtems_fdt_path_offset(&handle, path) == node);
+  }
+
+  node = rtems_fdt_node_offset_by_phandle(&handle, DEVICE_COUNT + 1);
+  rtems_test_assert(node == -FDT_ERR_NOTFOUND);
+  node = rtems_fdt_node_offset_by_phandle(&handle, 0);
+  rtems_test_assert(node == -FDT_ERR_BADPHANDLE);
+
+  for (c = 0; c < COMPATIBLE_COUNT; ++c) {
+    snprintf(compatible, sizeof(compatible), "rtems,dev-%d", c);
+    test_compatible(&handle, fdt, compatible, DEVICE_COUNT / COMPATIBLE_COUNT);
+  }
+
+  test_compatible(&handle, fdt, "rtems,generic", DEVICE_COUNT);
+  test_compatible(&handle, fdt, "simple-bus", BUS_COUNT);
+  test_compatible(&handle, fdt, "rtems,big", 1);
+  test_compatible(&handle, fdt, "rtems", 0);
+  test_compatible(&handle, fdt, "rtems,dev-100", 0);
+
+  t0 = rtems_clock_get_uptime_nanoseconds();
+  rtems_test_assert(probe_libfdt(fdt) == DEVICE_COUNT);
+  t1 = rtems_clock_get_uptime_nanoseconds();
+  rtems_test_assert(probe_rtems_fdt(&handle) == DEVICE_COUNT);
+  t2 = rtems_clock_get_uptime_nanoseconds();
+
+  printf(
+    "probe %d nodes: libfdt %" PRIu64 "us, rtems-fdt index %" PRIu64 "us\n",
+    DEVICE_COUNT,
+    (t1 - t0) / 1000,
+    (t2 - t1) / 1000
+  );
+
+  rtems_fdt_release_handle(&handle);
+}
+
 static void Init(rtems_task_argument arg)
 {
   (void) arg;
@@ -141,6 +381,7 @@ static void Init(rtems_task_argument arg)
   TEST_BEGIN();
 
   test();
+  test_index();
 
   TEST_END();
   rtems_test_exit(0);
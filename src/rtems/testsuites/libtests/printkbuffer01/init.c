@@ -0,0 +1,257 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/printkbuffer.h>
+#include <rtems.h>
+#include <rtems/bspIo.h>
+#include <rtems/counter.h>
+
+#include <inttypes.h>
+#include <string.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "PRINTKBUFFER 1";
+
+#define LATENCY_SAMPLES 16
+
+typedef struct {
+  char captured[ 2048 ];
+  size_t captured_size;
+  BSP_output_char_function_type output_char;
+  rtems_id timer;
+  rtems_counter_ticks isr_ticks;
+} test_context;
+
+static test_context test_instance;
+
+static void capture_char(char c)
+{
+  test_context *ctx;
+
+  ctx = &test_instance;
+
+  if (ctx->captured_size < sizeof(ctx->captured) - 1) {
+    ctx->captured[ctx->captured_size] = c;
+    ++ctx->captured_size;
+  }
+}
+
+static void start_capture(test_context *ctx)
+{
+  rtems_printk_buffer_flush();
+  memset(ctx->captured, 0, sizeof(ctx->captured));
+  ctx->captured_size = 0;
+  ctx->output_char = BSP_output_char;
+  BSP_output_char = capture_char;
+}
+
+static void stop_capture(test_context *ctx)
+{
+  rtems_printk_buffer_flush();
+  BSP_output_char = ctx->output_char;
+}
+
+static void fire_timer(
+  test_context *ctx,
+  rtems_timer_service_routine_entry routine
+)
+{
+  rtems_status_code sc;
+
+  sc = rtems_timer_fire_after(ctx->timer, 1, routine, ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_wake_after(2);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void print_in_isr(rtems_id timer, void *arg)
+{
+  (void) timer;
+  (void) arg;
+
+  rtems_test_assert(rtems_interrupt_is_in_progress());
+  printk("2");
+}
+
+static void test_order(test_context *ctx)
+{
+  start_capture(ctx);
+  printk("1");
+  fire_timer(ctx, print_in_isr);
+  printk("%i", 3);
+  rtems_test_assert(putk("4") == 2);
+  stop_capture(ctx);
+
+  rtems_test_assert(ctx->captured_size == 6);
+  rtems_test_assert(memcmp(ctx->captured, "1234\r\n", 6) == 0);
+}
+
+static void test_overflow(test_context *ctx)
+{
+  uint32_t discarded;
+  int i;
+
+  rtems_test_assert(
+    rtems_printk_buffer_get_discarded(rtems_scheduler_get_processor_maximum())
+      == 0
+  );
+
+  discarded = rtems_printk_buffer_get_discarded(0);
+
+  /*
+   * The drain task has a lower priority than the Init task, so the ring
+   * buffer is not drained before the flush.  Each message needs 32 bytes of
+   * the 1024 bytes ring buffer.
+   */
+  start_capture(ctx);
+
+  for (i = 0; i < 40; ++i) {
+    printk("message %02i\n", i);
+  }
+
+  rtems_test_assert(rtems_printk_buffer_get_discarded(0) - discarded == 8);
+  stop_capture(ctx);
+
+  rtems_test_assert(memcmp(ctx->captured, "message 00\r\n", 12) == 0);
+  rtems_test_assert(
+    strstr(ctx->captured, "message 31\r\n\r\n*** PRINTK BUFFER: PROCESSOR 0 "
+      "DISCARDED 8 MESSAGES ***\r\n") != NULL
+  );
+  rtems_test_assert(strstr(ctx->captured, "message 32") == NULL);
+}
+
+static rtems_counter_ticks measure_printk(void)
+{
+  rtems_counter_ticks begin;
+  int i;
+
+  begin = rtems_counter_read();
+
+  for (i = 0; i < LATENCY_SAMPLES; ++i) {
+    printk(".");
+  }
+
+  return rtems_counter_difference(rtems_counter_read(), begin);
+}
+
+static void measure_in_isr(rtems_id timer, void *arg)
+{
+  test_context *ctx;
+
+  (void) timer;
+  ctx = arg;
+  ctx->isr_ticks = measure_printk();
+}
+
+static void report_latency(const char *context, rtems_counter_ticks ticks)
+{
+  printk(
+    "printk latency in %s context: %" PRIu64 "ns\n",
+    context,
+    rtems_counter_ticks_to_nanoseconds(ticks) / LATENCY_SAMPLES
+  );
+}
+
+static void test_latency(test_context *ctx)
+{
+  int ( *handler )( const char *, va_list );
+  rtems_counter_ticks direct_task;
+  rtems_counter_ticks direct_isr;
+  rtems_counter_ticks buffered_task;
+  rtems_counter_ticks buffered_isr;
+
+  rtems_test_assert(_Vprintk_Handler == _Printk_Buffer_Vprintk);
+  rtems_printk_buffer_flush();
+
+  buffered_task = measure_printk();
+  fire_timer(ctx, measure_in_isr);
+  buffered_isr = ctx->isr_ticks;
+  rtems_printk_buffer_flush();
+
+  handler = _Vprintk_Handler;
+  _Vprintk_Handler = NULL;
+  direct_task = measure_printk();
+  fire_timer(ctx, measure_in_isr);
+  direct_isr = ctx->isr_ticks;
+  putk("");
+  _Vprintk_Handler = handler;
+
+  report_latency("buffered task", buffered_task);
+  report_latency("buffered interrupt", buffered_isr);
+  report_latency("direct task", direct_task);
+  report_latency("direct interrupt", direct_isr);
+  rtems_printk_buffer_flush();
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx;
+  rtems_status_code sc;
+
+  (void) arg;
+  ctx = &test_instance;
+
+  TEST_BEGIN();
+
+  sc = rtems_timer_create(rtems_build_name('P', 'R', 'N', 'K'), &ctx->timer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  test_order(ctx);
+  test_overflow(ctx);
+  test_latency(ctx);
+
+  sc = rtems_timer_delete(ctx->timer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+/* The Init task and the printk() buffer drain task */
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_PRINTK_BUFFER_SIZE 1024
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -2,6 +2,7 @@
 
 /*
  * Copyright (c) 2014 embedded brains GmbH & Co. KG
+ * Copyright (c) 2026 The RTEMS Project
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -34,11 +35,17 @@
 #include <sha384.h>
 #include <sha512.h>
 #include <sha512t.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
 #include <stdio.h>
 #include <string.h>
+#include <unistd.h>
 
 #include "tmacros.h"
 
+#include <rtems/counter.h>
+#include <rtems/sha256parallel.h>
 #include <rtems/stackchk.h>
 
 const char rtems_test_name[] = "SHA";
@@ -382,6 +389,342 @@ static void test_sha512_256(void)
   }
 }
 
+static void test_sha256_multi(void)
+{
+  SHA256_CTX ctx[RTEMS_ARRAY_SIZE(test_vectors)];
+  SHA256_CTX *hash[RTEMS_ARRAY_SIZE(test_vectors)];
+  const void *in[RTEMS_ARRAY_SIZE(test_vectors)];
+  size_t len[RTEMS_ARRAY_SIZE(test_vectors)];
+  size_t i;
+
+  printf("test SHA256 multi-buffer\n");
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(test_vectors); ++i) {
+    SHA256_Init(&ctx[i]);
+    hash[i] = &ctx[i];
+    in[i] = test_vectors[i];
+    len[i] = strlen(test_vectors[i]);
+  }
+
+  SHA256_Update_multi(hash, in, len, RTEMS_ARRAY_SIZE(test_vectors));
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(test_vectors); ++i) {
+    unsigned char r[SHA256_DIGEST_LENGTH];
+
+    SHA256_Final(r, &ctx[i]);
+    rtems_test_assert(
+      memcmp(&r[0], &test_sha256_results[i][0], sizeof(r)) == 0
+    );
+  }
+}
+
+/*
+ * The lengths are neither equal nor multiples of the block size, so that the
+ * lanes finish at different blocks and leave partial trailing blocks.
+ */
+static const size_t test_multi_lengths[] = { 0, 3, 63, 65, 130, 1000 };
+
+static unsigned char test_multi_data[1000];
+
+static const unsigned char test_sha256_multi_results
+[RTEMS_ARRAY_SIZE(test_multi_lengths)][SHA256_DIGEST_LENGTH] = {
+  {
+    0xe3, 0xb0, 0xc4, 0x42, 0x98, 0xfc, 0x1c, 0x14,
+    0x9a, 0xfb, 0xf4, 0xc8, 0x99, 0x6f, 0xb9, 0x24,
+    0x27, 0xae, 0x41, 0xe4, 0x64, 0x9b, 0x93, 0x4c,
+    0xa4, 0x95, 0x99, 0x1b, 0x78, 0x52, 0xb8, 0x55
+  }, {
+    0x64, 0x76, 0x74, 0xa2, 0x96, 0x19, 0x74, 0x42,
+    0xf5, 0x18, 0xbc, 0xca, 0x32, 0x3e, 0xc6, 0x05,
+    0xdd, 0x8d, 0x09, 0x8b, 0x2d, 0x4f, 0x22, 0xee,
+    0x1f, 0xdc, 0xdd, 0x2b, 0xb7, 0x53, 0xa1, 0x89
+  }, {
+    0x28, 0x0e, 0xd3, 0xe8, 0xff, 0x1d, 0xf8, 0x45,
+    0xb2, 0xe7, 0xdf, 0xe6, 0xac, 0x6c, 0xee, 0x81,
+    0x7b, 0xef, 0x20, 0xe7, 0x83, 0xcc, 0x65, 0xab,
+    0xc4, 0x1b, 0x81, 0x8b, 0x4d, 0x2f, 0xe0, 0x76
+  }, {
+    0x78, 0x83, 0x67, 0xc7, 0x3c, 0x7d, 0xdf, 0x4c,
+    0x53, 0xf6, 0x5e, 0x68, 0xcc, 0x0d, 0x94, 0x3e,
+    0x62, 0x27, 0xab, 0x55, 0xb0, 0xe7, 0x8b, 0xa6,
+    0x3a, 0xce, 0x82, 0x2b, 0x1c, 0x63, 0x01, 0xc0
+  }, {
+    0x1c, 0x7c, 0x3b, 0x5e, 0xee, 0x94, 0xd4, 0xfa,
+    0x8b, 0x41, 0x75, 0x4b, 0x89, 0x15, 0x3e, 0x50,
+    0x49, 0x18, 0x38, 0xd0, 0xd3, 0xe4, 0x9b, 0x02,
+    0x73, 0xd6, 0xf1, 0x2c, 0xae, 0x12, 0xe3, 0x87
+  }, {
+    0x50, 0x97, 0xe7, 0xd5, 0x87, 0x35, 0x2f, 0x50,
+    0x97, 0x06, 0x2a, 0xe6, 0x79, 0xf3, 0x7b, 0xda,
+    0x58, 0x02, 0xd9, 0xf8, 0x75, 0xab, 0xa1, 0x4c,
+    0x8c, 0xb4, 0xd1, 0xa1, 0x88, 0xad, 0xa1, 0x79
+  }
+};
+
+static void test_sha256_multi_unaligned(void)
+{
+  SHA256_CTX ctx[RTEMS_ARRAY_SIZE(test_multi_lengths)];
+  SHA256_CTX *hash[RTEMS_ARRAY_SIZE(test_multi_lengths)];
+  const void *in[RTEMS_ARRAY_SIZE(test_multi_lengths)];
+  size_t len[RTEMS_ARRAY_SIZE(test_multi_lengths)];
+  size_t i;
+
+  printf("test SHA256 multi-buffer unaligned\n");
+
+  for (i = 0; i < sizeof(test_multi_data); ++i) {
+    test_multi_data[i] = (unsigned char) (i * 31 + 7);
+  }
+
+  /*
+   * Feed a short prefix through the single-stream update first, so that the
+   * multi-buffer update starts with partially filled context buffers.
+   */
+  for (i = 0; i < RTEMS_ARRAY_SIZE(test_multi_lengths); ++i) {
+    size_t prefix;
+
+    prefix = i * 11;
+
+    if (prefix > test_multi_lengths[i]) {
+      prefix = test_multi_lengths[i];
+    }
+
+    SHA256_Init(&ctx[i]);
+    SHA256_Update(&ctx[i], &test_multi_data[0], prefix);
+    hash[i] = &ctx[i];
+    in[i] = &test_multi_data[prefix];
+    len[i] = test_multi_lengths[i] - prefix;
+  }
+
+  SHA256_Update_multi(hash, in, len, RTEMS_ARRAY_SIZE(test_multi_lengths));
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(test_multi_lengths); ++i) {
+    unsigned char r[SHA256_DIGEST_LENGTH];
+
+    SHA256_Final(r, &ctx[i]);
+    rtems_test_assert(
+      memcmp(&r[0], &test_sha256_multi_results[i][0], sizeof(r)) == 0
+    );
+  }
+}
+
+#define BENCHMARK_BUFFER_COUNT 16
+
+#define BENCHMARK_BUFFER_SIZE (16 * 1024)
+
+static unsigned char
+benchmark_buffers[BENCHMARK_BUFFER_COUNT][BENCHMARK_BUFFER_SIZE];
+
+static unsigned char
+benchmark_digests[BENCHMARK_BUFFER_COUNT][SHA256_DIGEST_LENGTH];
+
+/* Not a multiple of the chunk and block size */
+#define BENCHMARK_FILE_SIZE (3 * RTEMS_SHA256_PARALLEL_CHUNK_SIZE + 100)
+
+#define BENCHMARK_FILE "/sha256.bin"
+
+static unsigned char benchmark_file_digest[SHA256_DIGEST_LENGTH];
+
+static rtems_sha256_parallel_job benchmark_jobs[BENCHMARK_BUFFER_COUNT + 2];
+
+static void benchmark_fill(void)
+{
+  uint32_t x;
+  size_t i;
+  size_t j;
+
+  x = 1;
+
+  for (i = 0; i < BENCHMARK_BUFFER_COUNT; ++i) {
+    for (j = 0; j < BENCHMARK_BUFFER_SIZE; ++j) {
+      x = x * 1664525 + 1013904223;
+      benchmark_buffers[i][j] = (unsigned char) (x >> 24);
+    }
+  }
+}
+
+static void benchmark_create_file(void)
+{
+  SHA256_CTX ctx;
+  const unsigned char *data;
+  ssize_t n;
+  int fd;
+  int rv;
+
+  RTEMS_STATIC_ASSERT(
+    BENCHMARK_FILE_SIZE <= BENCHMARK_BUFFER_SIZE,
+    BENCHMARK_FILE_SIZE
+  );
+
+  data = &benchmark_buffers[1][0];
+  fd = open(BENCHMARK_FILE, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  rtems_test_assert(fd >= 0);
+
+  n = write(fd, data, BENCHMARK_FILE_SIZE);
+  rtems_test_assert(n == BENCHMARK_FILE_SIZE);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  SHA256_Init(&ctx);
+  SHA256_Update(&ctx, data, BENCHMARK_FILE_SIZE);
+  SHA256_Final(benchmark_file_digest, &ctx);
+}
+
+static void benchmark_report(const char *name, rtems_counter_ticks t)
+{
+  uint64_t ns;
+  uint64_t bytes;
+
+  ns = rtems_counter_ticks_to_nanoseconds(t);
+  bytes = (uint64_t) BENCHMARK_BUFFER_COUNT * BENCHMARK_BUFFER_SIZE;
+
+  if (ns == 0) {
+    ns = 1;
+  }
+
+  printf(
+    "SHA256 %s: %" PRIu64 " KiB/s\n",
+    name,
+    (bytes * 1000000000) / (ns * 1024)
+  );
+}
+
+static void test_sha256_serial_benchmark(void)
+{
+  rtems_counter_ticks t0;
+  rtems_counter_ticks t1;
+  size_t i;
+
+  t0 = rtems_counter_read();
+
+  for (i = 0; i < BENCHMARK_BUFFER_COUNT; ++i) {
+    SHA256_CTX ctx;
+
+    SHA256_Init(&ctx);
+    SHA256_Update(&ctx, &benchmark_buffers[i][0], BENCHMARK_BUFFER_SIZE);
+    SHA256_Final(&benchmark_digests[i][0], &ctx);
+  }
+
+  t1 = rtems_counter_read();
+  benchmark_report("serial", rtems_counter_difference(t1, t0));
+}
+
+static void test_sha256_multi_benchmark(void)
+{
+  SHA256_CTX ctx[BENCHMARK_BUFFER_COUNT];
+  SHA256_CTX *hash[BENCHMARK_BUFFER_COUNT];
+  const void *in[BENCHMARK_BUFFER_COUNT];
+  size_t len[BENCHMARK_BUFFER_COUNT];
+  rtems_counter_ticks t0;
+  rtems_counter_ticks t1;
+  size_t i;
+
+  t0 = rtems_counter_read();
+
+  for (i = 0; i < BENCHMARK_BUFFER_COUNT; ++i) {
+    SHA256_Init(&ctx[i]);
+    hash[i] = &ctx[i];
+    in[i] = &benchmark_buffers[i][0];
+    len[i] = BENCHMARK_BUFFER_SIZE;
+  }
+
+  SHA256_Update_multi(hash, in, len, BENCHMARK_BUFFER_COUNT);
+
+  for (i = 0; i < BENCHMARK_BUFFER_COUNT; ++i) {
+    unsigned char r[SHA256_DIGEST_LENGTH];
+
+    SHA256_Final(r, &ctx[i]);
+    rtems_test_assert(memcmp(&r[0], &benchmark_digests[i][0], sizeof(r)) == 0);
+  }
+
+  t1 = rtems_counter_read();
+  benchmark_report("multi-buffer", rtems_counter_difference(t1, t0));
+}
+
+static void test_sha256_parallel(uint32_t worker_count)
+{
+  rtems_sha256_parallel_job *jobs;
+  rtems_status_code sc;
+  rtems_counter_ticks t0;
+  rtems_counter_ticks t1;
+  size_t i;
+
+  jobs = &benchmark_jobs[0];
+  memset(jobs, 0xff, sizeof(benchmark_jobs));
+
+  for (i = 0; i < BENCHMARK_BUFFER_COUNT; ++i) {
+    jobs[i].path = NULL;
+    jobs[i].data = &benchmark_buffers[i][0];
+    jobs[i].size = BENCHMARK_BUFFER_SIZE;
+  }
+
+  t0 = rtems_counter_read();
+  sc = rtems_sha256_parallel(jobs, BENCHMARK_BUFFER_COUNT, worker_count);
+  t1 = rtems_counter_read();
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (i = 0; i < BENCHMARK_BUFFER_COUNT; ++i) {
+    rtems_test_assert(jobs[i].error == 0);
+    rtems_test_assert(
+      memcmp(&jobs[i].digest[0], &benchmark_digests[i][0], SHA256_DIGEST_LENGTH)
+        == 0
+    );
+  }
+
+  if (worker_count == 0) {
+    benchmark_report("parallel", rtems_counter_difference(t1, t0));
+  }
+
+  /*
+   * Mix buffers of different sizes with a file which does not exist and a
+   * file which does.
+   */
+  for (i = 0; i < BENCHMARK_BUFFER_COUNT; ++i) {
+    jobs[i].size = i * 1000;
+  }
+
+  jobs[BENCHMARK_BUFFER_COUNT].path = "/does/not/exist";
+  jobs[BENCHMARK_BUFFER_COUNT + 1].path = BENCHMARK_FILE;
+  sc = rtems_sha256_parallel(jobs, BENCHMARK_BUFFER_COUNT + 2, worker_count);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (i = 0; i < BENCHMARK_BUFFER_COUNT; ++i) {
+    SHA256_CTX ctx;
+    unsigned char r[SHA256_DIGEST_LENGTH];
+
+    SHA256_Init(&ctx);
+    SHA256_Update(&ctx, &benchmark_buffers[i][0], i * 1000);
+    SHA256_Final(r, &ctx);
+    rtems_test_assert(jobs[i].error == 0);
+    rtems_test_assert(memcmp(&jobs[i].digest[0], &r[0], sizeof(r)) == 0);
+  }
+
+  rtems_test_assert(jobs[BENCHMARK_BUFFER_COUNT].error == ENOENT);
+  rtems_test_assert(jobs[BENCHMARK_BUFFER_COUNT + 1].error == 0);
+  rtems_test_assert(
+    memcmp(
+      &jobs[BENCHMARK_BUFFER_COUNT + 1].digest[0],
+      &benchmark_file_digest[0],
+      SHA256_DIGEST_LENGTH
+    ) == 0
+  );
+
+  sc = rtems_sha256_parallel(jobs, 0, worker_count);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_sha256_benchmark(void)
+{
+  printf("test SHA256 benchmark\n");
+  benchmark_fill();
+  benchmark_create_file();
+  test_sha256_serial_benchmark();
+  test_sha256_multi_benchmark();
+  test_sha256_parallel(1);
+  test_sha256_parallel(2);
+  test_sha256_parallel(0);
+}
+
 static void Init(rtems_task_argument arg)
 {
   (void) arg;
@@ -394,6 +737,9 @@ static void Init(rtems_task_argument arg)
   test_sha512();
   test_sha512_224();
   test_sha512_256();
+  test_sha256_multi();
+  test_sha256_multi_unaligned();
+  test_sha256_benchmark();
   rtems_stack_checker_report_usage();
 
   TEST_END();
@@ -403,7 +749,13 @@ static void Init(rtems_task_argument arg)
 #define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
 #define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
 
-#define CONFIGURE_MAXIMUM_TASKS 1
+#define CONFIGURE_MAXIMUM_PROCESSORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS 4
+
+#define CONFIGURE_EXTRA_TASK_STACKS (3 * 2 * RTEMS_MINIMUM_STACK_SIZE)
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 8
 
 #define CONFIGURE_STACK_CHECKER_ENABLED
 
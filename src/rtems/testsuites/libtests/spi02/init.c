@@ -0,0 +1,215 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <dev/spi/spi.h>
+
+#include <errno.h>
+#include <string.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPI 2";
+
+#define WORKER_PRIORITY 4
+
+#define REQUEST_COUNT 5
+
+typedef struct {
+  spi_bus base;
+  uint32_t transfer_count;
+  uint32_t msg_count;
+} test_bus;
+
+typedef struct {
+  test_bus bus;
+  spi_bus_queue queue;
+  spi_bus_request reqs[REQUEST_COUNT];
+  spi_ioc_transfer msgs[REQUEST_COUNT];
+  uint8_t buf[4];
+  size_t order[REQUEST_COUNT];
+  size_t order_count;
+} test_context;
+
+static test_context test_instance;
+
+static int test_transfer(
+  spi_bus *base,
+  const spi_ioc_transfer *msgs,
+  uint32_t msg_count
+)
+{
+  test_bus *bus = (test_bus *) base;
+  uint32_t i;
+
+  /* A merged transfer must address exactly one device */
+  for (i = 1; i < msg_count; ++i) {
+    rtems_test_assert(msgs[i].cs == msgs[0].cs);
+  }
+
+  ++bus->transfer_count;
+  bus->msg_count += msg_count;
+
+  return 0;
+}
+
+static void test_done(spi_bus_request *req, int status)
+{
+  test_context *ctx = &test_instance;
+
+  rtems_test_assert(status == 0);
+  rtems_test_assert(ctx->order_count < REQUEST_COUNT);
+  ctx->order[ctx->order_count] = (size_t) (uintptr_t) req->arg;
+  ++ctx->order_count;
+}
+
+static void submit(
+  test_context *ctx,
+  const uint8_t *cs,
+  const uint32_t *priorities,
+  uint32_t flags
+)
+{
+  size_t i;
+
+  ctx->order_count = 0;
+  ctx->bus.transfer_count = 0;
+  ctx->bus.msg_count = 0;
+
+  for (i = 0; i < REQUEST_COUNT; ++i) {
+    spi_ioc_transfer *msg = &ctx->msgs[i];
+    spi_bus_request *req = &ctx->reqs[i];
+    int err;
+
+    memset(msg, 0, sizeof(*msg));
+    msg->len = sizeof(ctx->buf);
+    msg->rx_buf = ctx->buf;
+    msg->cs = cs[i];
+
+    memset(req, 0, sizeof(*req));
+    req->msgs = msg;
+    req->msg_count = 1;
+    req->priority = priorities[i];
+    req->flags = flags;
+    req->done = test_done;
+    req->arg = (void *) (uintptr_t) i;
+
+    err = spi_bus_queue_submit(&ctx->queue, req);
+    rtems_test_assert(err == 0);
+  }
+
+  while (ctx->order_count < REQUEST_COUNT) {
+    rtems_status_code sc;
+
+    sc = rtems_task_wake_after(1);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void test_priority_order(test_context *ctx)
+{
+  static const uint8_t cs[REQUEST_COUNT] = { 0, 0, 0, 0, 0 };
+  static const uint32_t priorities[REQUEST_COUNT] = { 5, 1, 3, 1, 5 };
+  static const size_t expected[REQUEST_COUNT] = { 1, 3, 2, 0, 4 };
+  size_t i;
+
+  submit(ctx, cs, priorities, 0);
+  rtems_test_assert(ctx->bus.transfer_count == REQUEST_COUNT);
+
+  for (i = 0; i < REQUEST_COUNT; ++i) {
+    rtems_test_assert(ctx->order[i] == expected[i]);
+  }
+}
+
+static void test_merge(test_context *ctx)
+{
+  static const uint8_t cs[REQUEST_COUNT] = { 0, 0, 1, 1, 0 };
+  static const uint32_t priorities[REQUEST_COUNT] = { 1, 1, 1, 1, 1 };
+  size_t i;
+
+  submit(ctx, cs, priorities, SPI_BUS_REQUEST_MERGE);
+  rtems_test_assert(ctx->bus.transfer_count == 3);
+  rtems_test_assert(ctx->bus.msg_count == REQUEST_COUNT);
+
+  for (i = 0; i < REQUEST_COUNT; ++i) {
+    rtems_test_assert(ctx->order[i] == i);
+  }
+}
+
+static void test_invalid_request(test_context *ctx)
+{
+  spi_bus_request req;
+  int err;
+
+  memset(&req, 0, sizeof(req));
+  err = spi_bus_queue_submit(&ctx->queue, &req);
+  rtems_test_assert(err == -EINVAL);
+}
+
+static void test(test_context *ctx)
+{
+  int err;
+
+  err = spi_bus_init(&ctx->bus.base);
+  rtems_test_assert(err == 0);
+  ctx->bus.base.transfer = test_transfer;
+
+  err = spi_bus_queue_init(&ctx->queue, &ctx->bus.base, WORKER_PRIORITY);
+  rtems_test_assert(err == 0);
+
+  test_invalid_request(ctx);
+  test_priority_order(ctx);
+  test_merge(ctx);
+
+  spi_bus_queue_destroy(&ctx->queue);
+  spi_bus_destroy(&ctx->bus.base);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  (void) arg;
+
+  TEST_BEGIN();
+  test(&test_instance);
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,239 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <rtems/counter.h>
+#include <rtems/stackchk.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "STACKCHK 5";
+
+#define TASK_COUNT 32
+
+#define TASK_STACK_SIZE (16 * 1024)
+
+#define USE_STACK_SIZE 1024
+
+#define USE_STACK_LEVELS 4
+
+#define EVENT_USE_STACK RTEMS_EVENT_0
+
+#define EVENT_DONE RTEMS_EVENT_1
+
+typedef struct {
+  rtems_id init;
+  rtems_id tasks[TASK_COUNT];
+  uintptr_t used[TASK_COUNT];
+  size_t visited;
+} test_context;
+
+static test_context test_instance;
+
+static RTEMS_NO_INLINE void use_stack(int level)
+{
+  volatile char buf[USE_STACK_SIZE];
+  size_t i;
+
+  for (i = 0; i < sizeof(buf); ++i) {
+    buf[i] = (char) i;
+  }
+
+  if (level > 0) {
+    use_stack(level - 1);
+  }
+}
+
+static void worker_task(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+
+  while (true) {
+    rtems_event_set events;
+    rtems_status_code sc;
+
+    sc = rtems_event_receive(
+      EVENT_USE_STACK,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    use_stack(USE_STACK_LEVELS);
+
+    sc = rtems_event_send(ctx->init, EVENT_DONE);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void record_usage(const rtems_stack_checker_info *info, void *arg)
+{
+  test_context *ctx = arg;
+  size_t i;
+
+  ++ctx->visited;
+
+  for (i = 0; i < TASK_COUNT; ++i) {
+    if (info->id == ctx->tasks[i]) {
+      rtems_test_assert(info->used != UINTPTR_MAX);
+      ctx->used[i] = info->used;
+    }
+  }
+}
+
+static uint64_t iterate(test_context *ctx)
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+
+  ctx->visited = 0;
+  a = rtems_counter_read();
+  rtems_stack_checker_iterate(record_usage, ctx);
+  b = rtems_counter_read();
+  rtems_test_assert(ctx->visited > TASK_COUNT);
+
+  return rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(b, a));
+}
+
+static void use_stack_of_task(test_context *ctx, size_t i)
+{
+  rtems_event_set events;
+  rtems_status_code sc;
+
+  sc = rtems_event_send(ctx->tasks[i], EVENT_USE_STACK);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_event_receive(
+    EVENT_DONE,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &events
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test(test_context *ctx)
+{
+  uintptr_t used[TASK_COUNT];
+  uint64_t cold_ns;
+  uint64_t clean_ns;
+  uint64_t dirty_ns;
+  rtems_status_code sc;
+  size_t i;
+
+  ctx->init = rtems_task_self();
+
+  for (i = 0; i < TASK_COUNT; ++i) {
+    sc = rtems_task_create(
+      rtems_build_name('W', 'O', 'R', 'K'),
+      2,
+      TASK_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &ctx->tasks[i]
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_start(
+      ctx->tasks[i],
+      worker_task,
+      (rtems_task_argument) ctx
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  /* Let the workers run until they wait for events */
+  sc = rtems_task_wake_after(1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  cold_ns = iterate(ctx);
+  memcpy(used, ctx->used, sizeof(used));
+
+  /* Nothing ran in between, so the remembered high water marks are used */
+  clean_ns = iterate(ctx);
+  rtems_test_assert(memcmp(used, ctx->used, sizeof(used)) == 0);
+
+  use_stack_of_task(ctx, 0);
+
+  /* Only the stack of the first worker has to be scanned again */
+  dirty_ns = iterate(ctx);
+  rtems_test_assert(ctx->used[0] >= used[0] + USE_STACK_SIZE);
+  rtems_test_assert(
+    memcmp(&used[1], &ctx->used[1], sizeof(used[1]) * (TASK_COUNT - 1)) == 0
+  );
+
+  printf(
+    "*** BEGIN OF JSON DATA ***\n"
+    "{\n"
+    "  \"tasks\": %d,\n"
+    "  \"task-stack-size\": %d,\n"
+    "  \"iterate-cold-ns\": %" PRIu64 ",\n"
+    "  \"iterate-clean-ns\": %" PRIu64 ",\n"
+    "  \"iterate-one-dirty-ns\": %" PRIu64 "\n"
+    "}\n"
+    "*** END OF JSON DATA ***\n",
+    TASK_COUNT,
+    TASK_STACK_SIZE,
+    cold_ns,
+    clean_ns,
+    dirty_ns
+  );
+}
+
+static void Init(rtems_task_argument arg)
+{
+  (void) arg;
+
+  TEST_BEGIN();
+  test(&test_instance);
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS (1 + TASK_COUNT)
+
+#define CONFIGURE_EXTRA_TASK_STACKS (TASK_COUNT * TASK_STACK_SIZE)
+
+#define CONFIGURE_STACK_CHECKER_ENABLED
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,301 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <rtems/counter.h>
+#include <rtems/termiostypes.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "TERMIOS 12";
+
+#define BUFFER_SIZE 4096
+
+#define TRANSFER_SIZE (128 * 1024)
+
+static const size_t block_sizes[] = { 1, 16, 256, 1024 };
+
+typedef struct {
+  rtems_termios_device_context base;
+  rtems_termios_tty *tty;
+  const char *output_buf;
+  size_t output_pending;
+} device_context;
+
+typedef struct {
+  device_context dev;
+  int fd;
+  struct termios term;
+  char tx_buf[BUFFER_SIZE];
+  char rx_buf[BUFFER_SIZE];
+} test_context;
+
+static test_context test_instance = {
+  .dev = {
+    .base = RTEMS_TERMIOS_DEVICE_CONTEXT_INITIALIZER("Loopback")
+  }
+};
+
+static bool first_open(
+  rtems_termios_tty *tty,
+  rtems_termios_device_context *base,
+  struct termios *term,
+  rtems_libio_open_close_args_t *args
+)
+{
+  (void) term;
+  (void) args;
+
+  device_context *dev = (device_context *) base;
+
+  dev->tty = tty;
+
+  return true;
+}
+
+static void write_loopback(
+  rtems_termios_device_context *base,
+  const char *buf,
+  size_t len
+)
+{
+  device_context *dev = (device_context *) base;
+
+  dev->output_buf = buf;
+  dev->output_pending = len;
+}
+
+static const rtems_termios_device_handler handler = {
+  .first_open = first_open,
+  .write = write_loopback,
+  .mode = TERMIOS_IRQ_DRIVEN
+};
+
+/*
+ * Complete the pending transmissions and feed the transmitted characters back
+ * to the receiver.  This is done in task context to emulate the transmit and
+ * receive interrupts of a device in loopback mode.
+ */
+static void loopback(device_context *dev)
+{
+  while (dev->output_pending > 0) {
+    size_t len;
+    int dropped;
+
+    len = dev->output_pending;
+    dev->output_pending = 0;
+
+    dropped = rtems_termios_enqueue_raw_characters(
+      dev->tty,
+      dev->output_buf,
+      (int) len
+    );
+    rtems_test_assert(dropped == 0);
+
+    rtems_termios_dequeue_characters(dev->tty, (int) len);
+  }
+}
+
+static void set_term(test_context *ctx, bool raw)
+{
+  int rv;
+
+  rv = tcgetattr(ctx->fd, &ctx->term);
+  rtems_test_assert(rv == 0);
+
+  ctx->term.c_iflag &= ~(IGNBRK | BRKINT | PARMRK | ISTRIP
+    | INLCR | IGNCR | ICRNL | IXON | IXOFF);
+  ctx->term.c_lflag &= ~(ECHO | ECHOE | ECHOK | ECHONL | ECHOPRT
+    | ECHOCTL | ECHOKE | ICANON | ISIG | IEXTEN);
+  ctx->term.c_cflag &= ~(CSIZE | PARENB | CRTSCTS);
+  ctx->term.c_cflag |= CS8;
+  ctx->term.c_oflag &= ~(OPOST | ONLRET | ONLCR | OCRNL | ONLRET
+    | TABDLY | OLCUC);
+
+  if (!raw) {
+    /* Force the per-character input and output processing */
+    ctx->term.c_iflag |= ICRNL;
+    ctx->term.c_lflag |= ISIG;
+    ctx->term.c_oflag |= OPOST | ONLCR;
+  }
+
+  ctx->term.c_cc[VMIN] = 0;
+  ctx->term.c_cc[VTIME] = 0;
+
+  rv = tcsetattr(ctx->fd, TCSANOW, &ctx->term);
+  rtems_test_assert(rv == 0);
+}
+
+static void setup(test_context *ctx)
+{
+  rtems_status_code sc;
+  size_t i;
+
+  for (i = 0; i < BUFFER_SIZE; ++i) {
+    ctx->tx_buf[i] = (char) ('a' + i % 26);
+  }
+
+  sc = rtems_termios_bufsize(BUFFER_SIZE, BUFFER_SIZE, BUFFER_SIZE);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_termios_initialize();
+
+  sc = rtems_termios_device_install(
+    "/loopback",
+    &handler,
+    NULL,
+    &ctx->dev.base
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  ctx->fd = open("/loopback", O_RDWR);
+  rtems_test_assert(ctx->fd >= 0);
+}
+
+static void transfer_block(test_context *ctx, size_t block_size)
+{
+  ssize_t n;
+  size_t done;
+
+  n = write(ctx->fd, ctx->tx_buf, block_size);
+  rtems_test_assert(n == (ssize_t) block_size);
+
+  loopback(&ctx->dev);
+
+  done = 0;
+
+  while (done < block_size) {
+    n = read(ctx->fd, &ctx->rx_buf[done], block_size - done);
+    rtems_test_assert(n > 0);
+    done += (size_t) n;
+  }
+}
+
+static void test_block_size(
+  test_context *ctx,
+  size_t block_size,
+  bool raw,
+  const char *sep
+)
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  uint64_t ns;
+  size_t blocks;
+  size_t i;
+
+  set_term(ctx, raw);
+  blocks = TRANSFER_SIZE / block_size;
+
+  a = rtems_counter_read();
+
+  for (i = 0; i < blocks; ++i) {
+    transfer_block(ctx, block_size);
+  }
+
+  b = rtems_counter_read();
+
+  rtems_test_assert(memcmp(ctx->rx_buf, ctx->tx_buf, block_size) == 0);
+
+  ns = rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(b, a));
+
+  printf(
+    "%s{\n"
+    "      \"mode\": \"%s\",\n"
+    "      \"block-size\": %zu,\n"
+    "      \"bytes\": %zu,\n"
+    "      \"duration-ns\": %" PRIu64 ",\n"
+    "      \"bytes-per-second\": %" PRIu64 "\n"
+    "    }",
+    sep,
+    raw ? "raw" : "processed",
+    block_size,
+    blocks * block_size,
+    ns,
+    ns > 0 ? (uint64_t) blocks * block_size * 1000000000 / ns : 0
+  );
+}
+
+static void test(test_context *ctx)
+{
+  const char *sep;
+  size_t i;
+
+  setup(ctx);
+
+  printf(
+    "*** BEGIN OF JSON DATA ***\n"
+    "{\n"
+    "  \"samples\": ["
+  );
+
+  sep = "\n    ";
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(block_sizes); ++i) {
+    test_block_size(ctx, block_sizes[i], true, sep);
+    sep = ", ";
+    test_block_size(ctx, block_sizes[i], false, sep);
+  }
+
+  printf("\n  ]\n}\n*** END OF JSON DATA ***\n");
+}
+
+static void Init(rtems_task_argument arg)
+{
+  (void) arg;
+
+  TEST_BEGIN();
+  test(&test_instance);
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,202 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <timesys.h>
+#include <rtems/btimer.h>
+#include "test_support.h"
+#include <tmacros.h>
+#include <mqueue.h>
+
+const char rtems_test_name[] = "PSXTMMQ 02";
+
+/* forward declarations to avoid warnings */
+void *POSIX_Init(void *argument);
+
+#define MQ_DEPTH_MAX  10000
+#define MQ_MSGSIZE    sizeof(int)
+
+/* Use only the priorities which are guaranteed by POSIX */
+#define MQ_PRIORITIES 32
+
+static const char q_name[] = "queue";
+
+static mqd_t queue;
+
+static void fill_queue(long depth)
+{
+  long i;
+
+  for (i = 0; i < depth; ++i) {
+    int          message;
+    unsigned int priority;
+    int          status;
+
+    message = (int) i;
+    priority = (unsigned int) ((i * 7) % MQ_PRIORITIES);
+    status = mq_send(queue, (const char *) &message, MQ_MSGSIZE, priority);
+    rtems_test_assert(status == 0);
+  }
+}
+
+static void benchmark_mq_send(long depth)
+{
+  benchmark_timer_t end_time;
+  int               status;
+  char              name[64];
+
+  status = 9;
+  benchmark_timer_initialize();
+    status = mq_send(
+      queue,
+      (const char *) &status,
+      MQ_MSGSIZE,
+      MQ_PRIORITIES / 2
+    );
+  end_time = benchmark_timer_read();
+  rtems_test_assert(status == 0);
+
+  snprintf(name, sizeof(name), "mq_send: %ld messages pending", depth);
+  put_time(
+    name,
+    end_time,
+    1,        /* Only executed once */
+    0,
+    0
+  );
+}
+
+static void benchmark_mq_receive(long depth)
+{
+  benchmark_timer_t end_time;
+  ssize_t           status;
+  unsigned int      priority;
+  int               message;
+  char              name[64];
+
+  benchmark_timer_initialize();
+    status = mq_receive(queue, (char *) &message, MQ_MSGSIZE, &priority);
+  end_time = benchmark_timer_read();
+  rtems_test_assert(status == (ssize_t) MQ_MSGSIZE);
+  rtems_test_assert(priority == MQ_PRIORITIES - 1);
+
+  snprintf(name, sizeof(name), "mq_receive: %ld messages pending", depth + 1);
+  put_time(
+    name,
+    end_time,
+    1,        /* Only executed once */
+    0,
+    0
+  );
+}
+
+static void check_order(void)
+{
+  unsigned int previous;
+
+  previous = MQ_PRIORITIES;
+
+  while (true) {
+    struct mq_attr attr;
+    unsigned int   priority;
+    int            message;
+    ssize_t        status;
+    int            rv;
+
+    rv = mq_getattr(queue, &attr);
+    rtems_test_assert(rv == 0);
+
+    if (attr.mq_curmsgs == 0) {
+      break;
+    }
+
+    status = mq_receive(queue, (char *) &message, MQ_MSGSIZE, &priority);
+    rtems_test_assert(status == (ssize_t) MQ_MSGSIZE);
+    rtems_test_assert(priority <= previous);
+    previous = priority;
+  }
+}
+
+static void benchmark_depth(long depth)
+{
+  struct mq_attr attr;
+  int            status;
+
+  attr.mq_maxmsg  = depth + 1;
+  attr.mq_msgsize = MQ_MSGSIZE;
+  queue = mq_open(q_name, O_CREAT | O_RDWR | O_NONBLOCK, 0x777, &attr);
+  rtems_test_assert(queue != (-1));
+
+  fill_queue(depth);
+  benchmark_mq_send(depth);
+  benchmark_mq_receive(depth);
+  check_order();
+
+  status = mq_close(queue);
+  rtems_test_assert(status == 0);
+  status = mq_unlink(q_name);
+  rtems_test_assert(status == 0);
+}
+
+void *POSIX_Init(
+  void *argument
+)
+{
+  (void) argument;
+
+  TEST_BEGIN();
+
+  benchmark_depth(10);
+  benchmark_depth(1000);
+  benchmark_depth(MQ_DEPTH_MAX);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_TIMER_DRIVER
+
+#define CONFIGURE_MAXIMUM_POSIX_THREADS     1
+#define CONFIGURE_POSIX_INIT_THREAD_TABLE
+#define CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUES  1
+
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE(MQ_DEPTH_MAX + 1, MQ_MSGSIZE)
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
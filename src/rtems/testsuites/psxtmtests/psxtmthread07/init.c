@@ -0,0 +1,131 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#if !defined(OPERATION_COUNT)
+#define OPERATION_COUNT 100
+#endif
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+#include <timesys.h>
+#include <rtems/btimer.h>
+#include "test_support.h"
+
+#include <pthread.h>
+
+const char rtems_test_name[] = "PSXTMTHREAD 07";
+
+/* forward declarations to avoid warnings */
+void *POSIX_Init(void *argument);
+
+static void *thread_body(void *argument)
+{
+  (void) argument;
+
+  return NULL;
+}
+
+static benchmark_timer_t create_and_join(void)
+{
+  benchmark_timer_t end_time;
+  pthread_t         thread;
+  int               status;
+
+  benchmark_timer_initialize();
+    status = pthread_create(&thread, NULL, thread_body, NULL);
+  end_time = benchmark_timer_read();
+  rtems_test_assert(status == 0);
+
+  /*
+   * The thread has the same priority as we have, so it runs and terminates
+   * while we wait for it.  The next pthread_create() kills the zombie thread
+   * and recycles its stack through the task stack cache.
+   */
+  status = pthread_join(thread, NULL);
+  rtems_test_assert(status == 0);
+
+  return end_time;
+}
+
+void *POSIX_Init(
+  void *argument
+)
+{
+  benchmark_timer_t end_time;
+  int               i;
+
+  (void) argument;
+
+  TEST_BEGIN();
+
+  end_time = create_and_join();
+  put_time(
+    "pthread_create: first stack allocation",
+    end_time,
+    1,        /* Only executed once */
+    0,
+    0
+  );
+
+  end_time = 0;
+
+  for (i = 0; i < OPERATION_COUNT; ++i) {
+    end_time += create_and_join();
+  }
+
+  put_time(
+    "pthread_create: recycled stack",
+    end_time,
+    OPERATION_COUNT,
+    0,
+    0
+  );
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_TIMER_DRIVER
+
+#define CONFIGURE_MAXIMUM_POSIX_THREADS     2
+#define CONFIGURE_POSIX_INIT_THREAD_TABLE
+
+#define CONFIGURE_MAXIMUM_CACHED_TASK_STACKS 1
+#define CONFIGURE_EXTRA_TASK_STACKS \
+  (CONFIGURE_MAXIMUM_CACHED_TASK_STACKS * CONFIGURE_MINIMUM_POSIX_THREAD_STACK_SIZE)
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
@@ -0,0 +1,291 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/test-info.h>
+#include <rtems.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPPART 1";
+
+#define TASK_PRIORITY 1
+
+#define CPU_COUNT 32
+
+#define TEST_COUNT 2
+
+#define BUFFER_SIZE 64
+
+#define BUFFER_COUNT 1024
+
+typedef struct {
+  rtems_test_parallel_context base;
+  const char *test_sep;
+  const char *counter_sep;
+  rtems_id part_id;
+  unsigned long local_counter[CPU_COUNT][TEST_COUNT][CPU_COUNT];
+  RTEMS_ALIGNED(RTEMS_PARTITION_ALIGNMENT)
+    char area[BUFFER_COUNT][BUFFER_SIZE];
+} test_context;
+
+static test_context test_instance;
+
+static rtems_attribute test_attributes(size_t test)
+{
+  return test == 0 ? RTEMS_DEFAULT_ATTRIBUTES : RTEMS_PARTITION_PER_CPU_CACHE;
+}
+
+static void create_partition(test_context *ctx, rtems_attribute attributes)
+{
+  rtems_status_code sc;
+
+  sc = rtems_partition_create(
+    rtems_build_name('P', 'A', 'R', 'T'),
+    ctx->area,
+    sizeof(ctx->area),
+    BUFFER_SIZE,
+    attributes,
+    &ctx->part_id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void delete_partition(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  sc = rtems_partition_delete(ctx->part_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static rtems_interval test_init(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t test = (size_t) (uintptr_t) arg;
+
+  (void) active_workers;
+
+  create_partition(ctx, test_attributes(test));
+
+  return rtems_clock_get_ticks_per_second();
+}
+
+static void test_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t test = (size_t) (uintptr_t) arg;
+  rtems_id part_id = ctx->part_id;
+  unsigned long counter = 0;
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    rtems_status_code sc;
+    void *buffer;
+
+    sc = rtems_partition_get_buffer(part_id, &buffer);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_partition_return_buffer(part_id, buffer);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    ++counter;
+  }
+
+  ctx->local_counter[active_workers - 1][test][worker_index] = counter;
+}
+
+static void test_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t test = (size_t) (uintptr_t) arg;
+  unsigned long sum = 0;
+  const char *value_sep;
+  size_t i;
+
+  delete_partition(ctx);
+
+  if (active_workers == 1) {
+    printf(
+      "%s{\n"
+      "    \"partition\": \"%s\",\n"
+      "    \"results\": [",
+      ctx->test_sep,
+      test == 0 ? "shared" : "per-CPU cache"
+    );
+    ctx->test_sep = ", ";
+    ctx->counter_sep = "\n      ";
+  }
+
+  printf(
+    "%s{\n"
+    "        \"counter\": [", ctx->counter_sep);
+  ctx->counter_sep = "\n      }, ";
+  value_sep = "";
+
+  for (i = 0; i < active_workers; ++i) {
+    unsigned long local_counter =
+      ctx->local_counter[active_workers - 1][test][i];
+
+    sum += local_counter;
+
+    printf(
+      "%s%lu",
+      value_sep,
+      local_counter
+    );
+    value_sep = ", ";
+  }
+
+  printf(
+    "],\n"
+    "        \"global-counter\": %lu",
+    sum
+  );
+
+  if (active_workers == rtems_scheduler_get_processor_maximum()) {
+    printf("\n      }\n    ]\n  }");
+  }
+}
+
+static const rtems_test_parallel_job test_jobs[TEST_COUNT] = {
+  {
+    .init = test_init,
+    .body = test_body,
+    .fini = test_fini,
+    .arg = (void *) 0,
+    .cascade = true
+  }, {
+    .init = test_init,
+    .body = test_body,
+    .fini = test_fini,
+    .arg = (void *) 1,
+    .cascade = true
+  }
+};
+
+static void test_get_all_buffers(test_context *ctx, rtems_attribute attributes)
+{
+  rtems_status_code sc;
+  void *buffers[BUFFER_COUNT];
+  void *buffer;
+  size_t i;
+
+  create_partition(ctx, attributes);
+
+  for (i = 0; i < BUFFER_COUNT; ++i) {
+    sc = rtems_partition_get_buffer(ctx->part_id, &buffers[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_partition_get_buffer(ctx->part_id, &buffer);
+  rtems_test_assert(sc == RTEMS_UNSATISFIED);
+
+  sc = rtems_partition_return_buffer(ctx->part_id, &ctx->area[0][1]);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_partition_return_buffer(ctx->part_id, buffers[0]);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_partition_delete(ctx->part_id);
+  rtems_test_assert(sc == RTEMS_RESOURCE_IN_USE);
+
+  for (i = 1; i < BUFFER_COUNT; ++i) {
+    sc = rtems_partition_return_buffer(ctx->part_id, buffers[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  delete_partition(ctx);
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+
+  test_get_all_buffers(ctx, RTEMS_DEFAULT_ATTRIBUTES);
+  test_get_all_buffers(ctx, RTEMS_PARTITION_PER_CPU_CACHE);
+
+  printf("*** BEGIN OF JSON DATA ***\n[\n  ");
+  ctx->test_sep = "";
+  rtems_test_parallel(&ctx->base, NULL, &test_jobs[0], TEST_COUNT);
+  printf("\n]\n*** END OF JSON DATA ***\n");
+}
+
+static void Init(rtems_task_argument arg)
+{
+  (void) arg;
+
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_PARTITIONS 1
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
+
+/* Account for the per-CPU partition buffer caches */
+#define CONFIGURE_MEMORY_OVERHEAD 8
+
+#define CONFIGURE_INIT_TASK_PRIORITY TASK_PRIORITY
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_DEFAULT_ATTRIBUTES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,542 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/mpmcqueue.h>
+#include <rtems/score/spscqueue.h>
+#include <rtems/test-info.h>
+#include <rtems.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPQUEUE 1";
+
+#define TASK_PRIORITY 1
+
+#define HELPER_PRIORITY 2
+
+#define CPU_COUNT 32
+
+#define TEST_COUNT 3
+
+#define ITEM_COUNT 64
+
+#define BLOCKING_ITEM_COUNT (4 * ITEM_COUNT)
+
+typedef enum {
+  TEST_MESSAGE_QUEUE,
+  TEST_MPMC_QUEUE,
+  TEST_SPSC_QUEUE
+} test_kind;
+
+typedef struct {
+  rtems_test_parallel_context base;
+  const char *test_sep;
+  const char *counter_sep;
+  bool first_result;
+  rtems_id msgq_id;
+  MPMC_Queue_Control mpmc;
+  SPSC_Queue_Control spsc;
+  unsigned long local_counter[CPU_COUNT][TEST_COUNT][CPU_COUNT];
+  RTEMS_ALIGNED(RTEMS_ALIGNOF(Atomic_Uint))
+    char mpmc_storage[MPMC_QUEUE_STORAGE_SIZE(ITEM_COUNT, sizeof(uint32_t))];
+  uint32_t spsc_storage[ITEM_COUNT];
+} test_context;
+
+static test_context test_instance;
+
+static const char *const test_names[TEST_COUNT] = {
+  "message queue",
+  "MPMC queue",
+  "SPSC queue"
+};
+
+static void test_mpmc_fill_and_drain(test_context *ctx)
+{
+  uint32_t item;
+  uint32_t i;
+  uint32_t lap;
+
+  _MPMC_Queue_Initialize(
+    &ctx->mpmc,
+    ctx->mpmc_storage,
+    ITEM_COUNT,
+    sizeof(item)
+  );
+
+  rtems_test_assert(!_MPMC_Queue_Try_receive(&ctx->mpmc, &item));
+
+  for (lap = 0; lap < 3; ++lap) {
+    for (i = 0; i < ITEM_COUNT; ++i) {
+      item = lap * ITEM_COUNT + i;
+      rtems_test_assert(_MPMC_Queue_Try_send(&ctx->mpmc, &item));
+    }
+
+    rtems_test_assert(!_MPMC_Queue_Try_send(&ctx->mpmc, &item));
+
+    for (i = 0; i < ITEM_COUNT; ++i) {
+      rtems_test_assert(_MPMC_Queue_Try_receive(&ctx->mpmc, &item));
+      rtems_test_assert(item == lap * ITEM_COUNT + i);
+    }
+
+    rtems_test_assert(!_MPMC_Queue_Try_receive(&ctx->mpmc, &item));
+  }
+
+  _MPMC_Queue_Destroy(&ctx->mpmc);
+}
+
+static void test_spsc_fill_and_drain(test_context *ctx)
+{
+  uint32_t item;
+  uint32_t i;
+  uint32_t lap;
+
+  _SPSC_Queue_Initialize(
+    &ctx->spsc,
+    ctx->spsc_storage,
+    ITEM_COUNT,
+    sizeof(item)
+  );
+
+  rtems_test_assert(!_SPSC_Queue_Try_receive(&ctx->spsc, &item));
+
+  for (lap = 0; lap < 3; ++lap) {
+    for (i = 0; i < ITEM_COUNT; ++i) {
+      item = lap * ITEM_COUNT + i;
+      rtems_test_assert(_SPSC_Queue_Try_send(&ctx->spsc, &item));
+    }
+
+    rtems_test_assert(!_SPSC_Queue_Try_send(&ctx->spsc, &item));
+
+    for (i = 0; i < ITEM_COUNT; ++i) {
+      rtems_test_assert(_SPSC_Queue_Try_receive(&ctx->spsc, &item));
+      rtems_test_assert(item == lap * ITEM_COUNT + i);
+    }
+
+    rtems_test_assert(!_SPSC_Queue_Try_receive(&ctx->spsc, &item));
+  }
+
+  _SPSC_Queue_Destroy(&ctx->spsc);
+}
+
+static void blocking_producer(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  uint32_t i;
+
+  for (i = 0; i < BLOCKING_ITEM_COUNT; ++i) {
+    if (arg == TEST_MPMC_QUEUE) {
+      _MPMC_Queue_Send(&ctx->mpmc, &i);
+    } else {
+      _SPSC_Queue_Send(&ctx->spsc, &i);
+    }
+  }
+
+  rtems_task_exit();
+}
+
+static void test_blocking(test_context *ctx, test_kind kind)
+{
+  rtems_status_code sc;
+  rtems_id id;
+  uint32_t item;
+  uint32_t i;
+
+  if (kind == TEST_MPMC_QUEUE) {
+    _MPMC_Queue_Initialize(
+      &ctx->mpmc,
+      ctx->mpmc_storage,
+      ITEM_COUNT,
+      sizeof(item)
+    );
+  } else {
+    _SPSC_Queue_Initialize(
+      &ctx->spsc,
+      ctx->spsc_storage,
+      ITEM_COUNT,
+      sizeof(item)
+    );
+  }
+
+  sc = rtems_task_create(
+    rtems_build_name('P', 'R', 'O', 'D'),
+    HELPER_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(id, blocking_producer, (rtems_task_argument) kind);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* Let the producer fill the queue and wait for free space */
+  sc = rtems_task_wake_after(2);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (i = 0; i < BLOCKING_ITEM_COUNT; ++i) {
+    if (kind == TEST_MPMC_QUEUE) {
+      _MPMC_Queue_Receive(&ctx->mpmc, &item);
+    } else {
+      _SPSC_Queue_Receive(&ctx->spsc, &item);
+    }
+
+    rtems_test_assert(item == i);
+  }
+
+  if (kind == TEST_MPMC_QUEUE) {
+    rtems_test_assert(!_MPMC_Queue_Try_receive(&ctx->mpmc, &item));
+    _MPMC_Queue_Destroy(&ctx->mpmc);
+  } else {
+    rtems_test_assert(!_SPSC_Queue_Try_receive(&ctx->spsc, &item));
+    _SPSC_Queue_Destroy(&ctx->spsc);
+  }
+}
+
+static rtems_interval test_init(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+  test_kind kind = (test_kind) (uintptr_t) arg;
+  rtems_status_code sc;
+
+  (void) active_workers;
+
+  switch (kind) {
+    case TEST_MESSAGE_QUEUE:
+      sc = rtems_message_queue_create(
+        rtems_build_name('M', 'S', 'G', 'Q'),
+        ITEM_COUNT,
+        sizeof(uint32_t),
+        RTEMS_DEFAULT_ATTRIBUTES,
+        &ctx->msgq_id
+      );
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+      break;
+    case TEST_MPMC_QUEUE:
+      _MPMC_Queue_Initialize(
+        &ctx->mpmc,
+        ctx->mpmc_storage,
+        ITEM_COUNT,
+        sizeof(uint32_t)
+      );
+      break;
+    default:
+      _SPSC_Queue_Initialize(
+        &ctx->spsc,
+        ctx->spsc_storage,
+        ITEM_COUNT,
+        sizeof(uint32_t)
+      );
+      break;
+  }
+
+  return rtems_clock_get_ticks_per_second();
+}
+
+static unsigned long message_queue_body(test_context *ctx)
+{
+  rtems_id msgq_id = ctx->msgq_id;
+  unsigned long counter = 0;
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    rtems_status_code sc;
+    uint32_t item;
+    size_t size;
+
+    item = (uint32_t) counter;
+    sc = rtems_message_queue_send(msgq_id, &item, sizeof(item));
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_message_queue_receive(
+      msgq_id,
+      &item,
+      &size,
+      RTEMS_NO_WAIT,
+      RTEMS_NO_TIMEOUT
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    rtems_test_assert(size == sizeof(item));
+
+    ++counter;
+  }
+
+  return counter;
+}
+
+static unsigned long mpmc_queue_body(test_context *ctx)
+{
+  MPMC_Queue_Control *queue = &ctx->mpmc;
+  unsigned long counter = 0;
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    uint32_t item;
+
+    item = (uint32_t) counter;
+
+    /*
+     * A producer or consumer on another processor may have claimed a cell
+     * without finishing its copy, so retry until the operation succeeds.
+     */
+    while (!_MPMC_Queue_Try_send(queue, &item)) {
+      /* Retry */
+    }
+
+    while (!_MPMC_Queue_Try_receive(queue, &item)) {
+      /* Retry */
+    }
+
+    ++counter;
+  }
+
+  return counter;
+}
+
+static unsigned long spsc_queue_body(
+  test_context *ctx,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  SPSC_Queue_Control *queue = &ctx->spsc;
+  unsigned long counter = 0;
+
+  if (active_workers == 1) {
+    while (!rtems_test_parallel_stop_job(&ctx->base)) {
+      uint32_t item;
+
+      item = (uint32_t) counter;
+      rtems_test_assert(_SPSC_Queue_Try_send(queue, &item));
+      rtems_test_assert(_SPSC_Queue_Try_receive(queue, &item));
+      rtems_test_assert(item == (uint32_t) counter);
+      ++counter;
+    }
+  } else if (worker_index == 0) {
+    while (!rtems_test_parallel_stop_job(&ctx->base)) {
+      uint32_t item;
+
+      item = (uint32_t) counter;
+
+      if (_SPSC_Queue_Try_send(queue, &item)) {
+        ++counter;
+      }
+    }
+  } else if (worker_index == 1) {
+    while (!rtems_test_parallel_stop_job(&ctx->base)) {
+      uint32_t item;
+
+      if (_SPSC_Queue_Try_receive(queue, &item)) {
+        rtems_test_assert(item == (uint32_t) counter);
+        ++counter;
+      }
+    }
+  }
+
+  return counter;
+}
+
+static void test_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  test_kind kind = (test_kind) (uintptr_t) arg;
+  unsigned long counter;
+
+  switch (kind) {
+    case TEST_MESSAGE_QUEUE:
+      counter = message_queue_body(ctx);
+      break;
+    case TEST_MPMC_QUEUE:
+      counter = mpmc_queue_body(ctx);
+      break;
+    default:
+      counter = spsc_queue_body(ctx, active_workers, worker_index);
+      break;
+  }
+
+  ctx->local_counter[active_workers - 1][kind][worker_index] = counter;
+}
+
+static void test_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+  test_kind kind = (test_kind) (uintptr_t) arg;
+  unsigned long sum = 0;
+  const char *value_sep;
+  rtems_status_code sc;
+  size_t i;
+
+  switch (kind) {
+    case TEST_MESSAGE_QUEUE:
+      sc = rtems_message_queue_delete(ctx->msgq_id);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+      break;
+    case TEST_MPMC_QUEUE:
+      _MPMC_Queue_Destroy(&ctx->mpmc);
+      break;
+    default:
+      _SPSC_Queue_Destroy(&ctx->spsc);
+      break;
+  }
+
+  if (ctx->first_result) {
+    printf(
+      "%s{\n"
+      "    \"queue\": \"%s\",\n"
+      "    \"results\": [",
+      ctx->test_sep,
+      test_names[kind]
+    );
+    ctx->test_sep = ", ";
+    ctx->counter_sep = "\n      ";
+    ctx->first_result = false;
+  }
+
+  printf(
+    "%s{\n"
+    "        \"counter\": [", ctx->counter_sep);
+  ctx->counter_sep = "\n      }, ";
+  value_sep = "";
+
+  for (i = 0; i < active_workers; ++i) {
+    unsigned long local_counter =
+      ctx->local_counter[active_workers - 1][kind][i];
+
+    sum += local_counter;
+
+    printf(
+      "%s%lu",
+      value_sep,
+      local_counter
+    );
+    value_sep = ", ";
+  }
+
+  printf(
+    "],\n"
+    "        \"global-counter\": %lu",
+    sum
+  );
+
+  if (active_workers == rtems_scheduler_get_processor_maximum()) {
+    printf("\n      }\n    ]\n  }");
+    ctx->first_result = true;
+  }
+}
+
+static const rtems_test_parallel_job test_jobs[TEST_COUNT] = {
+  {
+    .init = test_init,
+    .body = test_body,
+    .fini = test_fini,
+    .arg = (void *) TEST_MESSAGE_QUEUE,
+    .cascade = true
+  }, {
+    .init = test_init,
+    .body = test_body,
+    .fini = test_fini,
+    .arg = (void *) TEST_MPMC_QUEUE,
+    .cascade = true
+  }, {
+    .init = test_init,
+    .body = test_body,
+    .fini = test_fini,
+    .arg = (void *) TEST_SPSC_QUEUE,
+    .cascade = false
+  }
+};
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+
+  test_mpmc_fill_and_drain(ctx);
+  test_spsc_fill_and_drain(ctx);
+  test_blocking(ctx, TEST_MPMC_QUEUE);
+  test_blocking(ctx, TEST_SPSC_QUEUE);
+
+  printf("*** BEGIN OF JSON DATA ***\n[\n  ");
+  ctx->test_sep = "";
+  ctx->first_result = true;
+  rtems_test_parallel(&ctx->base, NULL, &test_jobs[0], TEST_COUNT);
+  printf("\n]\n*** END OF JSON DATA ***\n");
+}
+
+static void Init(rtems_task_argument arg)
+{
+  (void) arg;
+
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS (CPU_COUNT + 1)
+
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES 1
+
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE(ITEM_COUNT, sizeof(uint32_t))
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
+
+#define CONFIGURE_INIT_TASK_PRIORITY TASK_PRIORITY
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_DEFAULT_ATTRIBUTES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
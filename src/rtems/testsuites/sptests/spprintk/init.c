@@ -273,6 +273,90 @@ static void test_io_base64url( test_context *ctx )
   rtems_test_assert( strcmp( ctx->buf, "AAA-\nAAA_" ) == 0 );
 }
 
+static void test_io_base64_block( void )
+{
+  unsigned char buf[] = "abcdefghi";
+  unsigned char url[] = { 0, 0, 62, 0, 0, 63 };
+  char out[ 16 ];
+  size_t n;
+
+  rtems_test_assert( _Base64_Encoded_size( 0 ) == 0 );
+  rtems_test_assert( _Base64_Encoded_size( 1 ) == 4 );
+  rtems_test_assert( _Base64_Encoded_size( 3 ) == 4 );
+  rtems_test_assert( _Base64_Encoded_size( 4 ) == 8 );
+
+  memset( out, 0, sizeof( out ) );
+  n = _Base64_Encode_block( out, buf, 9 );
+  rtems_test_assert( n == 12 );
+  rtems_test_assert( strcmp( out, "YWJjZGVmZ2hp" ) == 0 );
+
+  memset( out, 0, sizeof( out ) );
+  n = _Base64_Encode_block( out, buf, 8 );
+  rtems_test_assert( n == 12 );
+  rtems_test_assert( strcmp( out, "YWJjZGVmZ2g=" ) == 0 );
+
+  memset( out, 0, sizeof( out ) );
+  n = _Base64_Encode_block( out, buf, 7 );
+  rtems_test_assert( n == 12 );
+  rtems_test_assert( strcmp( out, "YWJjZGVmZw==" ) == 0 );
+
+  memset( out, 0, sizeof( out ) );
+  n = _Base64_Encode_block( out, buf, 0 );
+  rtems_test_assert( n == 0 );
+  rtems_test_assert( out[ 0 ] == '\0' );
+
+  memset( out, 0, sizeof( out ) );
+  n = _Base64url_Encode_block( out, url, sizeof( url ) );
+  rtems_test_assert( n == 8 );
+  rtems_test_assert( strcmp( out, "AAA-AAA_" ) == 0 );
+}
+
+static void test_io_base64_lines( test_context *ctx )
+{
+  Base64_Encode_lines_control lines;
+  unsigned char buf[ BASE64_LINE_SOURCE_SIZE + 3 ];
+  size_t n;
+  size_t i;
+
+  memset( buf, 0, sizeof( buf ) );
+  buf[ BASE64_LINE_SOURCE_SIZE ] = 'a';
+  buf[ BASE64_LINE_SOURCE_SIZE + 1 ] = 'b';
+  buf[ BASE64_LINE_SOURCE_SIZE + 2 ] = 'c';
+
+  /* Feed the stream in pieces which do not align with the lines */
+  clear( ctx );
+  _Base64_Encode_lines_initialize( &lines, put_char, ctx );
+  _Base64_Encode_lines( &lines, &buf[ 0 ], 1 );
+  _Base64_Encode_lines( &lines, &buf[ 1 ], 0 );
+  _Base64_Encode_lines( &lines, &buf[ 1 ], 57 );
+  _Base64_Encode_lines( &lines, &buf[ 58 ], 2 );
+  n = _Base64_Encode_lines_flush( &lines );
+  rtems_test_assert( n == 4 );
+  rtems_test_assert( ctx->i == BASE64_LINE_LENGTH + 1 + 4 );
+
+  for ( i = 0; i < BASE64_LINE_LENGTH; ++i ) {
+    rtems_test_assert( ctx->buf[ i ] == 'A' );
+  }
+
+  rtems_test_assert( strcmp( &ctx->buf[ i ], "\nYWJj" ) == 0 );
+
+  /* A last line completed by the padding is terminated by a new line */
+  clear( ctx );
+  _Base64_Encode_lines_initialize( &lines, put_char, ctx );
+  _Base64_Encode_lines( &lines, &buf[ 0 ], BASE64_LINE_SOURCE_SIZE - 1 );
+  n = _Base64_Encode_lines_flush( &lines );
+  rtems_test_assert( n == 0 );
+  rtems_test_assert( ctx->i == BASE64_LINE_LENGTH + 1 );
+  rtems_test_assert( ctx->buf[ BASE64_LINE_LENGTH - 1 ] == '=' );
+  rtems_test_assert( ctx->buf[ BASE64_LINE_LENGTH ] == '\n' );
+
+  clear( ctx );
+  _Base64_Encode_lines_initialize( &lines, put_char, ctx );
+  n = _Base64_Encode_lines_flush( &lines );
+  rtems_test_assert( n == 0 );
+  rtems_test_assert( ctx->i == 0 );
+}
+
 static rtems_task Init(
   rtems_task_argument argument
 )
@@ -291,6 +375,8 @@ static rtems_task Init(
   test_io_printf(&test_instance);
   test_io_base64(&test_instance);
   test_io_base64url(&test_instance);
+  test_io_base64_block();
+  test_io_base64_lines(&test_instance);
 
   TEST_END();
   rtems_test_exit( 0 );
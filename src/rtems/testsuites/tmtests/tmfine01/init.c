@@ -38,6 +38,7 @@
 #include <stdio.h>
 
 #include <rtems/test-info.h>
+#include <rtems/score/threadqimpl.h>
 
 const char rtems_test_name[] = "TMFINE 1";
 
@@ -49,6 +50,10 @@ const char rtems_test_name[] = "TMFINE 1";
 
 #define MSG_COUNT 3
 
+#define ADAPTIVE_SPIN_NANOSECONDS 20000
+
+#define ADAPTIVE ((void *) (uintptr_t) ADAPTIVE_SPIN_NANOSECONDS)
+
 typedef struct {
   uint32_t value;
 } test_msg;
@@ -59,10 +64,14 @@ typedef struct {
   const char *counter_sep;
   rtems_id master;
   rtems_id sema;
+  struct _Mutex_Control sys_lock_mutex;
+  pthread_mutex_t pthread_mutex;
   rtems_id mq[CPU_COUNT];
   uint32_t self_event_ops[CPU_COUNT][CPU_COUNT];
   uint32_t all_to_one_event_ops[CPU_COUNT][CPU_COUNT];
   uint32_t one_mutex_ops[CPU_COUNT][CPU_COUNT];
+  uint32_t one_sys_lock_mutex_ops[CPU_COUNT][CPU_COUNT];
+  uint32_t one_pthread_mutex_ops[CPU_COUNT][CPU_COUNT];
   uint32_t many_mutex_ops[CPU_COUNT][CPU_COUNT];
   uint32_t self_msg_ops[CPU_COUNT][CPU_COUNT];
   uint32_t many_to_one_msg_ops[CPU_COUNT][CPU_COUNT];
@@ -88,9 +97,15 @@ static rtems_interval test_init(
 )
 {
   (void) base;
-  (void) arg;
   (void) active_workers;
 
+  /* The job argument is the adaptive mutex spin time in nanoseconds */
+#if defined(RTEMS_SMP)
+  _Thread_queue_Adaptive_spin_nanoseconds = (uint32_t) (uintptr_t) arg;
+#else
+  (void) arg;
+#endif
+
   return test_duration();
 }
 
@@ -280,16 +295,100 @@ static void test_one_mutex_fini(
   void *arg,
   size_t active_workers
 )
+{
+  test_context *ctx = (test_context *) base;
+
+  test_fini(
+    ctx,
+    "contested-mutex",
+    arg == NULL ?
+      "Obtain/Release Contested Classic Inheritance Mutex" :
+      "Obtain/Release Contested Classic Inheritance Mutex (Adaptive)",
+    &ctx->one_mutex_ops[active_workers - 1][0],
+    active_workers
+  );
+}
+
+static void test_one_sys_lock_mutex_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
 {
   (void) arg;
 
+  test_context *ctx = (test_context *) base;
+  struct _Mutex_Control *mtx = &ctx->sys_lock_mutex;
+  uint32_t counter = 0;
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    ++counter;
+
+    _Mutex_Acquire(mtx);
+    _Mutex_Release(mtx);
+  }
+
+  ctx->one_sys_lock_mutex_ops[active_workers - 1][worker_index] = counter;
+}
+
+static void test_one_sys_lock_mutex_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
   test_context *ctx = (test_context *) base;
 
   test_fini(
     ctx,
     "contested-mutex",
-    "Obtain/Release Contested Classic Inheritance Mutex",
-    &ctx->one_mutex_ops[active_workers - 1][0],
+    arg == NULL ?
+      "Obtain/Release Contested <sys/lock.h> Mutex" :
+      "Obtain/Release Contested <sys/lock.h> Mutex (Adaptive)",
+    &ctx->one_sys_lock_mutex_ops[active_workers - 1][0],
+    active_workers
+  );
+}
+
+static void test_one_pthread_mutex_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  (void) arg;
+
+  test_context *ctx = (test_context *) base;
+  pthread_mutex_t *mtx = &ctx->pthread_mutex;
+  uint32_t counter = 0;
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    ++counter;
+
+    pthread_mutex_lock(mtx);
+    pthread_mutex_unlock(mtx);
+  }
+
+  ctx->one_pthread_mutex_ops[active_workers - 1][worker_index] = counter;
+}
+
+static void test_one_pthread_mutex_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  test_fini(
+    ctx,
+    "contested-mutex",
+    arg == NULL ?
+      "Obtain/Release Contested Pthread Inheritance Mutex" :
+      "Obtain/Release Contested Pthread Inheritance Mutex (Adaptive)",
+    &ctx->one_pthread_mutex_ops[active_workers - 1][0],
     active_workers
   );
 }
@@ -872,9 +971,55 @@ static const rtems_test_parallel_job test_jobs[] = {
     .body = test_many_classic_mrsp_body,
     .fini = test_many_classic_mrsp_fini,
     .cascade = true
+  }, {
+    .init = test_init,
+    .body = test_one_mutex_body,
+    .fini = test_one_mutex_fini,
+    .arg = ADAPTIVE,
+    .cascade = true
+  }, {
+    .init = test_init,
+    .body = test_one_sys_lock_mutex_body,
+    .fini = test_one_sys_lock_mutex_fini,
+    .cascade = true
+  }, {
+    .init = test_init,
+    .body = test_one_sys_lock_mutex_body,
+    .fini = test_one_sys_lock_mutex_fini,
+    .arg = ADAPTIVE,
+    .cascade = true
+  }, {
+    .init = test_init,
+    .body = test_one_pthread_mutex_body,
+    .fini = test_one_pthread_mutex_fini,
+    .cascade = true
+  }, {
+    .init = test_init,
+    .body = test_one_pthread_mutex_body,
+    .fini = test_one_pthread_mutex_fini,
+    .arg = ADAPTIVE,
+    .cascade = true
   }
 };
 
+static void init_pthread_mutex(pthread_mutex_t *mtx)
+{
+  pthread_mutexattr_t attr;
+  int eno;
+
+  eno = pthread_mutexattr_init(&attr);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_INHERIT);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_mutex_init(mtx, &attr);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_mutexattr_destroy(&attr);
+  rtems_test_assert(eno == 0);
+}
+
 static void Init(rtems_task_argument arg)
 {
   (void) arg;
@@ -887,6 +1032,9 @@ static void Init(rtems_task_argument arg)
 
   ctx->master = rtems_task_self();
 
+  _Mutex_Initialize(&ctx->sys_lock_mutex);
+  init_pthread_mutex(&ctx->pthread_mutex);
+
   sc = rtems_semaphore_create(
     rtems_build_name('T', 'E', 'S', 'T'),
     1,
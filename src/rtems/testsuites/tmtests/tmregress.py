@@ -0,0 +1,305 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: BSD-2-Clause
+
+# Copyright (C) 2026 The RTEMS Project
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Statistical regression detector for the timing tests.
+
+The tm*, rhealstone and tmfine01/tmcontext01 tests print one result per
+measurement.  This script runs each test executable several times (or reads
+the console logs of such runs), collects the samples of every measurement in
+a JSON result file and compares two result files with confidence intervals.
+
+Run the timing tests ten times each on a simulator BSP:
+
+  ./tmregress.py run --runs 10 --runner "sparc-rtems7-sis -leon3 -r" \\
+    --output baseline.json build/sparc/leon3/testsuites/tmtests/*.exe \\
+    build/sparc/leon3/testsuites/rhealstone/*.exe
+
+Compare a later run against this baseline:
+
+  ./tmregress.py compare baseline.json current.json
+
+A measurement is flagged as regression if the 95% confidence interval of the
+difference of the means lies entirely on the worse side and the relative
+change exceeds --min-change.  The exit status is 1 if a regression was
+flagged.
+"""
+
+import argparse
+import json
+import math
+import os
+import re
+import shlex
+import subprocess
+import sys
+from typing import Dict, List, Optional, Tuple
+
+# Measurements are grouped by these categories in the comparison report
+_CATEGORIES = [
+    ("context-switch",
+     re.compile(r"context|switch|yield|wake_after|preempt|tmcontext",
+                re.IGNORECASE)),
+    ("semaphore",
+     re.compile(r"semaphore|mutex|shuffle|deadlock", re.IGNORECASE)),
+    ("message-queue", re.compile(r"message", re.IGNORECASE)),
+    ("interrupt-latency",
+     re.compile(r"interrupt|isr|latency", re.IGNORECASE)),
+]
+
+_BEGIN_OF_TEST = re.compile(r"\*\*\* BEGIN OF TEST (.*) \*\*\*")
+_PUT_TIME = re.compile(r"^(\S.*?) - (-?\d+)\s*$")
+_JSON_DATA = re.compile(
+    r"\*\*\* BEGIN OF JSON DATA \*\*\*(.*?)"
+    r"\*\*\* END OF JSON DATA \*\*\*", re.DOTALL)
+
+# Two-sided 97.5% quantiles of the t-distribution for 1 to 30 degrees of
+# freedom, larger degrees of freedom use the normal distribution
+_T_975 = [
+    12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+    2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+    2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+]
+
+
+def category(name: str) -> str:
+    """ Returns the category of the measurement. """
+    for label, pattern in _CATEGORIES:
+        if pattern.search(name):
+            return label
+    return "other"
+
+
+def parse_log(log: str, test: str) -> Dict[str, Tuple[float, bool]]:
+    """
+    Returns the measurements of one test run as name -> (value,
+    higher-is-better).
+    """
+    match = _BEGIN_OF_TEST.search(log)
+    if match:
+        test = match.group(1).strip()
+    values: Dict[str, Tuple[float, bool]] = {}
+    for data in _JSON_DATA.finditer(log):
+        for item in json.loads(data.group(1)):
+            if "stats-by-function-nest-level" in item:
+                # tmcontext01: the median context switch time per nest level
+                for level, stats in enumerate(
+                        item["stats-by-function-nest-level"]):
+                    name = (f"{test}: context switch {item['environment']} "
+                            f"nest level {level}")
+                    values[name] = (float(stats[2]), False)
+            elif "counter" in item:
+                # tmfine01: operations performed by all active workers
+                for index, counters in enumerate(item["counter"]):
+                    name = (f"{test}: {item['description']} "
+                            f"{index + 1} workers")
+                    values[name] = (float(sum(counters)), True)
+    log = _JSON_DATA.sub("", log)
+    for line in log.splitlines():
+        match = _PUT_TIME.match(line)
+        if match:
+            values[f"{test}: {match.group(1)}"] = (float(match.group(2)),
+                                                   False)
+    return values
+
+
+def add_run(results: dict, values: Dict[str, Tuple[float, bool]]) -> None:
+    """ Adds the measurements of a test run to the results. """
+    for name, (value, higher_is_better) in values.items():
+        entry = results.setdefault(
+            name, {
+                "category": category(name),
+                "higher-is-better": higher_is_better,
+                "samples": []
+            })
+        entry["samples"].append(value)
+
+
+def run(args: argparse.Namespace) -> int:
+    """ Runs the tests or reads their logs and writes the results. """
+    results: dict = {}
+    for path in args.logs:
+        with open(path, "r", encoding="utf-8", errors="replace") as src:
+            add_run(results, parse_log(src.read(), os.path.basename(path)))
+    runner = shlex.split(args.runner) if args.runner else []
+    for exe in args.executables:
+        for index in range(args.runs):
+            print(f"{exe}: run {index + 1} of {args.runs}", file=sys.stderr)
+            proc = subprocess.run(runner + [exe],
+                                  stdout=subprocess.PIPE,
+                                  stderr=subprocess.STDOUT,
+                                  timeout=args.timeout,
+                                  check=False)
+            log = proc.stdout.decode("utf-8", errors="replace")
+            values = parse_log(log, os.path.basename(exe))
+            if proc.returncode != 0:
+                print(f"{exe}: run failed, exit status {proc.returncode}",
+                      file=sys.stderr)
+                return 1
+            if not values:
+                print(f"{exe}: run produced no results", file=sys.stderr)
+                return 1
+            add_run(results, values)
+    for entry in results.values():
+        entry.update(summary(entry["samples"]))
+    output = json.dumps(results, indent=2, sort_keys=True)
+    if args.output:
+        with open(args.output, "w", encoding="utf-8") as dst:
+            dst.write(output + "\n")
+    else:
+        print("*** BEGIN OF JSON DATA ***")
+        print(output)
+        print("*** END OF JSON DATA ***")
+    return 0
+
+
+def summary(samples: List[float]) -> dict:
+    """ Returns the sample mean, standard deviation and count. """
+    count = len(samples)
+    mean = sum(samples) / count
+    var = sum((x - mean)**2 for x in samples) / (count - 1) if count > 1 else 0
+    return {"mean": mean, "stddev": math.sqrt(var), "count": count}
+
+
+def t_quantile(dof: float) -> float:
+    """ Returns the 97.5% quantile of the t-distribution. """
+    if dof < 1:
+        dof = 1
+    index = int(math.floor(dof))
+    if index <= len(_T_975):
+        return _T_975[index - 1]
+    return 1.960
+
+
+def difference_interval(base: dict, cur: dict) -> Tuple[float, float, float]:
+    """
+    Returns the difference of the means and its 95% confidence interval
+    according to Welch.
+    """
+    diff = cur["mean"] - base["mean"]
+    var_base = base["stddev"]**2 / base["count"]
+    var_cur = cur["stddev"]**2 / cur["count"]
+    err = var_base + var_cur
+    if err == 0:
+        return diff, diff, diff
+    dof_den = 0.0
+    if base["count"] > 1:
+        dof_den += var_base**2 / (base["count"] - 1)
+    if cur["count"] > 1:
+        dof_den += var_cur**2 / (cur["count"] - 1)
+    dof = err**2 / dof_den if dof_den > 0 else 1
+    half = t_quantile(dof) * math.sqrt(err)
+    return diff, diff - half, diff + half
+
+
+def regression(base: dict, cur: dict,
+               min_change: float) -> Tuple[bool, float, float, float]:
+    """
+    Returns if the current measurement is a significant regression with
+    respect to the baseline, the relative change and the confidence interval
+    of the difference.
+    """
+    diff, low, high = difference_interval(base, cur)
+    change = diff / abs(base["mean"]) if base["mean"] != 0 else 0.0
+    if base["higher-is-better"]:
+        worse = high < 0 and -change > min_change
+    else:
+        worse = low > 0 and change > min_change
+    return worse, change, low, high
+
+
+def compare(args: argparse.Namespace) -> int:
+    """ Compares the current results with the baseline. """
+    with open(args.baseline, "r", encoding="utf-8") as src:
+        baseline = json.load(src)
+    with open(args.current, "r", encoding="utf-8") as src:
+        current = json.load(src)
+    regressions = 0
+    report: Dict[str, List[str]] = {}
+    for name in sorted(set(baseline) & set(current)):
+        base = baseline[name]
+        if args.category and base["category"] not in args.category:
+            continue
+        worse, change, low, high = regression(base, current[name],
+                                              args.min_change)
+        if worse:
+            regressions += 1
+        if worse or args.verbose:
+            report.setdefault(base["category"], []).append(
+                f"  {'REGRESSION' if worse else 'ok':10} {change:+8.2%} "
+                f"[{low:+.1f}, {high:+.1f}] {name}")
+    for label in sorted(report):
+        print(f"{label}:")
+        print("\n".join(report[label]))
+    missing = sorted(set(baseline) - set(current))
+    for name in missing:
+        print(f"missing in current results: {name}")
+    print(f"{regressions} significant regressions")
+    return 1 if regressions > 0 else 0
+
+
+def main(argv: Optional[List[str]] = None) -> int:
+    """ Runs the regression detector. """
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0],
+                                     formatter_class=argparse.
+                                     RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest="command", required=True)
+    run_parser = sub.add_parser("run", help="run the tests and collect "
+                                "the results")
+    run_parser.add_argument("--runs", type=int, default=10,
+                            help="runs of each test executable")
+    run_parser.add_argument("--runner", default="",
+                            help="command to run an executable, e.g. "
+                            "a simulator")
+    run_parser.add_argument("--timeout", type=float, default=600,
+                            help="timeout of one run in seconds")
+    run_parser.add_argument("--log", dest="logs", action="append",
+                            default=[], help="console log of a test run "
+                            "to add to the results")
+    run_parser.add_argument("--output", help="result file, otherwise the "
+                            "results are printed as JSON data")
+    run_parser.add_argument("executables", nargs="*")
+    compare_parser = sub.add_parser("compare", help="compare results with "
+                                    "a baseline")
+    compare_parser.add_argument("--min-change", type=float, default=0.02,
+                                help="minimum relative change of a "
+                                "regression")
+    compare_parser.add_argument("--category", action="append",
+                                choices=[c[0] for c in _CATEGORIES] +
+                                ["other"],
+                                help="only compare these categories")
+    compare_parser.add_argument("--verbose", action="store_true",
+                                help="also list the unchanged measurements")
+    compare_parser.add_argument("baseline")
+    compare_parser.add_argument("current")
+    args = parser.parse_args(argv)
+    if args.command == "run":
+        return run(args)
+    return compare(args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
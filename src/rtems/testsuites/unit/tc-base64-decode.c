@@ -184,3 +184,61 @@ T_TEST_CASE(IOBase64DecodeInitialize) {
   T_eq_ptr(self->target, &buf[0]);
   T_eq_ptr(self->target_end, &buf[1]);
 }
+
+static int test_payload_block(test_control* self, const char* payload,
+                              size_t size) {
+  memset(self->buf, 0xff, sizeof(self->buf));
+  _Base64_Decode_initialize(&self->base, &self->buf[0], size);
+  return _Base64_Decode_block(&self->base, payload, strlen(payload));
+}
+
+T_TEST_CASE(IOBase64DecodeBlock) {
+  static const char* const payloads[] = {
+      "",
+      "POOL",
+      "ABCDEFGH",
+      "PO*OL",
+      "PO\x80OL",
+      "POOL\x80",
+      "P OOL",
+      "POOL POOL\nPOOL",
+      "POOL==",
+      "POOL==xy",
+      "POOLPOOL",
+      "POOLPO==",
+      "POOLPOO=",
+      "AAA-AAA_",
+      "YWJjZGVmZ2hpamtsbW5vcHFyc3R1dnd4eXo=",
+  };
+  test_control block_instance;
+  test_control* block = &block_instance;
+  test_control char_instance;
+  test_control* chars = &char_instance;
+
+  /*
+   * The block decoder shall produce the same result as the character decoder
+   * for all payloads and target sizes.
+   */
+  for (size_t i = 0; i < RTEMS_ARRAY_SIZE(payloads); ++i) {
+    for (size_t size = 0; size <= 32; ++size) {
+      int rv_block = test_payload_block(block, payloads[i], size);
+
+      memset(chars->buf, 0xff, sizeof(chars->buf));
+      _Base64_Decode_initialize(&chars->base, &chars->buf[0], size);
+      int rv_chars = test_run(chars, payloads[i]);
+
+      T_eq_int(rv_block, rv_chars);
+      T_eq_int(block->base.state, chars->base.state);
+      T_eq_sz((size_t)(block->base.target - &block->buf[0]),
+              (size_t)(chars->base.target - &chars->buf[0]));
+      T_eq_mem(&block->buf[0], &chars->buf[0], sizeof(block->buf));
+    }
+  }
+
+  int rv = test_payload_block(block, "POOLPOOL", sizeof(block->buf));
+  T_eq_int(rv, BASE64_DECODE_SUCCESS);
+  T_eq_int(block->base.state, BASE64_DECODE_STATE_0);
+  T_eq_ptr(block->base.target, &block->buf[6]);
+  const uint8_t expected[] = {0x3c, 0xe3, 0x8b, 0x3c, 0xe3, 0x8b, 0xff};
+  T_eq_mem(&block->buf[0], expected, sizeof(expected));
+}
@@ -8,6 +8,7 @@
 
 /*
  * Copyright (C) 2023 embedded brains GmbH & Co. KG
+ * Copyright (C) 2026 The RTEMS Project
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -33,6 +34,8 @@
 
 #include <rtems/crc.h>
 
+#include <inttypes.h>
+
 #include <rtems/test.h>
 
 T_TEST_CASE(CRC24Q) {
@@ -46,3 +49,194 @@ T_TEST_CASE(CRC24Q) {
   state = _CRC24Q_Sequence_update(CRC24Q_SEED, &bytes[0], sizeof(bytes));
   T_eq_u32(state & CRC24Q_MASK, 0x2c3045);
 }
+
+static const uint8_t check_bytes[] = {'1', '2', '3', '4', '5',
+                                      '6', '7', '8', '9'};
+
+static uint8_t crc_buffer[4096];
+
+static void crc_buffer_fill(void) {
+  uint32_t x = 1;
+
+  for (size_t i = 0; i < sizeof(crc_buffer); ++i) {
+    x = x * 1664525 + 1013904223;
+    crc_buffer[i] = (uint8_t)(x >> 24);
+  }
+}
+
+static uint32_t crc32_bitwise(uint32_t crc, uint32_t poly, const uint8_t* bytes,
+                              size_t size_in_bytes) {
+  for (size_t i = 0; i < size_in_bytes; ++i) {
+    crc ^= bytes[i];
+
+    for (int j = 0; j < 8; ++j) {
+      crc = (crc & 1) != 0 ? (crc >> 1) ^ poly : crc >> 1;
+    }
+  }
+
+  return crc;
+}
+
+T_TEST_CASE(CRC32) {
+  uint32_t state = _CRC32_Sequence_update(CRC32_SEED, &check_bytes[0],
+                                          sizeof(check_bytes));
+  T_eq_u32(state ^ CRC32_FINAL_XOR, 0xcbf43926);
+
+  state = CRC32_SEED;
+
+  for (size_t i = 0; i < sizeof(check_bytes); ++i) {
+    state = _CRC32_Update(state, check_bytes[i]);
+  }
+
+  T_eq_u32(state ^ CRC32_FINAL_XOR, 0xcbf43926);
+
+  crc_buffer_fill();
+
+  /* Check all alignments and the byte-wise tail processing */
+  for (size_t offset = 0; offset < 8; ++offset) {
+    for (size_t size = 0; size < 64; ++size) {
+      T_quiet_eq_u32(
+          _CRC32_Sequence_update(0x12345678, &crc_buffer[offset], size),
+          crc32_bitwise(0x12345678, 0xedb88320, &crc_buffer[offset], size));
+    }
+  }
+}
+
+T_TEST_CASE(CRC32C) {
+  uint32_t state = _CRC32C_Sequence_update(CRC32C_SEED, &check_bytes[0],
+                                           sizeof(check_bytes));
+  T_eq_u32(state ^ CRC32C_FINAL_XOR, 0xe3069283);
+
+  state = CRC32C_SEED;
+
+  for (size_t i = 0; i < sizeof(check_bytes); ++i) {
+    state = _CRC32C_Update(state, check_bytes[i]);
+  }
+
+  T_eq_u32(state ^ CRC32C_FINAL_XOR, 0xe3069283);
+
+  crc_buffer_fill();
+
+  for (size_t offset = 0; offset < 8; ++offset) {
+    for (size_t size = 0; size < 64; ++size) {
+      T_quiet_eq_u32(
+          _CRC32C_Sequence_update(0x12345678, &crc_buffer[offset], size),
+          crc32_bitwise(0x12345678, 0x82f63b78, &crc_buffer[offset], size));
+    }
+  }
+}
+
+T_TEST_CASE(CRC16CCITT) {
+  uint16_t state = _CRC16_CCITT_Sequence_update(
+      CRC16_CCITT_SEED, &check_bytes[0], sizeof(check_bytes));
+  T_eq_u16(state, 0x31c3);
+
+  state = CRC16_CCITT_SEED;
+
+  for (size_t i = 0; i < sizeof(check_bytes); ++i) {
+    state = _CRC16_CCITT_Update(state, check_bytes[i]);
+  }
+
+  T_eq_u16(state, 0x31c3);
+
+  state = _CRC16_CCITT_Sequence_update(0xffff, &check_bytes[0],
+                                       sizeof(check_bytes));
+  T_eq_u16(state, 0x29b1);
+
+  crc_buffer_fill();
+
+  for (size_t offset = 0; offset < 8; ++offset) {
+    for (size_t size = 0; size < 64; ++size) {
+      uint16_t expected = 0xabcd;
+
+      for (size_t i = 0; i < size; ++i) {
+        expected = _CRC16_CCITT_Update(expected, crc_buffer[offset + i]);
+      }
+
+      T_quiet_eq_u16(
+          _CRC16_CCITT_Sequence_update(0xabcd, &crc_buffer[offset], size),
+          expected);
+    }
+  }
+}
+
+T_TEST_CASE(CRC32Combine) {
+  crc_buffer_fill();
+
+  uint32_t all = _CRC32_Sequence_update(CRC32_SEED, &crc_buffer[0],
+                                        sizeof(crc_buffer));
+  uint32_t all_c = _CRC32C_Sequence_update(CRC32C_SEED, &crc_buffer[0],
+                                           sizeof(crc_buffer));
+
+  for (size_t split = 0; split <= sizeof(crc_buffer); split += 511) {
+    size_t size_b = sizeof(crc_buffer) - split;
+
+    uint32_t a = _CRC32_Sequence_update(CRC32_SEED, &crc_buffer[0], split);
+    uint32_t b = _CRC32_Sequence_update(0, &crc_buffer[split], size_b);
+    T_eq_u32(_CRC32_Combine(a, b, size_b), all);
+
+    /* The relation holds also for the final CRC-32 values */
+    b = _CRC32_Sequence_update(CRC32_SEED, &crc_buffer[split], size_b);
+    T_eq_u32(_CRC32_Combine(a ^ CRC32_FINAL_XOR, b ^ CRC32_FINAL_XOR, size_b),
+             all ^ CRC32_FINAL_XOR);
+
+    a = _CRC32C_Sequence_update(CRC32C_SEED, &crc_buffer[0], split);
+    b = _CRC32C_Sequence_update(0, &crc_buffer[split], size_b);
+    T_eq_u32(_CRC32C_Combine(a, b, size_b), all_c);
+  }
+}
+
+typedef uint32_t (*crc_benchmark_handler)(uint32_t, const void*, size_t);
+
+static uint32_t crc32_bytewise(uint32_t crc, const void* bytes,
+                               size_t size_in_bytes) {
+  const uint8_t* in = bytes;
+
+  for (size_t i = 0; i < size_in_bytes; ++i) {
+    crc = _CRC32_Update(crc, in[i]);
+  }
+
+  return crc;
+}
+
+static uint32_t crc16_ccitt_sequence(uint32_t crc, const void* bytes,
+                                     size_t size_in_bytes) {
+  return _CRC16_CCITT_Sequence_update((uint16_t)crc, bytes, size_in_bytes);
+}
+
+static void crc_benchmark(const char* name, crc_benchmark_handler handler) {
+  const int repetitions = 16;
+  volatile uint32_t state = 0;
+  T_ticks t0 = T_tick();
+
+  for (int i = 0; i < repetitions; ++i) {
+    state = (*handler)(state, &crc_buffer[0], sizeof(crc_buffer));
+  }
+
+  T_ticks t1 = T_tick();
+  uint32_t s;
+  uint32_t ns;
+  T_time_to_seconds_and_nanoseconds(T_ticks_to_time(t1 - t0), &s, &ns);
+  uint64_t duration = (uint64_t)s * 1000000000 + ns;
+  uint64_t bytes = (uint64_t)repetitions * sizeof(crc_buffer);
+
+  if (duration == 0) {
+    duration = 1;
+  }
+
+  T_log(T_NORMAL, "%s: %" PRIu64 " KiB/s", name,
+        (bytes * 1000000000) / (duration * 1024));
+}
+
+/*
+ * The throughput of the byte-wise and sliced implementations is reported in
+ * the test log.  It is not checked.
+ */
+T_TEST_CASE(CRCThroughput) {
+  crc_buffer_fill();
+  crc_benchmark("CRC-32 byte-wise", crc32_bytewise);
+  crc_benchmark("CRC-32 slicing-by-8", _CRC32_Sequence_update);
+  crc_benchmark("CRC-32C slicing-by-8", _CRC32C_Sequence_update);
+  crc_benchmark("CRC-16/CCITT slicing-by-8", crc16_ccitt_sequence);
+  crc_benchmark("CRC-24Q byte-wise", _CRC24Q_Sequence_update);
+}